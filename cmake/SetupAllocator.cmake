@@ -87,3 +87,13 @@ elseif(NOT "${MEMORY_ALLOCATOR}" STREQUAL "SYSTEM")
 else()
   message(STATUS "Using system default memory allocator.")
 endif()
+
+option(SPECTRE_POOLED_ALLOCATION
+  "Allocate DataVector and Variables memory from a thread-local size-class pool"
+  OFF)
+
+if(SPECTRE_POOLED_ALLOCATION)
+  message(STATUS "Using pooled allocation for DataVector and Variables.")
+  set_property(TARGET SpectreFlags
+    APPEND PROPERTY INTERFACE_COMPILE_DEFINITIONS SPECTRE_POOLED_ALLOCATION)
+endif()
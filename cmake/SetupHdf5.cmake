@@ -165,9 +165,15 @@ if(NOT HDF5_INIT_WITHOUT_FPES)
     "unaffected version or apply the patch referenced from that issue.")
 endif()
 
+# Volume data chunks can be compressed with zlib outside of HDF5 so that
+# several threads can compress them. See h5::Compression.
+find_package(ZLIB REQUIRED)
+message(STATUS "zlib libs: " ${ZLIB_LIBRARIES})
+message(STATUS "zlib vers: " ${ZLIB_VERSION_STRING})
+
 set_property(
   GLOBAL APPEND PROPERTY SPECTRE_THIRD_PARTY_LIBS
-  HDF5::HDF5
+  HDF5::HDF5 ZLIB::ZLIB
   )
 
 file(APPEND
@@ -6,11 +6,13 @@
 #include <array>
 #include <complex>
 #include <cstddef>
-#include <memory>
+#include <type_traits>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "DataStructures/ScratchArena.hpp"
+#include "DataStructures/SumFactorization.hpp"
 #include "DataStructures/Transpose.hpp"
 #include "Utilities/Blas.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
@@ -42,8 +44,7 @@ void do_transpose(const gsl::not_null<double*> result, const double* const data,
 }
 
 struct Scratch {
-  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
-  std::unique_ptr<double[]> buffer;
+  ScratchArena::Buffer buffer;
   double* a;
   double* b;
 };
@@ -66,10 +67,10 @@ Scratch get_scratch(const std::array<MatrixType, Dim>& matrices,
     }
   }
   Scratch result{};
-  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
-  result.buffer = cpp20::make_unique_for_overwrite<double[]>(2 * size);
-  result.a = &result.buffer[0];
-  result.b = &result.buffer[size];
+  result.buffer = ScratchArena::thread_local_arena().get(2 * size);
+  result.a = result.buffer.data();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  result.b = result.buffer.data() + size;
   return result;
 }
 
@@ -88,6 +89,52 @@ std::array<size_t, Dim> matrix_rows(const std::array<MatrixType, Dim>& matrices,
   }
   return result;
 }
+
+// Apply the matrices one dimension at a time without transposing the data,
+// ping-ponging between the two scratch buffers. Only used when all extents are
+// small enough for the unrolled kernels.
+template <typename MatrixType, size_t Dim>
+void apply_sum_factorized(const gsl::not_null<double*> result,
+                          const std::array<MatrixType, Dim>& matrices,
+                          const double* const data, const Index<Dim>& extents,
+                          const size_t number_of_independent_components) {
+  size_t last_dim = 0;
+  for (size_t d = 0; d < Dim; ++d) {
+    if (dereference_wrapper(gsl::at(matrices, d)) != Matrix{}) {
+      last_dim = d;
+    }
+  }
+  auto scratch =
+      get_scratch(matrices, extents, number_of_independent_components);
+  std::array<size_t, Dim> current_extents{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(current_extents, d) = extents[d];
+  }
+  const double* input = data;
+  double* output = scratch.a;
+  for (size_t d = 0; d <= last_dim; ++d) {
+    const Matrix& matrix = dereference_wrapper(gsl::at(matrices, d));
+    if (matrix == Matrix{}) {
+      continue;
+    }
+    size_t stride = 1;
+    for (size_t i = 0; i < d; ++i) {
+      stride *= gsl::at(current_extents, i);
+    }
+    size_t number_of_outer_slices = number_of_independent_components;
+    for (size_t i = d + 1; i < Dim; ++i) {
+      number_of_outer_slices *= gsl::at(current_extents, i);
+    }
+    if (d == last_dim) {
+      output = result.get();
+    }
+    sum_factorization::apply_in_dimension(make_not_null(output), matrix, input,
+                                          stride, number_of_outer_slices);
+    gsl::at(current_extents, d) = matrix.rows();
+    input = output;
+    output = output == scratch.a ? scratch.b : scratch.a;
+  }
+}
 }  // namespace
 
 namespace apply_matrices_detail {
@@ -97,6 +144,16 @@ void Impl<ElementType, Dim, DimensionIsIdentity...>::apply(
     const gsl::not_null<ElementType*> result,
     const std::array<MatrixType, Dim>& matrices, const ElementType* const data,
     const Index<Dim>& extents, const size_t number_of_independent_components) {
+  if constexpr (sizeof...(DimensionIsIdentity) == 0 and Dim > 1 and
+                std::is_same_v<ElementType, double>) {
+    // For small extents the data is cheap to sweep along any dimension, so
+    // avoid the transposes needed by the BLAS-based implementation.
+    if (sum_factorization::has_small_extents(matrices)) {
+      apply_sum_factorized(result, matrices, data, extents,
+                           number_of_independent_components);
+      return;
+    }
+  }
   if (dereference_wrapper(matrices[sizeof...(DimensionIsIdentity)]) ==
       Matrix{}) {
     Impl<ElementType, Dim, DimensionIsIdentity..., true>::apply(
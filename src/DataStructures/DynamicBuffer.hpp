@@ -82,7 +82,10 @@ class DynamicBuffer {
   // fundamental type T the data is saved in `data_` directly.
   std::vector<T> data_;
   // memory buffer for all DataVectors. Unused in case of fundamental type T.
-  std::vector<double> buffer_;
+  // A `DataVector` rather than a `std::vector` so that the memory is not
+  // value-initialized and is allocated through the same path as other
+  // `DataVector`s.
+  DataVector buffer_;
 };
 
 template <typename T>
@@ -0,0 +1,139 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/ScratchArena.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/MemoryHelpers.hpp"
+
+namespace {
+// Slices are padded to a multiple of a 64-byte cache line so that
+// consecutive buffers do not share cache lines.
+constexpr size_t padding_in_doubles = 8;
+
+size_t padded_size(const size_t size) {
+  return ((size + padding_in_doubles - 1) / padding_in_doubles) *
+         padding_in_doubles;
+}
+}  // namespace
+
+ScratchArena::Buffer::Buffer(ScratchArena* const arena, double* const data,
+                             const size_t size, const size_t offset,
+                             const bool is_overflow)
+    : arena_(arena),
+      data_(data),
+      size_(size),
+      offset_(offset),
+      is_overflow_(is_overflow) {}
+
+ScratchArena::Buffer::Buffer(Buffer&& rhs)
+    : arena_(std::exchange(rhs.arena_, nullptr)),
+      data_(std::exchange(rhs.data_, nullptr)),
+      size_(std::exchange(rhs.size_, 0)),
+      offset_(rhs.offset_),
+      is_overflow_(rhs.is_overflow_) {}
+
+ScratchArena::Buffer& ScratchArena::Buffer::operator=(Buffer&& rhs) {
+  if (this != &rhs) {
+    release();
+    arena_ = std::exchange(rhs.arena_, nullptr);
+    data_ = std::exchange(rhs.data_, nullptr);
+    size_ = std::exchange(rhs.size_, 0);
+    offset_ = rhs.offset_;
+    is_overflow_ = rhs.is_overflow_;
+  }
+  return *this;
+}
+
+ScratchArena::Buffer::~Buffer() { release(); }
+
+void ScratchArena::Buffer::release() {
+  if (arena_ != nullptr) {
+    arena_->release(*this);
+    arena_ = nullptr;
+    data_ = nullptr;
+    size_ = 0;
+  }
+}
+
+ScratchArena& ScratchArena::thread_local_arena() {
+  thread_local ScratchArena arena{};
+  return arena;
+}
+
+ScratchArena::Buffer ScratchArena::get(const size_t size) {
+  const size_t padded = padded_size(size);
+  if (number_of_buffers_in_use_ == 0) {
+    // Nothing is checked out, so the main block may be regrown freely.
+    reserve(std::max(padded, high_water_mark_));
+  }
+  ++number_of_buffers_in_use_;
+  if (used_ + padded <= capacity_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    Buffer result{this, block_.get() + used_, size, used_, false};
+    used_ += padded;
+    high_water_mark_ = std::max(high_water_mark_, used_ + overflow_used_);
+    return result;
+  }
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  overflow_blocks_.push_back(
+      cpp20::make_unique_for_overwrite<double[]>(padded));
+  ++number_of_allocations_;
+  overflow_used_ += padded;
+  high_water_mark_ = std::max(high_water_mark_, used_ + overflow_used_);
+  return Buffer{this, overflow_blocks_.back().get(), size, 0, true};
+}
+
+void ScratchArena::release(const Buffer& buffer) {
+  ASSERT(number_of_buffers_in_use_ > 0,
+         "Releasing a scratch buffer when none are in use.");
+  --number_of_buffers_in_use_;
+  if (buffer.is_overflow_) {
+    overflow_used_ -= padded_size(buffer.size_);
+  } else {
+    ASSERT(buffer.offset_ + padded_size(buffer.size_) == used_,
+           "Scratch buffers must be released in the reverse order of their "
+           "acquisition.");
+    used_ = buffer.offset_;
+  }
+  if (number_of_buffers_in_use_ == 0 and not overflow_blocks_.empty()) {
+    // Fold the overflow into the main block so the next pass through the
+    // same code path needs no allocations.
+    overflow_blocks_.clear();
+    reserve(high_water_mark_);
+  }
+}
+
+void ScratchArena::reserve(const size_t size) {
+  ASSERT(used_ == 0, "Cannot grow the scratch arena while it is in use.");
+  if (size > capacity_) {
+    block_.reset();
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    block_ = cpp20::make_unique_for_overwrite<double[]>(size);
+    capacity_ = size;
+    ++number_of_allocations_;
+  }
+}
+
+void ScratchArena::reset_statistics() {
+  high_water_mark_ = used_ + overflow_used_;
+  number_of_allocations_ = 0;
+}
+
+void ScratchArena::release_memory() {
+  if (number_of_buffers_in_use_ != 0) {
+    ERROR("Cannot release the memory of a scratch arena with "
+          << number_of_buffers_in_use_ << " buffers in use.");
+  }
+  block_.reset();
+  overflow_blocks_.clear();
+  capacity_ = 0;
+  used_ = 0;
+  overflow_used_ = 0;
+}
@@ -0,0 +1,108 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
+
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief A growable, per-thread stack of `double` scratch memory.
+ *
+ * \details Low-level numerical routines such as `apply_matrices` need a few
+ * temporary buffers whose size depends only on the extents of the data being
+ * operated on. Allocating these on every call puts `malloc`/`free` on the hot
+ * path. A `ScratchArena` instead hands out slices of a single block of memory
+ * using a bump pointer. Slices are returned to the arena in reverse order of
+ * acquisition when the `ScratchArena::Buffer` goes out of scope.
+ *
+ * If a request does not fit in the current block while other buffers are
+ * still in use, a separate overflow block is allocated for it. Once all
+ * buffers have been released the overflow blocks are freed and the main block
+ * is regrown to the high-water mark, so that after a warm-up phase no further
+ * allocations occur.
+ *
+ * Each thread (and therefore each Charm++ PE) has its own arena, obtained via
+ * `ScratchArena::thread_local_arena()`. Buffers must be released on the
+ * thread that acquired them.
+ */
+class ScratchArena {
+ public:
+  /// RAII handle to a slice of the arena. The memory is uninitialized.
+  class Buffer {
+   public:
+    Buffer() = default;
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+    Buffer(Buffer&& rhs);
+    Buffer& operator=(Buffer&& rhs);
+    ~Buffer();
+
+    double* data() { return data_; }
+    const double* data() const { return data_; }
+    size_t size() const { return size_; }
+
+   private:
+    friend class ScratchArena;
+    Buffer(ScratchArena* arena, double* data, size_t size, size_t offset,
+           bool is_overflow);
+    void release();
+
+    ScratchArena* arena_{nullptr};
+    double* data_{nullptr};
+    size_t size_{0};
+    size_t offset_{0};
+    bool is_overflow_{false};
+  };
+
+  ScratchArena() = default;
+  ScratchArena(const ScratchArena&) = delete;
+  ScratchArena& operator=(const ScratchArena&) = delete;
+  ScratchArena(ScratchArena&&) = delete;
+  ScratchArena& operator=(ScratchArena&&) = delete;
+  ~ScratchArena() = default;
+
+  /// The arena owned by the calling thread.
+  static ScratchArena& thread_local_arena();
+
+  /// Acquire `size` uninitialized doubles.
+  Buffer get(size_t size);
+
+  /// The largest number of doubles that were simultaneously in use.
+  size_t high_water_mark() const { return high_water_mark_; }
+
+  /// The number of doubles currently held by the arena's main block.
+  size_t capacity() const { return capacity_; }
+
+  /// The number of heap allocations made by the arena since construction or
+  /// the last call to `reset_statistics()`.
+  size_t number_of_allocations() const { return number_of_allocations_; }
+
+  /// The number of buffers that are currently checked out.
+  size_t number_of_buffers_in_use() const { return number_of_buffers_in_use_; }
+
+  /// Reset the high-water mark and the allocation counter.
+  void reset_statistics();
+
+  /// Free all memory held by the arena. No buffers may be in use.
+  void release_memory();
+
+ private:
+  void release(const Buffer& buffer);
+  void reserve(size_t size);
+
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  std::unique_ptr<double[]> block_{};
+  size_t capacity_{0};
+  size_t used_{0};
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  std::vector<std::unique_ptr<double[]>> overflow_blocks_{};
+  size_t overflow_used_{0};
+  size_t number_of_buffers_in_use_{0};
+  size_t high_water_mark_{0};
+  size_t number_of_allocations_{0};
+};
@@ -0,0 +1,111 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/SumFactorization.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "DataStructures/Matrix.hpp"
+#include "Utilities/Blas.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace sum_factorization {
+namespace {
+// `Columns == 0` selects the kernel with a runtime number of columns.
+//
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+template <size_t Columns>
+void apply_strided(double* __restrict__ result, const Matrix& matrix,
+                   const double* __restrict__ data, const size_t stride,
+                   const size_t number_of_outer_slices) {
+  const size_t rows = matrix.rows();
+  const size_t columns = Columns == 0 ? matrix.columns() : Columns;
+  // The coefficients of one row of the matrix, contiguous so that they can be
+  // kept in registers while sweeping over the stride.
+  std::array<double, Columns == 0 ? max_unrolled_extent : Columns> row{};
+  for (size_t r = 0; r < rows; ++r) {
+    if constexpr (Columns == 0) {
+      // Process the columns in chunks, accumulating into the result.
+      for (size_t c_begin = 0; c_begin < columns;
+           c_begin += max_unrolled_extent) {
+        const size_t c_end = std::min(columns, c_begin + max_unrolled_extent);
+        for (size_t c = c_begin; c < c_end; ++c) {
+          gsl::at(row, c - c_begin) = matrix(r, c);
+        }
+        for (size_t b = 0; b < number_of_outer_slices; ++b) {
+          const double* const in = data + stride * columns * b;
+          double* const out = result + stride * (r + rows * b);
+          for (size_t a = 0; a < stride; ++a) {
+            double sum = c_begin == 0 ? 0.0 : out[a];
+            for (size_t c = c_begin; c < c_end; ++c) {
+              sum += gsl::at(row, c - c_begin) * in[a + stride * c];
+            }
+            out[a] = sum;
+          }
+        }
+      }
+    } else {
+      for (size_t c = 0; c < Columns; ++c) {
+        gsl::at(row, c) = matrix(r, c);
+      }
+      for (size_t b = 0; b < number_of_outer_slices; ++b) {
+        const double* const in = data + stride * Columns * b;
+        double* const out = result + stride * (r + rows * b);
+        for (size_t a = 0; a < stride; ++a) {
+          double sum = gsl::at(row, 0) * in[a];
+          for (size_t c = 1; c < Columns; ++c) {
+            sum += gsl::at(row, c) * in[a + stride * c];
+          }
+          out[a] = sum;
+        }
+      }
+    }
+  }
+}
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+using KernelType = void (*)(double*, const Matrix&, const double*, size_t,
+                            size_t);
+
+template <size_t... Is>
+constexpr std::array<KernelType, sizeof...(Is)> make_kernels(
+    std::index_sequence<Is...> /*meta*/) {
+  return {{&apply_strided<Is>...}};
+}
+
+// Index 0 is the runtime-sized kernel, index N the kernel unrolled for N
+// columns.
+constexpr std::array<KernelType, max_unrolled_extent + 1> kernels =
+    make_kernels(std::make_index_sequence<max_unrolled_extent + 1>{});
+}  // namespace
+
+void apply_in_dimension(const gsl::not_null<double*> result,
+                        const Matrix& matrix, const double* const data,
+                        const size_t stride,
+                        const size_t number_of_outer_slices) {
+  ASSERT(matrix.columns() > 0, "Cannot apply an empty matrix.");
+  if (stride == 1) {
+    dgemm_<true>('N', 'N',
+                 matrix.rows(),           // rows of matrix and result
+                 number_of_outer_slices,  // columns of result and data
+                 matrix.columns(),        // columns of matrix and rows of data
+                 1.0,                     // overall multiplier
+                 matrix.data(),           // matrix
+                 matrix.spacing(),        // rows of matrix including padding
+                 data,                    // data
+                 matrix.columns(),        // rows of data
+                 0.0,                     // multiplier for unused term
+                 result.get(),            // result
+                 matrix.rows());          // rows of result
+    return;
+  }
+  const size_t kernel_index =
+      matrix.columns() <= max_unrolled_extent ? matrix.columns() : 0;
+  gsl::at(kernels, kernel_index)(result.get(), matrix, data, stride,
+                                 number_of_outer_slices);
+}
+}  // namespace sum_factorization
@@ -0,0 +1,59 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "DataStructures/Matrix.hpp"
+#include "Utilities/DereferenceWrapper.hpp"
+#include "Utilities/Gsl.hpp"
+
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Kernels for applying 1D matrices to tensor-product data along a single
+ * dimension without transposing the data.
+ *
+ * \details The data is viewed as a three-dimensional array
+ * \f$u_{a c b}\f$ stored with \f$a\f$ varying fastest, where \f$c\f$ is the
+ * index along the dimension the matrix acts on, \f$a\f$ runs over all
+ * faster-varying dimensions (the "stride") and \f$b\f$ over all slower-varying
+ * dimensions and tensor components. The result is
+ * \f$v_{a r b} = \sum_c M_{r c} u_{a c b}\f$.
+ *
+ * When the stride is one this is a single matrix-matrix multiplication, which
+ * is handed to BLAS. Otherwise the innermost loop runs over \f$a\f$, which is
+ * contiguous in both input and output, so it vectorizes without any
+ * rearrangement of the data. The sum over \f$c\f$ is fully unrolled for
+ * contraction lengths up to `max_unrolled_extent`.
+ */
+namespace sum_factorization {
+/// Largest number of matrix columns for which an unrolled kernel is compiled.
+/// Above this `apply_matrices` and `partial_derivatives` fall back to the
+/// transpose-and-GEMM implementation.
+constexpr size_t max_unrolled_extent = 16;
+
+/// Apply `matrix` along the dimension with the given `stride`. The input has
+/// `stride * matrix.columns() * number_of_outer_slices` entries and the result
+/// `stride * matrix.rows() * number_of_outer_slices`. `result` and `data` must
+/// not overlap.
+void apply_in_dimension(gsl::not_null<double*> result, const Matrix& matrix,
+                        const double* data, size_t stride,
+                        size_t number_of_outer_slices);
+
+/// Whether every non-empty matrix has at most `max_unrolled_extent` columns
+/// and at least one matrix is non-empty.
+template <typename MatrixType, size_t Dim>
+bool has_small_extents(const std::array<MatrixType, Dim>& matrices) {
+  bool any_non_empty = false;
+  for (size_t d = 0; d < Dim; ++d) {
+    const size_t columns = dereference_wrapper(gsl::at(matrices, d)).columns();
+    if (columns > max_unrolled_extent) {
+      return false;
+    }
+    any_non_empty = any_non_empty or columns > 0;
+  }
+  return any_non_empty;
+}
+}  // namespace sum_factorization
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <complex>
 #include <cstddef>
@@ -29,6 +30,21 @@
 #include "Utilities/TMPL.hpp"
 
 namespace tenex {
+/*!
+ * \ingroup TensorExpressionsGroup
+ * \brief The number of grid points that `tenex::evaluate` and `tenex::update`
+ * evaluate at a time when the tensors hold vector data
+ *
+ * \details Instead of evaluating the RHS expression over all grid points for
+ * one LHS component after the other, which streams the RHS components from
+ * memory once for every LHS component that uses them, all LHS components are
+ * evaluated on one tile of grid points before moving on to the next tile. A
+ * tile of 512 points is 4 kB per `DataVector` component, so the tiles of a few
+ * dozen tensor components fit into the L2 cache. Expressions over fewer grid
+ * points than this are evaluated one LHS component at a time.
+ */
+constexpr size_t evaluate_tile_size = 512;
+
 namespace detail {
 template <size_t NumIndices>
 constexpr bool contains_indices_to_contract(
@@ -133,17 +149,33 @@ struct CheckNoLhsAntiSymmetries<SymmList<Symm...>> {
  * implementation-dependent. Specifically, the safety of the operation depends
  * on the order of LHS component access and assignment.
  *
+ * When the tensors hold vector data with more than `tenex::evaluate_tile_size`
+ * grid points, the grid points are split into tiles and all LHS components are
+ * evaluated on one tile before moving on to the next tile. To this end, the
+ * `Tensor`s in the RHS expression are temporarily replaced by non-owning views
+ * of the tile (see `TensorAsExpression::bind_tile`), and each LHS component is
+ * evaluated into a non-owning view of its tile. The splitting of the RHS
+ * expression works the same on every tile. Using the LHS tensor in the RHS
+ * expression remains safe under the conditions described above, because every
+ * grid point of every LHS component is still modified only once, after it has
+ * been accessed. Pass `evaluate_in_tiles = false` to evaluate one LHS component
+ * at a time regardless of the number of grid points.
+ *
  * \note `LhsTensorIndices` must be passed by reference because non-type
  * template parameters cannot be class types until C++20.
  *
  * @tparam EvaluateSubtrees whether or not to evaluate subtrees of RHS
  * expression
+ * @tparam UpdateLhs whether the LHS tensor is used in the RHS expression (see
+ * `tenex::update`). The LHS components are then never resized.
  * @tparam LhsTensorIndices the `TensorIndex`s of the `Tensor` on the LHS of the
  * tensor expression, e.g. `ti::a`, `ti::b`, `ti::c`
  * @param lhs_tensor pointer to the resultant LHS `Tensor` to fill
  * @param rhs_tensorexpression the RHS TensorExpression to be evaluated
+ * @param evaluate_in_tiles whether to evaluate vector data in tiles of
+ * `tenex::evaluate_tile_size` grid points
  */
-template <bool EvaluateSubtrees, typename... LhsTensorIndices,
+template <bool EvaluateSubtrees, bool UpdateLhs, typename... LhsTensorIndices,
           typename LhsDataType, typename LhsSymmetry, typename LhsIndexList,
           typename Derived, typename RhsDataType, typename RhsSymmetry,
           typename RhsIndexList, typename... RhsTensorIndices>
@@ -152,7 +184,8 @@ void evaluate_impl(
         lhs_tensor,
     const TensorExpression<Derived, RhsDataType, RhsSymmetry, RhsIndexList,
                            tmpl::list<RhsTensorIndices...>>&
-        rhs_tensorexpression) {
+        rhs_tensorexpression,
+    const bool evaluate_in_tiles = true) {
   constexpr size_t num_lhs_indices = sizeof...(LhsTensorIndices);
   constexpr size_t num_rhs_indices = sizeof...(RhsTensorIndices);
 
@@ -234,17 +267,6 @@ void evaluate_impl(
   if constexpr (EvaluateSubtrees) {
     // Make sure the LHS tensor doesn't also appear in the RHS tensor expression
     (~rhs_tensorexpression).assert_lhs_tensor_not_in_rhs_expression(lhs_tensor);
-    // If the LHS data type is a vector, size the LHS tensor components if their
-    // size does not match the size from a `Tensor` in the RHS expression
-    if constexpr (is_derived_of_vector_impl_v<LhsDataType>) {
-      const size_t rhs_component_size =
-          (~rhs_tensorexpression).get_rhs_tensor_component_size();
-      if (rhs_component_size != (*lhs_tensor)[0].size()) {
-        for (auto& lhs_component : *lhs_tensor) {
-          lhs_component = LhsDataType(rhs_component_size);
-        }
-      }
-    }
   }
 
   constexpr std::array<size_t, num_rhs_indices> index_transformation =
@@ -269,6 +291,39 @@ void evaluate_impl(
   using rhs_expression_type =
       typename std::decay_t<decltype(~rhs_tensorexpression)>;
 
+  // Evaluate the LHS component at the given RHS multi-index
+  const auto evaluate_component =
+      [&rhs_tensorexpression](
+          LhsDataType& lhs_component,
+          const std::array<size_t, num_rhs_indices>& rhs_multi_index) {
+        // The expression will either be evaluated as one whole expression
+        // or it will be split up into subtrees that are evaluated one at a
+        // time. See the section on splitting in the documentation for the
+        // `TensorExpression` class to understand the logic and terminology
+        // used in this control flow below.
+        if constexpr (EvaluateSubtrees) {
+          // the expression is split up, so evaluate subtrees at splits
+          (~rhs_tensorexpression)
+              .evaluate_primary_subtree(lhs_component, rhs_multi_index);
+          if constexpr (not rhs_expression_type::is_primary_start) {
+            // the root expression type is not the starting point of a leg, so
+            // it has not yet been evaluated, so now we evaluate this last leg
+            // of the expression at the root of the tree
+            lhs_component = (~rhs_tensorexpression)
+                                .get_primary(lhs_component, rhs_multi_index);
+          }
+        } else {
+          // the expression is not split up, so evaluate full expression
+          lhs_component = (~rhs_tensorexpression).get(rhs_multi_index);
+        }
+      };
+
+  // Collect the LHS components to evaluate and the multi-index of the RHS
+  // component that each is computed from
+  std::array<size_t, lhs_tensor_type::size()> lhs_storage_indices{};
+  std::array<std::array<size_t, num_rhs_indices>, lhs_tensor_type::size()>
+      rhs_multi_indices{};
+  size_t num_evaluated_components = 0;
   for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
     auto lhs_multi_index =
         lhs_tensor_type::structure::get_canonical_tensor_index(i);
@@ -287,29 +342,67 @@ void evaluate_impl(
         gsl::at(rhs_multi_index,
                 gsl::at(rhs_spatial_spacetime_index_positions, j)) += 1;
       }
+      gsl::at(lhs_storage_indices, num_evaluated_components) = i;
+      gsl::at(rhs_multi_indices, num_evaluated_components) = rhs_multi_index;
+      ++num_evaluated_components;
+    }
+  }
 
-      // The expression will either be evaluated as one whole expression
-      // or it will be split up into subtrees that are evaluated one at a time.
-      // See the section on splitting in the documentation for the
-      // `TensorExpression` class to understand the logic and terminology used
-      // in this control flow below.
-      if constexpr (EvaluateSubtrees) {
-        // the expression is split up, so evaluate subtrees at splits
-        (~rhs_tensorexpression)
-            .evaluate_primary_subtree((*lhs_tensor)[i], rhs_multi_index);
-        if constexpr (not rhs_expression_type::is_primary_start) {
-          // the root expression type is not the starting point of a leg, so it
-          // has not yet been evaluated, so now we evaluate this last leg of the
-          // expression at the root of the tree
-          (*lhs_tensor)[i] =
-              (~rhs_tensorexpression)
-                  .get_primary((*lhs_tensor)[i], rhs_multi_index);
+  // For vector data that doesn't fit into a single tile we evaluate all LHS
+  // components on one tile of grid points before moving on to the next, so
+  // the RHS data stays in cache while it is reused for different LHS
+  // components. Otherwise, we evaluate one LHS component at a time.
+  if constexpr (is_derived_of_vector_impl_v<LhsDataType>) {
+    const size_t num_points =
+        (~rhs_tensorexpression).get_rhs_tensor_component_size();
+    const bool use_tiles =
+        evaluate_in_tiles and num_points > evaluate_tile_size;
+    // Subtrees are accumulated into the LHS components and tiles of the LHS
+    // components are views, so in these cases the LHS components that are
+    // evaluated must be sized up front. Components that are not evaluated,
+    // e.g. the time components when only spatial components are evaluated,
+    // are left alone.
+    if (EvaluateSubtrees or use_tiles) {
+      for (size_t k = 0; k < num_evaluated_components; k++) {
+        auto& lhs_component = (*lhs_tensor)[gsl::at(lhs_storage_indices, k)];
+        if constexpr (UpdateLhs) {
+          ASSERT(lhs_component.size() == num_points,
+                 "The LHS tensor component has size "
+                     << lhs_component.size()
+                     << ", but the RHS expression of tenex::update has size "
+                     << num_points << ".");
+        } else {
+          if (lhs_component.size() != num_points) {
+            lhs_component = LhsDataType(num_points);
+          }
+        }
+      }
+    }
+    if (use_tiles) {
+      LhsDataType lhs_component_tile{};
+      for (size_t offset = 0; offset < num_points;
+           offset += evaluate_tile_size) {
+        const size_t tile_size =
+            std::min(evaluate_tile_size, num_points - offset);
+        (~rhs_tensorexpression).bind_tile(offset, tile_size);
+        for (size_t k = 0; k < num_evaluated_components; k++) {
+          lhs_component_tile.set_data_ref(
+              // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+              (*lhs_tensor)[gsl::at(lhs_storage_indices, k)].data() + offset,
+              tile_size);
+          evaluate_component(lhs_component_tile,
+                             gsl::at(rhs_multi_indices, k));
         }
-      } else {
-        // the expression is not split up, so evaluate full expression
-        (*lhs_tensor)[i] = (~rhs_tensorexpression).get(rhs_multi_index);
       }
+      (~rhs_tensorexpression).unbind_tile();
+      return;
     }
+  } else {
+    (void)evaluate_in_tiles;
+  }
+  for (size_t k = 0; k < num_evaluated_components; k++) {
+    evaluate_component((*lhs_tensor)[gsl::at(lhs_storage_indices, k)],
+                       gsl::at(rhs_multi_indices, k));
   }
 }
 
@@ -438,6 +531,8 @@ void evaluate_impl(
  * tensor expression, e.g. `ti::a`, `ti::b`, `ti::c`
  * @param lhs_tensor pointer to the resultant LHS `Tensor` to fill
  * @param rhs_tensorexpression the RHS TensorExpression to be evaluated
+ * @param evaluate_in_tiles whether to evaluate vector data in tiles of
+ * `tenex::evaluate_tile_size` grid points (see `tenex::detail::evaluate_impl`)
  */
 template <auto&... LhsTensorIndices, typename LhsDataType, typename LhsSymmetry,
           typename LhsIndexList, typename Derived, typename RhsDataType,
@@ -448,14 +543,15 @@ void evaluate(
         lhs_tensor,
     const TensorExpression<Derived, RhsDataType, RhsSymmetry, RhsIndexList,
                            tmpl::list<RhsTensorIndices...>>&
-        rhs_tensorexpression) {
+        rhs_tensorexpression,
+    const bool evaluate_in_tiles = true) {
   using rhs_expression_type =
       typename std::decay_t<decltype(~rhs_tensorexpression)>;
   constexpr bool evaluate_subtrees =
       rhs_expression_type::primary_subtree_contains_primary_start;
-  detail::evaluate_impl<evaluate_subtrees,
+  detail::evaluate_impl<evaluate_subtrees, false,
                         std::decay_t<decltype(LhsTensorIndices)>...>(
-      lhs_tensor, rhs_tensorexpression);
+      lhs_tensor, rhs_tensorexpression, evaluate_in_tiles);
 }
 
 /// @{
@@ -542,12 +638,15 @@ void evaluate(
  * @tparam LhsTensorIndices the TensorIndexs of the Tensor on the LHS of the
  * tensor expression, e.g. `ti::a`, `ti::b`, `ti::c`
  * @param rhs_tensorexpression the RHS TensorExpression to be evaluated
+ * @param evaluate_in_tiles whether to evaluate vector data in tiles of
+ * `tenex::evaluate_tile_size` grid points (see `tenex::detail::evaluate_impl`)
  * @return the resultant LHS Tensor with index order specified by
  * LhsTensorIndices
  */
 template <auto&... LhsTensorIndices, typename RhsTE,
           Requires<std::is_base_of_v<Expression, RhsTE>> = nullptr>
-auto evaluate(const RhsTE& rhs_tensorexpression) {
+auto evaluate(const RhsTE& rhs_tensorexpression,
+              const bool evaluate_in_tiles = true) {
   using lhs_tensorindex_list =
       tmpl::list<std::decay_t<decltype(LhsTensorIndices)>...>;
   using rhs_tensorindex_list = typename RhsTE::args_list;
@@ -564,7 +663,7 @@ auto evaluate(const RhsTE& rhs_tensorexpression) {
          typename lhs_tensor_symm_and_indices::tensorindextype_list>
       lhs_tensor{};
   evaluate<LhsTensorIndices...>(make_not_null(&lhs_tensor),
-                                rhs_tensorexpression);
+                                rhs_tensorexpression, evaluate_in_tiles);
   return lhs_tensor;
 }
 
@@ -606,6 +705,8 @@ auto evaluate(const RhsTE& rhs_tensorexpression) {
  * tensor expression, e.g. `ti_a`, `ti_b`, `ti_c`
  * @param lhs_tensor pointer to the resultant LHS Tensor to fill
  * @param rhs_tensorexpression the RHS TensorExpression to be evaluated
+ * @param evaluate_in_tiles whether to evaluate vector data in tiles of
+ * `tenex::evaluate_tile_size` grid points (see `tenex::detail::evaluate_impl`)
  */
 template <auto&... LhsTensorIndices, typename LhsDataType, typename RhsDataType,
           typename LhsSymmetry, typename LhsIndexList, typename Derived,
@@ -616,7 +717,8 @@ void update(
         lhs_tensor,
     const TensorExpression<Derived, RhsDataType, RhsSymmetry, RhsIndexList,
                            tmpl::list<RhsTensorIndices...>>&
-        rhs_tensorexpression) {
+        rhs_tensorexpression,
+    const bool evaluate_in_tiles = true) {
   using lhs_tensorindex_list =
       tmpl::list<std::decay_t<decltype(LhsTensorIndices)>...>;
   // Assert that each instance of the LHS tensor in the RHS tensor expression
@@ -625,7 +727,8 @@ void update(
       .template assert_lhs_tensorindices_same_in_rhs<lhs_tensorindex_list>(
           lhs_tensor);
 
-  detail::evaluate_impl<false, std::decay_t<decltype(LhsTensorIndices)>...>(
-      lhs_tensor, rhs_tensorexpression);
+  detail::evaluate_impl<false, true,
+                        std::decay_t<decltype(LhsTensorIndices)>...>(
+      lhs_tensor, rhs_tensorexpression, evaluate_in_tiles);
 }
 }  // namespace tenex
@@ -141,6 +141,19 @@ struct Negate
     return t_.get_rhs_tensor_component_size();
   }
 
+  /// \brief Restrict the `Tensor`s in this expression's subtree to the grid
+  /// points `[offset, offset + size)`
+  ///
+  /// \details See `tenex::detail::evaluate_impl` for how this is used to
+  /// evaluate expressions one tile of grid points at a time.
+  SPECTRE_ALWAYS_INLINE void bind_tile(const size_t offset,
+                                       const size_t size) const {
+    t_.bind_tile(offset, size);
+  }
+
+  /// \brief Undo `bind_tile` for the `Tensor`s in this expression's subtree
+  SPECTRE_ALWAYS_INLINE void unbind_tile() const { t_.unbind_tile(); }
+
   /// \brief Return the value of the component of the negated tensor expression
   /// at a given multi-index
   ///
@@ -121,6 +121,10 @@ struct NumberAsExpression
   // This expression is a non-`Tensor` leaf, so we should never try to get the
   // size of a `Tensor` component from this expression.
   size_t get_rhs_tensor_component_size() const = delete;
+  // This expression is a non-`Tensor` leaf, so it holds no grid-point data
+  // that needs to be restricted to a tile
+  void bind_tile(const size_t /*offset*/, const size_t /*size*/) const {}
+  void unbind_tile() const {}
 
   /// \brief Returns the number represented by the expression
   ///
@@ -224,6 +224,23 @@ struct OuterProduct<T1, T2, IndexList1<Indices1...>, IndexList2<Indices2...>,
     }
   }
 
+  /// \brief Restrict the `Tensor`s in this expression's subtree to the grid
+  /// points `[offset, offset + size)`
+  ///
+  /// \details See `tenex::detail::evaluate_impl` for how this is used to
+  /// evaluate expressions one tile of grid points at a time.
+  SPECTRE_ALWAYS_INLINE void bind_tile(const size_t offset,
+                                       const size_t size) const {
+    t1_.bind_tile(offset, size);
+    t2_.bind_tile(offset, size);
+  }
+
+  /// \brief Undo `bind_tile` for the `Tensor`s in this expression's subtree
+  SPECTRE_ALWAYS_INLINE void unbind_tile() const {
+    t1_.unbind_tile();
+    t2_.unbind_tile();
+  }
+
   /// \brief Return the first operand's multi-index given the outer product's
   /// multi-index
   ///
@@ -16,6 +16,7 @@
 #include "DataStructures/Tensor/Expressions/SpatialSpacetimeIndex.hpp"
 #include "DataStructures/Tensor/Expressions/TensorExpression.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/VectorImpl.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -271,7 +272,7 @@ struct TensorAsExpression<Tensor<X, Symm<SymmValues...>, IndexList<Indices...>>,
   /// Construct an expression from a Tensor
   explicit TensorAsExpression(
       const Tensor<X, Symm<SymmValues...>, IndexList<Indices...>>& t)
-      : t_(&t) {}
+      : t_(&t), active_tensor_(&t) {}
   ~TensorAsExpression() override = default;
 
   /// \brief Assert that the LHS tensor of the equation is not equal to the
@@ -312,13 +313,37 @@ struct TensorAsExpression<Tensor<X, Symm<SymmValues...>, IndexList<Indices...>>,
     return get_size((*t_)[0]);
   }
 
+  /// \brief Restrict the `Tensor` represented by this expression to the grid
+  /// points `[offset, offset + size)`
+  ///
+  /// \details Until `unbind_tile` is called, the components retrieved from
+  /// this expression are non-owning views of the tile. This has no effect if
+  /// the `Tensor` doesn't hold vector data. See `tenex::detail::evaluate_impl`
+  /// for how this is used to evaluate expressions one tile of grid points at a
+  /// time.
+  SPECTRE_ALWAYS_INLINE void bind_tile(const size_t offset,
+                                       const size_t size) const {
+    if constexpr (is_derived_of_vector_impl_v<X>) {
+      for (size_t i = 0; i < tile_.size(); ++i) {
+        make_const_view<X>(make_not_null(&tile_[i]), (*t_)[i], offset, size);
+      }
+      active_tensor_ = &tile_;
+    } else {
+      (void)offset;
+      (void)size;
+    }
+  }
+
+  /// \brief Undo `bind_tile`
+  SPECTRE_ALWAYS_INLINE void unbind_tile() const { active_tensor_ = t_; }
+
   /// \brief Returns the value of the contained tensor's multi-index
   ///
   /// \param multi_index the multi-index of the tensor component to retrieve
   /// \return the value of the component at `multi_index` in the tensor
   SPECTRE_ALWAYS_INLINE decltype(auto) get(
       const std::array<size_t, num_tensor_indices>& multi_index) const {
-    return t_->get(multi_index);
+    return active_tensor_->get(multi_index);
   }
 
   /// \brief Returns the value of the contained tensor's multi-index
@@ -329,7 +354,7 @@ struct TensorAsExpression<Tensor<X, Symm<SymmValues...>, IndexList<Indices...>>,
   SPECTRE_ALWAYS_INLINE decltype(auto) get_primary(
       const ResultType& /*result_component*/,
       const std::array<size_t, num_tensor_indices>& multi_index) const {
-    return t_->get(multi_index);
+    return active_tensor_->get(multi_index);
   }
 
   // This expression is a leaf and therefore will never be the start of a leg
@@ -343,11 +368,26 @@ struct TensorAsExpression<Tensor<X, Symm<SymmValues...>, IndexList<Indices...>>,
 
   /// Retrieve the i'th entry of the Tensor being held
   SPECTRE_ALWAYS_INLINE type operator[](const size_t i) const {
-    return t_->operator[](i);
+    return active_tensor_->operator[](i);
   }
 
  private:
+  struct NoTile {};
+
   /// `Tensor` represented by this expression
   const Tensor<X, Symm<SymmValues...>, IndexList<Indices...>>* t_ = nullptr;
+  /// The `Tensor` that components are retrieved from, which is either `t_` or
+  /// views of a tile of `t_` (see `bind_tile`)
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable const Tensor<X, Symm<SymmValues...>, IndexList<Indices...>>*
+      active_tensor_ = nullptr;
+  /// Non-owning views of a tile of `t_` (see `bind_tile`). Default-constructed
+  /// vectors don't allocate, so this costs no allocation per expression. For
+  /// non-vector data no tile is needed.
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable tmpl::conditional_t<
+      is_derived_of_vector_impl_v<X>,
+      Tensor<X, Symm<SymmValues...>, IndexList<Indices...>>, NoTile>
+      tile_{};
 };
 }  // namespace tenex
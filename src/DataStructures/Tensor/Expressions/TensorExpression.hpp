@@ -181,6 +181,12 @@ struct Expression {};
 /// expression. This is used to size LHS components, if needed. Utilizes
 /// `height_relative_to_closest_tensor_leaf_in_subtree` to recursively find the
 /// nearest `TensorAsExpression` descendant leaf.
+/// - functions `void bind_tile(size_t offset, size_t size) const` and
+/// `void unbind_tile() const`: Restrict all `Tensor`s in the expression's
+/// subtree to the grid points `[offset, offset + size)` and undo the
+/// restriction. Non-leaf expressions forward these calls to their operands.
+/// This is used to evaluate expressions one tile of grid points at a time (see
+/// `tenex::detail::evaluate_impl`).
 ///
 /// Each derived `TensorExpression` class must also define the following
 /// members, which have real meaning for the expression *only* if it ends up
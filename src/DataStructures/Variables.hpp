@@ -39,10 +39,10 @@
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/MakeSignalingNan.hpp"
-#include "Utilities/MemoryHelpers.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/SetNumberOfGridPoints.hpp"
+#include "Utilities/SizeClassPool.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 #include "Utilities/TypeTraits.hpp"
@@ -89,7 +89,10 @@ class Variables;
  *
  * `Variables` stores the data it owns in a `std::unique_ptr<double[]>`
  * instead of a `std::vector` because `std::vector` value-initializes its
- * contents, which is very slow.
+ * contents, which is very slow. If SpECTRE is configured with
+ * `SPECTRE_POOLED_ALLOCATION` the memory is instead taken from a thread-local
+ * `size_class_pool`, which avoids the system allocator when `Variables` of the
+ * same size are repeatedly created and destroyed.
  */
 template <typename... Tags>
 class Variables<tmpl::list<Tags...>> {
@@ -573,7 +576,7 @@ class Variables<tmpl::list<Tags...>> {
 
   std::array<value_type, number_of_independent_components>
       variable_data_impl_static_;
-  std::unique_ptr<value_type[]> variable_data_impl_dynamic_{};
+  size_class_pool::owning_array<value_type> variable_data_impl_dynamic_{};
   bool owning_{true};
   size_t size_ = 0;
   size_t number_of_grid_points_ = 0;
@@ -670,7 +673,7 @@ void Variables<tmpl::list<Tags...>>::initialize(
       variable_data_impl_dynamic_.reset();
     } else {
       variable_data_impl_dynamic_ =
-          cpp20::make_unique_for_overwrite<value_type[]>(size_);
+          size_class_pool::make_owning_array_for_overwrite<value_type>(size_);
     }
     add_reference_variable_data();
 #if defined(SPECTRE_DEBUG) || defined(SPECTRE_NAN_INIT)
@@ -27,10 +27,10 @@
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/MakeWithValue.hpp"
-#include "Utilities/MemoryHelpers.hpp"
 #include "Utilities/PrintHelpers.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/SetNumberOfGridPoints.hpp"
+#include "Utilities/SizeClassPool.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
 #include "Utilities/TypeTraits/IsComplexOfFundamental.hpp"
 #include "Utilities/TypeTraits/IsStdArray.hpp"
@@ -133,6 +133,9 @@ constexpr size_t default_vector_impl_static_size = 0;
  * - If either `SPECTRE_DEBUG` or `SPECTRE_NAN_INIT` are defined, then the
  *   `VectorImpl` is default initialized to `signaling_NaN()`. Otherwise, the
  *   vector is filled with uninitialized memory for performance.
+ * - If `SPECTRE_POOLED_ALLOCATION` is defined, heap memory is taken from a
+ *   thread-local `size_class_pool` instead of directly from the system
+ *   allocator.
  */
 template <typename T, typename VectorType,
           size_t StaticSize = default_vector_impl_static_size>
@@ -317,7 +320,7 @@ class VectorImpl
   void pup(PUP::er& p);
 
  protected:
-  std::unique_ptr<value_type[]> owned_data_{};
+  size_class_pool::owning_array<value_type> owned_data_{};
   std::array<T, StaticSize> static_owned_data_{};
   bool owning_{true};
 
@@ -342,10 +345,11 @@ class VectorImpl
     }
   }
 
-  SPECTRE_ALWAYS_INLINE std::unique_ptr<value_type[]> heap_alloc_if_necessary(
-      const size_t set_size) {
+  SPECTRE_ALWAYS_INLINE size_class_pool::owning_array<value_type>
+  heap_alloc_if_necessary(const size_t set_size) {
     return set_size > StaticSize
-               ? cpp20::make_unique_for_overwrite<value_type[]>(set_size)
+               ? size_class_pool::make_owning_array_for_overwrite<value_type>(
+                     set_size)
                : nullptr;
   }
 };
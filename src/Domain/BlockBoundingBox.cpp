@@ -0,0 +1,120 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/BlockBoundingBox.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Block.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace domain {
+namespace {
+// Number of lattice points per dimension that are mapped to find the extent
+// of a block. With 5 points the faces of a 90 degree spherical wedge deviate
+// from the lattice by at most ~2% of the radius.
+constexpr size_t points_per_dim = 5;
+// Fraction of the extent of the mapped points that is added on each side, so
+// the box encloses the parts of curved blocks between the lattice points.
+constexpr double padding_fraction = 0.1;
+
+template <size_t Dim>
+tnsr::I<DataVector, Dim, Frame::BlockLogical> logical_lattice() {
+  size_t num_points = 1;
+  for (size_t d = 0; d < Dim; ++d) {
+    num_points *= points_per_dim;
+  }
+  tnsr::I<DataVector, Dim, Frame::BlockLogical> result(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    size_t index = i;
+    for (size_t d = 0; d < Dim; ++d) {
+      const auto lattice_index = static_cast<double>(index % points_per_dim);
+      result.get(d)[i] =
+          -1.0 + 2.0 * lattice_index / static_cast<double>(points_per_dim - 1);
+      index /= points_per_dim;
+    }
+  }
+  return result;
+}
+
+template <size_t Dim, typename Fr>
+BlockBoundingBox<Dim> padded_box(const tnsr::I<DataVector, Dim, Fr>& points) {
+  BlockBoundingBox<Dim> result{};
+  for (size_t d = 0; d < Dim; ++d) {
+    const auto [lower, upper] =
+        std::minmax_element(points.get(d).begin(), points.get(d).end());
+    const double padding =
+        padding_fraction * (*upper - *lower) +
+        100.0 * std::numeric_limits<double>::epsilon() *
+            std::max(std::abs(*lower), std::abs(*upper));
+    gsl::at(result.lower_corner, d) = *lower - padding;
+    gsl::at(result.upper_corner, d) = *upper + padding;
+  }
+  return result;
+}
+}  // namespace
+
+template <size_t Dim>
+BlockBoundingBox<Dim> grid_frame_bounding_box(const Block<Dim>& block) {
+  const auto logical_points = logical_lattice<Dim>();
+  if (block.is_time_dependent()) {
+    return padded_box(block.moving_mesh_logical_to_grid_map()(logical_points));
+  }
+  return padded_box(block.stationary_map()(logical_points));
+}
+
+template <size_t Dim, typename Fr>
+BlockBoundingBox<Dim> bounding_box(
+    const Block<Dim>& block, const double time,
+    const FunctionsOfTimeMap& functions_of_time) {
+  if (std::is_same_v<Fr, Frame::Grid> or not block.is_time_dependent()) {
+    return grid_frame_bounding_box(block);
+  }
+  const auto grid_points =
+      block.moving_mesh_logical_to_grid_map()(logical_lattice<Dim>());
+  if constexpr (std::is_same_v<Fr, Frame::Inertial>) {
+    return padded_box(block.moving_mesh_grid_to_inertial_map()(
+        grid_points, time, functions_of_time));
+  } else if constexpr (std::is_same_v<Fr, Frame::Grid>) {
+    return padded_box(grid_points);
+  } else {
+    static_assert(std::is_same_v<Fr, Frame::Distorted>,
+                  "Bounding boxes are only supported in the grid, distorted "
+                  "and inertial frames.");
+    if (not block.has_distorted_frame()) {
+      return BlockBoundingBox<Dim>{};
+    }
+    return padded_box(block.moving_mesh_grid_to_distorted_map()(
+        grid_points, time, functions_of_time));
+  }
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+#define FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
+
+#define INSTANTIATE_DIM(_, data)                                \
+  template BlockBoundingBox<DIM(data)> grid_frame_bounding_box( \
+      const Block<DIM(data)>& block);
+
+#define INSTANTIATE(_, data)                                                   \
+  template BlockBoundingBox<DIM(data)> bounding_box<DIM(data), FRAME(data)>( \
+      const Block<DIM(data)>& block, double time,                              \
+      const FunctionsOfTimeMap& functions_of_time);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE_DIM, (1, 2, 3))
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3),
+                        (Frame::Grid, Frame::Distorted, Frame::Inertial))
+
+#undef INSTANTIATE
+#undef INSTANTIATE_DIM
+#undef FRAME
+#undef DIM
+}  // namespace domain
@@ -0,0 +1,75 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+
+/// \cond
+template <size_t VolumeDim>
+class Block;
+/// \endcond
+
+namespace domain {
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief An axis-aligned box that encloses a `Block` in some frame.
+ *
+ * \details Used by `block_logical_coordinates` to skip map inverses for
+ * blocks that can't contain a point. The box is computed by mapping a lattice
+ * of points in the block to the frame and padding the extent of the mapped
+ * points. The padding exceeds the deviation of curved faces from the lattice
+ * by far, so a point outside the boxes of all blocks is outside the domain.
+ * However, the box of a single block is not guaranteed to enclose it, so
+ * callers must handle points that lie just outside the box of the block that
+ * contains them. A default-constructed box is empty.
+ */
+template <size_t Dim>
+struct BlockBoundingBox {
+  std::array<double, Dim> lower_corner =
+      make_array<Dim>(std::numeric_limits<double>::infinity());
+  std::array<double, Dim> upper_corner =
+      make_array<Dim>(-std::numeric_limits<double>::infinity());
+
+  template <typename Fr>
+  bool contains(const tnsr::I<double, Dim, Fr>& point) const {
+    for (size_t d = 0; d < Dim; ++d) {
+      if (point.get(d) < gsl::at(lower_corner, d) or
+          point.get(d) > gsl::at(upper_corner, d)) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+/*!
+ * \brief The bounding box of the `block` in the grid frame.
+ *
+ * For time-independent blocks the grid frame is the inertial frame. The grid
+ * frame doesn't depend on time, so `Domain` computes these boxes once.
+ */
+template <size_t Dim>
+BlockBoundingBox<Dim> grid_frame_bounding_box(const Block<Dim>& block);
+
+/*!
+ * \brief The bounding box of the `block` in the frame `Fr` at `time`.
+ *
+ * This maps the lattice of points through the time-dependent maps, so the box
+ * must be recomputed whenever the functions of time change. For
+ * time-independent blocks and for the grid frame this is the same as
+ * `grid_frame_bounding_box()`. Time-dependent blocks without a distorted frame
+ * get an empty box in the distorted frame, since
+ * `block_logical_coordinates_single_point` never finds a point in them.
+ */
+template <size_t Dim, typename Fr>
+BlockBoundingBox<Dim> bounding_box(const Block<Dim>& block, double time,
+                                   const FunctionsOfTimeMap& functions_of_time);
+}  // namespace domain
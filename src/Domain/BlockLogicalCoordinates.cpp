@@ -4,18 +4,39 @@
 #include "Domain/BlockLogicalCoordinates.hpp"
 
 #include <cstddef>
+#include <optional>
+#include <type_traits>
 #include <vector>
 
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/Block.hpp"
+#include "Domain/BlockBoundingBox.hpp"
 #include "Domain/Domain.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/Structure/BlockId.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/ParallelFor.hpp"
+
+namespace {
+// Whether block logical coordinates returned by
+// `block_logical_coordinates_single_point` lie on a face of the block. These
+// are clamped to exactly -1 or 1, so the point may also lie in a neighboring
+// block.
+template <size_t Dim>
+bool on_block_boundary(
+    const tnsr::I<double, Dim, ::Frame::BlockLogical>& logical_coords) {
+  for (size_t d = 0; d < Dim; ++d) {
+    if (abs(logical_coords.get(d)) == 1.0) {
+      return true;
+    }
+  }
+  return false;
+}
+}  // namespace
 
 template <size_t Dim, typename Fr>
 std::optional<tnsr::I<double, Dim, ::Frame::BlockLogical>>
@@ -136,31 +157,163 @@ block_logical_coordinates_single_point(
 template <size_t Dim, typename Fr>
 std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
     const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Fr>& x,
-    const double time, const domain::FunctionsOfTimeMap& functions_of_time) {
+    const double time, const domain::FunctionsOfTimeMap& functions_of_time,
+    const size_t number_of_threads) {
   const size_t num_pts = get<0>(x).size();
+  const auto& blocks = domain.blocks();
   std::vector<BlockLogicalCoords<Dim>> block_coord_holders(num_pts);
-  for (size_t s = 0; s < num_pts; ++s) {
+
+  // Only try the map inverses of blocks whose bounding box contains the
+  // point. Boxes of time-dependent blocks in the distorted or inertial frame
+  // move with the functions of time, so they are computed here. That costs a
+  // few forward map evaluations per block, which isn't worth it for a handful
+  // of points.
+  const bool use_bounding_boxes = num_pts > blocks.size();
+  std::vector<domain::BlockBoundingBox<Dim>> bounding_boxes{};
+  if (use_bounding_boxes) {
+    bounding_boxes = domain.block_bounding_boxes();
+    if constexpr (not std::is_same_v<Fr, ::Frame::Grid>) {
+      for (const auto& block : blocks) {
+        if (block.is_time_dependent()) {
+          bounding_boxes[block.id()] = domain::bounding_box<Dim, Fr>(
+              block, time, functions_of_time);
+        }
+      }
+    }
+  }
+
+  // Each point writes only to its own entry of the result. The maps and
+  // functions of time are only read.
+  const auto find_point = [&](const size_t s) {
     tnsr::I<double, Dim, Fr> x_frame(0.0);
     for (size_t d = 0; d < Dim; ++d) {
       x_frame.get(d) = x.get(d)[s];
     }
-    // Check which block this point is in. Each point will be in one
-    // and only one block, unless it is on a shared boundary.  In that
-    // case, choose the first matching block (and this block will have
-    // the smallest block_id).
-    for (const auto& block : domain.blocks()) {
+    const auto try_block = [&](const Block<Dim>& block) {
       std::optional<tnsr::I<double, Dim, ::Frame::BlockLogical>> x_logical =
           block_logical_coordinates_single_point(x_frame, block, time,
                                                  functions_of_time);
+      if (x_logical.has_value()) {
+        block_coord_holders[s] = make_id_pair(domain::BlockId(block.id()),
+                                              std::move(x_logical.value()));
+        return true;
+      }
+      return false;
+    };
+    // Check which block this point is in. Each point will be in one and only
+    // one block, unless it is on a shared boundary. In that case, choose the
+    // first matching block (and this block will have the smallest block_id).
+    if (not use_bounding_boxes) {
+      for (const auto& block : blocks) {
+        if (try_block(block)) {
+          return;
+        }
+      }
+      return;
+    }
+    bool point_in_any_box = false;
+    for (const auto& block : blocks) {
+      if (not bounding_boxes[block.id()].contains(x_frame)) {
+        continue;
+      }
+      point_in_any_box = true;
+      if (not try_block(block)) {
+        continue;
+      }
+      // The boxes are computed from a lattice of points in each block, so a
+      // strongly curved block may poke out of its box. A point on the
+      // boundary of this block may then also lie in a block with a smaller
+      // id whose box doesn't contain it.
+      if (on_block_boundary(block_coord_holders[s]->data)) {
+        for (size_t id = 0; id < block.id(); ++id) {
+          if (not bounding_boxes[id].contains(x_frame) and
+              try_block(blocks[id])) {
+            return;
+          }
+        }
+      }
+      return;
+    }
+    // The boxes are padded well beyond the deviation of the block faces from
+    // the lattice, so a point outside all of them is outside the domain.
+    if (not point_in_any_box) {
+      return;
+    }
+    // The point is in the box of some block but not in that block. It may
+    // still lie in a curved block that pokes out of its box.
+    for (const auto& block : blocks) {
+      if (not bounding_boxes[block.id()].contains(x_frame) and
+          try_block(block)) {
+        return;
+      }
+    }
+  };
 
+  parallel_for(num_pts, number_of_threads, find_point);
+  return block_coord_holders;
+}
+
+template <size_t Dim, typename Fr>
+std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
+    const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Fr>& x,
+    const std::vector<BlockLogicalCoords<Dim>>& previous_block_logical_coords,
+    const double time, const domain::FunctionsOfTimeMap& functions_of_time) {
+  const size_t num_pts = get<0>(x).size();
+  if (previous_block_logical_coords.size() != num_pts) {
+    return block_logical_coordinates(domain, x, time, functions_of_time);
+  }
+  std::vector<BlockLogicalCoords<Dim>> block_coord_holders(num_pts);
+  std::vector<size_t> points_to_search{};
+  tnsr::I<double, Dim, Fr> x_frame(0.0);
+  for (size_t s = 0; s < num_pts; ++s) {
+    if (previous_block_logical_coords[s].has_value()) {
+      for (size_t d = 0; d < Dim; ++d) {
+        x_frame.get(d) = x.get(d)[s];
+      }
+      const auto& block =
+          domain.blocks()[previous_block_logical_coords[s]->id.get_index()];
+      std::optional<tnsr::I<double, Dim, ::Frame::BlockLogical>> x_logical =
+          block_logical_coordinates_single_point(x_frame, block, time,
+                                                 functions_of_time);
       if (x_logical.has_value()) {
-        // Point is in this block.  Don't bother checking subsequent
-        // blocks.
+        // A point on a face shared with a block with a smaller id belongs to
+        // that block, like in the full search.
+        if (on_block_boundary(x_logical.value())) {
+          for (size_t id = 0; id < block.id(); ++id) {
+            auto x_logical_lower = block_logical_coordinates_single_point(
+                x_frame, domain.blocks()[id], time, functions_of_time);
+            if (x_logical_lower.has_value()) {
+              block_coord_holders[s] = make_id_pair(
+                  domain::BlockId(id), std::move(x_logical_lower.value()));
+              break;
+            }
+          }
+          if (block_coord_holders[s].has_value()) {
+            continue;
+          }
+        }
         block_coord_holders[s] = make_id_pair(domain::BlockId(block.id()),
                                               std::move(x_logical.value()));
-        break;
+        continue;
       }
     }
+    points_to_search.push_back(s);
+  }
+  if (points_to_search.empty()) {
+    return block_coord_holders;
+  }
+
+  tnsr::I<DataVector, Dim, Fr> x_to_search(points_to_search.size());
+  for (size_t i = 0; i < points_to_search.size(); ++i) {
+    for (size_t d = 0; d < Dim; ++d) {
+      x_to_search.get(d)[i] = x.get(d)[points_to_search[i]];
+    }
+  }
+  auto searched_block_coord_holders =
+      block_logical_coordinates(domain, x_to_search, time, functions_of_time);
+  for (size_t i = 0; i < points_to_search.size(); ++i) {
+    block_coord_holders[points_to_search[i]] =
+        std::move(searched_block_coord_holders[i]);
   }
   return block_coord_holders;
 }
@@ -179,7 +332,15 @@ std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
   block_logical_coordinates(                                                   \
       const Domain<DIM(data)>& domain,                                         \
       const tnsr::I<DataVector, DIM(data), FRAME(data)>& x, const double time, \
-      const domain::FunctionsOfTimeMap& functions_of_time);
+      const domain::FunctionsOfTimeMap& functions_of_time,                     \
+      size_t number_of_threads);                                               \
+  template std::vector<BlockLogicalCoords<DIM(data)>>                          \
+  block_logical_coordinates(                                                   \
+      const Domain<DIM(data)>& domain,                                         \
+      const tnsr::I<DataVector, DIM(data), FRAME(data)>& x,                    \
+      const std::vector<BlockLogicalCoords<DIM(data)>>&                        \
+          previous_block_logical_coords,                                       \
+      const double time, const domain::FunctionsOfTimeMap& functions_of_time);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3),
                         (::Frame::Grid, ::Frame::Distorted, ::Frame::Inertial))
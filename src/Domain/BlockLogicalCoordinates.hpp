@@ -62,9 +62,35 @@ using BlockLogicalCoords = std::optional<
 /// typical use cases.  This means that `block_logical_coordinates`
 /// does not assume that grid and distorted frames are equal in
 /// `Block`s that lack a distorted frame.
+///
+/// For many points, `block_logical_coordinates` first tries the blocks whose
+/// `domain::BlockBoundingBox` contains the point, in order of their id. A point
+/// outside all boxes is outside the domain. If none of the blocks contains the
+/// point, or if it lies on the boundary of the block that does, the other
+/// blocks are tried too, so the result is the same as without bounding boxes.
+/// This avoids most map inverses. The points are distributed over
+/// `number_of_threads` threads with `parallel_for`. Keep this at 1 when
+/// calling from a Charm++ entry method unless the node has idle cores.
+template <size_t Dim, typename Fr>
+auto block_logical_coordinates(
+    const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Fr>& x,
+    double time = std::numeric_limits<double>::signaling_NaN(),
+    const domain::FunctionsOfTimeMap& functions_of_time = {},
+    size_t number_of_threads = 1) -> std::vector<BlockLogicalCoords<Dim>>;
+
+/// \brief Version of `block_logical_coordinates` for points that have moved
+/// only slightly since the `previous_block_logical_coords` were computed.
+///
+/// Each point is first looked up in the block it was found in previously, so
+/// only points that left their block need the full search. If the number of
+/// points changed, the previous result is ignored. If a point lies on a face
+/// of its previous block, the blocks with a smaller `BlockId` are tried as
+/// well, so points on shared boundaries are assigned to the same block as by
+/// the full search.
 template <size_t Dim, typename Fr>
 auto block_logical_coordinates(
     const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Fr>& x,
+    const std::vector<BlockLogicalCoords<Dim>>& previous_block_logical_coords,
     double time = std::numeric_limits<double>::signaling_NaN(),
     const domain::FunctionsOfTimeMap& functions_of_time = {})
     -> std::vector<BlockLogicalCoords<Dim>>;
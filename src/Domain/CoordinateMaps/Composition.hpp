@@ -86,6 +86,11 @@ struct Composition<Frames, Dim, std::index_sequence<Is...>>
     return std::make_unique<Composition>(*this);
   }
 
+  std::unique_ptr<Base> get_element_clone() const override {
+    return std::make_unique<Composition>(
+        get<Is>(maps_)->get_element_clone()...);
+  }
+
   /// \cond
   explicit Composition(CkMigrateMessage* /*m*/) {}
   using PUP::able::register_constructor;
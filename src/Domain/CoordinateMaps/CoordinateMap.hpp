@@ -66,6 +66,16 @@ class CoordinateMapBase : public PUP::able {
   virtual std::unique_ptr<CoordinateMapBase<SourceFrame, TargetFrame, Dim>>
   get_clone() const = 0;
 
+  /// \brief Retrieve a copy of the map that is owned by a single element.
+  ///
+  /// An element evaluates its map at the same grid coordinates until it is
+  /// refined, so maps in the copy can cache data that only depends on these
+  /// coordinates. Maps that support this provide an `enable_element_cache()`
+  /// member function. Don't use this for maps that are evaluated at different
+  /// points on every call, like the maps held by a `Block`.
+  virtual std::unique_ptr<CoordinateMapBase<SourceFrame, TargetFrame, Dim>>
+  get_element_clone() const = 0;
+
   /// \brief Retrieve the same map but going from `SourceFrame` to
   /// `Frame::Grid`.
   ///
@@ -280,6 +290,9 @@ class CoordinateMap
     return std::make_unique<CoordinateMap>(*this);
   }
 
+  std::unique_ptr<CoordinateMapBase<SourceFrame, TargetFrame, dim>>
+  get_element_clone() const override;
+
   std::unique_ptr<CoordinateMapBase<SourceFrame, Frame::Grid, dim>>
   get_to_grid_frame() const override {
     return get_to_grid_frame_impl(std::make_index_sequence<sizeof...(Maps)>{});
@@ -41,6 +41,8 @@ namespace domain {
 namespace CoordinateMap_detail {
 CREATE_IS_CALLABLE(function_of_time_names)
 CREATE_IS_CALLABLE_V(function_of_time_names)
+CREATE_IS_CALLABLE(enable_element_cache)
+CREATE_IS_CALLABLE_V(enable_element_cache)
 
 template <size_t Dim, typename T>
 using combined_coords_frame_velocity_jacs_t =
@@ -576,6 +578,24 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::
       std::move(frame_velocity)};
 }
 
+template <typename SourceFrame, typename TargetFrame, typename... Maps>
+auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::get_element_clone()
+    const -> std::unique_ptr<CoordinateMapBase<SourceFrame, TargetFrame, dim>> {
+  auto clone = std::make_unique<CoordinateMap>(*this);
+  const auto enable_element_cache = [](auto& map) {
+    if constexpr (CoordinateMap_detail::is_enable_element_cache_callable_v<
+                      std::decay_t<decltype(map)>>) {
+      map.enable_element_cache();
+    }
+  };
+  std::apply(
+      [&enable_element_cache](auto&... maps) {
+        EXPAND_PACK_LEFT_TO_RIGHT(enable_element_cache(maps));
+      },
+      clone->maps_);
+  return clone;
+}
+
 template <typename SourceFrame, typename TargetFrame, typename... Maps>
 template <size_t... Is>
 auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::get_to_grid_frame_impl(
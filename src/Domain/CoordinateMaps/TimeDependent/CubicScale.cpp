@@ -18,6 +18,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/SnapshotCache.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
@@ -53,7 +54,9 @@ std::array<tt::remove_cvref_wrap_t<T>, Dim> CubicScale<Dim>::operator()(
     const std::unordered_map<
         std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
         functions_of_time) const {
-  const double a_of_t = functions_of_time.at(f_of_t_a_)->func(time)[0][0];
+  const double a_of_t =
+      FunctionsOfTime::cached_evaluate_components<1, 1>(
+          *functions_of_time.at(f_of_t_a_), time)[0][0];
 
   if (functions_of_time_equal_) {
     // optimization for linear radial scaling
@@ -64,7 +67,9 @@ std::array<tt::remove_cvref_wrap_t<T>, Dim> CubicScale<Dim>::operator()(
     return result;
   }
 
-  const double b_of_t = functions_of_time.at(f_of_t_b_)->func(time)[0][0];
+  const double b_of_t =
+      FunctionsOfTime::cached_evaluate_components<1, 1>(
+          *functions_of_time.at(f_of_t_b_), time)[0][0];
 
   tt::remove_cvref_wrap_t<T> rho_squared =
       square(dereference_wrapper(source_coords[0]));
@@ -93,7 +98,8 @@ std::optional<std::array<double, Dim>> CubicScale<Dim>::inverse(
   if (functions_of_time_equal_) {
     // optimization for linear radial scaling
     const double one_over_a_of_t =
-        1.0 / functions_of_time.at(f_of_t_a_)->func(time)[0][0];
+        1.0 / FunctionsOfTime::cached_evaluate_components<1, 1>(
+                  *functions_of_time.at(f_of_t_a_), time)[0][0];
 
     // Construct std::optional to have a default value of an empty array.
     // Doing just result{} would construct a std::optional that doesn't hold a
@@ -109,8 +115,12 @@ std::optional<std::array<double, Dim>> CubicScale<Dim>::inverse(
   // (b-a)/R^2*\rho^3 + a*\rho - r = 0,
   // where a and b are the FunctionsOfTime, R is the outer_boundary, and r is
   // the mapped/target coordinates radius.
-  const double a_of_t = functions_of_time.at(f_of_t_a_)->func(time)[0][0];
-  const double b_of_t = functions_of_time.at(f_of_t_b_)->func(time)[0][0];
+  const double a_of_t =
+      FunctionsOfTime::cached_evaluate_components<1, 1>(
+          *functions_of_time.at(f_of_t_a_), time)[0][0];
+  const double b_of_t =
+      FunctionsOfTime::cached_evaluate_components<1, 1>(
+          *functions_of_time.at(f_of_t_b_), time)[0][0];
 
   // these checks ensure that the function is monotonically increasing
   // and that there is one real root in the domain of \rho, [0,R]
@@ -170,7 +180,8 @@ std::array<tt::remove_cvref_wrap_t<T>, Dim> CubicScale<Dim>::frame_velocity(
         std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
         functions_of_time) const {
   const double dt_a_of_t =
-      functions_of_time.at(f_of_t_a_)->func_and_deriv(time)[1][0];
+      FunctionsOfTime::cached_evaluate_components<2, 1>(
+          *functions_of_time.at(f_of_t_a_), time)[1][0];
 
   if (functions_of_time_equal_) {
     // optimization for linear radial scaling
@@ -182,7 +193,8 @@ std::array<tt::remove_cvref_wrap_t<T>, Dim> CubicScale<Dim>::frame_velocity(
   }
 
   const double dt_b_of_t =
-      functions_of_time.at(f_of_t_b_)->func_and_deriv(time)[1][0];
+      FunctionsOfTime::cached_evaluate_components<2, 1>(
+          *functions_of_time.at(f_of_t_b_), time)[1][0];
 
   tt::remove_cvref_wrap_t<T> rho_squared =
       square(dereference_wrapper(source_coords[0]));
@@ -210,7 +222,9 @@ CubicScale<Dim>::jacobian(
     const std::unordered_map<
         std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
         functions_of_time) const {
-  const double a_of_t = functions_of_time.at(f_of_t_a_)->func(time)[0][0];
+  const double a_of_t =
+      FunctionsOfTime::cached_evaluate_components<1, 1>(
+          *functions_of_time.at(f_of_t_a_), time)[0][0];
 
   if (functions_of_time_equal_) {
     // optimization for linear radial scaling
@@ -223,7 +237,9 @@ CubicScale<Dim>::jacobian(
     return jac;
   }
 
-  const double b_of_t = functions_of_time.at(f_of_t_b_)->func(time)[0][0];
+  const double b_of_t =
+      FunctionsOfTime::cached_evaluate_components<1, 1>(
+          *functions_of_time.at(f_of_t_b_), time)[0][0];
 
   tt::remove_cvref_wrap_t<T> rho_squared =
       square(dereference_wrapper(source_coords[0]));
@@ -262,7 +278,9 @@ CubicScale<Dim>::inv_jacobian(
     const std::unordered_map<
         std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
         functions_of_time) const {
-  const double a_of_t = functions_of_time.at(f_of_t_a_)->func(time)[0][0];
+  const double a_of_t =
+      FunctionsOfTime::cached_evaluate_components<1, 1>(
+          *functions_of_time.at(f_of_t_a_), time)[0][0];
 
   if (functions_of_time_equal_) {
     // optimization for linear radial scaling
@@ -276,7 +294,9 @@ CubicScale<Dim>::inv_jacobian(
     return inv_jac;
   }
 
-  const double b_of_t = functions_of_time.at(f_of_t_b_)->func(time)[0][0];
+  const double b_of_t =
+      FunctionsOfTime::cached_evaluate_components<1, 1>(
+          *functions_of_time.at(f_of_t_b_), time)[0][0];
 
   tt::remove_cvref_wrap_t<T> rho_squared =
       square(dereference_wrapper(source_coords[0]));
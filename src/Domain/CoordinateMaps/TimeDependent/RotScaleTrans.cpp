@@ -22,6 +22,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/RotationMatrixHelpers.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/SnapshotCache.hpp"
 #include "NumericalAlgorithms/RootFinding/QuadraticEquation.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -91,9 +92,11 @@ std::array<tt::remove_cvref_wrap_t<T>, Dim> RotScaleTrans<Dim>::operator()(
   // Expansion Map
   if (scale_f_of_t_a_.has_value()) {
     const double scale_a_of_t =
-        functions_of_time.at(scale_f_of_t_a_.value())->func(time)[0][0];
+        FunctionsOfTime::cached_evaluate_components<1, 1>(
+            *functions_of_time.at(scale_f_of_t_a_.value()), time)[0][0];
     const double scale_b_of_t =
-        functions_of_time.at(scale_f_of_t_b_.value())->func(time)[0][0];
+        FunctionsOfTime::cached_evaluate_components<1, 1>(
+            *functions_of_time.at(scale_f_of_t_b_.value()), time)[0][0];
     if (region_ == BlockRegion::Inner) {
       for (size_t i = 0; i < Dim; i++) {
         gsl::at(result, i) *= scale_a_of_t;
@@ -138,12 +141,9 @@ std::array<tt::remove_cvref_wrap_t<T>, Dim> RotScaleTrans<Dim>::operator()(
   }
   // Translation map
   if (trans_f_of_t_.has_value()) {
-    const DataVector trans_func_of_time =
-        functions_of_time.at(trans_f_of_t_.value())->func(time)[0];
-    ASSERT(trans_func_of_time.size() == Dim,
-           "The dimension of the function of time ("
-               << trans_func_of_time.size()
-               << ") does not match the dimension of the map (" << Dim << ").");
+    const std::array<double, Dim> trans_func_of_time =
+        FunctionsOfTime::cached_evaluate_components<1, Dim>(
+            *functions_of_time.at(trans_f_of_t_.value()), time)[0];
     if (region_ == BlockRegion::Inner) {
       for (size_t i = 0; i < Dim; i++) {
         gsl::at(result, i) += gsl::at(trans_func_of_time, i);
@@ -203,12 +203,9 @@ std::optional<std::array<double, Dim>> RotScaleTrans<Dim>::inverse(
 
   // Inverse translation without expansion
   if (trans_f_of_t_.has_value() and not scale_f_of_t_a_.has_value()) {
-    const DataVector trans_func_of_time =
-        functions_of_time.at(trans_f_of_t_.value())->func(time)[0];
-    ASSERT(trans_func_of_time.size() == Dim,
-           "The dimension of the function of time ("
-               << trans_func_of_time.size()
-               << ") does not match the dimension of the map (" << Dim << ").");
+    const std::array<double, Dim> trans_func_of_time =
+        FunctionsOfTime::cached_evaluate_components<1, Dim>(
+            *functions_of_time.at(trans_f_of_t_.value()), time)[0];
       double non_translated_radius_squared = 0.;
       for (size_t i = 0; i < Dim; i++) {
         non_translated_radius_squared +=
@@ -276,9 +273,11 @@ std::optional<std::array<double, Dim>> RotScaleTrans<Dim>::inverse(
   // Inverse expansion without translation
   else if (scale_f_of_t_a_.has_value() and not trans_f_of_t_.has_value()) {
     const double scale_a_of_t =
-        functions_of_time.at(scale_f_of_t_a_.value())->func(time)[0][0];
+        FunctionsOfTime::cached_evaluate_components<1, 1>(
+            *functions_of_time.at(scale_f_of_t_a_.value()), time)[0][0];
     const double scale_b_of_t =
-        functions_of_time.at(scale_f_of_t_b_.value())->func(time)[0][0];
+        FunctionsOfTime::cached_evaluate_components<1, 1>(
+            *functions_of_time.at(scale_f_of_t_b_.value()), time)[0][0];
     ASSERT(scale_a_of_t != 0.0 and scale_b_of_t != 0.0,
            "An expansion map "
            "value was set to 0.0, this will cause an FPE. Expansion a: "
@@ -343,16 +342,15 @@ std::optional<std::array<double, Dim>> RotScaleTrans<Dim>::inverse(
 
   // Inverse expansion and translation
   else if (trans_f_of_t_.has_value() and scale_f_of_t_a_.has_value()) {
-    const DataVector trans_func_of_time =
-        functions_of_time.at(trans_f_of_t_.value())->func(time)[0];
-    ASSERT(trans_func_of_time.size() == Dim,
-           "The dimension of the function of time ("
-               << trans_func_of_time.size()
-               << ") does not match the dimension of the map (" << Dim << ").");
+    const std::array<double, Dim> trans_func_of_time =
+        FunctionsOfTime::cached_evaluate_components<1, Dim>(
+            *functions_of_time.at(trans_f_of_t_.value()), time)[0];
     const double scale_a_of_t =
-        functions_of_time.at(scale_f_of_t_a_.value())->func(time)[0][0];
+        FunctionsOfTime::cached_evaluate_components<1, 1>(
+            *functions_of_time.at(scale_f_of_t_a_.value()), time)[0][0];
     const double scale_b_of_t =
-        functions_of_time.at(scale_f_of_t_b_.value())->func(time)[0][0];
+        FunctionsOfTime::cached_evaluate_components<1, 1>(
+            *functions_of_time.at(scale_f_of_t_b_.value()), time)[0][0];
     ASSERT(scale_a_of_t != 0.0 and scale_b_of_t != 0.0,
            "An expansion map "
            "value was set to 0.0, this will cause an FPE. Expansion a: "
@@ -491,10 +489,12 @@ std::array<tt::remove_cvref_wrap_t<T>, Dim> RotScaleTrans<Dim>::frame_velocity(
   }
   // Expansion map with no rotation
   else if (scale_f_of_t_a_.has_value() and not rot_f_of_t_.has_value()) {
-    const double dt_a_of_t = functions_of_time.at(scale_f_of_t_a_.value())
-                                 ->func_and_deriv(time)[1][0];
-    const double dt_b_of_t = functions_of_time.at(scale_f_of_t_b_.value())
-                                 ->func_and_deriv(time)[1][0];
+    const double dt_a_of_t =
+        FunctionsOfTime::cached_evaluate_components<2, 1>(
+            *functions_of_time.at(scale_f_of_t_a_.value()), time)[1][0];
+    const double dt_b_of_t =
+        FunctionsOfTime::cached_evaluate_components<2, 1>(
+            *functions_of_time.at(scale_f_of_t_b_.value()), time)[1][0];
     if (region_ == BlockRegion::Inner) {
       for (size_t i = 0; i < Dim; i++) {
         gsl::at(result, i) +=
@@ -542,13 +542,15 @@ std::array<tt::remove_cvref_wrap_t<T>, Dim> RotScaleTrans<Dim>::frame_velocity(
         time, *(functions_of_time.at(rot_f_of_t_.value())));
     const Matrix rot_matrix_deriv = rotation_matrix_deriv<Dim>(
         time, *(functions_of_time.at(rot_f_of_t_.value())));
-    std::array<DataVector, 2> scale_a_func_and_deriv =
-        functions_of_time.at(scale_f_of_t_a_.value())->func_and_deriv(time);
-    std::array<DataVector, 2> scale_b_func_and_deriv =
-        functions_of_time.at(scale_f_of_t_b_.value())->func_and_deriv(time);
+    const std::array<std::array<double, 1>, 2> scale_a_func_and_deriv =
+        FunctionsOfTime::cached_evaluate_components<2, 1>(
+            *functions_of_time.at(scale_f_of_t_a_.value()), time);
     const double scale_a_of_t = scale_a_func_and_deriv[0][0];
-    const double scale_b_of_t = scale_b_func_and_deriv[0][0];
     const double dt_a_of_t = scale_a_func_and_deriv[1][0];
+    const std::array<std::array<double, 1>, 2> scale_b_func_and_deriv =
+        FunctionsOfTime::cached_evaluate_components<2, 1>(
+            *functions_of_time.at(scale_f_of_t_b_.value()), time);
+    const double scale_b_of_t = scale_b_func_and_deriv[0][0];
     const double dt_b_of_t = scale_b_func_and_deriv[1][0];
     if (region_ == BlockRegion::Inner) {
       for (size_t i = 0; i < Dim; i++) {
@@ -620,12 +622,9 @@ std::array<tt::remove_cvref_wrap_t<T>, Dim> RotScaleTrans<Dim>::frame_velocity(
   }
   // Translation map
   if (trans_f_of_t_.has_value()) {
-    const DataVector deriv_trans_func_of_time =
-        functions_of_time.at(trans_f_of_t_.value())->func_and_deriv(time)[1];
-    ASSERT(deriv_trans_func_of_time.size() == Dim,
-           "The dimension of the function of time ("
-               << deriv_trans_func_of_time.size()
-               << ") does not match the dimension of the map (" << Dim << ").");
+    const std::array<double, Dim> deriv_trans_func_of_time =
+        FunctionsOfTime::cached_evaluate_components<2, Dim>(
+            *functions_of_time.at(trans_f_of_t_.value()), time)[1];
     if (region_ == BlockRegion::Inner) {
       for (size_t i = 0; i < Dim; i++) {
         gsl::at(result, i) += gsl::at(deriv_trans_func_of_time, i);
@@ -691,9 +690,11 @@ RotScaleTrans<Dim>::jacobian(
   // Expansion map with no rotation
   else if (scale_f_of_t_a_.has_value() and not rot_f_of_t_.has_value()) {
     const double scale_a_of_t =
-        functions_of_time.at(scale_f_of_t_a_.value())->func(time)[0][0];
+        FunctionsOfTime::cached_evaluate_components<1, 1>(
+            *functions_of_time.at(scale_f_of_t_a_.value()), time)[0][0];
     const double scale_b_of_t =
-        functions_of_time.at(scale_f_of_t_b_.value())->func(time)[0][0];
+        FunctionsOfTime::cached_evaluate_components<1, 1>(
+            *functions_of_time.at(scale_f_of_t_b_.value()), time)[0][0];
     if (region_ == BlockRegion::Inner) {
       for (size_t i = 0; i < Dim; i++) {
         result.get(i, i) = scale_a_of_t;
@@ -758,9 +759,11 @@ RotScaleTrans<Dim>::jacobian(
     const Matrix rot_matrix = rotation_matrix<Dim>(
         time, *(functions_of_time.at(rot_f_of_t_.value())));
     const double scale_a_of_t =
-        functions_of_time.at(scale_f_of_t_a_.value())->func(time)[0][0];
+        FunctionsOfTime::cached_evaluate_components<1, 1>(
+            *functions_of_time.at(scale_f_of_t_a_.value()), time)[0][0];
     const double scale_b_of_t =
-        functions_of_time.at(scale_f_of_t_b_.value())->func(time)[0][0];
+        FunctionsOfTime::cached_evaluate_components<1, 1>(
+            *functions_of_time.at(scale_f_of_t_b_.value()), time)[0][0];
     if (region_ == BlockRegion::Inner) {
       for (size_t i = 0; i < Dim; i++) {
         for (size_t j = 0; j < Dim; j++) {
@@ -834,8 +837,9 @@ RotScaleTrans<Dim>::jacobian(
   }
   // Translation map
   if (trans_f_of_t_.has_value()) {
-      const DataVector trans_func_of_time =
-          functions_of_time.at(trans_f_of_t_.value())->func_and_deriv(time)[0];
+      const std::array<double, Dim> trans_func_of_time =
+          FunctionsOfTime::cached_evaluate_components<1, Dim>(
+              *functions_of_time.at(trans_f_of_t_.value()), time)[0];
       for (size_t i = 0; i < Dim; i++) {
         const double deriv_translation_factor =
             (-gsl::at(trans_func_of_time, i) / (outer_radius_ - inner_radius_));
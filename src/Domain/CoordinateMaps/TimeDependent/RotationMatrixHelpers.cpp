@@ -3,13 +3,16 @@
 
 #include "Domain/CoordinateMaps/TimeDependent/RotationMatrixHelpers.hpp"
 
-#include "DataStructures/DataVector.hpp"
+#include <array>
+
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/SnapshotCache.hpp"
 #include "Utilities/Gsl.hpp"
 
 namespace {
 void add_bilinear_term(const gsl::not_null<Matrix*> rot_matrix,
-                       const DataVector& q1, const DataVector& q2,
+                       const std::array<double, 4>& q1,
+                       const std::array<double, 4>& q2,
                        const double coef = 1.0) {
   (*rot_matrix)(0, 0) +=
       coef * (q1[0] * q2[0] + q1[1] * q2[1] - q1[2] * q2[2] - q1[3] * q2[3]);
@@ -36,13 +39,16 @@ Matrix rotation_matrix(const double t,
   Matrix rotation_matrix{Dim, Dim, 0.0};
 
   if constexpr (Dim == 2) {
-    const double rotation_angle = fot.func(t)[0][0];
+    const double rotation_angle =
+        domain::FunctionsOfTime::cached_evaluate_components<1, 1>(fot,
+                                                                  t)[0][0];
     rotation_matrix(0, 0) = cos(rotation_angle);
     rotation_matrix(0, 1) = -sin(rotation_angle);
     rotation_matrix(1, 0) = sin(rotation_angle);
     rotation_matrix(1, 1) = cos(rotation_angle);
   } else {
-    const DataVector quat = fot.func(t)[0];
+    const std::array<double, 4> quat =
+        domain::FunctionsOfTime::cached_evaluate_components<1, 4>(fot, t)[0];
     add_bilinear_term(make_not_null(&rotation_matrix), quat, quat);
   }
 
@@ -58,7 +64,8 @@ Matrix rotation_matrix_deriv(
   Matrix rotation_matrix_deriv{Dim, Dim, 0.0};
 
   if constexpr (Dim == 2) {
-    const std::array<DataVector, 2> angle_and_deriv = fot.func_and_deriv(t);
+    const std::array<std::array<double, 1>, 2> angle_and_deriv =
+        domain::FunctionsOfTime::cached_evaluate_components<2, 1>(fot, t);
     const double rotation_angle = angle_and_deriv[0][0];
     const double rotation_angular_velocity = angle_and_deriv[1][0];
     rotation_matrix_deriv(0, 0) =
@@ -70,7 +77,8 @@ Matrix rotation_matrix_deriv(
     rotation_matrix_deriv(1, 1) =
         -rotation_angular_velocity * sin(rotation_angle);
   } else {
-    const std::array<DataVector, 2> quat_and_deriv = fot.func_and_deriv(t);
+    const std::array<std::array<double, 4>, 2> quat_and_deriv =
+        domain::FunctionsOfTime::cached_evaluate_components<2, 4>(fot, t);
     add_bilinear_term(make_not_null(&rotation_matrix_deriv), quat_and_deriv[0],
                       quat_and_deriv[1]);
     add_bilinear_term(make_not_null(&rotation_matrix_deriv), quat_and_deriv[1],
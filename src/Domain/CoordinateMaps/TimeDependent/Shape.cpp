@@ -11,19 +11,26 @@
 #include <pup.h>
 #include <pup_stl.h>
 #include <string>
+#include <type_traits>
 #include <unordered_set>
+#include <utility>
+#include <variant>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/ShapeMapTransitionFunctions/ShapeMapTransitionFunction.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/SnapshotCache.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/SpherepackIterator.hpp"
+#include "Utilities/Blas.hpp"
 #include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeWithValue.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
 #include "Utilities/StdHelpers.hpp"
 
@@ -42,10 +49,105 @@ void cartesian_to_spherical(gsl::not_null<std::array<T, 2>*> result,
   gsl::at(*result, 1) = atan2(y, x);
 }
 
+namespace detail {
+ShapeYlmBasisCache& ShapeYlmBasisCache::operator=(
+    const ShapeYlmBasisCache& /*rhs*/) {
+  const std::lock_guard lock(mutex_);
+  entry_ = nullptr;
+  return *this;
+}
+
+ShapeYlmBasisCache& ShapeYlmBasisCache::operator=(
+    ShapeYlmBasisCache&& /*rhs*/) {
+  const std::lock_guard lock(mutex_);
+  entry_ = nullptr;
+  return *this;
+}
+
+std::shared_ptr<const Matrix> ShapeYlmBasisCache::basis(
+    const ylm::Spherepack& ylm,
+    const std::array<DataVector, 3>& centered_coords) {
+  std::shared_ptr<const Entry> entry{};
+  {
+    const std::lock_guard lock(mutex_);
+    entry = entry_;
+  }
+  if (entry == nullptr or entry->centered_coords != centered_coords or
+      entry->l_max != ylm.l_max() or entry->m_max != ylm.m_max()) {
+    // Compute outside the lock so other threads can use the old entry
+    Matrix basis{};
+    ylm.interpolation_matrix(
+        make_not_null(&basis),
+        ylm.set_up_interpolation_info(cartesian_to_spherical(centered_coords)));
+    entry = std::make_shared<const Entry>(
+        Entry{centered_coords, ylm.l_max(), ylm.m_max(), std::move(basis)});
+    const std::lock_guard lock(mutex_);
+    entry_ = entry;
+  }
+  // Aliasing constructor, so the entry is kept alive while the basis is used
+  return {entry, &entry->basis};
+}
+}  // namespace detail
+
 template <typename T>
+auto Shape::cached_interpolation(
+    const ylm::Spherepack& ylm,
+    const gsl::not_null<detail::ShapeYlmBasisCache*> cache,
+    const std::array<T, 3>& centered_coords) const {
+  if constexpr (std::is_same_v<T, DataVector>) {
+    if (cache_ylm_basis_) {
+      return YlmInterpolation{cache->basis(ylm, centered_coords)};
+    }
+    return YlmInterpolation{ylm.set_up_interpolation_info(
+        cartesian_to_spherical(centered_coords))};
+  } else {
+    return ylm.set_up_interpolation_info(
+        cartesian_to_spherical(centered_coords));
+  }
+}
+
+void Shape::interpolate_from_coefs(const gsl::not_null<DataVector*> result,
+                                   const ylm::Spherepack& ylm,
+                                   const YlmInterpolation& interpolation,
+                                   const DataVector& coefs) {
+  if (const auto* interpolation_info =
+          std::get_if<ylm::Spherepack::InterpolationInfo<DataVector>>(
+              &interpolation);
+      interpolation_info != nullptr) {
+    if (result->size() != interpolation_info->size()) {
+      result->destructive_resize(interpolation_info->size());
+    }
+    ylm.interpolate_from_coefs(result, coefs, *interpolation_info);
+    return;
+  }
+  const auto& basis = std::get<std::shared_ptr<const Matrix>>(interpolation);
+  ASSERT(basis->columns() == ylm.spectral_size() and
+             coefs.size() == ylm.spectral_size(),
+         "Expected " << ylm.spectral_size() << " coefficients, but the basis "
+                     << "has " << basis->columns() << " columns and there are "
+                     << coefs.size() << " coefficients.");
+  (void)ylm;
+  if (result->size() != basis->rows()) {
+    result->destructive_resize(basis->rows());
+  }
+  if (basis->rows() == 0) {
+    return;
+  }
+  dgemv_('n', basis->rows(), basis->columns(), 1.0, basis->data(),
+         basis->spacing(), coefs.data(), 1, 0.0, result->data(), 1);
+}
+
+void Shape::interpolate_from_coefs(
+    const gsl::not_null<double*> result, const ylm::Spherepack& ylm,
+    const ylm::Spherepack::InterpolationInfo<double>& interpolation_info,
+    const DataVector& coefs) {
+  ylm.interpolate_from_coefs(result, coefs, interpolation_info);
+}
+
+template <typename T, typename Interpolation>
 void Shape::jacobian_helper(
     gsl::not_null<tnsr::Ij<T, 3, Frame::NoFrame>*> result,
-    const ylm::Spherepack::InterpolationInfo<T>& interpolation_info,
+    const Interpolation& interpolation,
     const DataVector& extended_coefs, const std::array<T, 3>& centered_coords,
     const T& radial_distortion, const T& one_over_radius,
     const T& transition_func_over_radius) const {
@@ -84,15 +186,19 @@ void Shape::jacobian_helper(
 
   // interpolate the cartesian gradient to the thetas and phis of the
   // `source_coords`
-  extended_ylm_.interpolate(make_not_null(&target_gradient_x),
-                            get<0>(cartesian_gradient).data(),
-                            interpolation_info);
-  extended_ylm_.interpolate(make_not_null(&target_gradient_y),
-                            get<1>(cartesian_gradient).data(),
-                            interpolation_info);
-  extended_ylm_.interpolate(make_not_null(&target_gradient_z),
-                            get<2>(cartesian_gradient).data(),
-                            interpolation_info);
+  DataVector gradient_coefs(extended_ylm_.spectral_size());
+  extended_ylm_.phys_to_spec(make_not_null(gradient_coefs.data()),
+                             get<0>(cartesian_gradient).data());
+  interpolate_from_coefs(make_not_null(&target_gradient_x), extended_ylm_,
+                         interpolation, gradient_coefs);
+  extended_ylm_.phys_to_spec(make_not_null(gradient_coefs.data()),
+                             get<1>(cartesian_gradient).data());
+  interpolate_from_coefs(make_not_null(&target_gradient_y), extended_ylm_,
+                         interpolation, gradient_coefs);
+  extended_ylm_.phys_to_spec(make_not_null(gradient_coefs.data()),
+                             get<2>(cartesian_gradient).data());
+  interpolate_from_coefs(make_not_null(&target_gradient_z), extended_ylm_,
+                         interpolation, gradient_coefs);
 
   auto transition_func_over_square_radius =
       transition_func_over_radius * one_over_radius;
@@ -201,6 +307,7 @@ Shape& Shape::operator=(const Shape& rhs) {
     extended_ylm_ = rhs.extended_ylm_;
     transition_func_ = rhs.transition_func_->get_clone();
   }
+  cache_ylm_basis_ = rhs.cache_ylm_basis_;
   return *this;
 }
 
@@ -210,22 +317,22 @@ template <typename T>
 std::array<tt::remove_cvref_wrap_t<T>, 3> Shape::operator()(
     const std::array<T, 3>& source_coords, const double time,
     const FunctionsOfTimeMap& functions_of_time) const {
+  using ReturnType = tt::remove_cvref_wrap_t<T>;
   const auto centered_coords = center_coordinates(source_coords);
-  auto theta_phis = cartesian_to_spherical(centered_coords);
-  const auto interpolation_info = ylm_.set_up_interpolation_info(theta_phis);
-  DataVector coefs = functions_of_time.at(shape_f_of_t_name_)->func(time)[0];
+  const auto interpolation = cached_interpolation(
+      ylm_, make_not_null(&ylm_basis_cache_), centered_coords);
+  DataVector coefs = FunctionsOfTime::cached_evaluate<1>(
+      *functions_of_time.at(shape_f_of_t_name_), time)[0];
   check_size(make_not_null(&coefs), functions_of_time, time, false);
   check_coefficients(coefs);
-  // re-use allocation
-  auto& radial_distortion = get<0>(theta_phis);
+  auto radial_distortion = make_with_value<ReturnType>(centered_coords[0], 0.0);
   // evaluate the spherical harmonic expansion at the angles of `source_coords`
-  ylm_.interpolate_from_coefs(make_not_null(&radial_distortion), coefs,
-                              interpolation_info);
+  interpolate_from_coefs(make_not_null(&radial_distortion), ylm_,
+                         interpolation, coefs);
 
   // this should be taken care of by the control system but is very hard to
   // debug
 #ifdef SPECTRE_DEBUG
-  using ReturnType = tt::remove_cvref_wrap_t<T>;
   const ReturnType shift_radii =
       radial_distortion * transition_func_->operator()(centered_coords) *
       check_and_compute_one_over_radius(centered_coords);
@@ -252,7 +359,8 @@ std::optional<std::array<double, 3>> Shape::inverse(
       center_coordinates(target_coords);
   const std::array<double, 2> theta_phis =
       cartesian_to_spherical(centered_coords);
-  DataVector coefs = functions_of_time.at(shape_f_of_t_name_)->func(time)[0];
+  DataVector coefs = FunctionsOfTime::cached_evaluate<1>(
+      *functions_of_time.at(shape_f_of_t_name_), time)[0];
   check_size(make_not_null(&coefs), functions_of_time, time, false);
   check_coefficients(coefs);
   const double radial_distortion =
@@ -271,16 +379,16 @@ std::array<tt::remove_cvref_wrap_t<T>, 3> Shape::frame_velocity(
     const std::array<T, 3>& source_coords, const double time,
     const FunctionsOfTimeMap& functions_of_time) const {
   const auto centered_coords = center_coordinates(source_coords);
-  auto theta_phis = cartesian_to_spherical(centered_coords);
-  const auto interpolation_info = ylm_.set_up_interpolation_info(theta_phis);
-  DataVector coef_derivs =
-      functions_of_time.at(shape_f_of_t_name_)->func_and_deriv(time)[1];
+  const auto interpolation = cached_interpolation(
+      ylm_, make_not_null(&ylm_basis_cache_), centered_coords);
+  DataVector coef_derivs = FunctionsOfTime::cached_evaluate<2>(
+      *functions_of_time.at(shape_f_of_t_name_), time)[1];
   check_size(make_not_null(&coef_derivs), functions_of_time, time, true);
   check_coefficients(coef_derivs);
-  // re-use allocation
-  auto& radii_velocities = get<0>(theta_phis);
-  ylm_.interpolate_from_coefs(make_not_null(&radii_velocities), coef_derivs,
-                              interpolation_info);
+  auto radii_velocities = make_with_value<tt::remove_cvref_wrap_t<T>>(
+      centered_coords[0], 0.0);
+  interpolate_from_coefs(make_not_null(&radii_velocities), ylm_,
+                         interpolation, coef_derivs);
   return -centered_coords * radii_velocities *
          transition_func_->operator()(centered_coords) *
          check_and_compute_one_over_radius(centered_coords);
@@ -290,20 +398,19 @@ template <typename T>
 tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> Shape::jacobian(
     const std::array<T, 3>& source_coords, const double time,
     const FunctionsOfTimeMap& functions_of_time) const {
+  using ReturnType = tt::remove_cvref_wrap_t<T>;
   const auto centered_coords = center_coordinates(source_coords);
 
-  // The distorted radii are calculated analogously to the call operator
-  auto theta_phis = cartesian_to_spherical(centered_coords);
-
   // The Cartesian gradient cannot be represented exactly by `l_max_` and
   // `m_max_` which causes an aliasing error. We need an additional order to
   // represent it. This is in theory not needed for the radial_distortion
-  // calculation but saves calculating the `interpolation_info` twice.
-  const auto interpolation_info =
-      extended_ylm_.set_up_interpolation_info(theta_phis);
+  // calculation but saves setting up the interpolation twice.
+  const auto extended_interpolation = cached_interpolation(
+      extended_ylm_, make_not_null(&extended_ylm_basis_cache_),
+      centered_coords);
 
-  const DataVector coefs =
-      functions_of_time.at(shape_f_of_t_name_)->func(time)[0];
+  const DataVector coefs = FunctionsOfTime::cached_evaluate<1>(
+      *functions_of_time.at(shape_f_of_t_name_), time)[0];
   check_coefficients(coefs);
   DataVector extended_coefs(extended_ylm_.spectral_size(), 0.);
 
@@ -322,12 +429,11 @@ tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> Shape::jacobian(
   }
   check_size(make_not_null(&extended_coefs), functions_of_time, time, false);
 
-  // Re-use allocation
-  auto& radial_distortion = get<0>(theta_phis);
-  extended_ylm_.interpolate_from_coefs(make_not_null(&radial_distortion),
-                                       extended_coefs, interpolation_info);
+  // The distorted radii are calculated analogously to the call operator
+  auto radial_distortion = make_with_value<ReturnType>(centered_coords[0], 0.0);
+  interpolate_from_coefs(make_not_null(&radial_distortion), extended_ylm_,
+                         extended_interpolation, extended_coefs);
 
-  using ReturnType = tt::remove_cvref_wrap_t<T>;
   const ReturnType one_over_radius =
       check_and_compute_one_over_radius(centered_coords);
   const ReturnType transition_func_over_radius =
@@ -335,9 +441,9 @@ tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> Shape::jacobian(
   tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> result(
       get_size(centered_coords[0]));
 
-  jacobian_helper(make_not_null(&result), interpolation_info, extended_coefs,
-                  centered_coords, radial_distortion, one_over_radius,
-                  transition_func_over_radius);
+  jacobian_helper(make_not_null(&result), extended_interpolation,
+                  extended_coefs, centered_coords, radial_distortion,
+                  one_over_radius, transition_func_over_radius);
   return result;
 }
 
@@ -369,15 +475,12 @@ void Shape::coords_frame_velocity_jacobian(
   center_coordinates(make_not_null(&centered_coords),
                      *source_and_target_coords);
 
-  std::array<DataVector, 2> theta_phis{};
-  theta_phis[0].set_data_ref(&get<0, 0>(*jac));
-  theta_phis[1].set_data_ref(&get<0, 1>(*jac));
-  cartesian_to_spherical(make_not_null(&theta_phis), centered_coords);
-  const auto interpolation_info =
-      extended_ylm_.set_up_interpolation_info(theta_phis);
+  const auto extended_interpolation = cached_interpolation(
+      extended_ylm_, make_not_null(&extended_ylm_basis_cache_),
+      centered_coords);
 
-  const auto [coefs, coef_derivs] =
-      functions_of_time.at(shape_f_of_t_name_)->func_and_deriv(time);
+  const auto [coefs, coef_derivs] = FunctionsOfTime::cached_evaluate<2>(
+      *functions_of_time.at(shape_f_of_t_name_), time);
   DataVector extended_coefs_derivs(extended_ylm_.spectral_size(), 0.);
   DataVector extended_coefs(extended_ylm_.spectral_size(), 0.);
 
@@ -401,8 +504,8 @@ void Shape::coords_frame_velocity_jacobian(
   auto& radial_distortion = get(get<::Tags::TempScalar<0>>(temps));
   // evaluate the spherical harmonic expansion at the angles of
   // `source_coords`
-  extended_ylm_.interpolate_from_coefs(make_not_null(&radial_distortion),
-                                       extended_coefs, interpolation_info);
+  interpolate_from_coefs(make_not_null(&radial_distortion), extended_ylm_,
+                         extended_interpolation, extended_coefs);
 
   auto& one_over_radius = get(get<::Tags::TempScalar<1>>(temps));
   one_over_radius = check_and_compute_one_over_radius(centered_coords);
@@ -414,15 +517,15 @@ void Shape::coords_frame_velocity_jacobian(
       centered_coords * (1. - radial_distortion * transition_func_over_radius);
 
   auto& radii_velocities = get<0, 1>(*jac);
-  extended_ylm_.interpolate_from_coefs(make_not_null(&radii_velocities),
-                                       extended_coefs_derivs,
-                                       interpolation_info);
+  interpolate_from_coefs(make_not_null(&radii_velocities), extended_ylm_,
+                         extended_interpolation, extended_coefs_derivs);
   *frame_vel =
       -centered_coords * radii_velocities * transition_func_over_radius;
 
-  jacobian_helper<DataVector>(jac, interpolation_info, extended_coefs,
-                              centered_coords, radial_distortion,
-                              one_over_radius, transition_func_over_radius);
+  jacobian_helper<DataVector>(jac, extended_interpolation,
+                              extended_coefs, centered_coords,
+                              radial_distortion, one_over_radius,
+                              transition_func_over_radius);
 }
 
 template <typename T>
@@ -461,11 +564,12 @@ void Shape::check_size(const gsl::not_null<DataVector*>& coefs,
         std::numeric_limits<double>::signaling_NaN();
     if (use_deriv) {
       l0m0_spherical_harmonic_coef =
-          functions_of_time.at(size_f_of_t_name_.value())
-              ->func_and_deriv(time)[1][0];
+          FunctionsOfTime::cached_evaluate_components<2, 1>(
+              *functions_of_time.at(size_f_of_t_name_.value()), time)[1][0];
     } else {
       l0m0_spherical_harmonic_coef =
-          functions_of_time.at(size_f_of_t_name_.value())->func(time)[0][0];
+          FunctionsOfTime::cached_evaluate_components<1, 1>(
+              *functions_of_time.at(size_f_of_t_name_.value()), time)[0][0];
     }
 
     // Size holds the *actual* \lambda_00 spherical harmonic coefficient, but
@@ -508,7 +612,7 @@ bool operator==(const Shape& lhs, const Shape& rhs) {
 bool operator!=(const Shape& lhs, const Shape& rhs) { return not(lhs == rhs); }
 
 void Shape::pup(PUP::er& p) {
-  size_t version = 0;
+  size_t version = 1;
   p | version;
   // Remember to increment the version number when making changes to this
   // function. Retain support for unpacking data written by previous versions
@@ -521,6 +625,11 @@ void Shape::pup(PUP::er& p) {
     p | size_f_of_t_name_;
     p | transition_func_;
   }
+  if (version >= 1) {
+    p | cache_ylm_basis_;
+  } else if (p.isUnpacking()) {
+    cache_ylm_basis_ = false;
+  }
 
   // No need to pup these because they are uniquely determined by other members
   if (p.isUnpacking()) {
@@ -3,12 +3,17 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_set>
+#include <variant>
 
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/ShapeMapTransitionFunctions/ShapeMapTransitionFunction.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Spherepack.hpp"
@@ -26,6 +31,52 @@ class er;
 
 namespace domain::CoordinateMaps::TimeDependent {
 
+namespace detail {
+/*!
+ * \brief Caches the values of the spherical harmonic basis functions at the
+ * angles of the last set of `DataVector` coordinates passed to a shape map
+ * that is owned by a single element.
+ *
+ * \details The basis is stored as a `Matrix` with one row per point and one
+ * column per entry of the `ylm::Spherepack` coefficient buffer, so that
+ * interpolating coefficients to the points is a single matrix-vector product.
+ * Columns of buffer entries that don't hold a coefficient are zero (see
+ * `ylm::Spherepack::interpolation_matrix`). The basis only depends on the
+ * angles of the points, and an element passes the same (grid-frame)
+ * coordinates to the shape map on every evaluation until the element is
+ * refined. The cached basis is reused if the coordinates are identical to the
+ * cached ones, and is recomputed otherwise. Comparing the coordinates is much
+ * cheaper than computing the angles and the basis. The cache is protected by a
+ * mutex, so a map shared between threads stays correct. Copies of the cache
+ * start out empty.
+ */
+class ShapeYlmBasisCache {
+ public:
+  ShapeYlmBasisCache() = default;
+  ~ShapeYlmBasisCache() = default;
+  ShapeYlmBasisCache(const ShapeYlmBasisCache& /*rhs*/) {}
+  ShapeYlmBasisCache(ShapeYlmBasisCache&& /*rhs*/) {}
+  ShapeYlmBasisCache& operator=(const ShapeYlmBasisCache& rhs);
+  ShapeYlmBasisCache& operator=(ShapeYlmBasisCache&& rhs);
+
+  /// The basis functions of `ylm` at the angles of `centered_coords`
+  std::shared_ptr<const Matrix> basis(
+      const ylm::Spherepack& ylm,
+      const std::array<DataVector, 3>& centered_coords);
+
+ private:
+  struct Entry {
+    std::array<DataVector, 3> centered_coords;
+    size_t l_max;
+    size_t m_max;
+    Matrix basis;
+  };
+
+  std::mutex mutex_{};
+  std::shared_ptr<const Entry> entry_{};
+};
+}  // namespace detail
+
 /*!
  * \ingroup CoordMapsTimeDependentGroup
  * \brief Distorts a distribution of points radially according to a spherical
@@ -190,13 +241,21 @@ namespace domain::CoordinateMaps::TimeDependent {
  *
  * The inverse Jacobian is computed by numerically inverting the Jacobian.
  *
- * For future optimization, the `interpolation_info` objects calculated in all
- * functions of this class could be cached. Since every element should evaluate
- * the same grid coordinates most time steps, this might greatly decrease
- * computation. Every element has their own clone of the shape map so the
- * caching could be done with member variables. Care must be taken that
- * `jacobian` currently calculates the `interpolation_info` with an order
- * higher.
+ * ### Caching
+ *
+ * A map owned by a single element can cache the values of the spherical
+ * harmonic basis functions at the angles of `DataVector` coordinates (see
+ * `detail::ShapeYlmBasisCache`). The element evaluates the map at the same
+ * grid coordinates until it is refined, so each evaluation only has to
+ * multiply the cached basis with the current coefficients. Caching is off by
+ * default, because maps shared by many callers (like the maps of a `Block`)
+ * are evaluated at different points on every call, and is turned on by
+ * `enable_element_cache` (see `domain::CoordinateMapBase::get_element_clone`).
+ * There are separate caches for `l_max` (used by the call operator and
+ * `frame_velocity`) and `l_max + 1` (used by `jacobian` and
+ * `coords_frame_velocity_jacobian`). Whether to cache is copied and
+ * serialized, the cached basis is not. Uncached and pointwise (`double`)
+ * evaluations set up the Spherepack interpolation at the points instead.
  */
 class Shape {
  public:
@@ -260,6 +319,11 @@ class Shape {
   static bool is_identity() { return false; }
   static constexpr size_t dim = 3;
 
+  /// Cache the spherical harmonic basis at the `DataVector` coordinates the
+  /// map is evaluated at. Only enable this for a map owned by a single
+  /// element, which evaluates the map at the same coordinates every time.
+  void enable_element_cache() { cache_ylm_basis_ = true; }
+
   const std::unordered_set<std::string>& function_of_time_names() const {
     return f_of_t_names_;
   }
@@ -275,6 +339,32 @@ class Shape {
   ylm::Spherepack extended_ylm_{3, 3};
   std::unique_ptr<ShapeMapTransitionFunctions::ShapeMapTransitionFunction>
       transition_func_;
+  bool cache_ylm_basis_ = false;
+  mutable detail::ShapeYlmBasisCache ylm_basis_cache_{};
+  mutable detail::ShapeYlmBasisCache extended_ylm_basis_cache_{};
+
+  using YlmInterpolation =
+      std::variant<std::shared_ptr<const Matrix>,
+                   ylm::Spherepack::InterpolationInfo<DataVector>>;
+
+  // What is needed to interpolate coefficients of `ylm` to the angles of
+  // `centered_coords`. For `DataVector`s this is the basis taken from `cache`
+  // if `cache_ylm_basis_` is set, otherwise (and for `double`s) the Spherepack
+  // interpolation info.
+  template <typename T>
+  auto cached_interpolation(const ylm::Spherepack& ylm,
+                            gsl::not_null<detail::ShapeYlmBasisCache*> cache,
+                            const std::array<T, 3>& centered_coords) const;
+
+  // Interpolate the `coefs` of `ylm` with the result of `cached_interpolation`
+  static void interpolate_from_coefs(gsl::not_null<DataVector*> result,
+                                     const ylm::Spherepack& ylm,
+                                     const YlmInterpolation& interpolation,
+                                     const DataVector& coefs);
+  static void interpolate_from_coefs(
+      gsl::not_null<double*> result, const ylm::Spherepack& ylm,
+      const ylm::Spherepack::InterpolationInfo<double>& interpolation_info,
+      const DataVector& coefs);
 
   template <typename T>
   std::array<tt::remove_cvref_wrap_t<T>, 3> center_coordinates(
@@ -292,10 +382,10 @@ class Shape {
     }
   }
 
-  template <typename T>
+  template <typename T, typename Interpolation>
   void jacobian_helper(
       gsl::not_null<tnsr::Ij<T, 3, Frame::NoFrame>*> result,
-      const ylm::Spherepack::InterpolationInfo<T>& interpolation_info,
+      const Interpolation& interpolation,
       const DataVector& extended_coefs, const std::array<T, 3>& centered_coords,
       const T& radial_distortion, const T& one_over_radius,
       const T& transition_func_over_radius) const;
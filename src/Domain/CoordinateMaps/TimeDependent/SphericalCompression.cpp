@@ -19,6 +19,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/SnapshotCache.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -37,8 +38,9 @@ double lambda00_y00(
     const std::unordered_map<
         std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
         functions_of_time) {
-  return functions_of_time.at(f_of_t_name)->func(time)[0][0] * 0.25 *
-         M_2_SQRTPI;
+  return domain::FunctionsOfTime::cached_evaluate_components<1, 1>(
+             *functions_of_time.at(f_of_t_name), time)[0][0] *
+         0.25 * M_2_SQRTPI;
 }
 
 // Evaluate \f$\lambda_{00}^{\prime}(t) / sqrt{4\pi}\f$.
@@ -47,8 +49,9 @@ double dt_lambda00_y00(
     const std::unordered_map<
         std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
         functions_of_time) {
-  return functions_of_time.at(f_of_t_name)->func_and_deriv(time)[1][0] * 0.25 *
-         M_2_SQRTPI;
+  return domain::FunctionsOfTime::cached_evaluate_components<2, 1>(
+             *functions_of_time.at(f_of_t_name), time)[1][0] *
+         0.25 * M_2_SQRTPI;
 }
 
 // Evaluate \f$\rho^i = \xi^i - C^i\f$ or \f$r^i = x^i - C^i\f$.
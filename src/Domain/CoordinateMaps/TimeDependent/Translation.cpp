@@ -14,6 +14,7 @@
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Identity.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/SnapshotCache.hpp"
 #include "NumericalAlgorithms/RootFinding/QuadraticEquation.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
 #include "PointwiseFunctions/MathFunctions/MathFunction.hpp"
@@ -100,13 +101,9 @@ std::optional<std::array<double, Dim>> Translation<Dim>::inverse(
   for (size_t i = 0; i < Dim; i++) {
     gsl::at(result, i) = gsl::at(target_coords, i);
   }
-  const DataVector function_of_time =
-      functions_of_time.at(f_of_t_name_)->func(time)[0];
-  ASSERT(function_of_time.size() == Dim,
-         "The dimension of the function of time ("
-             << function_of_time.size()
-             << ") does not match the dimension of the translation map (" << Dim
-             << ").");
+  const std::array<double, Dim> function_of_time =
+      FunctionsOfTime::cached_evaluate_components<1, Dim>(
+          *functions_of_time.at(f_of_t_name_), time)[0];
   // If an inner radius specified then take the inverse of the
   // piecewise specific translation.
   if (inner_radius_.has_value()) {
@@ -206,8 +203,9 @@ Translation<Dim>::jacobian(
   // translation.
   if (inner_radius_.has_value()) {
     const tt::remove_cvref_wrap_t<T> radius = magnitude(source_coords);
-    const DataVector function_of_time =
-        functions_of_time.at(f_of_t_name_)->func(time)[0];
+    const std::array<double, Dim> function_of_time =
+        FunctionsOfTime::cached_evaluate_components<1, Dim>(
+            *functions_of_time.at(f_of_t_name_), time)[0];
     auto result = make_with_value<
         tnsr::Ij<tt::remove_cvref_wrap_t<T>, Dim, Frame::NoFrame>>(
         dereference_wrapper(source_coords[0]), 0.0);
@@ -242,8 +240,9 @@ Translation<Dim>::jacobian(
             gsl::at(source_coords, i) - gsl::at(center_, i);
       }
       const tt::remove_cvref_wrap_t<T> radius = magnitude(distance_to_center);
-      const DataVector function_of_time =
-          functions_of_time.at(f_of_t_name_)->func(time)[0];
+      const std::array<double, Dim> function_of_time =
+          FunctionsOfTime::cached_evaluate_components<1, Dim>(
+              *functions_of_time.at(f_of_t_name_), time)[0];
 
       auto result = make_with_value<
           tnsr::Ij<tt::remove_cvref_wrap_t<T>, Dim, Frame::NoFrame>>(
@@ -297,14 +296,10 @@ Translation<Dim>::math_function_helper(
         std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
         functions_of_time,
     const size_t function_or_deriv_index) const {
-  const DataVector func_or_deriv_of_time =
-      gsl::at(functions_of_time.at(f_of_t_name_)->func_and_deriv(time),
+  const std::array<double, Dim> func_or_deriv_of_time =
+      gsl::at(FunctionsOfTime::cached_evaluate_components<2, Dim>(
+                  *functions_of_time.at(f_of_t_name_), time),
               function_or_deriv_index);
-  ASSERT(func_or_deriv_of_time.size() == Dim,
-         "The dimension of the function of time ("
-             << func_or_deriv_of_time.size()
-             << ") does not match the dimension of the translation map (" << Dim
-             << ").");
   std::array<tt::remove_cvref_wrap_t<T>, Dim> result{};
   // sizing the result and getting the radial function value
   for (size_t i = 0; i < Dim; i++) {
@@ -335,14 +330,10 @@ std::array<tt::remove_cvref_wrap_t<T>, Dim> Translation<Dim>::piecewise_helper(
         std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
         functions_of_time,
     const size_t function_or_deriv_index) const {
-  const DataVector func_or_deriv_of_time =
-      gsl::at(functions_of_time.at(f_of_t_name_)->func_and_deriv(time),
+  const std::array<double, Dim> func_or_deriv_of_time =
+      gsl::at(FunctionsOfTime::cached_evaluate_components<2, Dim>(
+                  *functions_of_time.at(f_of_t_name_), time),
               function_or_deriv_index);
-  ASSERT(func_or_deriv_of_time.size() == Dim,
-         "The dimension of the function of time ("
-             << func_or_deriv_of_time.size()
-             << ") does not match the dimension of the translation map (" << Dim
-             << ").");
   std::array<tt::remove_cvref_wrap_t<T>, Dim> result{};
   // sizing the result and getting the radial function value
   for (size_t i = 0; i < Dim; i++) {
@@ -20,9 +20,23 @@ struct Inertial;
 struct BlockLogical;
 }  // namespace Frame
 
+namespace {
+template <size_t VolumeDim>
+std::vector<domain::BlockBoundingBox<VolumeDim>> compute_block_bounding_boxes(
+    const std::vector<Block<VolumeDim>>& blocks) {
+  std::vector<domain::BlockBoundingBox<VolumeDim>> result{};
+  result.reserve(blocks.size());
+  for (const auto& block : blocks) {
+    result.push_back(domain::grid_frame_bounding_box(block));
+  }
+  return result;
+}
+}  // namespace
+
 template <size_t VolumeDim>
 Domain<VolumeDim>::Domain(std::vector<Block<VolumeDim>> blocks)
-    : blocks_(std::move(blocks)) {}
+    : blocks_(std::move(blocks)),
+      block_bounding_boxes_(compute_block_bounding_boxes(blocks_)) {}
 
 template <size_t VolumeDim>
 Domain<VolumeDim>::Domain(
@@ -46,6 +60,7 @@ Domain<VolumeDim>::Domain(
                          std::move(neighbors_of_all_blocks[i]),
                          block_names.empty() ? "" : block_names[i]);
   }
+  block_bounding_boxes_ = compute_block_bounding_boxes(blocks_);
 }
 
 template <size_t VolumeDim>
@@ -81,6 +96,7 @@ Domain<VolumeDim>::Domain(
                          std::move(neighbors_of_all_blocks[i]),
                          block_names.empty() ? "" : block_names[i]);
   }
+  block_bounding_boxes_ = compute_block_bounding_boxes(blocks_);
 }
 
 template <size_t VolumeDim>
@@ -173,6 +189,11 @@ void Domain<VolumeDim>::pup(PUP::er& p) {
   if (version >= 1) {
     p | block_groups_;
   }
+  // The bounding boxes are derived from the blocks, so they don't need to be
+  // serialized.
+  if (p.isUnpacking()) {
+    block_bounding_boxes_ = compute_block_bounding_boxes(blocks_);
+  }
 }
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "Domain/Block.hpp"
+#include "Domain/BlockBoundingBox.hpp"
 #include "Domain/DomainHelpers.hpp"
 #include "Domain/ExcisionSphere.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -210,6 +211,16 @@ class Domain {
   /// The block names in the current domain.
   std::vector<std::string> block_names() const;
 
+  /// \brief Boxes enclosing each block in the grid frame, indexed by block
+  /// id. For time-independent blocks this is also the inertial frame.
+  ///
+  /// These are not serialized but recomputed when the domain is unpacked.
+  /// \see domain::grid_frame_bounding_box
+  const std::vector<domain::BlockBoundingBox<VolumeDim>>&
+  block_bounding_boxes() const {
+    return block_bounding_boxes_;
+  }
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p);
 
@@ -219,6 +230,7 @@ class Domain {
       excision_spheres_{};
   std::unordered_map<std::string, std::unordered_set<std::string>>
       block_groups_{};
+  std::vector<domain::BlockBoundingBox<VolumeDim>> block_bounding_boxes_{};
 };
 
 template <size_t VolumeDim>
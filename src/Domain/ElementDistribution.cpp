@@ -3,11 +3,13 @@
 
 #include "Domain/ElementDistribution.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <functional>
 #include <optional>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -23,6 +25,7 @@
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Structure/SegmentId.hpp"
 #include "Domain/Structure/ZCurve.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -75,6 +78,24 @@ double get_num_points_and_grid_spacing_cost(
 
   return mesh.number_of_grid_points() / sqrt(min_grid_spacing);
 }
+
+// The Morton index of the lower corner of the element on a grid refined to
+// `finest_level` in every dimension. The bits of the first dimension are the
+// least significant.
+template <size_t Dim>
+size_t z_curve_index_at_level(const ElementId<Dim>& element_id,
+                              const size_t finest_level) {
+  size_t result = 0;
+  for (size_t d = 0; d < Dim; ++d) {
+    const SegmentId& segment_id = element_id.segment_id(d);
+    const size_t fine_index = segment_id.index()
+                              << (finest_level - segment_id.refinement_level());
+    for (size_t bit = 0; bit < finest_level; ++bit) {
+      result |= ((fine_index >> bit) & 1_st) << (bit * Dim + d);
+    }
+  }
+  return result;
+}
 }  //  namespace
 
 std::ostream& operator<<(std::ostream& os, ElementWeight weight) {
@@ -317,6 +338,89 @@ size_t BlockZCurveProcDistribution<Dim>::get_proc_for_element(
       "of BlockZCurveProcDistribution.");
 }
 
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, size_t> z_curve_proc_distribution(
+    const std::unordered_map<ElementId<Dim>, double>& element_costs,
+    const size_t number_of_procs_with_elements,
+    const std::unordered_set<size_t>& global_procs_to_ignore) {
+  ASSERT(
+      number_of_procs_with_elements > 0,
+      "Must have a non-zero number of processors to distribute elements to.");
+
+  // Order the elements along the curve. The order (and the floating-point
+  // sums below) must not depend on the iteration order of `element_costs`,
+  // so that every caller computes the same distribution.
+  std::vector<size_t> finest_level_by_block{};
+  for (const auto& [element_id, cost] : element_costs) {
+    if (element_id.block_id() >= finest_level_by_block.size()) {
+      finest_level_by_block.resize(element_id.block_id() + 1, 0);
+    }
+    for (const size_t level : element_id.refinement_levels()) {
+      finest_level_by_block[element_id.block_id()] =
+          std::max(finest_level_by_block[element_id.block_id()], level);
+    }
+  }
+  std::vector<std::tuple<size_t, size_t, ElementId<Dim>, double>>
+      ordered_elements{};
+  ordered_elements.reserve(element_costs.size());
+  for (const auto& [element_id, cost] : element_costs) {
+    ordered_elements.emplace_back(
+        element_id.block_id(),
+        z_curve_index_at_level(element_id,
+                               finest_level_by_block[element_id.block_id()]),
+        element_id, cost);
+  }
+  alg::sort(ordered_elements, [](const auto& lhs, const auto& rhs) {
+    return std::pair{std::get<0>(lhs), std::get<1>(lhs)} <
+           std::pair{std::get<0>(rhs), std::get<1>(rhs)};
+  });
+
+  double total_cost = 0.0;
+  for (const auto& element : ordered_elements) {
+    total_cost += std::get<3>(element);
+  }
+  const bool uniform_cost = total_cost <= 0.0;
+  if (uniform_cost) {
+    total_cost = static_cast<double>(ordered_elements.size());
+  }
+
+  std::unordered_map<ElementId<Dim>, size_t> result{};
+  size_t element_index = 0;
+  double cost_remaining = total_cost;
+  size_t global_proc_number = 0;
+  for (size_t i = 0; i < number_of_procs_with_elements; ++i) {
+    while (global_procs_to_ignore.count(global_proc_number) != 0) {
+      ++global_proc_number;
+    }
+    // Same as in `BlockZCurveProcDistribution`: the target is updated for every
+    // proc, elements are added while that brings the cost on the proc closer
+    // to the target, and the last proc gets all remaining elements.
+    const double target_cost_per_proc =
+        cost_remaining / static_cast<double>(number_of_procs_with_elements - i);
+    const bool last_proc = i + 1 == number_of_procs_with_elements;
+    double cost_spent_on_proc = 0.0;
+    size_t elements_on_proc = 0;
+    while (element_index < ordered_elements.size()) {
+      const ElementId<Dim>& element_id =
+          std::get<2>(ordered_elements[element_index]);
+      const double element_cost =
+          uniform_cost ? 1.0 : std::get<3>(ordered_elements[element_index]);
+      if (not last_proc and elements_on_proc > 0 and
+          abs(target_cost_per_proc - cost_spent_on_proc) <=
+              abs(target_cost_per_proc - (cost_spent_on_proc + element_cost))) {
+        break;
+      }
+      result.emplace(element_id, global_proc_number);
+      cost_spent_on_proc += element_cost;
+      cost_remaining -= element_cost;
+      ++elements_on_proc;
+      ++element_index;
+    }
+    ++global_proc_number;
+  }
+  return result;
+}
+
 #define GET_DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATION(r, data)                                               \
@@ -335,7 +439,13 @@ size_t BlockZCurveProcDistribution<Dim>::get_proc_for_element(
           initial_refinement_levels,                                         \
       const std::vector<std::array<size_t, GET_DIM(data)>>& initial_extents, \
       ElementWeight element_weight,                                          \
-      const std::optional<Spectral::Quadrature>& quadrature);
+      const std::optional<Spectral::Quadrature>& quadrature);                \
+  template std::unordered_map<ElementId<GET_DIM(data)>, size_t>              \
+  z_curve_proc_distribution(                                                 \
+      const std::unordered_map<ElementId<GET_DIM(data)>, double>&            \
+          element_costs,                                                     \
+      size_t number_of_procs_with_elements,                                  \
+      const std::unordered_set<size_t>& global_procs_to_ignore);
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
@@ -174,6 +174,34 @@ struct BlockZCurveProcDistribution {
   std::vector<std::vector<std::pair<size_t, size_t>>>
       block_element_distribution_;
 };
+
+/*!
+ * \brief Assign each element in `element_costs` to a processor so that the
+ * total cost per processor is balanced along a Morton curve
+ *
+ * \details This is the same cost-balancing algorithm as
+ * `BlockZCurveProcDistribution`, but the elements do not need to be the
+ * initial elements of the domain. This makes it suitable for redistributing
+ * elements after AMR has changed the refinement within a block, using costs
+ * that were measured at runtime rather than estimated.
+ *
+ * Elements are ordered by block and within each block by the Morton index of
+ * their lower corner at the finest refinement level present in the block. For
+ * elements that are leaves of a refinement tree this is a valid space-filling
+ * curve, since each element covers a contiguous range of the finest curve. For
+ * isotropically refined blocks the order is the same as that of
+ * `z_curve_index()`.
+ *
+ * If all costs are zero, for example because no costs were measured yet, every
+ * element is given the same cost.
+ *
+ * \returns the global processor number of each element
+ */
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, size_t> z_curve_proc_distribution(
+    const std::unordered_map<ElementId<Dim>, double>& element_costs,
+    size_t number_of_procs_with_elements,
+    const std::unordered_set<size_t>& global_procs_to_ignore = {});
 }  // namespace domain
 
 namespace element_weight_detail {
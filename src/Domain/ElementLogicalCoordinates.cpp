@@ -3,6 +3,7 @@
 
 #include "Domain/ElementLogicalCoordinates.hpp"
 
+#include <algorithm>
 #include <array>
 #include <memory>
 #include <unordered_map>
@@ -15,7 +16,9 @@
 #include "Domain/BlockLogicalCoordinates.hpp"
 #include "Domain/Structure/BlockId.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
 #include "Domain/Structure/Side.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
@@ -55,6 +58,69 @@ bool segment_contains(const double x_block_logical,
   return (x_block_logical >= lower_bound_block_logical and
           x_block_logical < upper_bound_block_logical);
 }
+
+// The segment on the `refinement_level` that contains the point in the sense
+// of `segment_contains`, if the point is in the block
+SegmentId containing_segment(const double x_block_logical,
+                             const size_t refinement_level) {
+  const size_t number_of_segments = two_to_the(refinement_level);
+  const double scaled_x =
+      0.5 * (x_block_logical + 1.0) * static_cast<double>(number_of_segments);
+  size_t index = 0;
+  if (scaled_x > 0.0) {
+    index = std::min(static_cast<size_t>(scaled_x), number_of_segments - 1);
+  }
+  // Correct for roundoff in the scaling
+  const SegmentId segment{refinement_level, index};
+  if (index > 0 and x_block_logical < segment.endpoint(Side::Lower)) {
+    --index;
+  } else if (index + 1 < number_of_segments and
+             x_block_logical >= segment.endpoint(Side::Upper)) {
+    ++index;
+  }
+  return {refinement_level, index};
+}
+
+template <size_t Dim>
+bool element_contains(
+    const tnsr::I<double, Dim, Frame::BlockLogical>& x_block_logical,
+    const ElementId<Dim>& element_id) {
+  for (size_t d = 0; d < Dim; ++d) {
+    const double up = element_id.segment_id(d).endpoint(Side::Upper);
+    const double lo = element_id.segment_id(d).endpoint(Side::Lower);
+    if (not segment_contains(x_block_logical.get(d), lo, up)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Put the intermediate results into the final data structure, now that we know
+// how many points are in each element.
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>
+collect_element_logical_coordinates(
+    const std::vector<ElementId<Dim>>& element_ids,
+    const std::vector<std::array<std::vector<double>, Dim>>& x_element_logical,
+    const std::vector<std::vector<size_t>>& offsets) {
+  std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>> result;
+  for (size_t index = 0; index < element_ids.size(); ++index) {
+    const size_t num_grid_pts = x_element_logical[index][0].size();
+    if (num_grid_pts > 0) {
+      tnsr::I<DataVector, Dim, Frame::ElementLogical> tmp(num_grid_pts);
+      std::vector<size_t> off(num_grid_pts);
+      for (size_t s = 0; s < num_grid_pts; ++s) {
+        for (size_t d = 0; d < Dim; ++d) {
+          tmp.get(d)[s] = gsl::at(x_element_logical[index], d)[s];
+        }
+        off[s] = offsets[index][s];
+      }
+      result.emplace(element_ids[index], ElementLogicalCoordHolder<Dim>{
+                                             std::move(tmp), std::move(off)});
+    }
+  }
+  return result;
+}
 }  // namespace
 
 template <size_t Dim>
@@ -91,17 +157,7 @@ element_logical_coordinates(
           continue;
         }
         // Disambiguate points on shared element boundaries
-        bool is_contained = true;
-        for (size_t d = 0; d < Dim; ++d) {
-          const double up = element_id.segment_id(d).endpoint(Side::Upper);
-          const double lo = element_id.segment_id(d).endpoint(Side::Lower);
-          const double x_block_log = x_block_logical.get(d);
-          if (not segment_contains(x_block_log, lo, up)) {
-            is_contained = false;
-            break;
-          }
-        }
-        if (is_contained) {
+        if (element_contains(x_block_logical, element_id)) {
           for (size_t d = 0; d < Dim; ++d) {
             gsl::at(x_element_logical[index], d).push_back(x_elem->get(d));
           }
@@ -114,27 +170,86 @@ element_logical_coordinates(
     }
   }
 
-  // Now we know how many points are in each element, so we can
-  // put the intermediate results into the final data structure.
-  std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>> result;
-  for (size_t index = 0; index < element_ids.size(); ++index) {
-    const size_t num_grid_pts = x_element_logical[index][0].size();
-    if (num_grid_pts > 0) {
-      tnsr::I<DataVector, Dim, Frame::ElementLogical> tmp(num_grid_pts);
-      std::vector<size_t> off(num_grid_pts);
-      for (size_t s = 0; s < num_grid_pts; ++s) {
-        for (size_t d = 0; d < Dim; ++d) {
-          tmp.get(d)[s] = gsl::at(x_element_logical[index], d)[s];
-        }
-        off[s] = offsets[index][s];
-      }
-      result.emplace(element_ids[index], ElementLogicalCoordHolder<Dim>{
-                                             std::move(tmp), std::move(off)});
+  return collect_element_logical_coordinates(element_ids, x_element_logical,
+                                             offsets);
+}
+
+template <size_t Dim>
+ElementIndex<Dim>::ElementIndex(std::vector<ElementId<Dim>> element_ids)
+    : element_ids_(std::move(element_ids)) {
+  for (size_t index = 0; index < element_ids_.size(); ++index) {
+    const auto& element_id = element_ids_[index];
+    // Keep the first of repeated element IDs
+    positions_.emplace(element_id, index);
+    if (element_id.block_id() >= refinements_.size()) {
+      refinements_.resize(element_id.block_id() + 1);
+    }
+    auto& block_refinements = refinements_[element_id.block_id()];
+    std::pair<std::array<size_t, Dim>, size_t> refinement{
+        element_id.refinement_levels(), element_id.grid_index()};
+    if (std::find(block_refinements.begin(), block_refinements.end(),
+                  refinement) == block_refinements.end()) {
+      block_refinements.push_back(std::move(refinement));
+    }
+  }
+}
+
+template <size_t Dim>
+std::optional<size_t> ElementIndex<Dim>::find(
+    const domain::BlockId& block_id,
+    const tnsr::I<double, Dim, Frame::BlockLogical>& x_block_logical) const {
+  const size_t block = block_id.get_index();
+  if (block >= refinements_.size()) {
+    return std::nullopt;
+  }
+  std::optional<size_t> result{};
+  for (const auto& [refinement_levels, grid_index] : refinements_[block]) {
+    std::array<SegmentId, Dim> segment_ids{};
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(segment_ids, d) = containing_segment(
+          x_block_logical.get(d), gsl::at(refinement_levels, d));
+    }
+    const auto position =
+        positions_.find(ElementId<Dim>{block, segment_ids, grid_index});
+    if (position != positions_.end() and
+        (not result.has_value() or position->second < *result) and
+        element_contains(x_block_logical, position->first)) {
+      result = position->second;
     }
   }
   return result;
 }
 
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>
+element_logical_coordinates(
+    const ElementIndex<Dim>& element_index,
+    const std::vector<BlockLogicalCoords<Dim>>& block_coord_holders) {
+  const auto& element_ids = element_index.element_ids();
+  std::vector<std::array<std::vector<double>, Dim>> x_element_logical(
+      element_ids.size());
+  std::vector<std::vector<size_t>> offsets(element_ids.size());
+  for (size_t offset = 0; offset < block_coord_holders.size(); ++offset) {
+    if (not block_coord_holders[offset].has_value()) {
+      continue;
+    }
+    const auto& x_block_logical = block_coord_holders[offset].value().data;
+    const auto index = element_index.find(
+        block_coord_holders[offset].value().id, x_block_logical);
+    if (not index.has_value()) {
+      continue;
+    }
+    const auto x_elem =
+        element_logical_coordinates(x_block_logical, element_ids[*index]);
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(x_element_logical[*index], d).push_back(x_elem->get(d));
+    }
+    offsets[*index].push_back(offset);
+  }
+  return collect_element_logical_coordinates(element_ids, x_element_logical,
+                                             offsets);
+}
+
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATE(_, data)                                                  \
@@ -146,6 +261,12 @@ element_logical_coordinates(
                               ElementLogicalCoordHolder<DIM(data)>>           \
   element_logical_coordinates(                                                \
       const std::vector<ElementId<DIM(data)>>& element_ids,                   \
+      const std::vector<BlockLogicalCoords<DIM(data)>>& block_coord_holders); \
+  template class ElementIndex<DIM(data)>;                                     \
+  template std::unordered_map<ElementId<DIM(data)>,                           \
+                              ElementLogicalCoordHolder<DIM(data)>>           \
+  element_logical_coordinates(                                                \
+      const ElementIndex<DIM(data)>& element_index,                           \
       const std::vector<BlockLogicalCoords<DIM(data)>>& block_coord_holders);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
@@ -3,21 +3,22 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <optional>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/Structure/ElementId.hpp"
 
 /// \cond
 namespace domain {
 class BlockId;
 }  // namespace domain
 class DataVector;
-template <size_t VolumeDim>
-class ElementId;
 template <typename IdType, typename DataType>
 class IdPair;
 /// \endcond
@@ -131,3 +132,53 @@ auto element_logical_coordinates(
     const std::vector<ElementId<Dim>>& element_ids,
     const std::vector<BlockLogicalCoords<Dim>>& block_coord_holders)
     -> std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>;
+
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief Finds the element that contains a point given in block logical
+ * coordinates.
+ *
+ * \details The elements of each block are grouped by their refinement levels
+ * and grid index. For each group the segments containing the point follow
+ * directly from its block logical coordinates, so a lookup costs one hash
+ * table access per group instead of a loop over all elements. This makes
+ * `element_logical_coordinates` fast for many elements, e.g. when
+ * interpolating volume data from a file with thousands of elements.
+ *
+ * Points on shared element boundaries are assigned to elements in the same
+ * way as by `element_logical_coordinates`. If several elements contain a
+ * point, the one that comes first in `element_ids()` is found.
+ */
+template <size_t Dim>
+class ElementIndex {
+ public:
+  ElementIndex() = default;
+  explicit ElementIndex(std::vector<ElementId<Dim>> element_ids);
+
+  const std::vector<ElementId<Dim>>& element_ids() const {
+    return element_ids_;
+  }
+
+  /// The position in `element_ids()` of the element that contains the point,
+  /// or `std::nullopt` if no element contains it.
+  std::optional<size_t> find(
+      const domain::BlockId& block_id,
+      const tnsr::I<double, Dim, Frame::BlockLogical>& x_block_logical) const;
+
+ private:
+  std::vector<ElementId<Dim>> element_ids_{};
+  // Distinct refinement levels and grid indices of the elements in each block
+  std::vector<std::vector<std::pair<std::array<size_t, Dim>, size_t>>>
+      refinements_{};
+  std::unordered_map<ElementId<Dim>, size_t> positions_{};
+};
+
+/// \ingroup ComputationalDomainGroup
+///
+/// Same as the overload taking a `std::vector<ElementId<Dim>>`, but finds
+/// the elements with the `element_index`.
+template <size_t Dim>
+auto element_logical_coordinates(
+    const ElementIndex<Dim>& element_index,
+    const std::vector<BlockLogicalCoords<Dim>>& block_coord_holders)
+    -> std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>;
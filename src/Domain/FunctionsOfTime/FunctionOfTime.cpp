@@ -0,0 +1,71 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <pup.h>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace domain::FunctionsOfTime {
+namespace {
+std::uint64_t next_id() {
+  // Zero is never used, so it can mark an empty cache entry
+  static std::atomic<std::uint64_t> id{1};
+  return id.fetch_add(1, std::memory_order_relaxed);
+}
+}  // namespace
+
+FunctionOfTime::FunctionOfTime() : id_(next_id()) {}
+
+FunctionOfTime::FunctionOfTime(FunctionOfTime&& /*rhs*/) : id_(next_id()) {}
+
+FunctionOfTime& FunctionOfTime::operator=(FunctionOfTime&& /*rhs*/) {
+  id_ = next_id();
+  return *this;
+}
+
+FunctionOfTime::FunctionOfTime(const FunctionOfTime& /*rhs*/)
+    : id_(next_id()) {}
+
+FunctionOfTime& FunctionOfTime::operator=(const FunctionOfTime& /*rhs*/) {
+  id_ = next_id();
+  return *this;
+}
+
+void FunctionOfTime::evaluate(const gsl::span<DataVector> result,
+                              const double t) const {
+  const auto move_into_result = [&result](auto values) {
+    for (size_t i = 0; i < values.size(); ++i) {
+      result[i] = std::move(gsl::at(values, i));
+    }
+  };
+  switch (result.size()) {
+    case 1:
+      move_into_result(func(t));
+      break;
+    case 2:
+      move_into_result(func_and_deriv(t));
+      break;
+    case 3:
+      move_into_result(func_and_2_derivs(t));
+      break;
+    default:
+      ERROR("Can only evaluate the function and up to 2 derivatives, not "
+            << result.size() - 1 << " derivatives.");
+  }
+}
+
+void FunctionOfTime::pup(PUP::er& p) {
+  PUP::able::pup(p);
+  if (p.isUnpacking()) {
+    id_ = next_id();
+  }
+}
+}  // namespace domain::FunctionsOfTime
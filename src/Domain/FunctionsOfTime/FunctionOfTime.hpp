@@ -4,12 +4,14 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <memory>
 #include <pup.h>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 
 namespace domain {
@@ -38,13 +40,18 @@ namespace FunctionsOfTime {
 /// is, when evaluated at a time when the function was updated, they
 /// return the values just before the update, ignoring the updated
 /// value.
+///
+/// Every FunctionOfTime object has a unique integer `id`, which identifies
+/// its values: two objects with the same `id` return the same values at all
+/// times. Copies, assigned-to and deserialized objects get a new `id`. This
+/// is what `cached_evaluate` uses to key its snapshots.
 class FunctionOfTime : public PUP::able {
  public:
-  FunctionOfTime() = default;
-  FunctionOfTime(FunctionOfTime&&) = default;
-  FunctionOfTime& operator=(FunctionOfTime&&) = default;
-  FunctionOfTime(const FunctionOfTime&) = default;
-  FunctionOfTime& operator=(const FunctionOfTime&) = default;
+  FunctionOfTime();
+  FunctionOfTime(FunctionOfTime&& rhs);
+  FunctionOfTime& operator=(FunctionOfTime&& rhs);
+  FunctionOfTime(const FunctionOfTime& rhs);
+  FunctionOfTime& operator=(const FunctionOfTime& rhs);
   ~FunctionOfTime() override = default;
 
   virtual auto get_clone() const -> std::unique_ptr<FunctionOfTime> = 0;
@@ -81,6 +88,16 @@ class FunctionOfTime : public PUP::able {
   /// The DataVector can be of any size
   virtual std::array<DataVector, 3> func_and_2_derivs(double t) const = 0;
 
+  /// \brief Writes the function and its first `result.size() - 1`
+  /// derivatives at `t` into `result`.
+  ///
+  /// \details Derived classes that override this reuse the allocations of
+  /// `result` if its DataVectors already have the right size, so repeated
+  /// evaluations into the same buffers don't allocate. The default
+  /// implementation forwards to `func`, `func_and_deriv` or
+  /// `func_and_2_derivs`. `result` must hold 1, 2 or 3 DataVectors.
+  virtual void evaluate(gsl::span<DataVector> result, double t) const;
+
   /// \brief All derivatives a function of time has to offer (because it can be
   /// more than 2)
   ///
@@ -94,7 +111,16 @@ class FunctionOfTime : public PUP::able {
                        std::move(tmp_func_and_2_derivs[2])};
   }
 
+  /// A unique identifier of the values of this object
+  std::uint64_t id() const { return id_; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override;
+
   WRAPPED_PUPable_abstract(FunctionOfTime);  // NOLINT
+
+ private:
+  std::uint64_t id_;
 };
 }  // namespace FunctionsOfTime
 
@@ -24,7 +24,6 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
-#include "Utilities/MakeArray.hpp"
 #include "Utilities/StdHelpers.hpp"
 
 namespace domain::FunctionsOfTime {
@@ -73,31 +72,42 @@ template <size_t MaxDeriv>
 template <size_t MaxDerivReturned>
 std::array<DataVector, MaxDerivReturned + 1>
 PiecewisePolynomial<MaxDeriv>::func_and_derivs(const double t) const {
+  std::array<DataVector, MaxDerivReturned + 1> result{};
+  PiecewisePolynomial::evaluate(result, t);
+  return result;
+}
+
+template <size_t MaxDeriv>
+void PiecewisePolynomial<MaxDeriv>::evaluate(const gsl::span<DataVector> result,
+                                             const double t) const {
+  ASSERT(not result.empty(), "Must request at least the function value.");
   const auto deriv_info_at_t = deriv_info_at_update_times_(t);
   const double dt = t - deriv_info_at_t.update;
   const auto& coefs = deriv_info_at_t.data;
+  const size_t max_deriv_returned = result.size() - 1;
 
-  // initialize result for the number of derivs requested
-  std::array<DataVector, MaxDerivReturned + 1> result =
-      make_array<MaxDerivReturned + 1>(DataVector(coefs.back().size(), 0.0));
+  // initialize result for the number of derivs requested, reusing the
+  // allocations of `result`
+  for (size_t k = 1; k < result.size(); ++k) {
+    result[k].destructive_resize(coefs.back().size());
+    result[k] = 0.0;
+  }
 
   // evaluate the polynomial using ddpoly (Numerical Recipes sec 5.1)
   result[0] = coefs[MaxDeriv];
   for (size_t j = MaxDeriv; j-- > 0;) {
-    const size_t min_deriv = std::min(MaxDerivReturned, MaxDeriv - j);
+    const size_t min_deriv = std::min(max_deriv_returned, MaxDeriv - j);
     for (size_t k = min_deriv; k > 0; k--) {
-      gsl::at(result, k) = gsl::at(result, k) * dt + gsl::at(result, k - 1);
+      result[k] = result[k] * dt + result[k - 1];
     }
     result[0] = result[0] * dt + gsl::at(coefs, j);
   }
   // after the first derivative, factorial constants come in
   double fact = 1.0;
-  for (size_t j = 2; j < MaxDerivReturned + 1; j++) {
-    fact *= j;
-    gsl::at(result, j) *= fact;
+  for (size_t j = 2; j < result.size(); j++) {
+    fact *= static_cast<double>(j);
+    result[j] *= fact;
   }
-
-  return result;
 }
 
 template <size_t MaxDeriv>
@@ -15,6 +15,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/FunctionsOfTime/ThreadsafeList.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 
 namespace domain {
@@ -71,6 +72,11 @@ class PiecewisePolynomial : public FunctionOfTime {
   /// an arbitrary time `t`.
   std::vector<DataVector> func_and_all_derivs(double t) const override;
 
+  /// Writes the function and its first `result.size() - 1` derivatives at
+  /// `t` into `result`, reusing its allocations. Derivatives higher than
+  /// `MaxDeriv` are zero.
+  void evaluate(gsl::span<DataVector> result, double t) const override;
+
   /// Updates the `MaxDeriv`th derivative of the function at the given time.
   /// `updated_max_deriv` is a vector of the `MaxDeriv`ths for each component.
   /// `next_expiration_time` is the next expiration time.
@@ -0,0 +1,75 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/FunctionsOfTime/SnapshotCache.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace domain::FunctionsOfTime {
+namespace {
+struct Snapshot {
+  // Zero is not the id of any FunctionOfTime
+  std::uint64_t id = 0;
+  double time = 0.0;
+  size_t number_of_values = 0;
+  std::array<DataVector, 3> values{};
+};
+
+struct Snapshots {
+  // Enough for all functions of time of a binary at a few times
+  std::array<Snapshot, 32> snapshots{};
+  size_t next = 0;
+};
+
+Snapshots& thread_local_snapshots() {
+  thread_local Snapshots snapshots{};
+  return snapshots;
+}
+}  // namespace
+
+void cached_evaluate(const gsl::span<DataVector> result,
+                     const FunctionOfTime& function_of_time,
+                     const double time) {
+  ASSERT(not result.empty() and result.size() <= 3,
+         "Can evaluate the function and up to 2 derivatives, but "
+             << result.size() << " values were requested.");
+  Snapshots& snapshots = thread_local_snapshots();
+  const std::uint64_t id = function_of_time.id();
+  const Snapshot* snapshot = nullptr;
+  for (const Snapshot& cached_snapshot : snapshots.snapshots) {
+    if (cached_snapshot.id == id and cached_snapshot.time == time and
+        cached_snapshot.number_of_values >= result.size()) {
+      snapshot = &cached_snapshot;
+      break;
+    }
+  }
+  if (snapshot == nullptr) {
+    Snapshot& new_snapshot = snapshots.snapshots[snapshots.next];
+    snapshots.next = (snapshots.next + 1) % snapshots.snapshots.size();
+    // Mark the snapshot as empty in case the evaluation fails
+    new_snapshot.id = 0;
+    function_of_time.evaluate(
+        gsl::make_span(new_snapshot.values.data(), result.size()), time);
+    new_snapshot.id = id;
+    new_snapshot.time = time;
+    new_snapshot.number_of_values = result.size();
+    snapshot = &new_snapshot;
+  }
+  for (size_t i = 0; i < result.size(); ++i) {
+    ASSERT(result[i].is_owning() or
+               result[i].size() == gsl::at(snapshot->values, i).size(),
+           "The function of time has "
+               << gsl::at(snapshot->values, i).size()
+               << " components, but the result has size "
+               << result[i].size() << ".");
+    result[i] = gsl::at(snapshot->values, i);
+  }
+}
+}  // namespace domain::FunctionsOfTime
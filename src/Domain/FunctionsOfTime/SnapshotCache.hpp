@@ -0,0 +1,73 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace domain::FunctionsOfTime {
+class FunctionOfTime;
+}  // namespace domain::FunctionsOfTime
+/// \endcond
+
+namespace domain::FunctionsOfTime {
+/*!
+ * \brief Writes the function and its first `result.size() - 1` derivatives
+ * at `time` into `result`, reusing values computed earlier on this thread.
+ *
+ * \details All elements on a core evaluate the same handful of functions of
+ * time at the same few times every substep. The evaluated values are kept in
+ * a small thread-local table of snapshots keyed by `FunctionOfTime::id()` and
+ * `time`, so only the first element evaluates the function and the others
+ * copy the values. Because the table is thread-local, no locks or atomics are
+ * needed. A snapshot holding more derivatives than requested is reused. Old
+ * snapshots are overwritten in round-robin order.
+ *
+ * The values are copied into the existing allocations of `result` if the
+ * DataVectors have the right size, so repeated calls with the same buffers
+ * don't allocate. Non-owning DataVectors must already have the right size. At
+ * most 2 derivatives can be requested.
+ */
+void cached_evaluate(gsl::span<DataVector> result,
+                     const FunctionOfTime& function_of_time, double time);
+
+/// The function and its first `NumberOfValues - 1` derivatives at `time`.
+/// \see `cached_evaluate`
+template <size_t NumberOfValues>
+std::array<DataVector, NumberOfValues> cached_evaluate(
+    const FunctionOfTime& function_of_time, const double time) {
+  std::array<DataVector, NumberOfValues> result{};
+  cached_evaluate(result, function_of_time, time);
+  return result;
+}
+
+/*!
+ * \brief The `NumberOfComponents` components of the function and its first
+ * `NumberOfValues - 1` derivatives at `time`.
+ *
+ * \details Unlike the overload returning DataVectors this doesn't allocate, so
+ * it is meant for functions of time with a few components that are evaluated
+ * for every element. It is an error if the function of time doesn't have
+ * `NumberOfComponents` components.
+ *
+ * \see `cached_evaluate`
+ */
+template <size_t NumberOfValues, size_t NumberOfComponents>
+std::array<std::array<double, NumberOfComponents>, NumberOfValues>
+cached_evaluate_components(const FunctionOfTime& function_of_time,
+                           const double time) {
+  std::array<std::array<double, NumberOfComponents>, NumberOfValues> result{};
+  std::array<DataVector, NumberOfValues> views{};
+  for (size_t i = 0; i < NumberOfValues; ++i) {
+    gsl::at(views, i).set_data_ref(gsl::at(result, i).data(),
+                                   NumberOfComponents);
+  }
+  cached_evaluate(views, function_of_time, time);
+  return result;
+}
+}  // namespace domain::FunctionsOfTime
@@ -44,7 +44,8 @@ void bind_block_logical_coordinates_impl(py::module& m) {  // NOLINT
          const std::optional<double>& time = std::nullopt,
          const std::optional<std::unordered_map<
              std::string, const domain::FunctionsOfTime::FunctionOfTime&>>&
-             functions_of_time = std::nullopt) {
+             functions_of_time = std::nullopt,
+         const size_t number_of_threads = 1) {
         // Transform functions-of-time map to unique_ptrs because pybind11 can't
         // handle unique_ptrs easily as function arguments (it's hard to
         // transfer ownership of a Python object to C++)
@@ -60,10 +61,10 @@ void bind_block_logical_coordinates_impl(py::module& m) {  // NOLINT
         return block_logical_coordinates(
             domain, inertial_coords,
             time.value_or(std::numeric_limits<double>::signaling_NaN()),
-            functions_of_time_ptrs);
+            functions_of_time_ptrs, number_of_threads);
       },
       py::arg("domain"), py::arg("inertial_coords"), py::arg("time"),
-      py::arg("functions_of_time"));
+      py::arg("functions_of_time"), py::arg("number_of_threads") = 1);
 }
 }  // namespace
 
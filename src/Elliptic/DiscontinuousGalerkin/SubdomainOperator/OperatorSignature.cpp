@@ -0,0 +1,46 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Elliptic/DiscontinuousGalerkin/SubdomainOperator/OperatorSignature.hpp"
+
+#include <cmath>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/BoundaryConditions/BoundaryCondition.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+
+namespace elliptic::dg::subdomain_operator {
+
+void append_to_signature(const gsl::not_null<std::vector<double>*> signature,
+                         const double value) {
+  int exponent = 0;
+  const double mantissa = std::frexp(value, &exponent);
+  signature->push_back(std::ldexp(
+      std::round(std::ldexp(mantissa, operator_signature_mantissa_bits)),
+      exponent - operator_signature_mantissa_bits));
+}
+
+void append_to_signature(const gsl::not_null<std::vector<double>*> signature,
+                         const DataVector& data) {
+  signature->reserve(signature->size() + data.size() + 1);
+  signature->push_back(static_cast<double>(data.size()));
+  for (const double value : data) {
+    append_to_signature(signature, value);
+  }
+}
+
+void append_to_signature(
+    const gsl::not_null<std::vector<double>*> signature,
+    const domain::BoundaryConditions::BoundaryCondition& boundary_condition) {
+  const std::string type_name = typeid(boundary_condition).name();
+  signature->push_back(static_cast<double>(type_name.size()));
+  signature->insert(signature->end(), type_name.begin(), type_name.end());
+  append_serialized_to_signature<domain::BoundaryConditions::BoundaryCondition>(
+      signature, boundary_condition);
+}
+
+}  // namespace elliptic::dg::subdomain_operator
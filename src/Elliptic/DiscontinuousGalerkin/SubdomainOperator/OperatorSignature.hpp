@@ -0,0 +1,68 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <vector>
+
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+
+/// \cond
+class DataVector;
+namespace domain::BoundaryConditions {
+class BoundaryCondition;
+}  // namespace domain::BoundaryConditions
+/// \endcond
+
+namespace elliptic::dg::subdomain_operator {
+
+/*!
+ * \brief Number of mantissa bits that are kept when floating-point data is
+ * appended to an operator signature
+ *
+ * Rounding the geometric data to fewer bits than a `double` holds means that
+ * elements that differ only by a translation, and hence only by roundoff in
+ * their Jacobians, have the same signature. The relative precision is
+ * \f$2^{-36}\approx 10^{-11}\f$.
+ */
+constexpr int operator_signature_mantissa_bits = 36;
+
+/// @{
+/// Append floating-point `data` to the operator `signature`, rounded to
+/// `operator_signature_mantissa_bits`
+void append_to_signature(gsl::not_null<std::vector<double>*> signature,
+                         double value);
+
+void append_to_signature(gsl::not_null<std::vector<double>*> signature,
+                         const DataVector& data);
+
+template <typename Symm, typename IndexList>
+void append_to_signature(
+    const gsl::not_null<std::vector<double>*> signature,
+    const Tensor<DataVector, Symm, IndexList>& tensor) {
+  for (const auto& component : tensor) {
+    append_to_signature(signature, component);
+  }
+}
+/// @}
+
+/// Append the serialization of the `value` to the operator `signature`, one
+/// byte at a time. Use for data that is compared exactly, such as meshes and
+/// orientations.
+template <typename T>
+void append_serialized_to_signature(
+    const gsl::not_null<std::vector<double>*> signature, const T& value) {
+  const auto bytes = serialize<T>(value);
+  signature->push_back(static_cast<double>(bytes.size()));
+  signature->insert(signature->end(), bytes.begin(), bytes.end());
+}
+
+/// Append the type and the serialized parameters of the `boundary_condition`
+/// to the operator `signature`
+void append_to_signature(
+    gsl::not_null<std::vector<double>*> signature,
+    const domain::BoundaryConditions::BoundaryCondition& boundary_condition);
+
+}  // namespace elliptic::dg::subdomain_operator
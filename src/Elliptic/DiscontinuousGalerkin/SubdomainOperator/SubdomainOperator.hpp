@@ -3,14 +3,19 @@
 
 #pragma once
 
+#include <algorithm>
 #include <boost/functional/hash.hpp>
 #include <cstddef>
 #include <optional>
 #include <ostream>
 #include <pup.h>
+#include <string>
 #include <tuple>
+#include <type_traits>
+#include <typeinfo>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
@@ -20,6 +25,7 @@
 #include "Domain/FaceNormal.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/DirectionMap.hpp"
+#include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
 #include "Domain/Tags/FaceNormal.hpp"
@@ -28,6 +34,7 @@
 #include "Domain/Tags/SurfaceJacobian.hpp"
 #include "Elliptic/BoundaryConditions/ApplyBoundaryCondition.hpp"
 #include "Elliptic/DiscontinuousGalerkin/DgOperator.hpp"
+#include "Elliptic/DiscontinuousGalerkin/SubdomainOperator/OperatorSignature.hpp"
 #include "Elliptic/DiscontinuousGalerkin/SubdomainOperator/Tags.hpp"
 #include "Elliptic/DiscontinuousGalerkin/Tags.hpp"
 #include "Elliptic/Systems/GetFluxesComputer.hpp"
@@ -223,6 +230,212 @@ struct SubdomainOperator
                                              tmpl::pin<tmpl::size_t<Dim>>>;
 
  public:
+  /*!
+   * \brief A signature that identifies the operator on this subdomain
+   *
+   * Subdomains with the same signature have the same operator, so subdomain
+   * solvers can share their setup (see `LinearSolver::Serial::SparseLu`). The
+   * signature includes the meshes, Jacobians and face normals of the central
+   * element and of all overlaps, the overlap extents, the mortars and their
+   * penalty factors, and the boundary conditions. Floating-point data is
+   * rounded (see
+   * `elliptic::dg::subdomain_operator::operator_signature_mantissa_bits`), so
+   * elements that differ only by a translation share a signature.
+   *
+   * The `subdomain_data` defines the ordering of the operator's rows and
+   * columns: the central element followed by the overlaps in the iteration
+   * order of its `overlap_data`. This order depends on the hashes of the
+   * neighbors' `ElementId`s, so overlaps are appended in the same order and
+   * congruent subdomains that order their overlaps differently get different
+   * signatures.
+   *
+   * Returns `std::nullopt` if the system's fluxes or sources take arguments
+   * from the element's DataBox, such as background fields or coordinates,
+   * because then the operator can differ between elements with the same
+   * geometry.
+   */
+  template <typename SubdomainTagsList, typename DbTagsList>
+  std::optional<std::vector<double>> operator_signature(
+      const LinearSolver::Schwarz::ElementCenteredSubdomainData<
+          Dim, SubdomainTagsList>& subdomain_data,
+      const db::DataBox<DbTagsList>& box,
+      const std::unordered_map<std::pair<size_t, Direction<Dim>>,
+                               const BoundaryConditionsBase&,
+                               boost::hash<std::pair<size_t, Direction<Dim>>>>&
+          override_boundary_conditions = {}) const {
+    if constexpr (not std::is_same_v<
+                      tmpl::list_difference<
+                          tmpl::append<fluxes_args_tags, sources_args_tags>,
+                          args_tags_from_center>,
+                      tmpl::list<>>) {
+      (void)subdomain_data;
+      (void)box;
+      (void)override_boundary_conditions;
+      return std::nullopt;
+    } else {
+      const auto get_items = [](const auto&... args) {
+        return std::forward_as_tuple(args...);
+      };
+      using inv_jacobian_tag =
+          domain::Tags::InverseJacobian<Dim, Frame::ElementLogical,
+                                        Frame::Inertial>;
+      using face_normal_magnitudes_tag = domain::Tags::Faces<
+          Dim, domain::Tags::UnnormalizedFaceNormalMagnitude<Dim>>;
+      using penalty_factors_tag =
+          ::Tags::Mortars<elliptic::dg::Tags::PenaltyFactor, Dim>;
+      using tags_to_retrieve = tmpl::flatten<tmpl::list<
+          domain::Tags::ExternalBoundaryConditions<Dim>,
+          domain::Tags::Element<Dim>, domain::Tags::Mesh<Dim>, inv_jacobian_tag,
+          face_normal_magnitudes_tag, penalty_factors_tag,
+          ::Tags::Mortars<domain::Tags::Mesh<Dim - 1>, Dim>,
+          ::Tags::Mortars<::Tags::MortarSize<Dim - 1>, Dim>,
+          // Data on overlaps with neighbors
+          tmpl::transform<
+              tmpl::flatten<tmpl::list<
+                  Tags::ExtrudingExtent, domain::Tags::Element<Dim>,
+                  domain::Tags::Mesh<Dim>, inv_jacobian_tag,
+                  face_normal_magnitudes_tag, penalty_factors_tag,
+                  // Data on the remote side of the neighbor's mortars
+                  tmpl::transform<
+                      tmpl::list<
+                          domain::Tags::UnnormalizedFaceNormalMagnitude<Dim>,
+                          domain::Tags::Mesh<Dim - 1>,
+                          ::Tags::MortarSize<Dim - 1>>,
+                      make_neighbor_mortars_tag>>>,
+              make_overlap_tag>>>;
+      const auto& [external_boundary_conditions, central_element, central_mesh,
+                   central_inv_jacobian, central_face_normal_magnitudes,
+                   central_penalty_factors, central_mortar_meshes,
+                   central_mortar_sizes, all_overlap_extents,
+                   all_neighbor_elements, all_neighbor_meshes,
+                   all_neighbor_inv_jacobians,
+                   all_neighbor_face_normal_magnitudes,
+                   all_neighbor_penalty_factors,
+                   all_neighbors_neighbor_face_normal_magnitudes,
+                   all_neighbors_neighbor_mortar_meshes,
+                   all_neighbors_neighbor_mortar_sizes] =
+          db::apply<tags_to_retrieve>(get_items, box);
+
+      std::vector<double> signature{};
+      // Distinguish between different systems and global options
+      const std::string operator_name = typeid(SubdomainOperator).name();
+      signature.insert(signature.end(), operator_name.begin(),
+                       operator_name.end());
+      tmpl::for_each<args_tags_from_center>([&signature, &box](auto tag_v) {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        append_serialized_to_signature(make_not_null(&signature),
+                                       db::get<tag>(box));
+      });
+
+      // Append the penalty factors on all mortars of an element
+      std::vector<::dg::MortarId<Dim>> mortar_ids{};
+      const auto append_penalty_factors = [&signature, &mortar_ids](
+                                              const auto& penalty_factors) {
+        mortar_ids.clear();
+        for (const auto& [mortar_id, penalty_factor] : penalty_factors) {
+          mortar_ids.push_back(mortar_id);
+        }
+        std::sort(mortar_ids.begin(), mortar_ids.end());
+        for (const auto& mortar_id : mortar_ids) {
+          append_serialized_to_signature(make_not_null(&signature),
+                                         mortar_id.direction());
+          append_to_signature(make_not_null(&signature),
+                              penalty_factors.at(mortar_id));
+        }
+      };
+
+      // Append the geometry and boundary conditions of an element, either the
+      // central element or a neighbor
+      const auto append_element =
+          [&signature, &all_boundary_conditions = external_boundary_conditions,
+           &override_boundary_conditions, &append_penalty_factors](
+              const Element<Dim>& element, const Mesh<Dim>& mesh,
+              const auto& inv_jacobian, const auto& face_normal_magnitudes,
+              const auto& penalty_factors) {
+            append_serialized_to_signature(make_not_null(&signature), mesh);
+            append_to_signature(make_not_null(&signature), inv_jacobian);
+            for (const auto& direction : Direction<Dim>::all_directions()) {
+              append_serialized_to_signature(make_not_null(&signature),
+                                             direction);
+              if (face_normal_magnitudes.contains(direction)) {
+                append_to_signature(make_not_null(&signature),
+                                    face_normal_magnitudes.at(direction));
+              }
+              if (element.external_boundaries().contains(direction)) {
+                const size_t block_id = element.id().block_id();
+                if (override_boundary_conditions.empty()) {
+                  append_to_signature(
+                      make_not_null(&signature),
+                      *all_boundary_conditions.at(block_id).at(direction));
+                } else {
+                  append_to_signature(
+                      make_not_null(&signature),
+                      override_boundary_conditions.at({block_id, direction}));
+                }
+              }
+              if (element.neighbors().contains(direction)) {
+                const auto& neighbors = element.neighbors().at(direction);
+                append_serialized_to_signature(make_not_null(&signature),
+                                               neighbors.orientation());
+                append_serialized_to_signature(make_not_null(&signature),
+                                               neighbors.size());
+              }
+            }
+            append_penalty_factors(penalty_factors);
+          };
+      append_element(central_element, central_mesh, central_inv_jacobian,
+                     central_face_normal_magnitudes, central_penalty_factors);
+
+      // Append the overlaps in the order in which they are stored in the
+      // subdomain data, which is the order of the operator's rows and columns
+      ASSERT(subdomain_data.overlap_data.size() == all_overlap_extents.size(),
+             "The subdomain data has " << subdomain_data.overlap_data.size()
+                                       << " overlaps but the subdomain has "
+                                       << all_overlap_extents.size() << ".");
+      for (const auto& [overlap_id, overlap_data] :
+           subdomain_data.overlap_data) {
+        (void)overlap_data;
+        append_serialized_to_signature(make_not_null(&signature),
+                                       overlap_id.direction());
+        append_serialized_to_signature(make_not_null(&signature),
+                                       all_overlap_extents.at(overlap_id));
+        append_serialized_to_signature(make_not_null(&signature),
+                                       central_mortar_meshes.at(overlap_id));
+        append_serialized_to_signature(make_not_null(&signature),
+                                       central_mortar_sizes.at(overlap_id));
+        append_element(all_neighbor_elements.at(overlap_id),
+                       all_neighbor_meshes.at(overlap_id),
+                       all_neighbor_inv_jacobians.at(overlap_id),
+                       all_neighbor_face_normal_magnitudes.at(overlap_id),
+                       all_neighbor_penalty_factors.at(overlap_id));
+        // Data on the remote side of the neighbor's mortars
+        const auto& neighbors_neighbor_mortar_meshes =
+            all_neighbors_neighbor_mortar_meshes.at(overlap_id);
+        mortar_ids.clear();
+        for (const auto& [mortar_id, mortar_mesh] :
+             neighbors_neighbor_mortar_meshes) {
+          mortar_ids.push_back(mortar_id);
+        }
+        std::sort(mortar_ids.begin(), mortar_ids.end());
+        for (const auto& mortar_id : mortar_ids) {
+          append_serialized_to_signature(make_not_null(&signature),
+                                         mortar_id.direction());
+          append_serialized_to_signature(
+              make_not_null(&signature),
+              neighbors_neighbor_mortar_meshes.at(mortar_id));
+          append_serialized_to_signature(
+              make_not_null(&signature),
+              all_neighbors_neighbor_mortar_sizes.at(overlap_id).at(mortar_id));
+          append_to_signature(
+              make_not_null(&signature),
+              all_neighbors_neighbor_face_normal_magnitudes.at(overlap_id).at(
+                  mortar_id));
+        }
+      }
+      return signature;
+    }
+  }
+
   /// \warning This function is not thread-safe because it accesses mutable
   /// memory buffers.
   template <typename ResultTags, typename OperandTags, typename DbTagsList>
@@ -28,6 +28,7 @@
 #include "NumericalAlgorithms/LinearSolver/ExplicitInverse.hpp"
 #include "NumericalAlgorithms/LinearSolver/Gmres.hpp"
 #include "NumericalAlgorithms/LinearSolver/LinearSolver.hpp"
+#include "NumericalAlgorithms/LinearSolver/SparseLu.hpp"
 #include "Options/Auto.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/ElementCenteredSubdomainData.hpp"
@@ -55,7 +56,8 @@ template <size_t Dim, typename OptionsGroup,
               ::LinearSolver::Serial::Registrars::Gmres<
                   ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
                       Dim, tmpl::list<Poisson::Tags::Field<DataVector>>>>,
-              ::LinearSolver::Serial::Registrars::ExplicitInverse<double>>>>
+              ::LinearSolver::Serial::Registrars::ExplicitInverse<double>,
+              ::LinearSolver::Serial::Registrars::SparseLu<double>>>>
 struct MinusLaplacian {
   template <typename LinearSolverRegistrars>
   using f = subdomain_preconditioners::MinusLaplacian<Dim, OptionsGroup, Solver,
@@ -85,6 +87,14 @@ struct MinusLaplacian {
  * combination of element face and boundary-condition type among the tensor
  * components.
  *
+ * \par Sharing the setup between elements
+ * The flat-space Laplacian depends only on the subdomain geometry and the
+ * boundary conditions, so its
+ * `elliptic::dg::subdomain_operator::SubdomainOperator::operator_signature` is
+ * available. With the `LinearSolver::Serial::SparseLu` solver, elements on the
+ * same node with the same geometry share a single factorization and only the
+ * first of them builds the matrix.
+ *
  * \tparam Dim Spatial dimension
  * \tparam OptionsGroup The options group identifying the
  * `LinearSolver::Schwarz::Schwarz` solver that defines the subdomain geometry.
@@ -97,7 +107,8 @@ template <size_t Dim, typename OptionsGroup,
               ::LinearSolver::Serial::Registrars::Gmres<
                   ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
                       Dim, tmpl::list<Poisson::Tags::Field<DataVector>>>>,
-              ::LinearSolver::Serial::Registrars::ExplicitInverse<double>>>,
+              ::LinearSolver::Serial::Registrars::ExplicitInverse<double>,
+              ::LinearSolver::Serial::Registrars::SparseLu<double>>>,
           typename LinearSolverRegistrars =
               tmpl::list<Registrars::MinusLaplacian<Dim, OptionsGroup, Solver>>>
 class MinusLaplacian
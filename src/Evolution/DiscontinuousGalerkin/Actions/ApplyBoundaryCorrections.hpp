@@ -46,11 +46,14 @@
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Time/AdaptiveSteppingDiagnostics.hpp"
 #include "Time/BoundaryHistory.hpp"
 #include "Time/EvolutionOrdering.hpp"
 #include "Time/SelfStart.hpp"
+#include "Time/Tags/AdaptiveSteppingDiagnostics.hpp"
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/AdamsLts.hpp"
 #include "Time/TimeSteppers/LtsTimeStepper.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
 #include "Utilities/Algorithm.hpp"
@@ -364,8 +367,11 @@ bool receive_boundary_data_global_time_stepping(
                     mortar_id.direction().dimension());
             mortar_data->at(mortar_id).neighbor().mortar_mesh =
                 received_mortar_data.second.boundary_correction_mesh.value();
-            mortar_data->at(mortar_id).neighbor().mortar_data = std::move(
-                received_mortar_data.second.boundary_correction_data.value());
+            // Emplace rather than assign: the received data may be a view
+            // into a same-node neighbor's SharedMortarDataBuffer, and
+            // assigning would copy into the memory of a previous view.
+            mortar_data->at(mortar_id).neighbor().mortar_data.emplace(std::move(
+                received_mortar_data.second.boundary_correction_data.value()));
             if (mortar_mesh !=
                 received_mortar_data.second.boundary_correction_mesh) {
               p_project_only_mortar_data(
@@ -1034,6 +1040,14 @@ struct ApplyBoundaryCorrections {
               lifted_data = compute_correction_coupling(
                   mortar_id_and_data.second.local(),
                   mortar_id_and_data.second.neighbor());
+              // Drop views into the neighbor's SharedMortarDataBuffer so
+              // that the neighbor can reuse the memory.
+              auto& neighbor_mortar_data =
+                  mortar_id_and_data.second.neighbor().mortar_data;
+              if (neighbor_mortar_data.has_value() and
+                  not neighbor_mortar_data->is_owning()) {
+                neighbor_mortar_data.reset();
+              }
 
               if (using_gauss_lobatto_points) {
                 // Add the flux contribution to the volume data
@@ -1185,9 +1199,26 @@ struct ApplyLtsBoundaryCorrections {
       return {Parallel::AlgorithmExecution::Continue, std::nullopt};
     }
 
+    // The coefficient cache statistics are per thread, and nothing
+    // else runs on this thread during the update.
+    const auto cache_statistics_before =
+        TimeSteppers::adams_lts::lts_coefficients_cache_statistics();
     db::mutate_apply<
         ApplyBoundaryCorrections<true, System, VolumeDim, DenseOutput>>(
         make_not_null(&box));
+    if constexpr (db::tag_is_retrievable_v<::Tags::AdaptiveSteppingDiagnostics,
+                                           db::DataBox<DbTagsList>>) {
+      const auto& cache_statistics =
+          TimeSteppers::adams_lts::lts_coefficients_cache_statistics();
+      db::mutate<::Tags::AdaptiveSteppingDiagnostics>(
+          [&](const gsl::not_null<AdaptiveSteppingDiagnostics*> diags) {
+            diags->number_of_lts_coefficient_cache_hits +=
+                cache_statistics.hits - cache_statistics_before.hits;
+            diags->number_of_lts_coefficient_cache_misses +=
+                cache_statistics.misses - cache_statistics_before.misses;
+          },
+          make_not_null(&box));
+    }
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
@@ -7,6 +7,7 @@
 #include <optional>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -21,6 +22,8 @@
 #include "Domain/Creators/Tags/ExternalBoundaryConditions.hpp"
 #include "Domain/InterfaceHelpers.hpp"
 #include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
+#include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/OrientationMapHelpers.hpp"
 #include "Domain/Tags.hpp"
 #include "Domain/TagsTimeDependent.hpp"
@@ -37,6 +40,7 @@
 #include "Evolution/DiscontinuousGalerkin/MortarDataHolder.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/NormalVectorTags.hpp"
+#include "Evolution/DiscontinuousGalerkin/SharedMortarDataBuffer.hpp"
 #include "Evolution/DiscontinuousGalerkin/UsingSubcell.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
@@ -51,8 +55,11 @@
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 #include "Parallel/ArrayCollection/SendDataToElement.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
+#include "ParallelAlgorithms/Actions/GetItemFromDistributedObject.hpp"
 #include "Time/Actions/SelfStartActions.hpp"
 #include "Time/BoundaryHistory.hpp"
 #include "Time/Tags/HistoryEvolvedVariables.hpp"
@@ -345,6 +352,12 @@ struct get_primitive_tags_for_face {
  * - Removes: nothing
  * - Modifies:
  *   - `evolution::dg::Tags::MortarData<Dim>`
+ *   - `evolution::dg::Tags::SharedMortarDataBuffer<Dim>`
+ *
+ * With global time stepping, a `DgElementCollection`, and no DG-subcell, the
+ * local mortar data sent to an aligned neighbor on the same node is not copied.
+ * It is shared through the `evolution::dg::SharedMortarDataBuffer` instead.
+ * Neighbors on other nodes still receive a copy in the `BoundaryData` message.
  */
 template <size_t Dim, typename EvolutionSystem, typename DgStepChoosers,
           bool LocalTimeStepping, bool UseNodegroupDgElements>
@@ -370,6 +383,11 @@ struct ComputeTimeDerivative {
       const ParallelComponent* /*meta*/);  // NOLINT const
 
  private:
+  template <typename Metavariables>
+  static constexpr bool share_mortar_data =
+      UseNodegroupDgElements and not LocalTimeStepping and
+      not using_subcell_v<Metavariables>;
+
   template <typename ParallelComponent, typename DbTagsList,
             typename Metavariables>
   static void send_data_for_fluxes(
@@ -610,6 +628,20 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping,
       tmpl::all<derived_boundary_corrections, std::is_final<tmpl::_1>>::value,
       "All createable classes for boundary corrections must be marked "
       "final.");
+  if constexpr (share_mortar_data<Metavariables>) {
+    // The neighbors have finished with the older shared data, so its memory
+    // is reused for the mortar data computed below.
+    db::mutate<evolution::dg::Tags::MortarData<Dim>,
+               evolution::dg::Tags::SharedMortarDataBuffer<Dim>>(
+        [](const gsl::not_null<DirectionalIdMap<Dim, MortarDataHolder<Dim>>*>
+               mortar_data,
+           const gsl::not_null<SharedMortarDataBuffer<Dim>*>
+               shared_mortar_data_buffer) {
+          shared_mortar_data_buffer->reclaim(mortar_data);
+        },
+        make_not_null(&box));
+  }
+
   tmpl::for_each<derived_boundary_corrections>(
       [&boundary_correction, &box, &partial_derivs, &primitive_vars,
        &temporaries, &volume_fluxes, &packaged_data_buffer,
@@ -688,6 +720,14 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
     tci_decision = evolution::dg::subcell::get_tci_decision(*box);
   }
 
+  [[maybe_unused]] const std::unordered_map<ElementId<Dim>, size_t>*
+      element_locations = nullptr;
+  if constexpr (share_mortar_data<Metavariables>) {
+    element_locations = Parallel::local_synchronous_action<
+        Parallel::Actions::GetItemFromDistributedOject<
+            Parallel::Tags::ElementLocations<Dim>>>(receiver_proxy);
+  }
+
   for (const auto& [direction, neighbors] : element.neighbors()) {
     const auto& orientation = neighbors.orientation();
     const auto direction_from_neighbor = orientation(direction.opposite());
@@ -709,7 +749,34 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
       const Mesh<Dim - 1>& mortar_mesh = mortar_meshes.at(mortar_id);
       DataVector neighbor_boundary_data_on_mortar{};
 
-      if (LIKELY(orientation.is_aligned())) {
+      const bool share_with_neighbor = [&]() {
+        if constexpr (share_mortar_data<Metavariables>) {
+          return orientation.is_aligned() and
+                 element_locations->at(neighbor) ==
+                     Parallel::my_node<size_t>(*cache);
+        } else {
+          return false;
+        }
+      }();
+
+      if (share_with_neighbor) {
+        db::mutate<evolution::dg::Tags::MortarData<Dim>,
+                   evolution::dg::Tags::SharedMortarDataBuffer<Dim>>(
+            [&mortar_id, &neighbor_boundary_data_on_mortar, &time_step_id](
+                const gsl::not_null<
+                    DirectionalIdMap<Dim, MortarDataHolder<Dim>>*>
+                    mortar_data,
+                const gsl::not_null<SharedMortarDataBuffer<Dim>*>
+                    shared_mortar_data_buffer) {
+              // The view is moved into the empty `std::optional` of the
+              // message below, which keeps it non-owning.
+              shared_mortar_data_buffer->share(
+                  make_not_null(&neighbor_boundary_data_on_mortar),
+                  make_not_null(&mortar_data->at(mortar_id).local()),
+                  mortar_id, time_step_id);
+            },
+            box);
+      } else if (LIKELY(orientation.is_aligned())) {
         neighbor_boundary_data_on_mortar =
             *all_mortar_data.at(mortar_id).local().mortar_data.value();
       } else {
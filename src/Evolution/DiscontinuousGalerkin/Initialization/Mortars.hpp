@@ -31,6 +31,7 @@
 #include "Evolution/DiscontinuousGalerkin/MortarDataHolder.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/NormalVectorTags.hpp"
+#include "Evolution/DiscontinuousGalerkin/SharedMortarDataBuffer.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
@@ -190,6 +191,7 @@ void p_project(
  *   - `Tags::MortarNextTemporalId<Dim>`
  *   - `evolution::dg::Tags::NormalCovectorAndMagnitude<Dim>`
  *   - `evolution::dg::Tags::BoundaryData<Dim>`
+ *   - `evolution::dg::Tags::SharedMortarDataBuffer<Dim>`
  * - Removes: nothing
  * - Modifies: nothing
  */
@@ -210,7 +212,8 @@ struct Mortars {
       Tags::MortarDataHistory<
           Dim, typename db::add_tag_prefix<
                    ::Tags::dt, typename System::variables_tag>::type>,
-      evolution::dg::Tags::BoundaryData<Dim>>;
+      evolution::dg::Tags::BoundaryData<Dim>,
+      evolution::dg::Tags::SharedMortarDataBuffer<Dim>>;
   using compute_tags = tmpl::list<>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -244,7 +247,8 @@ struct Mortars {
         make_not_null(&box), std::move(mortar_data), std::move(mortar_meshes),
         std::move(mortar_sizes), std::move(mortar_next_temporal_ids),
         std::move(normal_covector_quantities), std::move(boundary_data_history),
-        typename evolution::dg::Tags::BoundaryData<Dim>::type{});
+        typename evolution::dg::Tags::BoundaryData<Dim>::type{},
+        typename evolution::dg::Tags::SharedMortarDataBuffer<Dim>::type{});
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
@@ -258,12 +262,15 @@ struct Mortars {
 ///   - Tags::MortarNextTemporalId<dim>
 ///   - evolution::dg::Tags::NormalCovectorAndMagnitude<dim>
 ///   - Tags::MortarDataHistory<dim, typename dt_variables_tag::type>>
+///   - evolution::dg::Tags::SharedMortarDataBuffer<dim>
 ///
 /// For p-refinement:
 ///   - Does nothing to MortarDataHistory (only valid for global time-stepping)
 ///     or MortarNextTemporalId (only valid for no h-refinement)
 ///   - Sets the other Mortar tags to be default initialized for each neighbor
 ///   - Sets the NormalCovectorAndMagnitude to std::nullopt
+///   - Releases the SharedMortarDataBuffer, copying any local mortar data that
+///     was shared with a neighbor before it is projected
 template <typename Metavariables>
 struct ProjectMortars : tt::ConformsTo<amr::protocols::Projector> {
  private:
@@ -283,7 +290,8 @@ struct ProjectMortars : tt::ConformsTo<amr::protocols::Projector> {
       tmpl::list<Tags::MortarData<dim>, Tags::MortarMesh<dim>,
                  Tags::MortarSize<dim>, Tags::MortarNextTemporalId<dim>,
                  evolution::dg::Tags::NormalCovectorAndMagnitude<dim>,
-                 Tags::MortarDataHistory<dim, typename dt_variables_tag::type>>;
+                 Tags::MortarDataHistory<dim, typename dt_variables_tag::type>,
+                 evolution::dg::Tags::SharedMortarDataBuffer<dim>>;
   using argument_tags =
       tmpl::list<domain::Tags::Mesh<dim>, domain::Tags::Element<dim>,
                  amr::Tags::NeighborInfo<dim>, domain::Tags::NeighborMesh<dim>>;
@@ -302,10 +310,13 @@ struct ProjectMortars : tt::ConformsTo<amr::protocols::Projector> {
           DirectionMap<dim, std::optional<magnitude_and_normal_type>>*>
           normal_covector_and_magnitude,
       const gsl::not_null<mortar_data_history_type*> mortar_data_history,
+      const gsl::not_null<evolution::dg::SharedMortarDataBuffer<dim>*>
+          shared_mortar_data_buffer,
       const Mesh<dim>& new_mesh, const Element<dim>& new_element,
       const std::unordered_map<ElementId<dim>, amr::Info<dim>>& neighbor_info,
       const ::dg::MortarMap<dim, Mesh<dim>>& neighbor_mesh,
       const std::pair<Mesh<dim>, Element<dim>>& old_mesh_and_element) {
+    shared_mortar_data_buffer->release(mortar_data);
     detail::p_project(mortar_data, mortar_mesh, mortar_size,
                       mortar_next_temporal_id, normal_covector_and_magnitude,
                       mortar_data_history, new_mesh, new_element, neighbor_info,
@@ -328,6 +339,8 @@ struct ProjectMortars : tt::ConformsTo<amr::protocols::Projector> {
       /*normal_covector_and_magnitude*/,
       const gsl::not_null<mortar_data_history_type*>
       /*mortar_data_history*/,
+      const gsl::not_null<evolution::dg::SharedMortarDataBuffer<dim>*>
+      /*shared_mortar_data_buffer*/,
       const Mesh<dim>& /*new_mesh*/, const Element<dim>& /*new_element*/,
       const std::unordered_map<ElementId<dim>,
                                amr::Info<dim>>& /*neighbor_info*/,
@@ -352,6 +365,8 @@ struct ProjectMortars : tt::ConformsTo<amr::protocols::Projector> {
       /*normal_covector_and_magnitude*/,
       const gsl::not_null<mortar_data_history_type*>
       /*mortar_data_history*/,
+      const gsl::not_null<evolution::dg::SharedMortarDataBuffer<dim>*>
+      /*shared_mortar_data_buffer*/,
       const Mesh<dim>& /*new_mesh*/, const Element<dim>& /*new_element*/,
       const std::unordered_map<ElementId<dim>,
                                amr::Info<dim>>& /*neighbor_info*/,
@@ -24,7 +24,14 @@
 namespace evolution::dg {
 template <size_t Dim>
 void MortarData<Dim>::pup(PUP::er& p) {
-  p | mortar_data;
+  if (mortar_data.has_value() and not mortar_data->is_owning()) {
+    // Data shared through a `SharedMortarDataBuffer` is a view, which is
+    // serialized as a copy and unpacked as owning data.
+    std::optional<DataVector> owned_mortar_data{*mortar_data};
+    p | owned_mortar_data;
+  } else {
+    p | mortar_data;
+  }
   p | face_normal_magnitude;
   p | face_det_jacobian;
   p | volume_det_inv_jacobian;
@@ -45,9 +52,12 @@ void p_project(
       if (old_mortar_mesh != new_mortar_mesh) {
         const auto mortar_projection_matrices =
             Spectral::p_projection_matrices(old_mortar_mesh, new_mortar_mesh);
-        DataVector& vars = mortar_data->mortar_data.value();
-        vars = apply_matrices(mortar_projection_matrices, vars,
-                              old_mortar_mesh.extents());
+        // Emplace rather than assign so that a view into a
+        // `SharedMortarDataBuffer` is replaced instead of written to.
+        mortar_data->mortar_data.emplace(
+            apply_matrices(mortar_projection_matrices,
+                           mortar_data->mortar_data.value(),
+                           old_mortar_mesh.extents()));
         mortar_data->mortar_mesh = new_mortar_mesh;
       }
     }
@@ -90,9 +100,11 @@ void p_project_only_mortar_data(
     const auto& old_mortar_mesh = mortar_data->mortar_mesh.value();
     const auto mortar_projection_matrices =
         Spectral::p_projection_matrices(old_mortar_mesh, new_mortar_mesh);
-    DataVector& vars = mortar_data->mortar_data.value();
-    vars = apply_matrices(mortar_projection_matrices, vars,
-                          old_mortar_mesh.extents());
+    // Emplace rather than assign so that a view into a
+    // `SharedMortarDataBuffer` is replaced instead of written to.
+    mortar_data->mortar_data.emplace(apply_matrices(
+        mortar_projection_matrices, mortar_data->mortar_data.value(),
+        old_mortar_mesh.extents()));
     mortar_data->mortar_mesh = new_mortar_mesh;
   } else {
     (void)mortar_data;
@@ -20,6 +20,8 @@ template <size_t Dim>
 class MortarData;
 template <size_t Dim>
 class MortarDataHolder;
+template <size_t Dim>
+class SharedMortarDataBuffer;
 }  // namespace evolution::dg
 namespace Spectral {
 enum class ChildSize : uint8_t;
@@ -59,6 +61,15 @@ struct MortarDataHistory : db::SimpleTag {
                                          CouplingResult>>;
 };
 
+/// Local mortar data that is shared with neighbors on the same node without
+/// copying it. See `evolution::dg::SharedMortarDataBuffer`.
+///
+/// The `Dim` is the volume dimension, not the face dimension.
+template <size_t Dim>
+struct SharedMortarDataBuffer : db::SimpleTag {
+  using type = evolution::dg::SharedMortarDataBuffer<Dim>;
+};
+
 /// Mesh on the mortars, indexed by (Direction, ElementId) pairs
 ///
 /// The `Dim` is the volume dimension, not the face dimension.
@@ -0,0 +1,130 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DiscontinuousGalerkin/SharedMortarDataBuffer.hpp"
+
+#include <cstddef>
+#include <pup.h>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/PupStlCpp11.hpp"
+
+namespace evolution::dg {
+template <size_t Dim>
+void SharedMortarDataBuffer<Dim>::share(
+    const gsl::not_null<DataVector*> neighbor_mortar_data,
+    const gsl::not_null<MortarData<Dim>*> local_mortar_data,
+    const DirectionalId<Dim>& mortar_id, const TimeStepId& time_step_id) {
+  ASSERT(local_mortar_data->mortar_data.has_value() and
+             local_mortar_data->mortar_data->is_owning(),
+         "The local mortar data on " << mortar_id
+                                     << " must be set and owning to be shared. "
+                                        "Was reclaim() called?");
+  Slots& slots = slots_[mortar_id];
+  ASSERT(gsl::at(slots.data, slots.latest).empty() or
+             gsl::at(slots.time_step_ids, slots.latest) < time_step_id,
+         "Sharing mortar data on " << mortar_id << " at " << time_step_id
+                                   << ", which is not newer than the data at "
+                                   << gsl::at(slots.time_step_ids,
+                                              slots.latest));
+  const size_t older = 1 - slots.latest;
+  DataVector& slot = gsl::at(slots.data, older);
+  slot = std::move(*local_mortar_data->mortar_data);
+  gsl::at(slots.time_step_ids, older) = time_step_id;
+  slots.latest = older;
+  local_mortar_data->mortar_data.emplace(slot.data(), slot.size());
+  neighbor_mortar_data->set_data_ref(slot.data(), slot.size());
+}
+
+template <size_t Dim>
+void SharedMortarDataBuffer<Dim>::reclaim(
+    const gsl::not_null<DirectionalIdMap<Dim, MortarDataHolder<Dim>>*>
+        mortar_data) {
+  for (auto& [mortar_id, slots] : slots_) {
+    const auto it = mortar_data->find(mortar_id);
+    if (it == mortar_data->end()) {
+      continue;
+    }
+    auto& local_data = it->second.local().mortar_data;
+    if (local_data.has_value() and not local_data->is_owning()) {
+      ASSERT(local_data->data() == gsl::at(slots.data, slots.latest).data(),
+             "The local mortar data on " << mortar_id
+                                         << " is a view, but not of the most "
+                                            "recently shared data.");
+      // The neighbor has finished with the older slot, so its memory can be
+      // reused for the next time step. Its contents are overwritten.
+      local_data.emplace(std::move(gsl::at(slots.data, 1 - slots.latest)));
+    }
+  }
+}
+
+template <size_t Dim>
+void SharedMortarDataBuffer<Dim>::release(
+    const gsl::not_null<DirectionalIdMap<Dim, MortarDataHolder<Dim>>*>
+        mortar_data) {
+  for (auto& [mortar_id, mortar_data_holder] : *mortar_data) {
+    (void)mortar_id;
+    auto& local_data = mortar_data_holder.local().mortar_data;
+    if (local_data.has_value() and not local_data->is_owning()) {
+      DataVector owned_data{*local_data};
+      local_data.emplace(std::move(owned_data));
+    }
+  }
+  slots_.clear();
+}
+
+template <size_t Dim>
+const TimeStepId& SharedMortarDataBuffer<Dim>::latest_time_step_id(
+    const DirectionalId<Dim>& mortar_id) const {
+  const Slots& slots = slots_.at(mortar_id);
+  return gsl::at(slots.time_step_ids, slots.latest);
+}
+
+template <size_t Dim>
+void SharedMortarDataBuffer<Dim>::pup(PUP::er& p) {
+  p | slots_;
+}
+
+template <size_t Dim>
+void SharedMortarDataBuffer<Dim>::Slots::pup(PUP::er& p) {
+  p | data;
+  p | time_step_ids;
+  p | latest;
+}
+
+template <size_t Dim>
+bool SharedMortarDataBuffer<Dim>::Slots::operator==(const Slots& rhs) const {
+  return data == rhs.data and time_step_ids == rhs.time_step_ids and
+         latest == rhs.latest;
+}
+
+template <size_t Dim>
+bool operator==(const SharedMortarDataBuffer<Dim>& lhs,
+                const SharedMortarDataBuffer<Dim>& rhs) {
+  return lhs.slots_ == rhs.slots_;
+}
+
+template <size_t Dim>
+bool operator!=(const SharedMortarDataBuffer<Dim>& lhs,
+                const SharedMortarDataBuffer<Dim>& rhs) {
+  return not(lhs == rhs);
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                            \
+  template class SharedMortarDataBuffer<DIM(data)>;                       \
+  template bool operator==(const SharedMortarDataBuffer<DIM(data)>& lhs,  \
+                           const SharedMortarDataBuffer<DIM(data)>& rhs); \
+  template bool operator!=(const SharedMortarDataBuffer<DIM(data)>& lhs,  \
+                           const SharedMortarDataBuffer<DIM(data)>& rhs);
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace evolution::dg
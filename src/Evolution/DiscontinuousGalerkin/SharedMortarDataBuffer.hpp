@@ -0,0 +1,106 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/Structure/DirectionalId.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
+#include "Evolution/DiscontinuousGalerkin/MortarDataHolder.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace evolution::dg {
+/*!
+ * \brief Double-buffered storage of the local mortar data that an element
+ * shares with neighbors on the same node.
+ *
+ * \details With global time stepping and a `DgElementCollection`, an element
+ * does not copy its local mortar data into the message for a neighbor on the
+ * same node. Instead, `share()` moves the data into one of two slots kept for
+ * the mortar, leaves a non-owning view of the slot in the local `MortarData`,
+ * and returns a second view that is sent to the neighbor. The neighbor reads
+ * the data directly from the slot and drops its view once it has applied the
+ * boundary correction.
+ *
+ * Each slot records the `TimeStepId` of the data it holds. Data for a new
+ * time step always goes into the older slot. This is safe because an element
+ * cannot compute its mortar data for time step \f$t_{k+1}\f$ before it has
+ * received the neighbor's data for \f$t_k\f$, which the neighbor only sends
+ * after it has finished with our data for \f$t_{k-1}\f$. Before the mortar
+ * data for the next time step is computed, `reclaim()` turns the local view
+ * back into owning storage by taking over the memory of the older slot, so
+ * that in steady state no memory is allocated or copied.
+ *
+ * Local time stepping keeps neighbor data for several steps and so cannot use
+ * this buffer.
+ */
+template <size_t Dim>
+class SharedMortarDataBuffer {
+ public:
+  /// Move the local mortar data on `mortar_id` for `time_step_id` into the
+  /// older slot, replace it by a view of that slot, and make
+  /// `neighbor_mortar_data` a view of the slot for the neighbor.
+  ///
+  /// \note A non-owning DataVector cannot be move-assigned, so the view for
+  /// the neighbor is set up in place and should only be moved into
+  /// default-constructed storage, e.g. an empty `std::optional`.
+  void share(gsl::not_null<DataVector*> neighbor_mortar_data,
+             gsl::not_null<MortarData<Dim>*> local_mortar_data,
+             const DirectionalId<Dim>& mortar_id,
+             const TimeStepId& time_step_id);
+
+  /// Make all local mortar data that are views into this buffer owning again
+  /// before they are overwritten for the next time step.
+  void reclaim(gsl::not_null<DirectionalIdMap<Dim, MortarDataHolder<Dim>>*>
+                   mortar_data);
+
+  /// Copy all local mortar data that are views into this buffer into owning
+  /// storage and free the buffer. Used when the mortars change.
+  void release(gsl::not_null<DirectionalIdMap<Dim, MortarDataHolder<Dim>>*>
+                   mortar_data);
+
+  /// The `TimeStepId` of the most recently shared data on `mortar_id`.
+  const TimeStepId& latest_time_step_id(
+      const DirectionalId<Dim>& mortar_id) const;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  template <size_t LocalDim>
+  // NOLINTNEXTLINE(readability-redundant-declaration)
+  friend bool operator==(const SharedMortarDataBuffer<LocalDim>& lhs,
+                         const SharedMortarDataBuffer<LocalDim>& rhs);
+
+  struct Slots {
+    std::array<DataVector, 2> data{};
+    std::array<TimeStepId, 2> time_step_ids{};
+    size_t latest{1};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+    bool operator==(const Slots& rhs) const;
+  };
+
+  DirectionalIdMap<Dim, Slots> slots_{};
+};
+
+template <size_t Dim>
+bool operator==(const SharedMortarDataBuffer<Dim>& lhs,
+                const SharedMortarDataBuffer<Dim>& rhs);
+
+template <size_t Dim>
+bool operator!=(const SharedMortarDataBuffer<Dim>& lhs,
+                const SharedMortarDataBuffer<Dim>& rhs);
+}  // namespace evolution::dg
@@ -152,7 +152,7 @@ struct Domain {
 
     if (my_block.is_time_dependent()) {
       *grid_to_inertial_map =
-          my_block.moving_mesh_grid_to_inertial_map().get_clone();
+          my_block.moving_mesh_grid_to_inertial_map().get_element_clone();
     } else {
       *grid_to_inertial_map =
           ::domain::make_coordinate_map_base<Frame::Grid, Frame::Inertial>(
@@ -194,7 +194,7 @@ struct ProjectDomain : tt::ConformsTo<amr::protocols::Projector> {
     *element_map = ElementMap<Dim, Frame::Grid>{element_id, my_block};
     if (my_block.is_time_dependent()) {
       *grid_to_inertial_map =
-          my_block.moving_mesh_grid_to_inertial_map().get_clone();
+          my_block.moving_mesh_grid_to_inertial_map().get_element_clone();
     } else {
       *grid_to_inertial_map =
           ::domain::make_coordinate_map_base<Frame::Grid, Frame::Inertial>(
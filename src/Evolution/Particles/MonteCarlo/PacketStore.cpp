@@ -0,0 +1,235 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Particles/MonteCarlo/PacketStore.hpp"
+
+#include <pup.h>
+#include <pup_stl.h>
+#include <utility>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Particles::MonteCarlo {
+
+namespace {
+template <typename T>
+void permute(const gsl::not_null<std::vector<T>*> values,
+             const std::vector<size_t>& new_order) {
+  std::vector<T> permuted_values(values->size());
+  for (size_t i = 0; i < new_order.size(); ++i) {
+    permuted_values[i] = (*values)[new_order[i]];
+  }
+  *values = std::move(permuted_values);
+}
+
+template <typename T>
+void move_last_to(const gsl::not_null<std::vector<T>*> values,
+                  const size_t index) {
+  (*values)[index] = values->back();
+  values->pop_back();
+}
+}  // namespace
+
+PacketStore::PacketStore(const std::vector<Packet>& packets,
+                         const std::uint64_t first_id) {
+  reserve(packets.size());
+  for (size_t i = 0; i < packets.size(); ++i) {
+    push_back(packets[i], first_id + i);
+  }
+}
+
+void PacketStore::reserve(const size_t number_of_packets) {
+  species.reserve(number_of_packets);
+  number_of_neutrinos.reserve(number_of_packets);
+  index_of_closest_grid_point.reserve(number_of_packets);
+  time.reserve(number_of_packets);
+  momentum_upper_t.reserve(number_of_packets);
+  for (size_t d = 0; d < 3; ++d) {
+    gsl::at(coordinates, d).reserve(number_of_packets);
+    gsl::at(momentum, d).reserve(number_of_packets);
+  }
+  id.reserve(number_of_packets);
+  random_number_counter.reserve(number_of_packets);
+}
+
+void PacketStore::clear() {
+  species.clear();
+  number_of_neutrinos.clear();
+  index_of_closest_grid_point.clear();
+  time.clear();
+  momentum_upper_t.clear();
+  for (size_t d = 0; d < 3; ++d) {
+    gsl::at(coordinates, d).clear();
+    gsl::at(momentum, d).clear();
+  }
+  id.clear();
+  random_number_counter.clear();
+  bucket_offsets_.clear();
+}
+
+void PacketStore::push_back(const Packet& packet,
+                            const std::uint64_t packet_id,
+                            const std::uint64_t random_number_counter_) {
+  species.push_back(packet.species);
+  number_of_neutrinos.push_back(packet.number_of_neutrinos);
+  index_of_closest_grid_point.push_back(packet.index_of_closest_grid_point);
+  time.push_back(packet.time);
+  momentum_upper_t.push_back(packet.momentum_upper_t);
+  for (size_t d = 0; d < 3; ++d) {
+    gsl::at(coordinates, d).push_back(packet.coordinates.get(d));
+    gsl::at(momentum, d).push_back(packet.momentum.get(d));
+  }
+  id.push_back(packet_id);
+  random_number_counter.push_back(random_number_counter_);
+  bucket_offsets_.clear();
+}
+
+void PacketStore::swap_and_pop(const size_t packet_index) {
+  ASSERT(packet_index < size(), "Packet index " << packet_index
+                                                << " is out of bounds for "
+                                                << size() << " packets.");
+  move_last_to(make_not_null(&species), packet_index);
+  move_last_to(make_not_null(&number_of_neutrinos), packet_index);
+  move_last_to(make_not_null(&index_of_closest_grid_point), packet_index);
+  move_last_to(make_not_null(&time), packet_index);
+  move_last_to(make_not_null(&momentum_upper_t), packet_index);
+  for (size_t d = 0; d < 3; ++d) {
+    move_last_to(make_not_null(&gsl::at(coordinates, d)), packet_index);
+    move_last_to(make_not_null(&gsl::at(momentum, d)), packet_index);
+  }
+  move_last_to(make_not_null(&id), packet_index);
+  move_last_to(make_not_null(&random_number_counter), packet_index);
+  bucket_offsets_.clear();
+}
+
+Packet PacketStore::packet(const size_t packet_index) const {
+  ASSERT(packet_index < size(), "Packet index " << packet_index
+                                                << " is out of bounds for "
+                                                << size() << " packets.");
+  return Packet{species[packet_index],
+                number_of_neutrinos[packet_index],
+                index_of_closest_grid_point[packet_index],
+                time[packet_index],
+                coordinates[0][packet_index],
+                coordinates[1][packet_index],
+                coordinates[2][packet_index],
+                momentum_upper_t[packet_index],
+                momentum[0][packet_index],
+                momentum[1][packet_index],
+                momentum[2][packet_index]};
+}
+
+void PacketStore::set_packet(const size_t packet_index, const Packet& packet) {
+  ASSERT(packet_index < size(), "Packet index " << packet_index
+                                                << " is out of bounds for "
+                                                << size() << " packets.");
+  species[packet_index] = packet.species;
+  number_of_neutrinos[packet_index] = packet.number_of_neutrinos;
+  index_of_closest_grid_point[packet_index] =
+      packet.index_of_closest_grid_point;
+  time[packet_index] = packet.time;
+  momentum_upper_t[packet_index] = packet.momentum_upper_t;
+  for (size_t d = 0; d < 3; ++d) {
+    gsl::at(coordinates, d)[packet_index] = packet.coordinates.get(d);
+    gsl::at(momentum, d)[packet_index] = packet.momentum.get(d);
+  }
+}
+
+std::vector<Packet> PacketStore::packets() const {
+  std::vector<Packet> result{};
+  result.reserve(size());
+  for (size_t i = 0; i < size(); ++i) {
+    result.push_back(packet(i));
+  }
+  return result;
+}
+
+PhiloxRandomNumberGenerator PacketStore::random_number_generator(
+    const std::uint64_t seed, const size_t packet_index) const {
+  return {seed, id[packet_index], random_number_counter[packet_index]};
+}
+
+void PacketStore::set_random_number_counter(
+    const size_t packet_index, const PhiloxRandomNumberGenerator& generator) {
+  random_number_counter[packet_index] = generator.counter();
+}
+
+void PacketStore::sort_by_closest_grid_point(
+    const size_t number_of_grid_points) {
+  // Counting sort, which is stable and linear in the number of packets
+  bucket_offsets_.assign(number_of_grid_points + 2, 0);
+  for (const size_t grid_point : index_of_closest_grid_point) {
+    if (UNLIKELY(grid_point > number_of_grid_points)) {
+      ERROR("Packet closest to grid point "
+            << grid_point << ", but the element has only "
+            << number_of_grid_points << " grid points.");
+    }
+    ++bucket_offsets_[grid_point + 1];
+  }
+  for (size_t i = 1; i < bucket_offsets_.size(); ++i) {
+    bucket_offsets_[i] += bucket_offsets_[i - 1];
+  }
+  std::vector<size_t> new_order(size());
+  std::vector<size_t> next_in_bucket(bucket_offsets_.begin(),
+                                     bucket_offsets_.end() - 1);
+  for (size_t i = 0; i < size(); ++i) {
+    new_order[next_in_bucket[index_of_closest_grid_point[i]]++] = i;
+  }
+  permute(make_not_null(&species), new_order);
+  permute(make_not_null(&number_of_neutrinos), new_order);
+  permute(make_not_null(&index_of_closest_grid_point), new_order);
+  permute(make_not_null(&time), new_order);
+  permute(make_not_null(&momentum_upper_t), new_order);
+  for (size_t d = 0; d < 3; ++d) {
+    permute(make_not_null(&gsl::at(coordinates, d)), new_order);
+    permute(make_not_null(&gsl::at(momentum, d)), new_order);
+  }
+  permute(make_not_null(&id), new_order);
+  permute(make_not_null(&random_number_counter), new_order);
+}
+
+size_t PacketStore::bucket_begin(const size_t grid_point_index) const {
+  ASSERT(grid_point_index + 1 < bucket_offsets_.size(),
+         "The packets are not sorted, or grid point "
+             << grid_point_index << " is out of bounds.");
+  return bucket_offsets_[grid_point_index];
+}
+
+size_t PacketStore::bucket_end(const size_t grid_point_index) const {
+  ASSERT(grid_point_index + 1 < bucket_offsets_.size(),
+         "The packets are not sorted, or grid point "
+             << grid_point_index << " is out of bounds.");
+  return bucket_offsets_[grid_point_index + 1];
+}
+
+void PacketStore::pup(PUP::er& p) {
+  p | species;
+  p | number_of_neutrinos;
+  p | index_of_closest_grid_point;
+  p | time;
+  p | momentum_upper_t;
+  p | coordinates;
+  p | momentum;
+  p | id;
+  p | random_number_counter;
+  p | bucket_offsets_;
+}
+
+bool operator==(const PacketStore& lhs, const PacketStore& rhs) {
+  return lhs.species == rhs.species and
+         lhs.number_of_neutrinos == rhs.number_of_neutrinos and
+         lhs.index_of_closest_grid_point == rhs.index_of_closest_grid_point and
+         lhs.time == rhs.time and
+         lhs.momentum_upper_t == rhs.momentum_upper_t and
+         lhs.coordinates == rhs.coordinates and
+         lhs.momentum == rhs.momentum and lhs.id == rhs.id and
+         lhs.random_number_counter == rhs.random_number_counter;
+}
+
+bool operator!=(const PacketStore& lhs, const PacketStore& rhs) {
+  return not(lhs == rhs);
+}
+
+}  // namespace Particles::MonteCarlo
@@ -0,0 +1,124 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Evolution/Particles/MonteCarlo/Packet.hpp"
+#include "Evolution/Particles/MonteCarlo/PhiloxRandomNumberGenerator.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Particles::MonteCarlo {
+
+/*!
+ * \brief Structure-of-arrays storage for the Monte Carlo packets of an element
+ *
+ * Every member of `Packet` is stored in a separate contiguous array, so that
+ * loops over packets read only the data they need and can be vectorized over
+ * packets. Each packet additionally carries a unique `id` and the counter of a
+ * `PhiloxRandomNumberGenerator`, so the random numbers drawn for a packet don't
+ * depend on the order in which packets are processed.
+ *
+ * After `sort_by_closest_grid_point` the packets are ordered by
+ * `index_of_closest_grid_point`, and the packets closest to grid point `i` are
+ * those in `[bucket_begin(i), bucket_end(i))`. Packets with an index equal to
+ * the number of grid points (i.e. packets that left the element) are in the
+ * last bucket. Packets close to the same grid point are then processed
+ * together, which keeps the metric and opacities at that point in cache. Adding
+ * or removing packets, or changing their closest grid point, invalidates the
+ * buckets.
+ *
+ * \note The store and the `PhiloxRandomNumberGenerator` are not yet used by
+ * the evolution. `TemplatedLocalFunctions::evolve_packets` still processes a
+ * `std::vector<Packet>` one packet at a time with a `std::mt19937`, because
+ * every packet takes its own sequence of time steps between interactions.
+ */
+struct PacketStore {
+  PacketStore() = default;
+  /// Store the `packets`, with ids starting at `first_id`
+  explicit PacketStore(const std::vector<Packet>& packets,
+                       std::uint64_t first_id = 0);
+
+  size_t size() const { return species.size(); }
+  bool empty() const { return species.empty(); }
+  void reserve(size_t number_of_packets);
+  void clear();
+
+  /// Add a packet. Its random numbers are drawn from stream `packet_id`,
+  /// starting at `random_number_counter`.
+  void push_back(const Packet& packet, std::uint64_t packet_id,
+                 std::uint64_t random_number_counter = 0);
+
+  /// Remove the packet at `packet_index` by moving the last packet into its
+  /// place.
+  void swap_and_pop(size_t packet_index);
+
+  /// Copy of the packet at `packet_index`
+  Packet packet(size_t packet_index) const;
+
+  /// Overwrite the packet at `packet_index`, keeping its id and random number
+  /// counter.
+  void set_packet(size_t packet_index, const Packet& packet);
+
+  /// All packets, in the order in which they are stored
+  std::vector<Packet> packets() const;
+
+  /// A generator for the random numbers of the packet at `packet_index`,
+  /// continuing where the last generator for the packet stopped. Store the
+  /// counter of the generator with `set_random_number_counter` after use.
+  PhiloxRandomNumberGenerator random_number_generator(
+      std::uint64_t seed, size_t packet_index) const;
+
+  void set_random_number_counter(size_t packet_index,
+                                 const PhiloxRandomNumberGenerator& generator);
+
+  /// Stably sort the packets by `index_of_closest_grid_point` and compute the
+  /// buckets. All indices must be at most `number_of_grid_points`.
+  void sort_by_closest_grid_point(size_t number_of_grid_points);
+
+  /// The first packet closest to the grid point `grid_point_index`. Only valid
+  /// after `sort_by_closest_grid_point`.
+  size_t bucket_begin(size_t grid_point_index) const;
+  /// One past the last packet closest to the grid point `grid_point_index`.
+  /// Only valid after `sort_by_closest_grid_point`.
+  size_t bucket_end(size_t grid_point_index) const;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+  /// \see `Packet::species`
+  std::vector<size_t> species{};
+  /// \see `Packet::number_of_neutrinos`
+  std::vector<double> number_of_neutrinos{};
+  /// \see `Packet::index_of_closest_grid_point`
+  std::vector<size_t> index_of_closest_grid_point{};
+  /// \see `Packet::time`
+  std::vector<double> time{};
+  /// \see `Packet::momentum_upper_t`
+  std::vector<double> momentum_upper_t{};
+  /// Components of `Packet::coordinates`
+  std::array<std::vector<double>, 3> coordinates{};
+  /// Components of `Packet::momentum`
+  std::array<std::vector<double>, 3> momentum{};
+  /// Unique id of the packet, used as its random number stream
+  std::vector<std::uint64_t> id{};
+  /// Number of random values drawn for the packet so far
+  std::vector<std::uint64_t> random_number_counter{};
+
+ private:
+  std::vector<size_t> bucket_offsets_{};
+};
+
+bool operator==(const PacketStore& lhs, const PacketStore& rhs);
+bool operator!=(const PacketStore& lhs, const PacketStore& rhs);
+
+}  // namespace Particles::MonteCarlo
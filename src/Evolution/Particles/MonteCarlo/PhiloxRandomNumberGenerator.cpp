@@ -0,0 +1,40 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Particles/MonteCarlo/PhiloxRandomNumberGenerator.hpp"
+
+#include <pup.h>
+#include <pup_stl.h>
+
+namespace Particles::MonteCarlo {
+
+PhiloxRandomNumberGenerator::PhiloxRandomNumberGenerator(
+    const std::uint64_t seed, const std::uint64_t stream,
+    const std::uint64_t counter)
+    : key_{static_cast<std::uint32_t>(seed),
+           static_cast<std::uint32_t>(seed >> 32)},
+      stream_{static_cast<std::uint32_t>(stream),
+              static_cast<std::uint32_t>(stream >> 32)},
+      counter_(counter) {}
+
+void PhiloxRandomNumberGenerator::pup(PUP::er& p) {
+  p | key_;
+  p | stream_;
+  p | counter_;
+  if (p.isUnpacking()) {
+    cached_block_ = std::numeric_limits<std::uint64_t>::max();
+  }
+}
+
+bool operator==(const PhiloxRandomNumberGenerator& lhs,
+                const PhiloxRandomNumberGenerator& rhs) {
+  return lhs.key_ == rhs.key_ and lhs.stream_ == rhs.stream_ and
+         lhs.counter_ == rhs.counter_;
+}
+
+bool operator!=(const PhiloxRandomNumberGenerator& lhs,
+                const PhiloxRandomNumberGenerator& rhs) {
+  return not(lhs == rhs);
+}
+
+}  // namespace Particles::MonteCarlo
@@ -0,0 +1,134 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "Utilities/ForceInline.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Particles::MonteCarlo {
+
+namespace detail {
+/// The Philox4x32-10 bijection of Salmon et al. (2011), "Parallel random
+/// numbers: as easy as 1, 2, 3". Maps a 128-bit counter to 128 random bits
+/// for a given 64-bit key.
+SPECTRE_ALWAYS_INLINE std::array<std::uint32_t, 4> philox4x32(
+    std::array<std::uint32_t, 4> counter, std::array<std::uint32_t, 2> key) {
+  constexpr std::uint64_t multiplier_0 = 0xD2511F53;
+  constexpr std::uint64_t multiplier_1 = 0xCD9E8D57;
+  constexpr std::uint32_t weyl_0 = 0x9E3779B9;
+  constexpr std::uint32_t weyl_1 = 0xBB67AE85;
+  for (size_t round = 0; round < 10; ++round) {
+    if (round > 0) {
+      key[0] += weyl_0;
+      key[1] += weyl_1;
+    }
+    const std::uint64_t product_0 = multiplier_0 * counter[0];
+    const std::uint64_t product_1 = multiplier_1 * counter[2];
+    counter = {
+        static_cast<std::uint32_t>(product_1 >> 32) ^ counter[1] ^ key[0],
+        static_cast<std::uint32_t>(product_1),
+        static_cast<std::uint32_t>(product_0 >> 32) ^ counter[3] ^ key[1],
+        static_cast<std::uint32_t>(product_0)};
+  }
+  return counter;
+}
+}  // namespace detail
+
+/*!
+ * \brief Counter-based random number generator for Monte Carlo packets
+ *
+ * The random numbers are a pure function of the `seed`, the `stream` and the
+ * number of values drawn so far (the counter), computed with the Philox4x32-10
+ * bijection. Giving every packet its own stream (e.g. its id in the
+ * `PacketStore`) and storing the counter with the packet makes the random
+ * numbers of a packet independent of the order in which packets are
+ * processed, so that packets can be evolved in any order or in parallel and
+ * still give reproducible results. Unlike `std::mt19937` the state is only
+ * four integers, so it is cheap to create a generator for each packet.
+ *
+ * The class satisfies the requirements of a `UniformRandomBitGenerator`, so it
+ * can be used with the distributions of the standard library. Prefer
+ * `uniform_zero_to_one` and `uniform_eps_to_one` where possible, because they
+ * give the same values on all platforms.
+ */
+class PhiloxRandomNumberGenerator {
+ public:
+  using result_type = std::uint32_t;
+
+  PhiloxRandomNumberGenerator() = default;
+  PhiloxRandomNumberGenerator(std::uint64_t seed, std::uint64_t stream,
+                              std::uint64_t counter = 0);
+
+  static constexpr result_type min() {
+    return std::numeric_limits<result_type>::min();
+  }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /// The next 32 random bits
+  SPECTRE_ALWAYS_INLINE result_type operator()() {
+    const std::uint64_t block = counter_ / 4;
+    if (block != cached_block_) {
+      cached_block_ = block;
+      cached_values_ = detail::philox4x32(
+          {static_cast<std::uint32_t>(cached_block_),
+           static_cast<std::uint32_t>(cached_block_ >> 32), stream_[0],
+           stream_[1]},
+          key_);
+    }
+    return gsl::at(cached_values_, counter_++ % 4);
+  }
+
+  /// A uniformly distributed number in \f$[0,1)\f$ with 53 random bits
+  SPECTRE_ALWAYS_INLINE double uniform_zero_to_one() {
+    const std::uint64_t high = operator()();
+    const std::uint64_t low = operator()();
+    return static_cast<double>(((high << 32) | low) >> 11) * 0x1.0p-53;
+  }
+
+  /// A uniformly distributed number in \f$(0,1]\f$, which can be passed to
+  /// a logarithm to sample the distance to the next interaction
+  SPECTRE_ALWAYS_INLINE double uniform_eps_to_one() {
+    return 1.0 - uniform_zero_to_one();
+  }
+
+  /// Skip the next `number_of_values` 32-bit values
+  void discard(std::uint64_t number_of_values) {
+    counter_ += number_of_values;
+  }
+
+  /// The number of 32-bit values drawn so far. Store this to continue the
+  /// sequence later with the same seed and stream.
+  std::uint64_t counter() const { return counter_; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  friend bool operator==(const PhiloxRandomNumberGenerator& lhs,
+                         const PhiloxRandomNumberGenerator& rhs);
+
+  std::array<std::uint32_t, 2> key_{};
+  std::array<std::uint32_t, 2> stream_{};
+  std::uint64_t counter_ = 0;
+  std::uint64_t cached_block_ = std::numeric_limits<std::uint64_t>::max();
+  std::array<std::uint32_t, 4> cached_values_{};
+};
+
+bool operator!=(const PhiloxRandomNumberGenerator& lhs,
+                const PhiloxRandomNumberGenerator& rhs);
+
+}  // namespace Particles::MonteCarlo
@@ -178,6 +178,11 @@ struct TemplatedLocalFunctions {
    * The absorption and scattering opacity tables include ghost
    * zones, and so do the coupling terms. Other variables are
    * only using live points.
+   *
+   * The packets are evolved one at a time, each with its own sequence
+   * of time steps, and all random numbers are drawn from the single
+   * `random_number_generator`. The results therefore depend on the
+   * order of the packets. This function doesn't use the `PacketStore`.
    */
   void evolve_packets(
       gsl::not_null<std::vector<Packet>*> packets,
@@ -3,20 +3,23 @@
 
 #include "Evolution/Systems/Cce/LinearSolve.hpp"
 
+#include <algorithm>
+#include <complex>
 #include <cstddef>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/SpinWeighted.hpp"
-#include "DataStructures/Transpose.hpp"
 #include "NumericalAlgorithms/LinearOperators/IndefiniteIntegral.hpp"
-#include "NumericalAlgorithms/LinearSolver/Lapack.hpp"
+#include "NumericalAlgorithms/LinearSolver/BatchedLinearSolve.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCoefficients.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/StaticCache.hpp"
 #include "Utilities/VectorAlgebra.hpp"
@@ -132,23 +135,6 @@ void radial_integrate_cce_pole_equations(
   *integral_result += outer_product(boundary_correction, one_minus_y_squared);
 }
 
-namespace detail {
-void transpose_to_reals_then_imags_radial_stripes(
-    const gsl::not_null<DataVector*> result, const ComplexDataVector& input,
-    const size_t number_of_radial_points,
-    const size_t number_of_angular_points) {
-  for (size_t i = 0; i < input.size() * 2; ++i) {
-    (*result)[i] = ((i / number_of_radial_points) % 2) == 0
-                       ? real(input[number_of_angular_points *
-                                        (i % number_of_radial_points) +
-                                    i / (2 * number_of_radial_points)])
-                       : imag(input[number_of_angular_points *
-                                        (i % number_of_radial_points) +
-                                    i / (2 * number_of_radial_points)]);
-  }
-}
-}  // namespace detail
-
 // generic template applies to `Tags::BondiBeta` and `Tags::BondiU`
 template <template <typename> class BoundaryPrefix, typename Tag>
 void RadialIntegrateBondi<BoundaryPrefix, Tag>::apply(
@@ -221,106 +207,136 @@ void RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH>::apply(
     const size_t l_max, const size_t number_of_radial_points) {
   const size_t number_of_angular_points =
       Spectral::Swsh::number_of_swsh_collocation_points(l_max);
+  // The real and imaginary parts of the radial stripe at each angular point
+  // are solved for as one real system of this size.
+  const size_t system_size = 2 * number_of_radial_points;
 
-  Matrix operator_matrix(2 * number_of_radial_points,
-                         2 * number_of_radial_points);
-
-  ComplexDataVector integrand =
+  const ComplexDataVector integrand =
       get(pole_of_integrand).data() +
       get(one_minus_y).data() * get(regular_integrand).data();
-
-  DataVector transpose_buffer{2 * get(pole_of_integrand).size()};
-  DataVector linear_solve_buffer{2 * get(pole_of_integrand).size()};
-
-  // transpose such that each radial slice is split up into the order:
-  // (real radial slice 00) (imag radial slice 00) (real radial slice 01) ...
-  detail::transpose_to_reals_then_imags_radial_stripes(
-      make_not_null(&linear_solve_buffer), integrand, number_of_radial_points,
-      number_of_angular_points);
-
-  raw_transpose(make_not_null(transpose_buffer.data()),
-                linear_solve_buffer.data(), number_of_radial_points,
-                2 * number_of_angular_points);
+  const ComplexDataVector& linear_factor_data = get(linear_factor).data();
+  const ComplexDataVector& linear_factor_of_conjugate_data =
+      get(linear_factor_of_conjugate).data();
+  const ComplexDataVector& boundary_data = get(boundary).data();
+  ComplexDataVector& result = get(*integral_result).data();
 
   const auto& derivative_matrix =
       Spectral::differentiation_matrix<Spectral::Basis::Legendre,
                                        Spectral::Quadrature::GaussLobatto>(
           number_of_radial_points);
-  for (size_t offset = 0; offset < number_of_angular_points; ++offset) {
-    // on repeated evaluations, the matrix gets permuted by the dgesv routine.
-    // We'll ignore its pivots and just overwrite the whole thing on each
-    // pass. There are probably optimizations that can be made which make use
-    // of the pivots.
 
-    // first we apply the (1 - y) \partial_y part of the matrix
-    // to the upper right (real-real) and lower left (imag-imag) part of the
-    // matrix
-    for (size_t matrix_block = 0; matrix_block < 2; ++matrix_block) {
+  // The systems of neighboring angular points are solved together with the
+  // batched solver, which vectorizes over the angular points. The batches are
+  // limited so their matrices stay in cache.
+  constexpr size_t maximum_batch_size = 32;
+  DataVector operator_matrices{};
+  DataVector linear_solve_buffer{};
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (size_t batch_start = 0; batch_start < number_of_angular_points;
+       batch_start += maximum_batch_size) {
+    const size_t batch_size = std::min(
+        maximum_batch_size, number_of_angular_points - batch_start);
+    if (linear_solve_buffer.size() != system_size * batch_size) {
+      operator_matrices.destructive_resize(system_size * system_size *
+                                           batch_size);
+      linear_solve_buffer.destructive_resize(system_size * batch_size);
+    }
+    const auto matrix_entries = [&operator_matrices, &system_size,
+                                 &batch_size](const size_t row,
+                                              const size_t column) {
+      return operator_matrices.data() +
+             (row + system_size * column) * batch_size;
+    };
+    const auto fill_entries = [&matrix_entries, &batch_size](
+                                  const size_t row, const size_t column,
+                                  const double value) {
+      std::fill(matrix_entries(row, column),
+                matrix_entries(row, column) + batch_size, value);
+    };
+
+    // first we apply the (1 - y) \partial_y part of the matrix to the upper
+    // left (real-real) and lower right (imag-imag) blocks, and zero the
+    // other two blocks
+    for (size_t j = 0; j < number_of_radial_points; ++j) {
       for (size_t i = 0; i < number_of_radial_points; ++i) {
-        for (size_t j = 0; j < number_of_radial_points; ++j) {
-          operator_matrix(i + matrix_block * number_of_radial_points,
-                          j + matrix_block * number_of_radial_points) =
-              derivative_matrix(i, j) *
-              real(get(one_minus_y).data()[i * number_of_angular_points]);
-        }
+        const double value =
+            derivative_matrix(i, j) *
+            real(get(one_minus_y).data()[i * number_of_angular_points]);
+        fill_entries(i, j, value);
+        fill_entries(i + number_of_radial_points, j + number_of_radial_points,
+                     value);
+        fill_entries(i + number_of_radial_points, j, 0.0);
+        fill_entries(i, j + number_of_radial_points, 0.0);
       }
     }
 
-    // zero out the lower left and upper right part of the matrix
+    // gather the contributions to the matrix blocks from the linear factors,
+    // and split the integrand into its real and imaginary parts
     for (size_t i = 0; i < number_of_radial_points; ++i) {
-      for (size_t j = 0; j < number_of_radial_points; ++j) {
-        operator_matrix(i + number_of_radial_points, j) = 0.0;
-        operator_matrix(i, j + number_of_radial_points) = 0.0;
+      double* const upper_left = matrix_entries(i, i);
+      double* const upper_right =
+          matrix_entries(i, number_of_radial_points + i);
+      double* const lower_left = matrix_entries(number_of_radial_points + i, i);
+      double* const lower_right = matrix_entries(number_of_radial_points + i,
+                                                 number_of_radial_points + i);
+      double* const real_rhs = linear_solve_buffer.data() + i * batch_size;
+      double* const imag_rhs =
+          linear_solve_buffer.data() +
+          (number_of_radial_points + i) * batch_size;
+      const size_t offset = batch_start + i * number_of_angular_points;
+      for (size_t b = 0; b < batch_size; ++b) {
+        const std::complex<double> sum =
+            linear_factor_data[offset + b] +
+            linear_factor_of_conjugate_data[offset + b];
+        const std::complex<double> difference =
+            linear_factor_data[offset + b] -
+            linear_factor_of_conjugate_data[offset + b];
+        upper_left[b] += real(sum);
+        upper_right[b] -= imag(difference);
+        lower_left[b] += imag(sum);
+        lower_right[b] += real(difference);
+        real_rhs[b] = real(integrand[offset + b]);
+        imag_rhs[b] = imag(integrand[offset + b]);
       }
     }
 
-    // gather the contributions to the matrix blocks from the linear factors
-    // each, we zero the first row
+    // the first row of the real and the imaginary part impose the boundary
+    // condition
+    for (size_t j = 0; j < system_size; ++j) {
+      fill_entries(0, j, 0.0);
+      fill_entries(number_of_radial_points, j, 0.0);
+    }
+    fill_entries(0, 0, 1.0);
+    fill_entries(number_of_radial_points, number_of_radial_points, 1.0);
+    for (size_t b = 0; b < batch_size; ++b) {
+      linear_solve_buffer[b] = real(boundary_data[batch_start + b]);
+      linear_solve_buffer[number_of_radial_points * batch_size + b] =
+          imag(boundary_data[batch_start + b]);
+    }
+
+    const int info = LinearSolver::Serial::batched_linear_solve(
+        make_not_null(&linear_solve_buffer), make_not_null(&operator_matrices),
+        system_size);
+    if (UNLIKELY(info != 0)) {
+      ERROR("The radial linear solve is singular: zero pivot in column "
+            << info - 1 << " of the system at an angular point in ["
+            << batch_start << ", " << batch_start + batch_size << ").");
+    }
+
     for (size_t i = 0; i < number_of_radial_points; ++i) {
-      const size_t linear_factor_index = offset + i * number_of_angular_points;
-      // upper left
-      operator_matrix(i, i) +=
-          real(get(linear_factor).data()[linear_factor_index] +
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(0, i) = 0.0;
-      // upper right
-      operator_matrix(i, number_of_radial_points + i) -=
-          imag(get(linear_factor).data()[linear_factor_index] -
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(0, number_of_radial_points + i) = 0.0;
-      // lower left
-      operator_matrix(number_of_radial_points + i, i) +=
-          imag(get(linear_factor).data()[linear_factor_index] +
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(number_of_radial_points, i) = 0.0;
-      // lower right
-      operator_matrix(number_of_radial_points + i,
-                      number_of_radial_points + i) +=
-          real(get(linear_factor).data()[linear_factor_index] -
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(number_of_radial_points, number_of_radial_points + i) =
-          0.0;
+      const double* const real_solution =
+          linear_solve_buffer.data() + i * batch_size;
+      const double* const imag_solution =
+          linear_solve_buffer.data() +
+          (number_of_radial_points + i) * batch_size;
+      const size_t offset = batch_start + i * number_of_angular_points;
+      for (size_t b = 0; b < batch_size; ++b) {
+        result[offset + b] =
+            std::complex<double>(real_solution[b], imag_solution[b]);
+      }
     }
-    operator_matrix(0, 0) = 1.0;
-    operator_matrix(number_of_radial_points, number_of_radial_points) = 1.0;
-    // put the data currently in integrand into a real DataVector of twice the
-    // length
-    linear_solve_buffer[offset * 2 * number_of_radial_points] =
-        real(get(boundary).data()[offset]);
-    linear_solve_buffer[(offset * 2 + 1) * number_of_radial_points] =
-        imag(get(boundary).data()[offset]);
-    DataVector linear_solve_buffer_view{
-        linear_solve_buffer.data() + offset * 2 * number_of_radial_points,
-        2 * number_of_radial_points};
-    lapack::general_matrix_linear_solve(
-        make_not_null(&linear_solve_buffer_view),
-        make_not_null(&operator_matrix));
   }
-  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-  raw_transpose(make_not_null(reinterpret_cast<double*>(
-                    get(*integral_result).data().data())),
-                linear_solve_buffer.data(), number_of_radial_points,
-                2 * number_of_angular_points);
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 }
 
 template struct RadialIntegrateBondi<Tags::BoundaryValue, Tags::BondiBeta>;
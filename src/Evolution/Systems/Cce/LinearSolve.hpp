@@ -54,15 +54,6 @@ void radial_integrate_cce_pole_equations(
     const ComplexDataVector& boundary, const ComplexDataVector& one_minus_y,
     size_t l_max, size_t number_of_radial_points);
 
-namespace detail {
-// needed because the standard transpose utility cannot create an arbitrary
-// ordering of blocks of data. This returns by pointer the configuration useful
-// for the linear solve step for H integration
-void transpose_to_reals_then_imags_radial_stripes(
-    gsl::not_null<DataVector*> result, const ComplexDataVector& input,
-    size_t number_of_radial_points, size_t number_of_angular_points);
-}  // namespace detail
-
 /// @{
 /*!
  * \brief Computational structs for evaluating the hypersurface integrals during
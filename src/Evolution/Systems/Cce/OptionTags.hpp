@@ -159,6 +159,15 @@ struct H5LookaheadTimes {
   using group = Cce;
 };
 
+struct H5PrefetchDepth {
+  using type = size_t;
+  static constexpr Options::String help{
+      "Number of the following H5LookaheadTimes-sized reads to start on helper "
+      "threads ahead of time. 0 reads the data only when it is needed."};
+  static size_t suggested_value() { return 1; }
+  using group = Cce;
+};
+
 struct H5Interpolator {
   using type = std::unique_ptr<intrp::SpanInterpolator>;
   static constexpr Options::String help{
@@ -316,14 +325,15 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
       Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>>;
   using option_tags =
       tmpl::list<OptionTags::LMax, OptionTags::BoundaryDataFilename,
-                 OptionTags::H5LookaheadTimes, OptionTags::H5Interpolator,
-                 OptionTags::H5IsBondiData, OptionTags::FixSpecNormalization,
+                 OptionTags::H5LookaheadTimes, OptionTags::H5PrefetchDepth,
+                 OptionTags::H5Interpolator, OptionTags::H5IsBondiData,
+                 OptionTags::FixSpecNormalization,
                  OptionTags::StandaloneExtractionRadius>;
 
   static constexpr bool pass_metavariables = false;
   static type create_from_options(
       const size_t l_max, const std::string& filename,
-      const size_t number_of_lookahead_times,
+      const size_t number_of_lookahead_times, const size_t prefetch_depth,
       const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
       const bool h5_is_bondi_data, const bool fix_spec_normalization,
       const std::optional<double> extraction_radius) {
@@ -340,7 +350,8 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
       return std::make_unique<BondiWorldtubeDataManager>(
           std::make_unique<BondiWorldtubeH5BufferUpdater>(filename,
                                                           extraction_radius),
-          l_max, number_of_lookahead_times, interpolator->get_clone());
+          l_max, number_of_lookahead_times, interpolator->get_clone(),
+          prefetch_depth);
     } else {
       Parallel::printf(
           "\nDEPRECATION WARNING: Reading worldtube H5 files that are in the "
@@ -354,7 +365,7 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
           std::make_unique<MetricWorldtubeH5BufferUpdater>(filename,
                                                            extraction_radius),
           l_max, number_of_lookahead_times, interpolator->get_clone(),
-          fix_spec_normalization);
+          fix_spec_normalization, prefetch_depth);
     }
   }
 };
@@ -365,19 +376,21 @@ struct KleinGordonH5WorldtubeBoundaryDataManager : db::SimpleTag {
       WorldtubeDataManager<Tags::klein_gordon_worldtube_boundary_tags>>;
   using option_tags =
       tmpl::list<OptionTags::LMax, OptionTags::KleinGordonBoundaryDataFilename,
-                 OptionTags::H5LookaheadTimes, OptionTags::H5Interpolator,
+                 OptionTags::H5LookaheadTimes, OptionTags::H5PrefetchDepth,
+                 OptionTags::H5Interpolator,
                  OptionTags::StandaloneExtractionRadius>;
 
   static constexpr bool pass_metavariables = false;
   static type create_from_options(
       const size_t l_max, const std::string& filename,
-      const size_t number_of_lookahead_times,
+      const size_t number_of_lookahead_times, const size_t prefetch_depth,
       const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
       const std::optional<double> extraction_radius) {
     return std::make_unique<KleinGordonWorldtubeDataManager>(
         std::make_unique<KleinGordonWorldtubeH5BufferUpdater>(
             filename, extraction_radius),
-        l_max, number_of_lookahead_times, interpolator->get_clone());
+        l_max, number_of_lookahead_times, interpolator->get_clone(),
+        prefetch_depth);
   }
 };
 
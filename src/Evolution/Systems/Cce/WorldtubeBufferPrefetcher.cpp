@@ -0,0 +1,147 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/Cce/WorldtubeBufferPrefetcher.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/Cce/BoundaryData.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTags.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Cce {
+template <typename BufferTags>
+WorldtubeBufferPrefetcher<BufferTags>::WorldtubeBufferPrefetcher(
+    const WorldtubeBufferUpdater<BufferTags>& buffer_updater,
+    const size_t lookahead_depth)
+    : lookahead_depth_{lookahead_depth} {
+  if (lookahead_depth_ > 0) {
+    prefetch_updater_ = buffer_updater.get_clone();
+  }
+}
+
+template <typename BufferTags>
+WorldtubeBufferPrefetcher<BufferTags>&
+WorldtubeBufferPrefetcher<BufferTags>::operator=(
+    WorldtubeBufferPrefetcher&& rhs) {
+  // Wait for the pending reads, which use `prefetch_updater_`, before it is
+  // replaced.
+  pending_windows_.clear();
+  lookahead_depth_ = rhs.lookahead_depth_;
+  prefetch_updater_ = std::move(rhs.prefetch_updater_);
+  pending_windows_ = std::move(rhs.pending_windows_);
+  return *this;
+}
+
+template <typename BufferTags>
+double WorldtubeBufferPrefetcher<BufferTags>::update_buffers_for_time(
+    const gsl::not_null<Variables<BufferTags>*> buffers,
+    const gsl::not_null<size_t*> time_span_start,
+    const gsl::not_null<size_t*> time_span_end, const double time,
+    const size_t computation_l_max, const size_t interpolator_length,
+    const size_t buffer_depth,
+    WorldtubeBufferUpdater<BufferTags>& buffer_updater,
+    const gsl::not_null<Parallel::NodeLock*> hdf5_lock) {
+  if (lookahead_depth_ == 0) {
+    const std::lock_guard hold_lock(*hdf5_lock);
+    return buffer_updater.update_buffers_for_time(
+        buffers, time_span_start, time_span_end, time, computation_l_max,
+        interpolator_length, buffer_depth);
+  }
+  const DataVector& time_buffer = buffer_updater.get_time_buffer();
+  // These are the same checks the buffer updaters do before reading
+  if (*time_span_end >= time_buffer.size()) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  if (*time_span_end > interpolator_length and
+      time_buffer[*time_span_end - interpolator_length] > time) {
+    return time_buffer[*time_span_end - interpolator_length + 1];
+  }
+
+  const auto needed_span = detail::create_span_for_time_value(
+      time, buffer_depth, interpolator_length, 0, time_buffer.size(),
+      time_buffer);
+  bool used_prefetched_window = false;
+  while (not pending_windows_.empty()) {
+    auto& [span, window_future] = pending_windows_.front();
+    if (span == needed_span) {
+      Window window = window_future.get();
+      *buffers = std::move(window.buffers);
+      *time_span_start = window.time_span_start;
+      *time_span_end = window.time_span_end;
+      used_prefetched_window = true;
+      pending_windows_.pop_front();
+      break;
+    }
+    // The requested time jumped past this window, so it is dropped. Destroying
+    // the future waits for its read to finish.
+    pending_windows_.pop_front();
+  }
+  double next_update_time = std::numeric_limits<double>::quiet_NaN();
+  if (used_prefetched_window) {
+    next_update_time = time_buffer[std::min(
+        *time_span_end - interpolator_length + 1, time_buffer.size() - 1)];
+  } else {
+    const std::lock_guard hold_lock(*hdf5_lock);
+    next_update_time = buffer_updater.update_buffers_for_time(
+        buffers, time_span_start, time_span_end, time, computation_l_max,
+        interpolator_length, buffer_depth);
+  }
+
+  // Schedule the windows that follow the last scheduled one
+  size_t last_span_end = pending_windows_.empty()
+                             ? *time_span_end
+                             : pending_windows_.back().first.second;
+  const size_t number_of_buffer_points = buffers->number_of_grid_points();
+  while (pending_windows_.size() < lookahead_depth_ and
+         last_span_end < time_buffer.size() and
+         last_span_end > interpolator_length) {
+    // The next update is requested at the first time past
+    // `time_buffer[last_span_end - interpolator_length]`. Predict it halfway to
+    // the next time in the file, so the span doesn't depend on the exact time.
+    const size_t trigger_index = last_span_end - interpolator_length;
+    const double predicted_time =
+        0.5 * (time_buffer[trigger_index] + time_buffer[trigger_index + 1]);
+    const auto predicted_span = detail::create_span_for_time_value(
+        predicted_time, buffer_depth, interpolator_length, 0,
+        time_buffer.size(), time_buffer);
+    if (predicted_span.second <= last_span_end) {
+      break;
+    }
+    pending_windows_.emplace_back(
+        predicted_span,
+        std::async(std::launch::async,
+                   [prefetch_updater = prefetch_updater_.get(), hdf5_lock,
+                    predicted_time, computation_l_max, interpolator_length,
+                    buffer_depth, number_of_buffer_points]() {
+                     Window window{
+                         0, 0, Variables<BufferTags>{number_of_buffer_points}};
+                     const std::lock_guard hold_lock(*hdf5_lock);
+                     prefetch_updater->update_buffers_for_time(
+                         make_not_null(&window.buffers),
+                         make_not_null(&window.time_span_start),
+                         make_not_null(&window.time_span_end), predicted_time,
+                         computation_l_max, interpolator_length, buffer_depth);
+                     return window;
+                   }));
+    last_span_end = predicted_span.second;
+  }
+  return next_update_time;
+}
+
+template class WorldtubeBufferPrefetcher<cce_metric_input_tags>;
+template class WorldtubeBufferPrefetcher<
+    Tags::worldtube_boundary_tags_for_writing<
+        Spectral::Swsh::Tags::SwshTransform>>;
+template class WorldtubeBufferPrefetcher<klein_gordon_input_tags>;
+}  // namespace Cce
@@ -0,0 +1,83 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <utility>
+
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Cce {
+/*!
+ * \brief Reads the upcoming windows of worldtube data on helper threads while
+ * the current window is in use.
+ *
+ * \details The `WorldtubeDataManager`s refill their buffers only when the
+ * requested time runs off the end of the current window. Reading the next
+ * window from the H5 file then stalls the evolution. With a nonzero
+ * `lookahead_depth` this class instead predicts the next `lookahead_depth`
+ * windows as soon as a window is loaded and reads them asynchronously with a
+ * clone of the buffer updater. The windows are predicted from the times in the
+ * file, assuming the next request comes between the two times at which the
+ * current window runs out. When a request needs a new window that matches the
+ * prefetched one, the buffers are swapped in; otherwise (e.g. when the
+ * requested time jumped ahead by more than one data point) the window is read
+ * synchronously as without prefetching. Either way the buffers hold the same
+ * data as a synchronous update, so the results don't depend on the
+ * prefetching.
+ *
+ * The helper threads hold the `hdf5_lock` while reading, like the
+ * synchronous reads, so they don't race with other HDF5 access on the node.
+ * The prefetched windows are not serialized.
+ */
+template <typename BufferTags>
+class WorldtubeBufferPrefetcher {
+ public:
+  WorldtubeBufferPrefetcher() = default;
+  WorldtubeBufferPrefetcher(
+      const WorldtubeBufferUpdater<BufferTags>& buffer_updater,
+      size_t lookahead_depth);
+  WorldtubeBufferPrefetcher(const WorldtubeBufferPrefetcher&) = delete;
+  WorldtubeBufferPrefetcher& operator=(const WorldtubeBufferPrefetcher&) =
+      delete;
+  WorldtubeBufferPrefetcher(WorldtubeBufferPrefetcher&&) = default;
+  WorldtubeBufferPrefetcher& operator=(WorldtubeBufferPrefetcher&& rhs);
+  ~WorldtubeBufferPrefetcher() = default;
+
+  size_t lookahead_depth() const { return lookahead_depth_; }
+
+  /// Has the same effect and return value as
+  /// `buffer_updater.update_buffers_for_time()`, but uses a prefetched window
+  /// if one is available. Locks the `hdf5_lock` only for synchronous reads.
+  double update_buffers_for_time(
+      gsl::not_null<Variables<BufferTags>*> buffers,
+      gsl::not_null<size_t*> time_span_start,
+      gsl::not_null<size_t*> time_span_end, double time,
+      size_t computation_l_max, size_t interpolator_length,
+      size_t buffer_depth, WorldtubeBufferUpdater<BufferTags>& buffer_updater,
+      gsl::not_null<Parallel::NodeLock*> hdf5_lock);
+
+ private:
+  struct Window {
+    size_t time_span_start = 0;
+    size_t time_span_end = 0;
+    Variables<BufferTags> buffers{};
+  };
+
+  size_t lookahead_depth_ = 0;
+  // Used only by the helper threads, so they don't share the H5 file handle
+  // with the synchronous reads.
+  std::unique_ptr<WorldtubeBufferUpdater<BufferTags>> prefetch_updater_{};
+  // Declared after `prefetch_updater_` so the pending reads are waited for
+  // before the updater they use is destroyed.
+  std::deque<std::pair<std::pair<size_t, size_t>, std::future<Window>>>
+      pending_windows_{};
+};
+}  // namespace Cce
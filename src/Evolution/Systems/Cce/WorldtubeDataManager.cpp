@@ -6,7 +6,6 @@
 #include <complex>
 #include <cstddef>
 #include <memory>
-#include <mutex>
 #include <utility>
 
 #include "DataStructures/ComplexModalVector.hpp"
@@ -17,6 +16,7 @@
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
 #include "Evolution/Systems/Cce/SpecBoundaryData.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferPrefetcher.hpp"
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCoefficients.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransform.hpp"
@@ -82,14 +82,12 @@ void populate_hypersurface_boundary_data(
     const gsl::not_null<Parallel::NodeLock*> hdf5_lock, const double time,
     const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
     const std::unique_ptr<WorldtubeBufferUpdater<InputTags>>& buffer_updater,
+    const gsl::not_null<WorldtubeBufferPrefetcher<InputTags>*> prefetcher,
     const size_t l_max, const size_t buffer_depth) {
-  {
-    const std::lock_guard hold_lock(*hdf5_lock);
-    buffer_updater->update_buffers_for_time(
-        coefficients_buffers, time_span_start, time_span_end, time, l_max,
-        interpolator->required_number_of_points_before_and_after(),
-        buffer_depth);
-  }
+  prefetcher->update_buffers_for_time(
+      coefficients_buffers, time_span_start, time_span_end, time, l_max,
+      interpolator->required_number_of_points_before_and_after(), buffer_depth,
+      *buffer_updater, hdf5_lock);
 
   auto interpolation_time_span = detail::create_span_for_time_value(
       time, 0, interpolator->required_number_of_points_before_and_after(),
@@ -166,8 +164,9 @@ MetricWorldtubeDataManager::MetricWorldtubeDataManager(
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
     std::unique_ptr<intrp::SpanInterpolator> interpolator,
-    const bool fix_spec_normalization)
+    const bool fix_spec_normalization, const size_t prefetch_depth)
     : buffer_updater_{std::move(buffer_updater)},
+      prefetcher_{*buffer_updater_, prefetch_depth},
       l_max_{l_max},
       fix_spec_normalization_{fix_spec_normalization},
       interpolated_coefficients_{
@@ -189,14 +188,11 @@ bool MetricWorldtubeDataManager::populate_hypersurface_boundary_data(
   if (buffer_updater_->time_is_outside_range(time)) {
     return false;
   }
-  {
-    const std::lock_guard hold_lock(*hdf5_lock);
-    buffer_updater_->update_buffers_for_time(
-        make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
-        make_not_null(&time_span_end_), time, l_max_,
-        interpolator_->required_number_of_points_before_and_after(),
-        buffer_depth_);
-  }
+  prefetcher_.update_buffers_for_time(
+      make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
+      make_not_null(&time_span_end_), time, l_max_,
+      interpolator_->required_number_of_points_before_and_after(),
+      buffer_depth_, *buffer_updater_, hdf5_lock);
   const auto interpolation_time_span = detail::create_span_for_time_value(
       time, 0, interpolator_->required_number_of_points_before_and_after(),
       time_span_start_, time_span_end_, buffer_updater_->get_time_buffer());
@@ -351,7 +347,8 @@ std::unique_ptr<WorldtubeDataManager<
 MetricWorldtubeDataManager::get_clone() const {
   return std::make_unique<MetricWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone(), fix_spec_normalization_);
+      interpolator_->get_clone(), fix_spec_normalization_,
+      prefetcher_.lookahead_depth());
 }
 
 std::pair<size_t, size_t> MetricWorldtubeDataManager::get_time_span() const {
@@ -366,7 +363,11 @@ void MetricWorldtubeDataManager::pup(PUP::er& p) {
   p | buffer_depth_;
   p | interpolator_;
   p | fix_spec_normalization_;
+  size_t prefetch_depth = prefetcher_.lookahead_depth();
+  p | prefetch_depth;
   if (p.isUnpacking()) {
+    prefetcher_ = WorldtubeBufferPrefetcher<cce_metric_input_tags>{
+        *buffer_updater_, prefetch_depth};
     detail::set_non_pupped_members<cce_metric_input_tags>(
         make_not_null(&time_span_start_), make_not_null(&time_span_end_),
         make_not_null(&coefficients_buffers_),
@@ -381,8 +382,10 @@ BondiWorldtubeDataManager::BondiWorldtubeDataManager(
             Spectral::Swsh::Tags::SwshTransform>>>
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
-    std::unique_ptr<intrp::SpanInterpolator> interpolator)
+    std::unique_ptr<intrp::SpanInterpolator> interpolator,
+    const size_t prefetch_depth)
     : buffer_updater_{std::move(buffer_updater)},
+      prefetcher_{*buffer_updater_, prefetch_depth},
       l_max_{l_max},
       interpolated_coefficients_{
           Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max)},
@@ -412,7 +415,7 @@ bool BondiWorldtubeDataManager::populate_hypersurface_boundary_data(
       boundary_data_variables, make_not_null(&interpolated_coefficients_),
       make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
       make_not_null(&time_span_end_), hdf5_lock, time, interpolator_,
-      buffer_updater_, l_max_, buffer_depth_);
+      buffer_updater_, make_not_null(&prefetcher_), l_max_, buffer_depth_);
 
   const auto& du_r = get(get<Tags::BoundaryValue<Tags::Du<Tags::BondiR>>>(
       *boundary_data_variables));
@@ -451,7 +454,7 @@ std::unique_ptr<WorldtubeDataManager<
 BondiWorldtubeDataManager::get_clone() const {
   return std::make_unique<BondiWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone());
+      interpolator_->get_clone(), prefetcher_.lookahead_depth());
 }
 
 std::pair<size_t, size_t> BondiWorldtubeDataManager::get_time_span() const {
@@ -465,7 +468,13 @@ void BondiWorldtubeDataManager::pup(PUP::er& p) {
   p | l_max_;
   p | buffer_depth_;
   p | interpolator_;
+  size_t prefetch_depth = prefetcher_.lookahead_depth();
+  p | prefetch_depth;
   if (p.isUnpacking()) {
+    prefetcher_ =
+        WorldtubeBufferPrefetcher<Tags::worldtube_boundary_tags_for_writing<
+            Spectral::Swsh::Tags::SwshTransform>>{*buffer_updater_,
+                                                  prefetch_depth};
     detail::set_non_pupped_members<Tags::worldtube_boundary_tags_for_writing<
         Spectral::Swsh::Tags::SwshTransform>>(
         make_not_null(&time_span_start_), make_not_null(&time_span_end_),
@@ -479,8 +488,10 @@ KleinGordonWorldtubeDataManager::KleinGordonWorldtubeDataManager(
     std::unique_ptr<WorldtubeBufferUpdater<klein_gordon_input_tags>>
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
-    std::unique_ptr<intrp::SpanInterpolator> interpolator)
+    std::unique_ptr<intrp::SpanInterpolator> interpolator,
+    const size_t prefetch_depth)
     : buffer_updater_{std::move(buffer_updater)},
+      prefetcher_{*buffer_updater_, prefetch_depth},
       l_max_{l_max},
       interpolated_coefficients_{
           Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max)},
@@ -506,7 +517,7 @@ bool KleinGordonWorldtubeDataManager::populate_hypersurface_boundary_data(
       boundary_data_variables, make_not_null(&interpolated_coefficients_),
       make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
       make_not_null(&time_span_end_), hdf5_lock, time, interpolator_,
-      buffer_updater_, l_max_, buffer_depth_);
+      buffer_updater_, make_not_null(&prefetcher_), l_max_, buffer_depth_);
 
   return true;
 }
@@ -516,7 +527,7 @@ std::unique_ptr<
 KleinGordonWorldtubeDataManager::get_clone() const {
   return std::make_unique<KleinGordonWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone());
+      interpolator_->get_clone(), prefetcher_.lookahead_depth());
 }
 
 std::pair<size_t, size_t> KleinGordonWorldtubeDataManager::get_time_span()
@@ -531,7 +542,11 @@ void KleinGordonWorldtubeDataManager::pup(PUP::er& p) {
   p | l_max_;
   p | buffer_depth_;
   p | interpolator_;
+  size_t prefetch_depth = prefetcher_.lookahead_depth();
+  p | prefetch_depth;
   if (p.isUnpacking()) {
+    prefetcher_ = WorldtubeBufferPrefetcher<klein_gordon_input_tags>{
+        *buffer_updater_, prefetch_depth};
     detail::set_non_pupped_members<klein_gordon_input_tags>(
         make_not_null(&time_span_start_), make_not_null(&time_span_end_),
         make_not_null(&coefficients_buffers_),
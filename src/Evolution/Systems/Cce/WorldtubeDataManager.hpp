@@ -11,6 +11,7 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferPrefetcher.hpp"
 #include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
 #include "Parallel/NodeLock.hpp"
@@ -46,6 +47,7 @@ void populate_hypersurface_boundary_data(
     gsl::not_null<Parallel::NodeLock*> hdf5_lock, double time,
     const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
     const std::unique_ptr<WorldtubeBufferUpdater<InputTags>>& buffer_updater,
+    gsl::not_null<WorldtubeBufferPrefetcher<InputTags>*> prefetcher,
     size_t l_max, size_t buffer_depth);
 }  // namespace detail
 
@@ -107,6 +109,8 @@ class WorldtubeDataManager : public PUP::able {
  * the `Interpolator` and the `buffer_depth` also passed to the constructor. A
  * longer depth will ensure that the buffer updater is called less frequently,
  * which is useful for slow updaters (e.g. those that perform file access).
+ * A nonzero `prefetch_depth` reads that many of the following buffers on
+ * helper threads ahead of time, see `Cce::WorldtubeBufferPrefetcher`.
  * The main functionality is provided by the
  * `WorldtubeDataManager::populate_hypersurface_boundary_data()` member
  * function that handles buffer updating and boundary computation.
@@ -123,7 +127,7 @@ class MetricWorldtubeDataManager
           buffer_updater,
       size_t l_max, size_t buffer_depth,
       std::unique_ptr<intrp::SpanInterpolator> interpolator,
-      bool fix_spec_normalization);
+      bool fix_spec_normalization, size_t prefetch_depth = 0);
 
   WRAPPED_PUPable_decl_template(MetricWorldtubeDataManager);  // NOLINT
 
@@ -169,6 +173,8 @@ class MetricWorldtubeDataManager
   std::unique_ptr<WorldtubeBufferUpdater<cce_metric_input_tags>>
       buffer_updater_;
   // NOLINTNEXTLINE(spectre-mutable)
+  mutable WorldtubeBufferPrefetcher<cce_metric_input_tags> prefetcher_;
+  // NOLINTNEXTLINE(spectre-mutable)
   mutable size_t time_span_start_ = 0;
   // NOLINTNEXTLINE(spectre-mutable)
   mutable size_t time_span_end_ = 0;
@@ -198,6 +204,8 @@ class MetricWorldtubeDataManager
  * the `Interpolator` and the `buffer_depth` also passed to the constructor. A
  * longer depth will ensure that the buffer updater is called less frequently,
  * which is useful for slow updaters (e.g. those that perform file access).
+ * A nonzero `prefetch_depth` reads that many of the following buffers on
+ * helper threads ahead of time, see `Cce::WorldtubeBufferPrefetcher`.
  * The main functionality is provided by the
  * `WorldtubeDataManager::populate_hypersurface_boundary_data()` member
  * function that handles buffer updating and boundary computation. This version
@@ -219,7 +227,8 @@ class BondiWorldtubeDataManager
               Spectral::Swsh::Tags::SwshTransform>>>
           buffer_updater,
       size_t l_max, size_t buffer_depth,
-      std::unique_ptr<intrp::SpanInterpolator> interpolator);
+      std::unique_ptr<intrp::SpanInterpolator> interpolator,
+      size_t prefetch_depth = 0);
 
   WRAPPED_PUPable_decl_template(BondiWorldtubeDataManager);  // NOLINT
 
@@ -267,6 +276,10 @@ class BondiWorldtubeDataManager
           Spectral::Swsh::Tags::SwshTransform>>>
       buffer_updater_;
   // NOLINTNEXTLINE(spectre-mutable)
+  mutable WorldtubeBufferPrefetcher<Tags::worldtube_boundary_tags_for_writing<
+      Spectral::Swsh::Tags::SwshTransform>>
+      prefetcher_;
+  // NOLINTNEXTLINE(spectre-mutable)
   mutable size_t time_span_start_ = 0;
   // NOLINTNEXTLINE(spectre-mutable)
   mutable size_t time_span_end_ = 0;
@@ -300,7 +313,8 @@ class KleinGordonWorldtubeDataManager
       std::unique_ptr<WorldtubeBufferUpdater<klein_gordon_input_tags>>
           buffer_updater,
       size_t l_max, size_t buffer_depth,
-      std::unique_ptr<intrp::SpanInterpolator> interpolator);
+      std::unique_ptr<intrp::SpanInterpolator> interpolator,
+      size_t prefetch_depth = 0);
 
   WRAPPED_PUPable_decl_template(KleinGordonWorldtubeDataManager);  // NOLINT
 
@@ -342,6 +356,8 @@ class KleinGordonWorldtubeDataManager
   std::unique_ptr<WorldtubeBufferUpdater<klein_gordon_input_tags>>
       buffer_updater_;
   // NOLINTNEXTLINE(spectre-mutable)
+  mutable WorldtubeBufferPrefetcher<klein_gordon_input_tags> prefetcher_;
+  // NOLINTNEXTLINE(spectre-mutable)
   mutable size_t time_span_start_ = 0;
   // NOLINTNEXTLINE(spectre-mutable)
   mutable size_t time_span_end_ = 0;
@@ -55,10 +55,11 @@ NumericInitialData::NumericInitialData(
     std::string file_glob, std::string subfile_name,
     std::variant<double, importers::ObservationSelector> observation_value,
     std::optional<double> observation_value_epsilon, bool enable_interpolation,
-    std::variant<AdmVars, GhVars> selected_variables)
-    : importer_options_(
-          std::move(file_glob), std::move(subfile_name), observation_value,
-          observation_value_epsilon.value_or(1.0e-12), enable_interpolation),
+    size_t number_of_threads, std::variant<AdmVars, GhVars> selected_variables)
+    : importer_options_(std::move(file_glob), std::move(subfile_name),
+                        observation_value,
+                        observation_value_epsilon.value_or(1.0e-12),
+                        enable_interpolation, number_of_threads),
       selected_variables_(std::move(selected_variables)) {}
 
 NumericInitialData::NumericInitialData(CkMigrateMessage* msg)
@@ -15,17 +15,19 @@ NumericInitialData::NumericInitialData(
     std::string file_glob, std::string subfile_name,
     std::variant<double, importers::ObservationSelector> observation_value,
     std::optional<double> observation_value_epsilon,
-    const bool enable_interpolation,
+    const bool enable_interpolation, const size_t number_of_threads,
     typename GhNumericId::Variables::type gh_selected_variables,
     typename HydroNumericId::Variables::type hydro_selected_variables,
     const double density_cutoff)
     : gh_numeric_id_(file_glob, subfile_name, observation_value,
                      observation_value_epsilon.value_or(1.0e-12),
-                     enable_interpolation, std::move(gh_selected_variables)),
+                     enable_interpolation, number_of_threads,
+                     std::move(gh_selected_variables)),
       hydro_numeric_id_(
           std::move(file_glob), std::move(subfile_name), observation_value,
           observation_value_epsilon.value_or(1.0e-12), enable_interpolation,
-          std::move(hydro_selected_variables), density_cutoff) {}
+          number_of_threads, std::move(hydro_selected_variables),
+          density_cutoff) {}
 
 NumericInitialData::NumericInitialData(CkMigrateMessage* msg)
     : InitialData(msg) {}
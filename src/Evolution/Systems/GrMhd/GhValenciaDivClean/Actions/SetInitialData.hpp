@@ -101,7 +101,7 @@ class NumericInitialData : public evolution::initial_data::InitialData,
       std::string file_glob, std::string subfile_name,
       std::variant<double, importers::ObservationSelector> observation_value,
       std::optional<double> observation_value_epsilon,
-      bool enable_interpolation,
+      bool enable_interpolation, size_t number_of_threads,
       typename GhNumericId::Variables::type gh_selected_variables,
       typename HydroNumericId::Variables::type hydro_selected_variables,
       double density_cutoff);
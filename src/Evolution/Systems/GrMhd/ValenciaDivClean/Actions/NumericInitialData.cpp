@@ -17,11 +17,12 @@ NumericInitialData::NumericInitialData(
     std::string file_glob, std::string subfile_name,
     std::variant<double, importers::ObservationSelector> observation_value,
     std::optional<double> observation_value_epsilon,
-    const bool enable_interpolation, PrimitiveVars selected_variables,
-    const double density_cutoff)
-    : importer_options_(
-          std::move(file_glob), std::move(subfile_name), observation_value,
-          observation_value_epsilon.value_or(1.0e-12), enable_interpolation),
+    const bool enable_interpolation, const size_t number_of_threads,
+    PrimitiveVars selected_variables, const double density_cutoff)
+    : importer_options_(std::move(file_glob), std::move(subfile_name),
+                        observation_value,
+                        observation_value_epsilon.value_or(1.0e-12),
+                        enable_interpolation, number_of_threads),
       selected_variables_(std::move(selected_variables)),
       density_cutoff_(density_cutoff) {}
 
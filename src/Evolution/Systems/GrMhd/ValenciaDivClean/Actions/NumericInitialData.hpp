@@ -136,8 +136,8 @@ class NumericInitialData : public evolution::initial_data::InitialData {
       std::string file_glob, std::string subfile_name,
       std::variant<double, importers::ObservationSelector> observation_value,
       std::optional<double> observation_value_epsilon,
-      bool enable_interpolation, PrimitiveVars selected_variables,
-      double density_cutoff);
+      bool enable_interpolation, size_t number_of_threads,
+      PrimitiveVars selected_variables, double density_cutoff);
 
   const importers::ImporterOptions& importer_options() const {
     return importer_options_;
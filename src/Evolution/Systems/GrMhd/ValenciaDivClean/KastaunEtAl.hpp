@@ -9,6 +9,8 @@
 #include <string>
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 /// \cond
 namespace EquationsOfState {
@@ -49,6 +51,14 @@ namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes {
  * of the spatial metric \f$\gamma_{kl}\f$.
  *
  * \note This scheme does not use the initial guess for the pressure.
+ *
+ * `apply_batch` performs the same recovery for all lanes of a SIMD batch
+ * at once, running a single masked root find for the whole batch. It only
+ * supports equations of state with `thermodynamic_dim == 3`. Equation-of-state
+ * calls are evaluated lane by lane. Lanes for which the batched recovery is not
+ * attempted or fails, including the rare corner cases of Appendix A where the
+ * bracket must be tightened, are flagged as `false` in the returned mask and
+ * must be recovered with the scalar `apply` (or the next scheme).
  */
 class KastaunEtAl {
  public:
@@ -62,6 +72,17 @@ class KastaunEtAl {
       const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
           primitive_from_conservative_options);
 
+  template <bool EnforcePhysicality, typename EosType, typename T>
+  static simd::mask_type_t<T> apply_batch(
+      gsl::not_null<PrimitiveRecoveryDataBatch<T>*> result, const T& tau,
+      const T& momentum_density_squared,
+      const T& momentum_density_dot_magnetic_field,
+      const T& magnetic_field_squared,
+      const T& rest_mass_density_times_lorentz_factor,
+      const T& electron_fraction, const EosType& equation_of_state,
+      const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
+          primitive_from_conservative_options);
+
   static const std::string name() { return "KastaunEtAl"; }
 
  private:
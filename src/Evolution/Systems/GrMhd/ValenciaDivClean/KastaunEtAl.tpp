@@ -5,7 +5,10 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <exception>
 #include <limits>
 #include <optional>
@@ -19,6 +22,8 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes {
 
@@ -343,6 +348,34 @@ double FunctionOfMu<EnforcePhysicality, EosType>::operator()(
   // Equations (44) - (45)
   return mu - 1.0 / (nu_hat + mu * r_bar_squared);
 }
+
+// Evaluates the scalar function `f` on each lane of the batches `args`. Used
+// for equation-of-state calls, which are not vectorized.
+template <typename T, typename F, typename... Args>
+T lanewise(const F& f, const Args&... args) {
+  constexpr size_t width = simd::size<T>();
+  std::array<std::array<double, width>, sizeof...(Args)> inputs{};
+  size_t arg_index = 0;
+  (simd::store_unaligned(gsl::at(inputs, arg_index++).data(), args), ...);
+  std::array<double, width> result{};
+  for (size_t lane = 0; lane < width; ++lane) {
+    gsl::at(result, lane) = [&f, &inputs, lane]<size_t... Is>(
+                                std::index_sequence<Is...> /*meta*/) {
+      return f(gsl::at(gsl::at(inputs, Is), lane)...);
+    }(std::make_index_sequence<sizeof...(Args)>{});
+  }
+  return simd::load_unaligned(result.data());
+}
+
+template <typename T>
+struct PrimitivesBatch {
+  T rest_mass_density;
+  T lorentz_factor;
+  T pressure;
+  T specific_internal_energy;
+  T q_bar;
+  T r_bar_squared;
+};
 }  // namespace KastaunEtAl_detail
 
 template <bool EnforcePhysicality, typename EosType>
@@ -405,4 +438,176 @@ std::optional<PrimitiveRecoveryData> KastaunEtAl::apply(
           one_over_specific_enthalpy_times_lorentz_factor,
       electron_fraction};
 }
+
+template <bool EnforcePhysicality, typename EosType, typename T>
+simd::mask_type_t<T> KastaunEtAl::apply_batch(
+    const gsl::not_null<PrimitiveRecoveryDataBatch<T>*> result, const T& tau,
+    const T& momentum_density_squared,
+    const T& momentum_density_dot_magnetic_field,
+    const T& magnetic_field_squared,
+    const T& rest_mass_density_times_lorentz_factor,
+    const T& electron_fraction, const EosType& equation_of_state,
+    const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
+        primitive_from_conservative_options) {
+  static_assert(EosType::thermodynamic_dim == 3,
+                "The batched recovery is only implemented for 3d equations "
+                "of state.");
+  using KastaunEtAl_detail::lanewise;
+  const T& d = rest_mass_density_times_lorentz_factor;
+  const double lorentz_max =
+      primitive_from_conservative_options.kastaun_max_lorentz_factor();
+
+  // See the constructor of `KastaunEtAl_detail::FunctionOfMu`
+  T r_squared = momentum_density_squared / square(d);
+  const T b_squared = magnetic_field_squared / d;
+  const T r_dot_b_squared = square(momentum_density_dot_magnetic_field) /
+                            cube(d);
+  const double h_0 = equation_of_state.specific_enthalpy_lower_bound();
+  const T z_0_squared = r_squared / square(h_0);
+  const T v_0_squared =
+      simd::min(z_0_squared / (1.0 + z_0_squared),
+                T(1.0 - 1.0 / (lorentz_max * lorentz_max)));
+  const T eps_min = lanewise<T>(
+      [&equation_of_state](const double rest_mass_density,
+                           const double local_electron_fraction) {
+        return equation_of_state.specific_internal_energy_lower_bound(
+            rest_mass_density, local_electron_fraction);
+      },
+      T(d / lorentz_max), electron_fraction);
+  T q = tau / d;
+  simd::mask_type_t<T> failed(false);
+  if constexpr (EnforcePhysicality) {
+    q = simd::max(q, eps_min);
+    const T r_squared_bound =
+        4.0 * v_0_squared * square(q + 1.0) / square(1.0 + v_0_squared);
+    r_squared = simd::select(r_squared_bound < r_squared, r_squared_bound,
+                             r_squared);
+  } else {
+    const T r_squared_bound =
+        4.0 * v_0_squared * square(q + 1.0) / square(1.0 + v_0_squared);
+    failed = q < eps_min or r_squared > r_squared_bound;
+  }
+
+  const auto compute_x = [&b_squared](const T& mu) {
+    return 1.0 / (1.0 + mu * b_squared);
+  };
+  const auto compute_r_bar_squared = [&r_squared, &r_dot_b_squared](
+                                         const T& mu, const T& x) {
+    return x * (r_squared * x + mu * (1.0 + x) * r_dot_b_squared);
+  };
+
+  // See `KastaunEtAl_detail::FunctionOfMu::root_bracket`
+  const double rho_min = equation_of_state.rest_mass_density_lower_bound();
+  const double rho_max = equation_of_state.rest_mass_density_upper_bound();
+  failed = failed or d < rho_min;
+  const T lower_bound(0.0);
+  T upper_bound(1.0 / (h_0 + std::numeric_limits<double>::min()));
+  try {
+    if (const auto needs_auxiliary = r_squared < square(h_0) and not failed;
+        simd::any(needs_auxiliary)) {
+      const auto auxiliary_function = [&compute_x, &compute_r_bar_squared,
+                                       h_0](const T& mu) {
+        return mu * sqrt(square(h_0) +
+                         compute_r_bar_squared(mu, compute_x(mu))) -
+               1.0;
+      };
+      upper_bound = simd::select(
+          needs_auxiliary,
+          RootFinder::toms748(auxiliary_function, lower_bound, upper_bound,
+                              absolute_tolerance_, relative_tolerance_,
+                              max_iterations_, not needs_auxiliary),
+          upper_bound);
+    }
+    const T v_hat_squared_at_upper_bound = simd::min(
+        square(upper_bound) *
+            compute_r_bar_squared(upper_bound, compute_x(upper_bound)),
+        v_0_squared);
+    const T w_hat_at_upper_bound =
+        1.0 / sqrt(1.0 - v_hat_squared_at_upper_bound);
+    // Lanes that need the bracket to be tightened (Appendix A) are left to the
+    // scalar implementation.
+    failed = failed or d / w_hat_at_upper_bound > rho_max or
+             d / w_hat_at_upper_bound < rho_min or d > rho_max;
+    if (simd::all(failed)) {
+      return not failed;
+    }
+
+    // See `KastaunEtAl_detail::FunctionOfMu::primitives`
+    const auto primitives = [&](const T& mu) {
+      const T x = compute_x(mu);
+      const T r_bar_squared = compute_r_bar_squared(mu, x);
+      const T v_hat_squared = simd::min(square(mu) * r_bar_squared,
+                                        v_0_squared);
+      const T w_hat = 1.0 / sqrt(1.0 - v_hat_squared);
+      const T rho_hat = simd::clip(T(d / w_hat), T(rho_min), T(rho_max));
+      const T q_bar =
+          q - 0.5 * b_squared -
+          0.5 * square(mu * x) * (r_squared * b_squared - r_dot_b_squared);
+      const T epsilon_hat = lanewise<T>(
+          [&equation_of_state](const double epsilon,
+                               const double rest_mass_density,
+                               const double local_electron_fraction) {
+            return std::clamp(
+                epsilon,
+                equation_of_state.specific_internal_energy_lower_bound(
+                    rest_mass_density, local_electron_fraction),
+                equation_of_state.specific_internal_energy_upper_bound(
+                    rest_mass_density, local_electron_fraction));
+          },
+          T(w_hat * (q_bar - mu * r_bar_squared) +
+            v_hat_squared * square(w_hat) / (1.0 + w_hat)),
+          rho_hat, electron_fraction);
+      const T p_hat = lanewise<T>(
+          [&equation_of_state](const double rest_mass_density,
+                               const double specific_internal_energy,
+                               const double local_electron_fraction) {
+            return get(equation_of_state.pressure_from_density_and_energy(
+                Scalar<double>(rest_mass_density),
+                Scalar<double>(specific_internal_energy),
+                Scalar<double>(local_electron_fraction)));
+          },
+          rho_hat, epsilon_hat, electron_fraction);
+      return KastaunEtAl_detail::PrimitivesBatch<T>{
+          rho_hat, w_hat, p_hat, epsilon_hat, q_bar, r_bar_squared};
+    };
+    // See `KastaunEtAl_detail::FunctionOfMu::operator()`
+    const auto f_of_mu = [&primitives](const T& mu) {
+      const auto prims = primitives(mu);
+      const T a_hat = prims.pressure / (prims.rest_mass_density *
+                                        (1.0 + prims.specific_internal_energy));
+      const T h_hat = (1.0 + prims.specific_internal_energy) * (1.0 + a_hat);
+      const T nu_hat = simd::max(
+          h_hat / prims.lorentz_factor,
+          (1.0 + a_hat) * (1.0 + prims.q_bar - mu * prims.r_bar_squared));
+      return mu - 1.0 / (nu_hat + mu * prims.r_bar_squared);
+    };
+
+    // Failed lanes are excluded from the root find. Their function values are
+    // replaced so that they do not trigger the bracketing check.
+    const T f_at_lower_bound =
+        simd::select(failed, T(-1.0), f_of_mu(lower_bound));
+    const T f_at_upper_bound =
+        simd::select(failed, T(1.0), f_of_mu(upper_bound));
+    const T one_over_specific_enthalpy_times_lorentz_factor =
+        RootFinder::toms748(f_of_mu, lower_bound, upper_bound,
+                            f_at_lower_bound, f_at_upper_bound,
+                            absolute_tolerance_, relative_tolerance_,
+                            max_iterations_, failed);
+
+    const auto prims =
+        primitives(one_over_specific_enthalpy_times_lorentz_factor);
+    *result = PrimitiveRecoveryDataBatch<T>{
+        prims.rest_mass_density,
+        prims.lorentz_factor,
+        prims.pressure,
+        prims.specific_internal_energy,
+        d / one_over_specific_enthalpy_times_lorentz_factor,
+        electron_fraction};
+  } catch (std::exception& exception) {
+    // A lane did not converge, so fall back to the scalar recovery for the
+    // whole batch.
+    return simd::mask_type_t<T>(false);
+  }
+  return not failed;
+}
 }  // namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes
@@ -3,6 +3,8 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
 
+#include <algorithm>
+#include <array>
 #include <iomanip>
 #include <limits>
 #include <optional>
@@ -33,6 +35,7 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace grmhd::ValenciaDivClean {
@@ -117,7 +120,8 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
   Variables<
       tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
                  ::Tags::TempScalar<2>, ::Tags::TempScalar<3>,
-                 ::Tags::TempScalar<4>, ::Tags::TempI<5, 3, Frame::Inertial>>>
+                 ::Tags::TempScalar<4>, ::Tags::TempI<5, 3, Frame::Inertial>,
+                 ::Tags::TempScalar<6>>>
       temp_buffer(number_of_points);
 
   DataVector& tau = get(get<::Tags::TempScalar<0>>(temp_buffer));
@@ -155,9 +159,127 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
   const double floorD =
       primitive_from_conservative_options.density_when_skipping_inversion();
 
+  const auto store_primitive_data =
+      [&](const size_t s,
+          const PrimitiveRecoverySchemes::PrimitiveRecoveryData&
+              primitive_data) {
+        get(*rest_mass_density)[s] = primitive_data.rest_mass_density;
+        const double coefficient_of_b =
+            get(momentum_density_dot_magnetic_field)[s] /
+            (primitive_data.rho_h_w_squared *
+             (primitive_data.rho_h_w_squared + get(magnetic_field_squared)[s]));
+        const double coefficient_of_s =
+            1.0 /
+            (get(sqrt_det_spatial_metric)[s] *
+             (primitive_data.rho_h_w_squared + get(magnetic_field_squared)[s]));
+        for (size_t i = 0; i < 3; ++i) {
+          spatial_velocity->get(i)[s] =
+              coefficient_of_b * magnetic_field->get(i)[s] +
+              coefficient_of_s * tilde_s_upper.get(i)[s];
+        }
+        get(*lorentz_factor)[s] = primitive_data.lorentz_factor;
+        get(*pressure)[s] = primitive_data.pressure;
+        if constexpr (not eos_is_barotropic) {
+          get(*specific_internal_energy)[s] =
+              primitive_data.specific_internal_energy;
+        }
+      };
+  // Whether the point can skip the scalar loop below because it was already
+  // recovered by the vectorized scheme.
+  DataVector& recovered = get(get<::Tags::TempScalar<6>>(temp_buffer));
+  recovered = 0.0;
+  const auto uses_hydro_optimization = [&](const size_t s) {
+    return use_hydro_optimization and
+           (get(magnetic_field_squared)[s] <
+            100.0 * std::numeric_limits<double>::epsilon() * tau[s]);
+  };
+
+#ifdef SPECTRE_USE_XSIMD
+  // When the first scheme is KastaunEtAl, run it on a full SIMD batch of
+  // points at once. Points in the atmosphere or using the hydro optimization,
+  // and points where the batched scheme fails, are handled point by point
+  // below, so the scalar schemes remain the reference implementation.
+  if constexpr (std::is_same_v<
+                    tmpl::front<OrderedListOfPrimitiveRecoverySchemes>,
+                    PrimitiveRecoverySchemes::KastaunEtAl>) {
+    using Batch = simd::batch<double>;
+    constexpr size_t simd_width = simd::size<Batch>();
+    std::array<std::array<double, simd_width>, 6> inputs{};
+    std::array<size_t, simd_width> lane_points{};
+    size_t active_lanes = 0;
+    const auto recover_batch = [&]() {
+      // Pad unused lanes with copies of the first point so that every lane
+      // holds a valid state.
+      for (size_t lane = active_lanes; lane < simd_width; ++lane) {
+        for (auto& input : inputs) {
+          gsl::at(input, lane) = input[0];
+        }
+      }
+      PrimitiveRecoverySchemes::PrimitiveRecoveryDataBatch<Batch> batch_data{};
+      const auto success = PrimitiveRecoverySchemes::KastaunEtAl::
+          template apply_batch<EnforcePhysicality>(
+              make_not_null(&batch_data),
+              simd::load_unaligned(inputs[0].data()),
+              simd::load_unaligned(inputs[1].data()),
+              simd::load_unaligned(inputs[2].data()),
+              simd::load_unaligned(inputs[3].data()),
+              simd::load_unaligned(inputs[4].data()),
+              simd::load_unaligned(inputs[5].data()), equation_of_state,
+              primitive_from_conservative_options);
+      std::array<std::array<double, simd_width>, 6> outputs{};
+      simd::store_unaligned(outputs[0].data(), batch_data.rest_mass_density);
+      simd::store_unaligned(outputs[1].data(), batch_data.lorentz_factor);
+      simd::store_unaligned(outputs[2].data(), batch_data.pressure);
+      simd::store_unaligned(outputs[3].data(),
+                            batch_data.specific_internal_energy);
+      simd::store_unaligned(outputs[4].data(), batch_data.rho_h_w_squared);
+      simd::store_unaligned(outputs[5].data(),
+                            simd::select(success, Batch(1.0), Batch(0.0)));
+      for (size_t lane = 0; lane < active_lanes; ++lane) {
+        if (gsl::at(outputs[5], lane) != 0.0) {
+          const size_t s = gsl::at(lane_points, lane);
+          store_primitive_data(
+              s, PrimitiveRecoverySchemes::PrimitiveRecoveryData{
+                     gsl::at(outputs[0], lane), gsl::at(outputs[1], lane),
+                     gsl::at(outputs[2], lane), gsl::at(outputs[3], lane),
+                     gsl::at(outputs[4], lane), get(*electron_fraction)[s]});
+          recovered[s] = 1.0;
+        }
+      }
+      active_lanes = 0;
+    };
+    for (size_t s = 0; s < number_of_points; ++s) {
+      if (rest_mass_density_times_lorentz_factor[s] < cutoffD or
+          uses_hydro_optimization(s)) {
+        continue;
+      }
+      get(*electron_fraction)[s] =
+          std::min(0.5, std::max(get(tilde_ye)[s] / get(tilde_d)[s], 0.));
+      gsl::at(lane_points, active_lanes) = s;
+      gsl::at(inputs[0], active_lanes) = tau[s];
+      gsl::at(inputs[1], active_lanes) = get(momentum_density_squared)[s];
+      gsl::at(inputs[2], active_lanes) =
+          get(momentum_density_dot_magnetic_field)[s];
+      gsl::at(inputs[3], active_lanes) = get(magnetic_field_squared)[s];
+      gsl::at(inputs[4], active_lanes) =
+          rest_mass_density_times_lorentz_factor[s];
+      gsl::at(inputs[5], active_lanes) = get(*electron_fraction)[s];
+      if (++active_lanes == simd_width) {
+        recover_batch();
+      }
+    }
+    if (active_lanes > 0) {
+      recover_batch();
+    }
+  }
+#endif  // SPECTRE_USE_XSIMD
+
   // This may need bounds
   // limit Ye to table bounds once that is implemented
   for (size_t s = 0; s < number_of_points; ++s) {
+    if (recovered[s] != 0.0) {
+      continue;
+    }
     get(*electron_fraction)[s] =
         std::min(0.5, std::max(get(tilde_ye)[s] / get(tilde_d)[s], 0.));
 
@@ -211,9 +333,7 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
         }
       };
       // Check consistency
-      if (use_hydro_optimization and
-          (get(magnetic_field_squared)[s] <
-           100.0 * std::numeric_limits<double>::epsilon() * tau[s])) {
+      if (uses_hydro_optimization(s)) {
         tmpl::for_each<
             tmpl::list<grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::
                            KastaunEtAlHydro>>(apply_scheme);
@@ -223,27 +343,7 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
     }
 
     if (primitive_data.has_value()) {
-      get(*rest_mass_density)[s] = primitive_data.value().rest_mass_density;
-      const double coefficient_of_b =
-          get(momentum_density_dot_magnetic_field)[s] /
-          (primitive_data.value().rho_h_w_squared *
-           (primitive_data.value().rho_h_w_squared +
-            get(magnetic_field_squared)[s]));
-      const double coefficient_of_s =
-          1.0 / (get(sqrt_det_spatial_metric)[s] *
-                 (primitive_data.value().rho_h_w_squared +
-                  get(magnetic_field_squared)[s]));
-      for (size_t i = 0; i < 3; ++i) {
-        spatial_velocity->get(i)[s] =
-            coefficient_of_b * magnetic_field->get(i)[s] +
-            coefficient_of_s * tilde_s_upper.get(i)[s];
-      }
-      get(*lorentz_factor)[s] = primitive_data.value().lorentz_factor;
-      get(*pressure)[s] = primitive_data.value().pressure;
-      if constexpr (not eos_is_barotropic) {
-        get(*specific_internal_energy)[s] =
-            primitive_data.value().specific_internal_energy;
-      }
+      store_primitive_data(s, primitive_data.value());
     } else {
       if constexpr (ErrorOnFailure) {
         ERROR("All primitive inversion schemes failed at s = "
@@ -24,6 +24,20 @@ struct PrimitiveRecoveryData {
   double rho_h_w_squared;
   double electron_fraction;
 };
+
+/*!
+ * \brief The data in `PrimitiveRecoveryData` for a batch of grid points, e.g.
+ * `simd::batch<double>`, one grid point per lane.
+ */
+template <typename T>
+struct PrimitiveRecoveryDataBatch {
+  T rest_mass_density;
+  T lorentz_factor;
+  T pressure;
+  T specific_internal_energy;
+  T rho_h_w_squared;
+  T electron_fraction;
+};
 }  // namespace PrimitiveRecoverySchemes
 }  // namespace ValenciaDivClean
 }  // namespace grmhd
@@ -6,9 +6,16 @@
 #include <benchmark/benchmark.h>
 #pragma GCC diagnostic pop
 #include <charm++.h>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -19,11 +26,24 @@
 #include "Domain/CoordinateMaps/ProductMaps.hpp"
 #include "Domain/CoordinateMaps/ProductMaps.tpp"
 #include "Domain/Structure/Element.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Compression.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3d.hpp"
 #include "PointwiseFunctions/MathFunctions/PowX.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/SizeClassPool.hpp"
+#include "Utilities/TMPL.hpp"
 
 // Charm looks for this function but since we build without a main function or
 // main module we just have it be empty
@@ -108,6 +128,296 @@ void bench_all_gradient(benchmark::State& state) {  // NOLINT
 BENCHMARK(bench_all_gradient);  // NOLINT
 }  // namespace
 
+namespace {
+// In this anonymous namespace is a benchmark of the allocation pattern of a
+// GH volume-term evaluation: per element and substep, Variables for the
+// fluxes, the partial derivatives and a TempBuffer of intermediate quantities
+// are created and destroyed. Compare builds with and without
+// `SPECTRE_POOLED_ALLOCATION` to see the time spent in the allocator.
+template <size_t Dim>
+struct Phi : db::SimpleTag {
+  using type = tnsr::iaa<DataVector, Dim, Frame::Grid>;
+};
+template <size_t Dim>
+struct Pi : db::SimpleTag {
+  using type = tnsr::aa<DataVector, Dim, Frame::Grid>;
+};
+
+// clang-tidy: don't pass be non-const reference
+void bench_volume_term_temporaries(benchmark::State& state) {  // NOLINT
+  constexpr size_t Dim = 3;
+  const auto pts_1d = static_cast<size_t>(state.range(0));
+  const size_t num_points = pts_1d * pts_1d * pts_1d;
+  using EvolvedTags = tmpl::list<Psi<Dim>, Pi<Dim>, Phi<Dim>>;
+  using DerivTags = db::wrap_tags_in<Tags::deriv, EvolvedTags,
+                                     tmpl::size_t<Dim>, Frame::Grid>;
+  using FluxTags = db::wrap_tags_in<::Tags::Flux, EvolvedTags,
+                                    tmpl::size_t<Dim>, Frame::Inertial>;
+  const Variables<EvolvedTags> evolved_vars(num_points, 1.0);
+
+  size_class_pool::reset_thread_statistics();
+  while (state.KeepRunning()) {
+    Variables<DerivTags> partial_derivs(num_points);
+    Variables<FluxTags> fluxes(num_points);
+    Variables<EvolvedTags> dt_vars(num_points);
+    DataVector lapse(num_points);
+    DataVector sqrt_det_spatial_metric(num_points);
+    benchmark::DoNotOptimize(partial_derivs.data());
+    benchmark::DoNotOptimize(fluxes.data());
+    benchmark::DoNotOptimize(dt_vars.data());
+    benchmark::DoNotOptimize(lapse.data());
+    benchmark::DoNotOptimize(sqrt_det_spatial_metric.data());
+    benchmark::ClobberMemory();
+  }
+  const auto& pool_statistics = size_class_pool::thread_statistics();
+  state.counters["pool_hits"] =
+      static_cast<double>(pool_statistics.number_of_cache_hits);
+  state.counters["pool_allocations"] =
+      static_cast<double>(pool_statistics.number_of_allocations);
+}
+BENCHMARK(bench_volume_term_temporaries)->Arg(6)->Arg(8)->Arg(10);  // NOLINT
+}  // namespace
+
+namespace {
+// In this anonymous namespace is a benchmark of tabulated EOS lookups for all
+// points of an element. The table has the size of a typical nuclear EOS table,
+// so it does not fit into cache. The first benchmark evaluates the EOS point by
+// point, the second calls the individual `DataVector` functions and the third
+// evaluates all quantities in a single pass over the table.
+EquationsOfState::Tabulated3D<true> make_benchmark_table() {
+  const size_t num_temperature = 80;
+  const size_t num_density = 200;
+  const size_t num_electron_fraction = 60;
+  const auto uniform = [](const size_t size, const double lower,
+                          const double upper) {
+    std::vector<double> result(size);
+    for (size_t i = 0; i < size; ++i) {
+      result[i] = lower + (upper - lower) * static_cast<double>(i) /
+                              static_cast<double>(size - 1);
+    }
+    return result;
+  };
+  auto log_temperature = uniform(num_temperature, -3.0, 3.0);
+  auto log_density = uniform(num_density, -30.0, -5.0);
+  auto electron_fraction = uniform(num_electron_fraction, 0.01, 0.6);
+  using Table = EquationsOfState::Tabulated3D<true>;
+  std::vector<double> table_data(num_temperature * num_density *
+                                 num_electron_fraction * Table::NumberOfVars);
+  size_t node = 0;
+  for (size_t k = 0; k < num_electron_fraction; ++k) {
+    for (size_t j = 0; j < num_density; ++j) {
+      for (size_t i = 0; i < num_temperature; ++i) {
+        double* const vars = &table_data[Table::NumberOfVars * node];
+        vars[Table::Epsilon] = log_temperature[i];
+        vars[Table::Pressure] = log_temperature[i] + log_density[j];
+        vars[Table::CsSquared] = electron_fraction[k];
+        vars[Table::DeltaMu] = electron_fraction[k] - 0.3;
+        ++node;
+      }
+    }
+  }
+  return Table{std::move(electron_fraction), std::move(log_density),
+               std::move(log_temperature), std::move(table_data), 0.0, 1.0};
+}
+
+struct TabulatedEosState {
+  explicit TabulatedEosState(const size_t num_points)
+      : rest_mass_density(num_points),
+        temperature(num_points),
+        electron_fraction(num_points) {
+    std::mt19937 gen{1};
+    std::uniform_real_distribution<> dist(0.0, 1.0);
+    for (size_t i = 0; i < num_points; ++i) {
+      get(rest_mass_density)[i] = std::exp(-30.0 + 25.0 * dist(gen));
+      get(temperature)[i] = std::exp(-3.0 + 6.0 * dist(gen));
+      get(electron_fraction)[i] = 0.01 + 0.59 * dist(gen);
+    }
+  }
+  Scalar<DataVector> rest_mass_density;
+  Scalar<DataVector> temperature;
+  Scalar<DataVector> electron_fraction;
+};
+
+// clang-tidy: don't pass be non-const reference
+void bench_tabulated_eos_pointwise(benchmark::State& state) {  // NOLINT
+  const auto eos = make_benchmark_table();
+  const TabulatedEosState input(static_cast<size_t>(state.range(0)));
+  Scalar<DataVector> pressure{get(input.rest_mass_density).size()};
+  Scalar<DataVector> specific_internal_energy{
+      get(input.rest_mass_density).size()};
+  Scalar<DataVector> sound_speed_squared{get(input.rest_mass_density).size()};
+  while (state.KeepRunning()) {
+    for (size_t i = 0; i < get(pressure).size(); ++i) {
+      const Scalar<double> rho{get(input.rest_mass_density)[i]};
+      const Scalar<double> temperature{get(input.temperature)[i]};
+      const Scalar<double> ye{get(input.electron_fraction)[i]};
+      get(pressure)[i] =
+          get(eos.pressure_from_density_and_temperature(rho, temperature, ye));
+      get(specific_internal_energy)[i] =
+          get(eos.specific_internal_energy_from_density_and_temperature(
+              rho, temperature, ye));
+      get(sound_speed_squared)[i] =
+          get(eos.sound_speed_squared_from_density_and_temperature(
+              rho, temperature, ye));
+    }
+    benchmark::DoNotOptimize(get(pressure).data());
+    benchmark::DoNotOptimize(get(specific_internal_energy).data());
+    benchmark::DoNotOptimize(get(sound_speed_squared).data());
+  }
+}
+BENCHMARK(bench_tabulated_eos_pointwise)->Arg(512)->Arg(4096);  // NOLINT
+
+// clang-tidy: don't pass be non-const reference
+void bench_tabulated_eos_separate(benchmark::State& state) {  // NOLINT
+  const auto eos = make_benchmark_table();
+  const TabulatedEosState input(static_cast<size_t>(state.range(0)));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(eos.pressure_from_density_and_temperature(
+        input.rest_mass_density, input.temperature, input.electron_fraction));
+    benchmark::DoNotOptimize(
+        eos.specific_internal_energy_from_density_and_temperature(
+            input.rest_mass_density, input.temperature,
+            input.electron_fraction));
+    benchmark::DoNotOptimize(
+        eos.sound_speed_squared_from_density_and_temperature(
+            input.rest_mass_density, input.temperature,
+            input.electron_fraction));
+  }
+}
+BENCHMARK(bench_tabulated_eos_separate)->Arg(512)->Arg(4096);  // NOLINT
+
+// clang-tidy: don't pass be non-const reference
+void bench_tabulated_eos_combined(benchmark::State& state) {  // NOLINT
+  const auto eos = make_benchmark_table();
+  const TabulatedEosState input(static_cast<size_t>(state.range(0)));
+  Scalar<DataVector> pressure{};
+  Scalar<DataVector> specific_internal_energy{};
+  Scalar<DataVector> sound_speed_squared{};
+  while (state.KeepRunning()) {
+    eos.thermodynamic_state_from_density_and_temperature(
+        make_not_null(&pressure), make_not_null(&specific_internal_energy),
+        make_not_null(&sound_speed_squared), input.rest_mass_density,
+        input.temperature, input.electron_fraction);
+    benchmark::DoNotOptimize(get(pressure).data());
+  }
+}
+BENCHMARK(bench_tabulated_eos_combined)->Arg(512)->Arg(4096);  // NOLINT
+}  // namespace
+
+namespace {
+// In this anonymous namespace is a benchmark of writing volume data with the
+// different `h5::Compression` settings. The first argument selects the codec,
+// the second the number of mantissa bits kept, where a negative number keeps
+// all bits. The data is smooth, like most evolved fields, and has the size of
+// about 64 elements with 10^3 points each.
+// clang-tidy: don't pass be non-const reference
+void bench_h5_volume_compression(benchmark::State& state) {  // NOLINT
+  h5::Compression compression{};
+  compression.codec = static_cast<h5::Compression::Codec>(state.range(0));
+  if (state.range(1) >= 0) {
+    compression.mantissa_bits = static_cast<size_t>(state.range(1));
+  }
+  const size_t number_of_points = 64'000;
+  const size_t number_of_components = 10;
+  std::vector<TensorComponent> components{};
+  for (size_t i = 0; i < number_of_components; ++i) {
+    DataVector data(number_of_points);
+    for (size_t j = 0; j < number_of_points; ++j) {
+      data[j] = std::sin(1.0e-3 * static_cast<double>(j * (i + 1)));
+    }
+    components.emplace_back("Var" + std::to_string(i), std::move(data));
+  }
+  const std::vector<ElementVolumeData> volume_data{
+      {"[B0,(L0I0)]", std::move(components),
+       std::vector<size_t>{number_of_points},
+       std::vector<Spectral::Basis>{Spectral::Basis::Legendre},
+       std::vector<Spectral::Quadrature>{Spectral::Quadrature::GaussLobatto}}};
+  const std::string file_name{"BenchmarkH5VolumeCompression.h5"};
+  size_t observation_id = 0;
+  {
+    if (file_system::check_if_file_exists(file_name)) {
+      file_system::rm(file_name, true);
+    }
+    h5::H5File<h5::AccessType::ReadWrite> file{file_name};
+    auto& volume_file =
+        file.insert<h5::VolumeData>("/element_data", 0, compression);
+    while (state.KeepRunning()) {
+      volume_file.write_volume_data(observation_id,
+                                    static_cast<double>(observation_id),
+                                    volume_data);
+      ++observation_id;
+    }
+  }
+  const double raw_bytes = static_cast<double>(
+      observation_id * number_of_points * number_of_components *
+      sizeof(double));
+  state.SetBytesProcessed(static_cast<int64_t>(raw_bytes));
+  state.counters["compression_ratio"] =
+      raw_bytes / static_cast<double>(std::filesystem::file_size(file_name));
+  file_system::rm(file_name, true);
+}
+BENCHMARK(bench_h5_volume_compression)  // NOLINT
+    ->Args({static_cast<int64_t>(h5::Compression::Codec::None), -1})
+    ->Args({static_cast<int64_t>(h5::Compression::Codec::Deflate), -1})
+    ->Args({static_cast<int64_t>(h5::Compression::Codec::Lz4), -1})
+    ->Args({static_cast<int64_t>(h5::Compression::Codec::Zstd), -1})
+    ->Args({static_cast<int64_t>(h5::Compression::Codec::Lz4), 16})
+    ->Unit(benchmark::kMillisecond);
+}  // namespace
+
+namespace {
+// In this anonymous namespace is a benchmark of `intrp::Irregular` in its two
+// modes, interpolating five tensor components from a 3D element with N^3
+// points (first argument) to a number of target points (second argument). The
+// third argument selects the `intrp::IrregularMode`: 0 is `DenseMatrix` and 1
+// is `MatrixFree`. The interpolant is constructed in every iteration, as when
+// the target points move, and the memory held by the weights is reported as a
+// counter.
+// clang-tidy: don't pass be non-const reference
+void bench_irregular_interpolant(benchmark::State& state) {  // NOLINT
+  const auto num_points_1d = static_cast<size_t>(state.range(0));
+  const auto number_of_target_points = static_cast<size_t>(state.range(1));
+  const auto mode = static_cast<intrp::IrregularMode>(state.range(2));
+  const size_t number_of_components = 5;
+  const Mesh<3> mesh{num_points_1d, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  std::mt19937 generator{1};
+  std::uniform_real_distribution<double> dist{-1.0, 1.0};
+  tnsr::I<DataVector, 3, Frame::ElementLogical> target_points{
+      number_of_target_points};
+  for (size_t d = 0; d < 3; ++d) {
+    for (auto& xi : target_points.get(d)) {
+      xi = dist(generator);
+    }
+  }
+  DataVector source(mesh.number_of_grid_points() * number_of_components);
+  for (auto& value : source) {
+    value = dist(generator);
+  }
+  DataVector target(number_of_target_points * number_of_components);
+  auto target_span = gsl::make_span(target.data(), target.size());
+  const auto source_span = gsl::make_span(source.data(), source.size());
+  while (state.KeepRunning()) {
+    const intrp::Irregular<3> interpolant{mesh, target_points, mode};
+    interpolant.interpolate(make_not_null(&target_span), source_span);
+    benchmark::DoNotOptimize(target.data());
+  }
+  const size_t weights_per_target =
+      mode == intrp::IrregularMode::DenseMatrix ? mesh.number_of_grid_points()
+                                                : 3 * num_points_1d;
+  state.counters["weights_bytes"] = static_cast<double>(
+      number_of_target_points * weights_per_target * sizeof(double));
+}
+BENCHMARK(bench_irregular_interpolant)  // NOLINT
+    ->Args({6, 100, 0})
+    ->Args({6, 100, 1})
+    ->Args({10, 100, 0})
+    ->Args({10, 100, 1})
+    ->Args({10, 10'000, 0})
+    ->Args({10, 10'000, 1})
+    ->Unit(benchmark::kMicrosecond);
+}  // namespace
+
 // Ignore the warning about an extra ';' because some versions of benchmark
 // require it
 #pragma GCC diagnostic push
@@ -0,0 +1,301 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/Compression.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <hdf5.h>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <zlib.h>
+
+#include "IO/H5/CheckH5.hpp"
+#include "IO/H5/Wrappers.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/ParallelFor.hpp"
+
+namespace {
+// Filter IDs registered with the HDF Group for the LZ4 and Zstandard plugins.
+constexpr H5Z_filter_t lz4_filter_id = 32004;
+constexpr H5Z_filter_t zstd_filter_id = 32015;
+}  // namespace
+
+namespace h5 {
+Compression Compression::none() {
+  Compression result{};
+  result.codec = Codec::None;
+  result.shuffle = false;
+  return result;
+}
+
+bool operator==(const Compression& lhs, const Compression& rhs) {
+  return lhs.codec == rhs.codec and lhs.level == rhs.level and
+         lhs.shuffle == rhs.shuffle and
+         lhs.mantissa_bits == rhs.mantissa_bits and
+         lhs.target_bytes_per_chunk == rhs.target_bytes_per_chunk and
+         lhs.number_of_threads == rhs.number_of_threads;
+}
+
+bool operator!=(const Compression& lhs, const Compression& rhs) {
+  return not(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os, const Compression::Codec codec) {
+  switch (codec) {
+    case Compression::Codec::None:
+      return os << "None";
+    case Compression::Codec::Deflate:
+      return os << "Deflate";
+    case Compression::Codec::Lz4:
+      return os << "Lz4";
+    case Compression::Codec::Zstd:
+      return os << "Zstd";
+    default:
+      ERROR("Unknown codec " << static_cast<int>(codec));
+  }
+}
+
+template <typename T>
+void truncate_mantissa(const gsl::not_null<std::vector<T>*> data,
+                       const size_t mantissa_bits) {
+  static_assert(std::is_same_v<T, double> or std::is_same_v<T, float>);
+  using Bits =
+      std::conditional_t<std::is_same_v<T, double>, uint64_t, uint32_t>;
+  constexpr size_t stored_mantissa_bits = std::numeric_limits<T>::digits - 1;
+  ASSERT(mantissa_bits <= stored_mantissa_bits,
+         "Cannot keep " << mantissa_bits << " mantissa bits of a type with "
+                        << stored_mantissa_bits << ".");
+  if (mantissa_bits >= stored_mantissa_bits) {
+    return;
+  }
+  const size_t dropped_bits = stored_mantissa_bits - mantissa_bits;
+  const Bits half = Bits{1} << (dropped_bits - 1);
+  const Bits mask = ~((Bits{1} << dropped_bits) - 1);
+  for (T& value : *data) {
+    if (not std::isfinite(value)) {
+      continue;
+    }
+    // Adding half of the last kept bit before masking rounds to nearest. A
+    // carry into the exponent correctly rounds up to the next power of two.
+    const Bits rounded = (std::bit_cast<Bits>(value) + half) & mask;
+    const T result = std::bit_cast<T>(rounded);
+    // Values just below the largest finite value can round to infinity.
+    if (std::isfinite(result)) {
+      value = result;
+    }
+  }
+}
+
+template void truncate_mantissa(gsl::not_null<std::vector<double>*> data,
+                                size_t mantissa_bits);
+template void truncate_mantissa(gsl::not_null<std::vector<float>*> data,
+                                size_t mantissa_bits);
+
+namespace detail {
+bool filter_available(const H5Z_filter_t filter_id) {
+  if (H5Zfilter_avail(filter_id) <= 0) {
+    return false;
+  }
+  unsigned int filter_info = 0;
+  const auto status = H5Zget_filter_info(filter_id, &filter_info);
+  return status >= 0 and (filter_info & H5Z_FILTER_CONFIG_ENCODE_ENABLED) and
+         (filter_info & H5Z_FILTER_CONFIG_DECODE_ENABLED);
+}
+
+hid_t dataset_creation_property_list(const Compression& compression,
+                                     const std::vector<hsize_t>& chunk_size,
+                                     const bool chunking_required,
+                                     const std::string& name) {
+  // We can't compress a single number. Since there's not much to reduce
+  // anyway, we just skip compression.
+  const bool compress =
+      compression.codec != Compression::Codec::None and not chunk_size.empty();
+  if (not compress and not chunking_required) {
+    return h5::h5p_default();
+  }
+  const hid_t property_list = H5Pcreate(H5P_DATASET_CREATE);
+  CHECK_H5(property_list, "Failed to create property list for " << name);
+  CHECK_H5(H5Pset_chunk(property_list, static_cast<int>(chunk_size.size()),
+                        chunk_size.data()),
+           "Failed to set chunk size on dataset " << name);
+  CHECK_H5(H5Pset_fill_time(property_list, H5D_FILL_TIME_NEVER),
+           "Failed to disable setting default values on dataset creation for "
+           "dataset "
+               << name);
+  if (not compress) {
+    return property_list;
+  }
+
+  if (compression.shuffle and filter_available(H5Z_FILTER_SHUFFLE)) {
+    CHECK_H5(H5Pset_shuffle(property_list),
+             "Failed to enable shuffle filter on dataset " << name);
+  }
+  const auto set_deflate = [&property_list, &name](const int level) {
+    if (filter_available(H5Z_FILTER_DEFLATE)) {
+      CHECK_H5(H5Pset_deflate(property_list, static_cast<unsigned>(level)),
+               "Failed to enable gzip filter on dataset " << name);
+    }
+  };
+  switch (compression.codec) {
+    case Compression::Codec::Deflate:
+      set_deflate(compression.level);
+      break;
+    case Compression::Codec::Lz4:
+      if (filter_available(lz4_filter_id)) {
+        // A block size of zero selects the filter's default.
+        const std::array<unsigned, 1> parameters{{0}};
+        CHECK_H5(H5Pset_filter(property_list, lz4_filter_id,
+                               H5Z_FLAG_OPTIONAL, parameters.size(),
+                               parameters.data()),
+                 "Failed to enable LZ4 filter on dataset " << name);
+      } else {
+        set_deflate(1);
+      }
+      break;
+    case Compression::Codec::Zstd:
+      if (filter_available(zstd_filter_id)) {
+        const std::array<unsigned, 1> parameters{
+            {static_cast<unsigned>(compression.level)}};
+        CHECK_H5(H5Pset_filter(property_list, zstd_filter_id,
+                               H5Z_FLAG_OPTIONAL, parameters.size(),
+                               parameters.data()),
+                 "Failed to enable Zstd filter on dataset " << name);
+      } else {
+        set_deflate(1);
+      }
+      break;
+    default:
+      ERROR("Unknown codec " << compression.codec);
+  }
+  return property_list;
+}
+
+bool write_compressed_chunks(const hid_t dataset_id, const hid_t property_list,
+                             const hid_t memory_type, const void* const data,
+                             const size_t number_of_elements,
+                             const size_t element_size,
+                             const hsize_t chunk_size,
+                             const size_t number_of_threads,
+                             const std::string& name) {
+  // Find out which filters HDF5 would apply, in order. We reproduce shuffle
+  // followed by deflate, which is what `dataset_creation_property_list` sets
+  // up for `Codec::Deflate`.
+  const int number_of_filters = H5Pget_nfilters(property_list);
+  CHECK_H5(number_of_filters, "Failed to get filters of dataset " << name);
+  bool shuffle = false;
+  int deflate_level = -1;
+  for (int i = 0; i < number_of_filters; ++i) {
+    unsigned int flags = 0;
+    std::array<unsigned int, 1> parameters{{0}};
+    size_t number_of_parameters = parameters.size();
+    unsigned int filter_config = 0;
+    const H5Z_filter_t filter = H5Pget_filter2(
+        property_list, static_cast<unsigned>(i), &flags,
+        &number_of_parameters, parameters.data(), 0, nullptr, &filter_config);
+    if (filter == H5Z_FILTER_SHUFFLE and i == 0) {
+      shuffle = true;
+    } else if (filter == H5Z_FILTER_DEFLATE and i == number_of_filters - 1 and
+               number_of_parameters == 1) {
+      deflate_level = static_cast<int>(parameters[0]);
+    } else {
+      return false;
+    }
+  }
+  if (deflate_level < 0) {
+    return false;
+  }
+
+  // Only complete chunks are compressed here. HDF5 pads the last chunk with
+  // unspecified bytes because the fill time is `H5D_FILL_TIME_NEVER`, so we
+  // leave that chunk to `H5Dwrite` below.
+  const size_t chunk_bytes = chunk_size * element_size;
+  const size_t number_of_full_chunks = number_of_elements / chunk_size;
+  const auto* const bytes = static_cast<const unsigned char*>(data);
+  std::vector<std::vector<unsigned char>> compressed_chunks(
+      number_of_full_chunks);
+  parallel_for(
+      number_of_full_chunks, number_of_threads,
+      [&bytes, &chunk_bytes, &chunk_size, &compressed_chunks, &deflate_level,
+       &element_size, &shuffle](const size_t chunk) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const unsigned char* const chunk_data = bytes + chunk * chunk_bytes;
+        std::vector<unsigned char> raw_chunk(chunk_bytes);
+        if (shuffle) {
+          // Byte `b` of element `j` goes to `b * chunk_size + j`, which is
+          // what HDF5's shuffle filter does.
+          for (size_t j = 0; j < chunk_size; ++j) {
+            for (size_t b = 0; b < element_size; ++b) {
+              // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+              raw_chunk[b * chunk_size + j] = chunk_data[j * element_size + b];
+            }
+          }
+        } else {
+          std::copy_n(chunk_data, chunk_bytes, raw_chunk.begin());
+        }
+        auto& compressed_chunk = compressed_chunks[chunk];
+        uLongf compressed_size = compressBound(chunk_bytes);
+        compressed_chunk.resize(compressed_size);
+        const int status =
+            compress2(compressed_chunk.data(), &compressed_size,
+                      raw_chunk.data(), chunk_bytes, deflate_level);
+        if (status != Z_OK) {
+          ERROR("Failed to compress chunk " << chunk << " with zlib (status "
+                                            << status << ").");
+        }
+        compressed_chunk.resize(compressed_size);
+      });
+
+  for (size_t chunk = 0; chunk < number_of_full_chunks; ++chunk) {
+    const hsize_t offset = chunk * chunk_size;
+    CHECK_H5(H5Dwrite_chunk(dataset_id, h5::h5p_default(), 0, &offset,
+                            compressed_chunks[chunk].size(),
+                            compressed_chunks[chunk].data()),
+             "Failed to write chunk " << chunk << " of dataset " << name);
+  }
+
+  const hsize_t remaining_elements =
+      number_of_elements - number_of_full_chunks * chunk_size;
+  if (remaining_elements > 0) {
+    const hsize_t offset = number_of_full_chunks * chunk_size;
+    const hid_t file_space_id = H5Dget_space(dataset_id);
+    CHECK_H5(file_space_id, "Failed to get dataspace of dataset " << name);
+    CHECK_H5(H5Sselect_hyperslab(file_space_id, H5S_SELECT_SET, &offset,
+                                 nullptr, &remaining_elements, nullptr),
+             "Failed to select the last chunk of dataset " << name);
+    const hid_t memory_space_id =
+        H5Screate_simple(1, &remaining_elements, nullptr);
+    CHECK_H5(memory_space_id, "Failed to create dataspace for " << name);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const unsigned char* const last_chunk_data = bytes + offset * element_size;
+    CHECK_H5(H5Dwrite(dataset_id, memory_type, memory_space_id, file_space_id,
+                      h5::h5p_default(), last_chunk_data),
+             "Failed to write the last chunk of dataset " << name);
+    CHECK_H5(H5Sclose(memory_space_id), "Failed to close dataspace");
+    CHECK_H5(H5Sclose(file_space_id), "Failed to close dataspace");
+  }
+  return true;
+}
+
+std::vector<hsize_t> chunk_size(const std::vector<size_t>& extents,
+                                const size_t element_size,
+                                const size_t target_bytes_per_chunk) {
+  const size_t elements_per_chunk =
+      std::max(target_bytes_per_chunk / element_size, size_t{1});
+  std::vector<hsize_t> result(extents.size());
+  for (size_t i = 0; i < result.size(); ++i) {
+    result[i] = std::min(extents[i], elements_per_chunk);
+  }
+  return result;
+}
+}  // namespace detail
+}  // namespace h5
@@ -0,0 +1,130 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines struct h5::Compression
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <hdf5.h>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
+
+namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief How datasets are compressed and chunked when they are written.
+ *
+ * \details The default reproduces what `h5::write_data` has always done:
+ * shuffle followed by deflate at level 5, with chunks of about 128 KiB.
+ * Deflate is slow to write, so for large volume dumps a faster codec or no
+ * compression at all may be preferable:
+ *
+ * - `Codec::None` writes contiguous, uncompressed datasets.
+ * - `Codec::Deflate` uses the gzip filter built into HDF5 at `level`.
+ * - `Codec::Lz4` and `Codec::Zstd` use the registered HDF5 plugin filters
+ *   (IDs 32004 and 32015). If the plugin is not available at runtime, deflate
+ *   at level 1 is used instead so that the file can be read everywhere.
+ *
+ * If `mantissa_bits` is set, floating-point data is rounded to that many
+ * explicit mantissa bits before it is written (at most 52 for `double` and 23
+ * for `float`). This is lossy, but the zeroed low bits compress much better.
+ * The relative rounding error is at most
+ * \f$2^{-(\mathrm{mantissa\_bits}+1)}\f$.
+ *
+ * The chunk size is chosen so that a chunk holds about
+ * `target_bytes_per_chunk` bytes. Keep this a power of two, since other sizes
+ * make compression much slower.
+ *
+ * With `number_of_threads` greater than one, the chunks of one-dimensional
+ * deflate-compressed datasets are shuffled and compressed concurrently outside
+ * of HDF5, and the compressed chunks are then written one after the other with
+ * `H5Dwrite_chunk` on the calling thread. The stored chunks are the ones
+ * HDF5's own filters produce with the same zlib. A last chunk that is only
+ * partly filled, and all other datasets, are compressed by HDF5 on the calling
+ * thread. HDF5 is only ever called from the calling thread.
+ *
+ * Compression settings are not stored in the subfile. They apply to the
+ * datasets written through the `h5::VolumeData` or `h5::Dat` object that was
+ * opened with them.
+ */
+struct Compression {
+  enum class Codec : uint8_t { None, Deflate, Lz4, Zstd };
+
+  Codec codec{Codec::Deflate};
+  /// Compression level for deflate (1-9) and Zstd (1-22)
+  int level{5};
+  /// Whether to apply the byte-shuffle filter before compressing
+  bool shuffle{true};
+  /// Explicit mantissa bits kept for floating-point data, or all if unset
+  std::optional<size_t> mantissa_bits{};
+  size_t target_bytes_per_chunk{131'072};
+  /// Threads that compress the chunks of a dataset, including the calling one
+  size_t number_of_threads{1};
+
+  /// No compression and unchunked datasets
+  static Compression none();
+};
+
+bool operator==(const Compression& lhs, const Compression& rhs);
+bool operator!=(const Compression& lhs, const Compression& rhs);
+
+std::ostream& operator<<(std::ostream& os, Compression::Codec codec);
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Round every element of `data` to `mantissa_bits` explicit mantissa
+ * bits, rounding to nearest with ties away from zero.
+ *
+ * Non-finite values are left unchanged.
+ */
+template <typename T>
+void truncate_mantissa(gsl::not_null<std::vector<T>*> data,
+                       size_t mantissa_bits);
+
+namespace detail {
+/// Whether the HDF5 filter `filter_id` is available for both encoding and
+/// decoding.
+bool filter_available(H5Z_filter_t filter_id);
+
+/// Create a dataset creation property list that chunks with `chunk_size` and
+/// applies the filters of `compression`. The caller must close the returned
+/// list. Returns `H5P_DEFAULT` if no filters are applied and the dataset does
+/// not need to be chunked.
+hid_t dataset_creation_property_list(const Compression& compression,
+                                     const std::vector<hsize_t>& chunk_size,
+                                     bool chunking_required,
+                                     const std::string& name);
+
+/*!
+ * \brief Compress the one-dimensional `data` of `number_of_elements` elements
+ * of `element_size` bytes each into chunks of `chunk_size` elements on
+ * `number_of_threads` threads, and write them to `dataset_id` with
+ * `H5Dwrite_chunk`.
+ *
+ * \details The chunks are compressed the way the filter pipeline of
+ * `property_list` would compress them. Only the shuffle and deflate filters
+ * are supported. Returns `false` without writing anything if the pipeline
+ * contains any other filter or does not end with deflate, in which case the
+ * caller should write the data with `H5Dwrite`. A last chunk that is only
+ * partly filled is written with `H5Dwrite` as `memory_type`.
+ */
+bool write_compressed_chunks(hid_t dataset_id, hid_t property_list,
+                             hid_t memory_type, const void* data,
+                             size_t number_of_elements,
+                             size_t element_size, hsize_t chunk_size,
+                             size_t number_of_threads, const std::string& name);
+
+/// The number of elements of size `element_size` along each dimension of a
+/// chunk, so that a chunk holds about `target_bytes_per_chunk` bytes.
+std::vector<hsize_t> chunk_size(const std::vector<size_t>& extents,
+                                size_t element_size,
+                                size_t target_bytes_per_chunk);
+}  // namespace detail
+}  // namespace h5
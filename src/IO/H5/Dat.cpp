@@ -8,10 +8,12 @@
 #include <iosfwd>
 #include <memory>
 #include <ostream>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/Matrix.hpp"
 #include "IO/H5/CheckH5.hpp"
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/Header.hpp"
 #include "IO/H5/Helpers.hpp"
 #include "IO/H5/Type.hpp"
@@ -24,7 +26,7 @@
 namespace h5 {
 Dat::Dat(const bool exists, detail::OpenGroup&& group, const hid_t location,
          const std::string& name, std::vector<std::string> legend,
-         const uint32_t version)
+         const uint32_t version, Compression compression)
     : group_(std::move(group)),
       name_(extension() == name.substr(name.size() > extension().size()
                                            ? name.size() - extension().size()
@@ -34,7 +36,8 @@ Dat::Dat(const bool exists, detail::OpenGroup&& group, const hid_t location,
       path_(group_.group_path_with_trailing_slash() + name),
       version_(version),
       legend_(std::move(legend)),
-      size_{{0, legend_.size()}} {
+      size_{{0, legend_.size()}},
+      compression_(std::move(compression)) {
   if (exists) {
     dataset_id_ = H5Dopen2(location, name_.c_str(), h5::h5p_default());
     CHECK_H5(dataset_id_, "Failed to open dataset");
@@ -68,9 +71,20 @@ Dat::Dat(const bool exists, detail::OpenGroup&& group, const hid_t location,
     legend_ = read_rank1_attribute<std::string>(dataset_id_, "Legend"s);
     size_[1] = legend_.size();
   } else {  // file does not exist
+    // Uncompressed Dat files keep small chunks so that appending a single row
+    // stays cheap. Compressed chunks must be larger to compress well.
+    const size_t bytes_per_row =
+        sizeof(double) * std::max(legend_.size(), size_t{1});
+    const hsize_t rows_per_chunk =
+        compression_.codec == Compression::Codec::None
+            ? 4
+            : std::max(hsize_t{4}, static_cast<hsize_t>(
+                                       compression_.target_bytes_per_chunk /
+                                       bytes_per_row));
     dataset_id_ = h5::detail::create_extensible_dataset(
-        location, name_, size_, std::array<hsize_t, 2>{{4, legend_.size()}},
-        {{h5s_unlimited(), legend_.size()}});
+        location, name_, size_,
+        std::array<hsize_t, 2>{{rows_per_chunk, legend_.size()}},
+        {{h5s_unlimited(), legend_.size()}}, compression_);
     CHECK_H5(dataset_id_, "Failed to create dataset");
 
     {
@@ -107,7 +121,7 @@ void Dat::append(const std::vector<double>& data) {
           << size_[1] << " but received " << data.size() << " entries.");
   }
 
-  size_ = h5::append_to_dataset(dataset_id_, name_, data, 1, size_);
+  append_rows(data, 1);
 }
 
 void Dat::append(const std::vector<std::vector<double>>& data) {
@@ -134,8 +148,7 @@ void Dat::append(const std::vector<std::vector<double>>& data) {
         return result;
       }(data);
 
-  size_ = h5::append_to_dataset(dataset_id_, name_, contiguous_data,
-                                data.size(), size_);
+  append_rows(contiguous_data, data.size());
 }
 
 void Dat::append(const Matrix& data) {
@@ -157,8 +170,21 @@ void Dat::append(const Matrix& data) {
     return result;
   }(data);
 
-  size_ = h5::append_to_dataset(dataset_id_, name_, contiguous_data,
-                                data.rows(), size_);
+  append_rows(contiguous_data, data.rows());
+}
+
+void Dat::append_rows(const std::vector<double>& data,
+                      const size_t number_of_rows) {
+  if (compression_.mantissa_bits.has_value()) {
+    std::vector<double> truncated_data = data;
+    truncate_mantissa(make_not_null(&truncated_data),
+                      *compression_.mantissa_bits);
+    size_ = h5::append_to_dataset(dataset_id_, name_, truncated_data,
+                                  number_of_rows, size_);
+  } else {
+    size_ = h5::append_to_dataset(dataset_id_, name_, data, number_of_rows,
+                                  size_);
+  }
 }
 
 template <typename T>
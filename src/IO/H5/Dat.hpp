@@ -13,6 +13,7 @@
 #include <string>
 #include <vector>
 
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/Object.hpp"
 #include "IO/H5/OpenGroup.hpp"
 
@@ -36,6 +37,13 @@ namespace h5 {
  * multiple Dat objects can be stored inside a single H5File the problem of many
  * different dat files being stored as individual files is solved.
  *
+ * The data is stored uncompressed unless a `Compression` is passed when the
+ * Dat file is created. Since rows are usually appended a few at a time, a
+ * compressed Dat file uses chunks of about
+ * `Compression::target_bytes_per_chunk` bytes that span many rows. If
+ * `Compression::mantissa_bits` is set, appended data is truncated also when an
+ * existing Dat file is opened.
+ *
  * \note This class does not do any caching of data so all data is written as
  * soon as append() is called.
  */
@@ -46,7 +54,7 @@ class Dat : public h5::Object {
 
   Dat(bool exists, detail::OpenGroup&& group, hid_t location,
       const std::string& name, std::vector<std::string> legend = {},
-      uint32_t version = 1);
+      uint32_t version = 1, Compression compression = Compression::none());
 
   Dat(const Dat& /*rhs*/) = delete;
   Dat& operator=(const Dat& /*rhs*/) = delete;
@@ -124,6 +132,8 @@ class Dat : public h5::Object {
 
  private:
   /// \cond HIDDEN_SYMBOLS
+  void append_rows(const std::vector<double>& data, size_t number_of_rows);
+
   detail::OpenGroup group_;
   std::string name_;
   std::string path_;
@@ -132,6 +142,7 @@ class Dat : public h5::Object {
   std::array<hsize_t, 2> size_;
   std::string header_;
   hid_t dataset_id_{-1};
+  Compression compression_;
   /// \endcond HIDDEN_SYMBOLS
 };
 }  // namespace h5
@@ -18,6 +18,7 @@
 #include "DataStructures/Matrix.hpp"
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/CheckH5.hpp"
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/OpenGroup.hpp"
 #include "IO/H5/Type.hpp"
 #include "IO/H5/Wrappers.hpp"
@@ -195,66 +196,35 @@ bool types_equal(const hid_t dtype1, const hid_t dtype2) {
   return equal > 0;
 }
 
+namespace {
+// Writes `data` without copying it, unless the mantissa has to be truncated.
 template <typename T>
-void write_data(const hid_t group_id, const std::vector<T>& data,
-                const std::vector<size_t>& extents, const std::string& name,
-                const bool overwrite_existing) {
-  std::vector<hsize_t> chunk_size(extents.size());
-  for (size_t i = 0; i < chunk_size.size(); ++i) {
-    // Setting the target number of bytes per chunk to a power of 2 is important
-    // for reducing the cost of writing to disk. Setting to a non-power of 2
-    // increases the compression overhead by ~>10x.
-    constexpr size_t target_number_of_bytes_per_chunk = 131'072;
-    chunk_size[i] = target_number_of_bytes_per_chunk / sizeof(T) > extents[i]
-                        ? extents[i]
-                        : target_number_of_bytes_per_chunk / sizeof(T);
-  }
-  ASSERT(alg::none_of(extents, [](const size_t extent) { return extent == 0; }),
-         "Got zero extent when trying to write data.");
-
+void write_data_impl(const hid_t group_id, const gsl::span<const T> data,
+                     const std::vector<size_t>& extents,
+                     const std::string& name, const bool overwrite_existing,
+                     const Compression& compression) {
   const std::vector<hsize_t> dims(extents.begin(), extents.end());
   const hid_t space_id = H5Screate_simple(dims.size(), dims.data(), nullptr);
   CHECK_H5(space_id, "Failed to create dataspace");
   const hid_t contained_type = h5::h5_type<tt::get_fundamental_type_t<T>>();
 
-  // Check for available filters and write with GZIP+shuffle if available
-  const bool use_gzip_filter = []() {
-    if (not static_cast<bool>(H5Zfilter_avail(H5Z_FILTER_DEFLATE))) {
-      return false;
+  const std::vector<hsize_t> chunk_size = detail::chunk_size(
+      extents, sizeof(T), compression.target_bytes_per_chunk);
+  const hid_t property_list = detail::dataset_creation_property_list(
+      compression, chunk_size, false, name);
+
+  // Only floating-point data can be truncated, and only a copy since the
+  // caller's data must not change.
+  std::vector<T> truncated_data{};
+  if constexpr (std::is_floating_point_v<T>) {
+    if (compression.mantissa_bits.has_value()) {
+      truncated_data.assign(data.begin(), data.end());
+      truncate_mantissa(make_not_null(&truncated_data),
+                        *compression.mantissa_bits);
     }
-    unsigned int filter_info = 0;
-    const auto status = H5Zget_filter_info(H5Z_FILTER_DEFLATE, &filter_info);
-    return status >= 0 and (filter_info & H5Z_FILTER_CONFIG_ENCODE_ENABLED) and
-           (filter_info & H5Z_FILTER_CONFIG_DECODE_ENABLED);
-  }();
-  const bool use_shuffle_filter = []() {
-    if (not static_cast<bool>(H5Zfilter_avail(H5Z_FILTER_SHUFFLE))) {
-      return false;
-    }
-    unsigned int filter_info = 0;
-    const auto status = H5Zget_filter_info(H5Z_FILTER_SHUFFLE, &filter_info);
-    return status >= 0 and (filter_info & H5Z_FILTER_CONFIG_ENCODE_ENABLED) and
-           (filter_info & H5Z_FILTER_CONFIG_DECODE_ENABLED);
-  }();
-
-  hid_t property_list = h5::h5p_default();
-  // We can't compress a single number. Since there's not much to reduce anyway,
-  // we just skip compression.
-  if (not extents.empty() and use_gzip_filter) {
-    property_list = H5Pcreate(H5P_DATASET_CREATE);
-    if (use_shuffle_filter) {
-      CHECK_H5(H5Pset_shuffle(property_list),
-               "Failed to enable shuffle filter on dataset " << name);
-    }
-    CHECK_H5(H5Pset_deflate(property_list, 5),
-             "Failed to enable gzip filter on dataset " << name);
-    CHECK_H5(H5Pset_chunk(property_list, chunk_size.size(), chunk_size.data()),
-             "Failed to set chunk size on dataset " << name);
-    CHECK_H5(H5Pset_fill_time(property_list, H5D_FILL_TIME_NEVER),
-             "Failed to disable setting default values on dataset creation for "
-             "dataset "
-                 << name);
   }
+  const T* const data_to_write =
+      truncated_data.empty() ? data.data() : truncated_data.data();
 
   if (H5Lexists(group_id, name.c_str(), h5::h5p_default()) != 0) {
     if (not overwrite_existing) {
@@ -269,37 +239,43 @@ void write_data(const hid_t group_id, const std::vector<T>& data,
       H5Dcreate2(group_id, name.c_str(), contained_type, space_id,
                  h5::h5p_default(), property_list, h5::h5p_default());
   CHECK_H5(dataset_id, "Failed to create dataset");
-  CHECK_H5(H5Dwrite(dataset_id, contained_type, h5::h5s_all(), h5::h5s_all(),
-                    h5::h5p_default(), static_cast<const void*>(data.data())),
-           "Failed to write data to dataset");
+  const bool wrote_compressed_chunks =
+      compression.number_of_threads > 1 and extents.size() == 1 and
+      property_list != h5::h5p_default() and
+      detail::write_compressed_chunks(
+          dataset_id, property_list, contained_type,
+          static_cast<const void*>(data_to_write),
+          data.size(), sizeof(T), chunk_size[0],
+          compression.number_of_threads, name);
+  if (not wrote_compressed_chunks) {
+    CHECK_H5(H5Dwrite(dataset_id, contained_type, h5::h5s_all(), h5::h5s_all(),
+                      h5::h5p_default(),
+                      static_cast<const void*>(data_to_write)),
+             "Failed to write data to dataset");
+  }
+  if (property_list != h5::h5p_default()) {
+    CHECK_H5(H5Pclose(property_list), "Failed to close property list");
+  }
   CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
   CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
 }
+}  // namespace
+
+template <typename T>
+void write_data(const hid_t group_id, const std::vector<T>& data,
+                const std::vector<size_t>& extents, const std::string& name,
+                const bool overwrite_existing, const Compression& compression) {
+  ASSERT(alg::none_of(extents, [](const size_t extent) { return extent == 0; }),
+         "Got zero extent when trying to write data.");
+  write_data_impl(group_id, gsl::span<const T>(data.data(), data.size()),
+                  extents, name, overwrite_existing, compression);
+}
 
 void write_data(const hid_t group_id, const DataVector& data,
-                const std::string& name, const bool overwrite_existing) {
-  const auto number_of_points = static_cast<hsize_t>(data.size());
-  const hid_t space_id = H5Screate_simple(1, &number_of_points, nullptr);
-  CHECK_H5(space_id, "Failed to create dataspace");
-  const hid_t contained_type = h5::h5_type<double>();
-  if (H5Lexists(group_id, name.c_str(), h5::h5p_default()) != 0) {
-    if (not overwrite_existing) {
-      ERROR("Dataset already exists with name '" << name << "'.");
-    }
-    // Possible optimization: resize existing dataset if it has the same
-    // dimensions.
-    CHECK_H5(H5Ldelete(group_id, name.c_str(), h5::h5p_default()),
-             "Failed to delete existing dataset");
-  }
-  const hid_t dataset_id =
-      H5Dcreate2(group_id, name.c_str(), contained_type, space_id,
-                 h5::h5p_default(), h5::h5p_default(), h5::h5p_default());
-  CHECK_H5(dataset_id, "Failed to create dataset");
-  CHECK_H5(H5Dwrite(dataset_id, contained_type, h5::h5s_all(), h5::h5s_all(),
-                    h5::h5p_default(), static_cast<const void*>(data.data())),
-           "Failed to write data to dataset");
-  CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
-  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+                const std::string& name, const bool overwrite_existing,
+                const Compression& compression) {
+  write_data_impl(group_id, gsl::span<const double>(data.data(), data.size()),
+                  {data.size()}, name, overwrite_existing, compression);
 }
 
 template <size_t Dim>
@@ -964,7 +940,7 @@ template Index<3> read_extents<3>(const hid_t group_id,
   template void write_data<TYPE(DATA)>(                            \
       const hid_t group_id, const std::vector<TYPE(DATA)>& data,   \
       const std::vector<size_t>& extents, const std::string& name, \
-      bool overwrite_existing);
+      bool overwrite_existing, const Compression& compression);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE_WRITE_DATA,
                         (float, double, int, unsigned int, long, unsigned long,
@@ -1085,19 +1061,16 @@ template <size_t Dims>
 hid_t create_extensible_dataset(const hid_t group_id, const std::string& name,
                                 const std::array<hsize_t, Dims>& initial_size,
                                 const std::array<hsize_t, Dims>& chunk_size,
-                                const std::array<hsize_t, Dims>& max_size) {
+                                const std::array<hsize_t, Dims>& max_size,
+                                const Compression& compression) {
   const hid_t dataspace_id =
       H5Screate_simple(Dims, initial_size.data(), max_size.data());
   CHECK_H5(dataspace_id, "Failed to create extensible dataspace");
 
-  const auto property_list = H5Pcreate(H5P_DATASET_CREATE);
-  CHECK_H5(property_list, "Failed to create property list");
-  CHECK_H5(H5Pset_chunk(property_list, Dims, chunk_size.data()),
-           "Failed to set chunk size");
-  CHECK_H5(H5Pset_fill_time(property_list, H5D_FILL_TIME_NEVER),
-           "Failed to disable setting default values on dataset creation for "
-           "dataset "
-               << name);
+  // Extensible datasets must always be chunked
+  const auto property_list = dataset_creation_property_list(
+      compression, std::vector<hsize_t>(chunk_size.begin(), chunk_size.end()),
+      true, name);
 
   const hid_t dataset_id =
       H5Dcreate2(group_id, name.c_str(), h5_type<double>(), dataspace_id,
@@ -1112,15 +1085,18 @@ template hid_t create_extensible_dataset<1>(
     const hid_t group_id, const std::string& name,
     const std::array<hsize_t, 1>& initial_size,
     const std::array<hsize_t, 1>& chunk_size,
-    const std::array<hsize_t, 1>& max_size);
+    const std::array<hsize_t, 1>& max_size,
+    const Compression& compression);
 template hid_t create_extensible_dataset<2>(
     const hid_t group_id, const std::string& name,
     const std::array<hsize_t, 2>& initial_size,
     const std::array<hsize_t, 2>& chunk_size,
-    const std::array<hsize_t, 2>& max_size);
+    const std::array<hsize_t, 2>& max_size,
+    const Compression& compression);
 template hid_t create_extensible_dataset<3>(
     const hid_t group_id, const std::string& name,
     const std::array<hsize_t, 3>& initial_size,
     const std::array<hsize_t, 3>& chunk_size,
-    const std::array<hsize_t, 3>& max_size);
+    const std::array<hsize_t, 3>& max_size,
+    const Compression& compression);
 }  // namespace h5::detail
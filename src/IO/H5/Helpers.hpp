@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "DataStructures/Index.hpp"
+#include "IO/H5/Compression.hpp"
 
 /// \cond
 class DataVector;
@@ -29,19 +30,27 @@ bool types_equal(hid_t dtype1, hid_t dtype2);
 /*!
  * \ingroup HDF5Group
  * \brief Write a std::vector named `name` to the group `group_id`
+ *
+ * The dataset is chunked and compressed according to `compression`.
  */
 template <typename T>
 void write_data(hid_t group_id, const std::vector<T>& data,
                 const std::vector<size_t>& extents,
                 const std::string& name = "scalar",
-                const bool overwrite_existing = false);
+                const bool overwrite_existing = false,
+                const Compression& compression = {});
 
 /*!
  * \ingroup HDF5Group
  * \brief Write a DataVector named `name` to the group `group_id`
+ *
+ * By default the dataset is contiguous and uncompressed. Otherwise it is
+ * chunked and compressed according to `compression`, without copying `data`
+ * unless its mantissa is truncated.
  */
 void write_data(hid_t group_id, const DataVector& data, const std::string& name,
-                const bool overwrite_existing = false);
+                const bool overwrite_existing = false,
+                const Compression& compression = Compression::none());
 
 /*!
  * \ingroup HDF5Group
@@ -230,12 +239,15 @@ namespace detail {
  * \returns the HDF5 id to the created dataset
  *
  * See the tutorial at https://support.hdfgroup.org/HDF5/Tutor/extend.html
- * for details on the implementation choice.
+ * for details on the implementation choice. The filters of `compression` are
+ * applied to each chunk; its chunk size target is ignored.
  */
 template <size_t Dims>
-hid_t create_extensible_dataset(hid_t group_id, const std::string& name,
-                                const std::array<hsize_t, Dims>& initial_size,
-                                const std::array<hsize_t, Dims>& chunk_size,
-                                const std::array<hsize_t, Dims>& max_size);
+hid_t create_extensible_dataset(
+    hid_t group_id, const std::string& name,
+    const std::array<hsize_t, Dims>& initial_size,
+    const std::array<hsize_t, Dims>& chunk_size,
+    const std::array<hsize_t, Dims>& max_size,
+    const Compression& compression = Compression::none());
 }  // namespace detail
 }  // namespace h5
@@ -14,11 +14,14 @@
 #include <optional>
 #include <ostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "IO/Connectivity.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/ExtendConnectivityHelpers.hpp"
 #include "IO/H5/Header.hpp"
 #include "IO/H5/Helpers.hpp"
@@ -150,7 +153,8 @@ void append_element_extents_and_connectivity(
 
 VolumeData::VolumeData(const bool subfile_exists, detail::OpenGroup&& group,
                        const hid_t /*location*/, const std::string& name,
-                       const uint32_t version)
+                       const uint32_t version,
+                       std::optional<Compression> compression)
     : group_(std::move(group)),
       name_(name.size() > extension().size()
                 ? (extension() == name.substr(name.size() - extension().size())
@@ -159,7 +163,8 @@ VolumeData::VolumeData(const bool subfile_exists, detail::OpenGroup&& group,
                 : name + extension()),
       path_(group_.group_path_with_trailing_slash() + name),
       version_(version),
-      volume_data_group_(group_.id(), name_, h5::AccessType::ReadWrite) {
+      volume_data_group_(group_.id(), name_, h5::AccessType::ReadWrite),
+      compression_(std::move(compression)) {
   if (subfile_exists) {
     // We treat this as an internal version for now. We'll need to deal with
     // proper versioning later.
@@ -203,6 +208,7 @@ void VolumeData::write_volume_data(
   }
   h5::write_to_attribute(observation_group.id(), "observation_value",
                          observation_value);
+  const Compression compression = compression_.value_or(Compression{});
   // Get first element to extract the component names and dimension
   const auto get_component_name = [](const auto& component) {
     ASSERT(component.name.find_last_of('/') == std::string::npos,
@@ -294,7 +300,8 @@ void VolumeData::write_volume_data(
                 std::get<type_from_variant>(tensor_component.data).end());
           }  // for each element
           h5::write_data(observation_group.id(), *contiguous_tensor_data_ptr,
-                         {contiguous_tensor_data_ptr->size()}, component_name);
+                         {contiguous_tensor_data_ptr->size()}, component_name,
+                         false, compression);
         };
 
     if (elements[0].tensor_components[i].data.index() == 0) {
@@ -317,12 +324,13 @@ void VolumeData::write_volume_data(
   // First grid, the second `dim` belong to the second grid, and so on,
   // Ordering is `x, y, z, ... `
   h5::write_data(observation_group.id(), total_extents, {total_extents.size()},
-                 "total_extents");
+                 "total_extents", false, compression);
   // Write the names of the grids as vector of chars with individual names
   // separated by `separator()`
   std::vector<char> grid_names_as_chars(grid_names.begin(), grid_names.end());
   h5::write_data(observation_group.id(), grid_names_as_chars,
-                 {grid_names_as_chars.size()}, "grid_names");
+                 {grid_names_as_chars.size()}, "grid_names", false,
+                 compression);
   // Write the coded quadrature, along with the dictionary
   const auto io_quadratures = Spectral::all_quadratures();
   std::vector<std::string> quadrature_dict(io_quadratures.size());
@@ -331,17 +339,19 @@ void VolumeData::write_volume_data(
   h5_detail::write_dictionary("Quadrature dictionary", quadrature_dict,
                               observation_group);
   h5::write_data(observation_group.id(), quadratures, {quadratures.size()},
-                 "quadratures");
+                 "quadratures", false, compression);
   // Write the coded basis, along with the dictionary
   const auto io_bases = Spectral::all_bases();
   std::vector<std::string> basis_dict(io_bases.size());
   alg::transform(io_bases, basis_dict.begin(), get_output<Spectral::Basis>);
   h5_detail::write_dictionary("Basis dictionary", basis_dict,
                               observation_group);
-  h5::write_data(observation_group.id(), bases, {bases.size()}, "bases");
+  h5::write_data(observation_group.id(), bases, {bases.size()}, "bases", false,
+                 compression);
   // Write the Connectivity
   h5::write_data(observation_group.id(), total_connectivity,
-                 {total_connectivity.size()}, "connectivity");
+                 {total_connectivity.size()}, "connectivity", false,
+                 compression);
   // Note: pole_connectivity stores extra connections that define triangles to
   // fill in the poles on a Strahlkorper and is empty if not outputting
   // Strahlkorper surface data. Because these connections define triangles
@@ -349,17 +359,20 @@ void VolumeData::write_volume_data(
   // included in total_connectivity.
   if (not pole_connectivity.empty()) {
     h5::write_data(observation_group.id(), pole_connectivity,
-                   {pole_connectivity.size()}, "pole_connectivity");
+                   {pole_connectivity.size()}, "pole_connectivity", false,
+                   compression);
   }
   // Write the serialized domain
   if (serialized_domain.has_value()) {
     h5::write_data(observation_group.id(), *serialized_domain,
-                   {serialized_domain->size()}, "domain");
+                   {serialized_domain->size()}, "domain", false,
+                   compression);
   }
   // Write the serialized functions of time
   if (serialized_functions_of_time.has_value()) {
     h5::write_data(observation_group.id(), *serialized_functions_of_time,
-                   {serialized_functions_of_time->size()}, "functions_of_time");
+                   {serialized_functions_of_time->size()}, "functions_of_time",
+                   false, compression);
   }
 }
 
@@ -393,8 +406,9 @@ void VolumeData::write_tensor_component(
   const std::string path = "ObservationId" + std::to_string(observation_id);
   detail::OpenGroup observation_group(volume_data_group_.id(), path,
                                       AccessType::ReadWrite);
-  h5::write_data(observation_group.id(), contiguous_tensor_data, component_name,
-                 overwrite_existing);
+  h5::write_data(observation_group.id(), contiguous_tensor_data,
+                 component_name, overwrite_existing,
+                 compression_.value_or(Compression::none()));
 }
 
 void VolumeData::write_tensor_component(
@@ -406,7 +420,7 @@ void VolumeData::write_tensor_component(
                                       AccessType::ReadWrite);
   h5::write_data(observation_group.id(), contiguous_tensor_data,
                  {contiguous_tensor_data.size()}, component_name,
-                 overwrite_existing);
+                 overwrite_existing, compression_.value_or(Compression{}));
 }
 
 std::vector<size_t> VolumeData::list_observation_ids() const {
@@ -539,6 +553,80 @@ TensorComponent VolumeData::get_tensor_component(
   }
 }
 
+TensorComponent VolumeData::get_tensor_component(
+    const size_t observation_id, const std::string& tensor_component,
+    const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths) const {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadOnly);
+
+  const hid_t dataset_id =
+      h5::open_dataset(observation_group.id(), tensor_component);
+  const hid_t dataspace_id = h5::open_dataspace(dataset_id);
+  if (H5Sget_simple_extent_ndims(dataspace_id) != 1) {
+    ERROR("Can only read parts of rank 1 datasets, but '"
+          << tensor_component << "' has rank "
+          << H5Sget_simple_extent_ndims(dataspace_id));
+  }
+  hsize_t dataset_size = 0;
+  H5Sget_simple_extent_dims(dataspace_id, &dataset_size, nullptr);
+
+  CHECK_H5(H5Sselect_none(dataspace_id),
+           "Failed to select none of the dataspace");
+  hsize_t number_of_points = 0;
+  for (const auto& [offset, length] : offsets_and_lengths) {
+    ASSERT(offset >= number_of_points,
+           "The intervals must be sorted by offset and must not overlap.");
+    if (UNLIKELY(offset + length > dataset_size)) {
+      ERROR("The interval [" << offset << ", " << offset + length
+                             << ") is out of bounds for the dataset '"
+                             << tensor_component << "' of size "
+                             << dataset_size << ".");
+    }
+    if (length == 0) {
+      continue;
+    }
+    const std::array<hsize_t, 1> start{{offset}};
+    const std::array<hsize_t, 1> count{{length}};
+    CHECK_H5(H5Sselect_hyperslab(dataspace_id, H5S_SELECT_OR, start.data(),
+                                 nullptr, count.data(), nullptr),
+             "Failed to select the interval at offset " << offset);
+    number_of_points += length;
+  }
+
+  const bool use_float =
+      h5::types_equal(H5Dget_type(dataset_id), h5::h5_type<float>());
+  const auto read_selection = [&dataset_id, &dataspace_id, &number_of_points,
+                               &tensor_component](auto type_to_get_v) {
+    using type_to_get = tmpl::type_from<decltype(type_to_get_v)>;
+    type_to_get data(number_of_points);
+    if (number_of_points > 0) {
+      const hid_t memspace_id =
+          H5Screate_simple(1, &number_of_points, &number_of_points);
+      CHECK_H5(memspace_id, "Failed to create memory space");
+      CHECK_H5(H5Dread(dataset_id,
+                       h5::h5_type<typename type_to_get::value_type>(),
+                       memspace_id, dataspace_id, h5::h5p_default(),
+                       data.data()),
+               "Failed to read the selected intervals of '" << tensor_component
+                                                            << "'");
+      CHECK_H5(H5Sclose(memspace_id), "Failed to close memory space");
+    }
+    return data;
+  };
+
+  TensorComponent result{};
+  if (use_float) {
+    result = {tensor_component,
+              read_selection(tmpl::type_<std::vector<float>>{})};
+  } else {
+    result = {tensor_component, read_selection(tmpl::type_<DataVector>{})};
+  }
+  h5::close_dataspace(dataspace_id);
+  h5::close_dataset(dataset_id);
+  return result;
+}
+
 std::vector<std::vector<size_t>> VolumeData::get_extents(
     const size_t observation_id) const {
   const std::string path = "ObservationId" + std::to_string(observation_id);
@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/Object.hpp"
 #include "IO/H5/OpenGroup.hpp"
 
@@ -74,6 +75,16 @@ namespace h5 {
  * deserialize the data, taking into account that files may be written and read
  * with different versions of the code.
  *
+ * \par Compression
+ * All datasets written through a VolumeData object are chunked and compressed
+ * according to the `h5::Compression` passed to the constructor. Without one,
+ * `write_volume_data` and the `std::vector<float>` overload of
+ * `write_tensor_component` apply shuffle and deflate at level 5 and the
+ * `DataVector` overload writes contiguous, uncompressed datasets, as they
+ * always have. The compression settings are not stored in the subfile, since
+ * HDF5 records the filters of each dataset and readers need no extra
+ * information.
+ *
  * \warning Currently the topology of the grids is assumed to be tensor products
  * of lines, i.e. lines, quadrilaterals, and hexahedrons. However, this can be
  * extended in the future. If support for more topologies is required, please
@@ -84,7 +95,8 @@ class VolumeData : public h5::Object {
   static std::string extension() { return ".vol"; }
 
   VolumeData(bool subfile_exists, detail::OpenGroup&& group, hid_t location,
-             const std::string& name, uint32_t version = 1);
+             const std::string& name, uint32_t version = 1,
+             std::optional<Compression> compression = std::nullopt);
 
   VolumeData(const VolumeData& /*rhs*/) = delete;
   VolumeData& operator=(const VolumeData& /*rhs*/) = delete;
@@ -166,6 +178,17 @@ class VolumeData : public h5::Object {
   TensorComponent get_tensor_component(
       size_t observation_id, const std::string& tensor_component) const;
 
+  /// Read a tensor component with name `tensor_component` at observation id
+  /// `observation_id` only in the intervals `offsets_and_lengths` of the
+  /// contiguous dataset, as returned by `h5::offset_and_length_for_grid`.
+  ///
+  /// The intervals are selected with an HDF5 hyperslab so only their data is
+  /// read from disk. They must be sorted by offset and must not overlap. The
+  /// data of the intervals is concatenated in the returned component.
+  TensorComponent get_tensor_component(
+      size_t observation_id, const std::string& tensor_component,
+      const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths) const;
+
   /// Read the extents of all the grids stored in the file at the observation id
   /// `observation_id`
   std::vector<std::vector<size_t>> get_extents(size_t observation_id) const;
@@ -228,6 +251,7 @@ class VolumeData : public h5::Object {
   uint32_t version_{};
   detail::OpenGroup volume_data_group_{};
   std::string header_{};
+  std::optional<Compression> compression_{};
 };
 
 /*!
@@ -3,10 +3,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -26,22 +32,28 @@
 #include "IO/H5/VolumeData.hpp"
 #include "IO/Importers/ObservationSelector.hpp"
 #include "IO/Importers/Tags.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
 #include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
 #include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 #include "Parallel/ArrayComponentId.hpp"
 #include "Parallel/ArrayIndex.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/FileSystem.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
+#include "Utilities/MakeArray.hpp"
 #include "Utilities/Overloader.hpp"
+#include "Utilities/ParallelFor.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/Serialization/Serialize.hpp"
 #include "Utilities/TMPL.hpp"
@@ -79,16 +91,24 @@ struct Selected : db::SimpleTag {
 namespace detail {
 
 // Read the single `tensor_name` from the `volume_file`, taking care of suffixes
-// like "_x" etc for its components.
+// like "_x" etc for its components. If `offsets_and_lengths` is given, only
+// these intervals of the contiguous dataset are read and concatenated.
 template <typename TensorType>
-void read_tensor_data(const gsl::not_null<TensorType*> tensor_data,
-                      const std::string& tensor_name,
-                      const h5::VolumeData& volume_file,
-                      const size_t observation_id) {
+void read_tensor_data(
+    const gsl::not_null<TensorType*> tensor_data,
+    const std::string& tensor_name, const h5::VolumeData& volume_file,
+    const size_t observation_id,
+    const std::optional<std::vector<std::pair<size_t, size_t>>>&
+        offsets_and_lengths = std::nullopt) {
   for (size_t i = 0; i < tensor_data->size(); ++i) {
-    const auto& tensor_component = volume_file.get_tensor_component(
-        observation_id, tensor_name + tensor_data->component_suffix(
-                                          tensor_data->get_tensor_index(i)));
+    const std::string component_name =
+        tensor_name +
+        tensor_data->component_suffix(tensor_data->get_tensor_index(i));
+    const auto& tensor_component =
+        offsets_and_lengths.has_value()
+            ? volume_file.get_tensor_component(observation_id, component_name,
+                                               *offsets_and_lengths)
+            : volume_file.get_tensor_component(observation_id, component_name);
     if (not std::holds_alternative<DataVector>(tensor_component.data)) {
       ERROR("The tensor component '"
             << tensor_component.name
@@ -100,24 +120,28 @@ void read_tensor_data(const gsl::not_null<TensorType*> tensor_data,
 }
 
 // Read the `selected_fields` from the `volume_file`. Reads the data
-// for all elements in the `volume_file` at once. Invoked lazily when data
-// for an element in the volume file is needed.
+// for all elements in the `volume_file` at once, or only the intervals
+// `offsets_and_lengths` of the contiguous dataset if they are given. Invoked
+// lazily when data for an element in the volume file is needed.
 template <typename FieldTagsList>
 tuples::tagged_tuple_from_typelist<FieldTagsList> read_tensor_data(
     const h5::VolumeData& volume_file, const size_t observation_id,
     const tuples::tagged_tuple_from_typelist<
-        db::wrap_tags_in<Tags::Selected, FieldTagsList>>& selected_fields) {
+        db::wrap_tags_in<Tags::Selected, FieldTagsList>>& selected_fields,
+    const std::optional<std::vector<std::pair<size_t, size_t>>>&
+        offsets_and_lengths = std::nullopt) {
   tuples::tagged_tuple_from_typelist<FieldTagsList> all_tensor_data{};
   tmpl::for_each<FieldTagsList>([&all_tensor_data, &volume_file,
-                                 &observation_id,
-                                 &selected_fields](auto field_tag_v) {
+                                 &observation_id, &selected_fields,
+                                 &offsets_and_lengths](auto field_tag_v) {
     using field_tag = tmpl::type_from<decltype(field_tag_v)>;
     const auto& selection = get<Tags::Selected<field_tag>>(selected_fields);
     if (not selection.has_value()) {
       return;
     }
     read_tensor_data(make_not_null(&get<field_tag>(all_tensor_data)),
-                     selection.value(), volume_file, observation_id);
+                     selection.value(), volume_file, observation_id,
+                     offsets_and_lengths);
   });
   return all_tensor_data;
 }
@@ -359,16 +383,27 @@ struct ReadVolumeData {
  * that was encoded into the `Parallel::ArrayComponentId` used to register the
  * elements. The `volume_data_id` passed to this action is used as key.
  *
+ * \par Parallelism
+ * When the source and target elements differ, the target points are found in
+ * the source elements and the data is interpolated with `parallel_for` on
+ * `importers::OptionTags::NumberOfThreads` threads. The source elements of each
+ * volume data file are indexed by their refinement levels (see
+ * `ElementIndex`), and the target points are transformed to block logical
+ * coordinates only once for all files. The data is sent to the target elements
+ * from the thread that runs this action.
+ *
  * \par Memory consumption
  * This action runs once on every node. It reads all volume data files on the
  * node, but doesn't keep them all in memory at once. The following items
  * contribute primarily to memory consumption and can be reconsidered if we run
  * into memory issues:
  *
- * - `all_tensor_data`: All requested tensor components in the volume data file
- *   at the specified observation ID. Only data from one volume data file is
- *   held in memory at any time. Only data from files that overlap with target
- *   elements on this node are read in.
+ * - `all_tensor_data` / `needed_tensor_data`: The requested tensor components
+ *   in the volume data file at the specified observation ID. Only data from one
+ *   volume data file is held in memory at any time. Only data from files that
+ *   overlap with target elements on this node are read in. When interpolating,
+ *   only the data of source elements that overlap with target elements on this
+ *   node is read.
  * - `target_element_data_buffer`: Holds incomplete interpolated data for each
  *   (target) element that resides on this node. In the worst case, when all
  *   target elements need data from the last source element in the last volume
@@ -450,6 +485,17 @@ struct ReadAllVolumeDataAndDistribute {
         target_element_data_buffer{};
     std::unordered_map<ElementId<Dim>, std::vector<size_t>>
         all_indices_of_filled_interp_points{};
+    // Block logical coordinates of the target points in the source domain.
+    // They are the same for all volume files, so they are computed only once.
+    std::unordered_map<ElementId<Dim>,
+                       std::optional<std::vector<BlockLogicalCoords<Dim>>>>
+        target_block_logical_coords{};
+    if (not elements_are_identical) {
+      for (const auto& target_element_id : target_element_ids) {
+        target_block_logical_coords.emplace(target_element_id, std::nullopt);
+      }
+    }
+    const size_t number_of_threads = get<OptionTags::NumberOfThreads>(options);
 
     // Resolve the file glob
     const std::string& file_glob = get<OptionTags::FileGlob>(options);
@@ -458,12 +504,20 @@ struct ReadAllVolumeDataAndDistribute {
       ERROR_NO_TRACE("The file glob '" << file_glob << "' matches no files.");
     }
 
+    // HDF5 isn't thread-safe, so we hold the same lock as the observers while
+    // a file is open. They may be writing volume data in the background.
+    Parallel::NodeLock* const h5_file_lock = observers::h5_file_lock(cache);
+
     // Open every file in turn
     std::optional<size_t> prev_observation_id{};
     double observation_value = std::numeric_limits<double>::signaling_NaN();
     std::optional<Domain<Dim>> source_domain{};
     domain::FunctionsOfTimeMap source_domain_functions_of_time{};
     for (const std::string& file_name : file_paths) {
+      std::unique_lock<Parallel::NodeLock> hold_lock{};
+      if (h5_file_lock != nullptr) {
+        hold_lock = std::unique_lock{*h5_file_lock};
+      }
       // Open the volume data file
       h5::H5File<h5::AccessType::ReadOnly> h5file(file_name);
       constexpr size_t version_number = 0;
@@ -517,10 +571,13 @@ struct ReadAllVolumeDataAndDistribute {
       const auto source_quadratures =
           volume_file.get_quadratures(observation_id);
       std::vector<ElementId<Dim>> source_element_ids{};
+      std::unordered_map<ElementId<Dim>, size_t> source_element_positions{};
       if (not elements_are_identical) {
         // Need to parse all source grid names to element IDs
         source_element_ids.reserve(source_grid_names.size());
         for (const auto& grid_name : source_grid_names) {
+          source_element_positions.emplace(ElementId<Dim>(grid_name),
+                                           source_element_ids.size());
           source_element_ids.push_back(ElementId<Dim>(grid_name));
         }
       }
@@ -581,64 +638,35 @@ struct ReadAllVolumeDataAndDistribute {
       // search only for incomplete elements in subsequent volume files, and
       // to stop early when all registered elements are complete.
       std::unordered_set<ElementId<Dim>> completed_target_elements{};
-      for (const auto& target_element_id : target_element_ids) {
-        const auto& [target_points, target_mesh] =
-            get<Tags::RegisteredElements<Dim>>(box).at(
-                Parallel::make_array_component_id<ReceiveComponent>(
-                    target_element_id));
-        const auto target_grid_name = get_output(target_element_id);
-
-        // Proceed with the registered element only if it overlaps with the
-        // volume file. It's possible that the volume file only contains data
-        // for a subset of elements, e.g., when each node of a simulation
-        // wrote volume data for its elements to a separate file.
-        std::vector<ElementId<Dim>> overlapping_source_element_ids{};
-        std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>
-            source_element_logical_coords{};
-        if (not elements_are_identical) {
-          // Transform the target points to block logical coords in the source
-          // domain
-          const auto source_block_logical_coords = block_logical_coordinates(
-              *source_domain, target_points, observation_value,
-              source_domain_functions_of_time);
-          // Find the target points in the subset of source elements contained
-          // in this volume file
-          source_element_logical_coords = element_logical_coordinates(
-              source_element_ids, source_block_logical_coords);
-          overlapping_source_element_ids.reserve(
-              source_element_logical_coords.size());
-          for (const auto& source_element_id_and_coords :
-               source_element_logical_coords) {
-            overlapping_source_element_ids.push_back(
-                source_element_id_and_coords.first);
-          }
-        } else {
+      if (elements_are_identical) {
+        for (const auto& target_element_id : target_element_ids) {
+          const auto& [target_points, target_mesh] =
+              get<Tags::RegisteredElements<Dim>>(box).at(
+                  Parallel::make_array_component_id<ReceiveComponent>(
+                      target_element_id));
+          const auto target_grid_name = get_output(target_element_id);
+
           // When elements match we process only volume files that contain the
-          // exact element
+          // exact element. It's possible that the volume file only contains
+          // data for a subset of elements, e.g., when each node of a
+          // simulation wrote volume data for its elements to a separate file.
           if (std::find(source_grid_names.begin(), source_grid_names.end(),
                         target_grid_name) == source_grid_names.end()) {
             continue;
           }
-          overlapping_source_element_ids.push_back(target_element_id);
-        }
 
-        // Lazily load the tensor data from the file if needed
-        if (not overlapping_source_element_ids.empty() and
-            not all_tensor_data.has_value()) {
-          all_tensor_data = detail::read_tensor_data<FieldTagsList>(
-              volume_file, observation_id, selected_fields);
-        }
+          // Lazily load the tensor data from the file if needed
+          if (not all_tensor_data.has_value()) {
+            all_tensor_data = detail::read_tensor_data<FieldTagsList>(
+                volume_file, observation_id, selected_fields);
+          }
 
-        // Iterate over the source elements in this volume file that overlap
-        // with the target element
-        for (const auto& source_element_id : overlapping_source_element_ids) {
-          const auto source_grid_name = get_output(source_element_id);
           const auto source_mesh = h5::mesh_for_grid<Dim>(
-              source_grid_name, source_grid_names, source_extents, source_bases,
-              source_quadratures);
+              target_grid_name, source_grid_names, source_extents,
+              source_bases, source_quadratures);
           // Find the data offset that corresponds to this element
           const auto element_data_offset_and_length =
-              h5::offset_and_length_for_grid(source_grid_name,
+              h5::offset_and_length_for_grid(target_grid_name,
                                              source_grid_names, source_extents);
           // Extract this element's data from the read-in dataset
           auto source_element_data =
@@ -646,90 +674,207 @@ struct ReadAllVolumeDataAndDistribute {
                   element_data_offset_and_length, *all_tensor_data,
                   selected_fields);
 
-          if (not elements_are_identical) {
-            const size_t target_num_points = target_points.begin()->size();
-
-            // Get and resize target buffer
-            auto& target_element_data =
-                target_element_data_buffer[target_element_id];
-            tmpl::for_each<FieldTagsList>([&target_element_data,
-                                           &target_num_points,
-                                           &selected_fields](auto field_tag_v) {
-              using field_tag = tmpl::type_from<decltype(field_tag_v)>;
-              if (get<Tags::Selected<field_tag>>(selected_fields).has_value()) {
-                for (auto& component : get<field_tag>(target_element_data)) {
-                  component.destructive_resize(target_num_points);
-                }
+          // Source and target element are the same (matching domains and
+          // same h-refinement), so no interpolation across elements is
+          // needed. We still may have to interpolate between different
+          // meshes (p-refinement). First, verify this assumption:
+          if (source_domain.has_value()) {
+            detail::verify_inertial_coordinates(
+                *source_domain, observation_value,
+                source_domain_functions_of_time, target_element_id,
+                target_mesh, target_points);
+          }
+          tuples::tagged_tuple_from_typelist<FieldTagsList>
+              target_element_data{};
+          if (source_mesh == target_mesh) {
+            target_element_data = std::move(source_element_data);
+          } else {
+            detail::interpolate_selected_fields<FieldTagsList>(
+                make_not_null(&target_element_data), source_element_data,
+                source_mesh, target_mesh, selected_fields);
+          }
+          // Pass data directly to the target element
+          if constexpr (Parallel::is_dg_element_collection_v<
+                            ReceiveComponent>) {
+            ERROR("Can't yet do numerical initial data with nodegroups");
+          } else {
+            Parallel::receive_data<Tags::VolumeData<FieldTagsList>>(
+                Parallel::get_parallel_component<ReceiveComponent>(
+                    cache)[target_element_id],
+                volume_data_id, std::move(target_element_data));
+          }
+          completed_target_elements.insert(target_element_id);
+        }  // loop over registered elements
+      } else {
+        const std::vector<ElementId<Dim>> remaining_target_element_ids(
+            target_element_ids.begin(), target_element_ids.end());
+        const size_t num_targets = remaining_target_element_ids.size();
+        std::vector<const tnsr::I<DataVector, Dim, Frame::Inertial>*>
+            all_target_points(num_targets);
+        for (size_t i = 0; i < num_targets; ++i) {
+          all_target_points[i] =
+              &get<Tags::RegisteredElements<Dim>>(box)
+                   .at(Parallel::make_array_component_id<ReceiveComponent>(
+                       remaining_target_element_ids[i]))
+                   .first;
+        }
+
+        // Find the target points in the subset of source elements contained
+        // in this volume file. Transforming the target points to block logical
+        // coords in the source domain is only done for the first file.
+        const ElementIndex<Dim> source_element_index{source_element_ids};
+        std::vector<
+            std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>>
+            source_element_logical_coords(num_targets);
+        parallel_for(
+            num_targets, number_of_threads,
+            [&target_block_logical_coords, &remaining_target_element_ids,
+             &source_domain, &all_target_points, &observation_value,
+             &source_domain_functions_of_time, &source_element_logical_coords,
+             &source_element_index](const size_t i) {
+              auto& block_logical_coords = target_block_logical_coords.at(
+                  remaining_target_element_ids[i]);
+              if (not block_logical_coords.has_value()) {
+                block_logical_coords = block_logical_coordinates(
+                    *source_domain, *all_target_points[i], observation_value,
+                    source_domain_functions_of_time);
               }
+              source_element_logical_coords[i] = element_logical_coordinates(
+                  source_element_index, *block_logical_coords);
             });
-            auto& indices_of_filled_interp_points =
-                all_indices_of_filled_interp_points[target_element_id];
 
-            // Interpolate!
-            const auto& source_logical_coords_of_target_points =
-                source_element_logical_coords.at(source_element_id);
-            detail::interpolate_selected_fields<FieldTagsList>(
-                make_not_null(&target_element_data), source_element_data,
-                source_mesh,
-                source_logical_coords_of_target_points.element_logical_coords,
-                source_logical_coords_of_target_points.offsets,
-                selected_fields);
-            indices_of_filled_interp_points.insert(
-                indices_of_filled_interp_points.end(),
-                source_logical_coords_of_target_points.offsets.begin(),
-                source_logical_coords_of_target_points.offsets.end());
-
-            if (indices_of_filled_interp_points.size() == target_num_points) {
-              // Pass the (interpolated) data to the element. Now it can
-              // proceed in parallel with transforming the data, taking
-              // derivatives on the grid, etc.
-              if constexpr (Parallel::is_dg_element_collection_v<
-                                ReceiveComponent>) {
-                ERROR("Can't yet do numerical initial data with nodegroups");
-              } else {
-                Parallel::receive_data<Tags::VolumeData<FieldTagsList>>(
-                    Parallel::get_parallel_component<ReceiveComponent>(
-                        cache)[target_element_id],
-                    volume_data_id, std::move(target_element_data));
+        // Read only the data of source elements that overlap with a target
+        // element. It's possible that the volume file only contains data for a
+        // subset of elements, e.g., when each node of a simulation wrote volume
+        // data for its elements to a separate file.
+        std::vector<bool> source_element_is_needed(source_element_ids.size(),
+                                                   false);
+        for (const auto& element_logical_coords :
+             source_element_logical_coords) {
+          for (const auto& source_element_id_and_coords :
+               element_logical_coords) {
+            source_element_is_needed[source_element_positions.at(
+                source_element_id_and_coords.first)] = true;
+          }
+        }
+        std::unordered_map<ElementId<Dim>, size_t> needed_source_elements{};
+        std::vector<std::pair<size_t, size_t>> offsets_and_lengths{};
+        std::vector<Mesh<Dim>> source_meshes{};
+        size_t source_data_offset = 0;
+        for (size_t j = 0; j < source_element_ids.size(); ++j) {
+          const size_t num_points =
+              alg::accumulate(source_extents[j], 1_st, std::multiplies<>{});
+          if (source_element_is_needed[j]) {
+            needed_source_elements.emplace(source_element_ids[j],
+                                           source_meshes.size());
+            offsets_and_lengths.emplace_back(source_data_offset, num_points);
+            source_meshes.emplace_back(
+                make_array<size_t, Dim>(source_extents[j]),
+                make_array<Spectral::Basis, Dim>(source_bases[j]),
+                make_array<Spectral::Quadrature, Dim>(source_quadratures[j]));
+          }
+          source_data_offset += num_points;
+        }
+        if (needed_source_elements.empty()) {
+          continue;
+        }
+        const auto needed_tensor_data = detail::read_tensor_data<FieldTagsList>(
+            volume_file, observation_id, selected_fields, offsets_and_lengths);
+
+        // Extract the data of each needed source element
+        std::vector<tuples::tagged_tuple_from_typelist<FieldTagsList>>
+            source_element_data(source_meshes.size());
+        std::vector<size_t> needed_data_offsets(source_meshes.size(), 0);
+        for (size_t k = 1; k < source_meshes.size(); ++k) {
+          needed_data_offsets[k] =
+              needed_data_offsets[k - 1] + offsets_and_lengths[k - 1].second;
+        }
+        parallel_for(
+            source_meshes.size(), number_of_threads,
+            [&source_element_data, &needed_data_offsets, &offsets_and_lengths,
+             &needed_tensor_data, &selected_fields](const size_t k) {
+              source_element_data[k] =
+                  detail::extract_element_data<FieldTagsList>(
+                      {needed_data_offsets[k], offsets_and_lengths[k].second},
+                      needed_tensor_data, selected_fields);
+            });
+
+        // Get and resize the target buffers. This is done before
+        // interpolating so the threads don't modify the maps.
+        std::vector<tuples::tagged_tuple_from_typelist<FieldTagsList>*>
+            all_target_element_data(num_targets, nullptr);
+        std::vector<std::vector<size_t>*> all_indices_of_filled_points(
+            num_targets, nullptr);
+        for (size_t i = 0; i < num_targets; ++i) {
+          if (source_element_logical_coords[i].empty()) {
+            continue;
+          }
+          const auto& target_element_id = remaining_target_element_ids[i];
+          const size_t target_num_points =
+              all_target_points[i]->begin()->size();
+          auto& target_element_data =
+              target_element_data_buffer[target_element_id];
+          tmpl::for_each<FieldTagsList>([&target_element_data,
+                                         &target_num_points,
+                                         &selected_fields](auto field_tag_v) {
+            using field_tag = tmpl::type_from<decltype(field_tag_v)>;
+            if (get<Tags::Selected<field_tag>>(selected_fields).has_value()) {
+              for (auto& component : get<field_tag>(target_element_data)) {
+                component.destructive_resize(target_num_points);
               }
-              completed_target_elements.insert(target_element_id);
-              target_element_data_buffer.erase(target_element_id);
-              all_indices_of_filled_interp_points.erase(target_element_id);
             }
+          });
+          all_target_element_data[i] = &target_element_data;
+          all_indices_of_filled_points[i] =
+              &all_indices_of_filled_interp_points[target_element_id];
+        }
+
+        // Interpolate! Each target element is handled by one thread.
+        parallel_for(
+            num_targets, number_of_threads,
+            [&source_element_logical_coords, &needed_source_elements,
+             &all_target_element_data, &source_element_data, &source_meshes,
+             &selected_fields, &all_indices_of_filled_points](const size_t i) {
+              for (const auto& [source_element_id, source_logical_coords] :
+                   source_element_logical_coords[i]) {
+                const size_t k = needed_source_elements.at(source_element_id);
+                detail::interpolate_selected_fields<FieldTagsList>(
+                    make_not_null(all_target_element_data[i]),
+                    source_element_data[k], source_meshes[k],
+                    source_logical_coords.element_logical_coords,
+                    source_logical_coords.offsets, selected_fields);
+                all_indices_of_filled_points[i]->insert(
+                    all_indices_of_filled_points[i]->end(),
+                    source_logical_coords.offsets.begin(),
+                    source_logical_coords.offsets.end());
+              }
+            });
+
+        for (size_t i = 0; i < num_targets; ++i) {
+          if (all_indices_of_filled_points[i] == nullptr or
+              all_indices_of_filled_points[i]->size() !=
+                  all_target_points[i]->begin()->size()) {
+            continue;
+          }
+          const auto& target_element_id = remaining_target_element_ids[i];
+          // Pass the (interpolated) data to the element. Now it can proceed in
+          // parallel with transforming the data, taking derivatives on the
+          // grid, etc.
+          if constexpr (Parallel::is_dg_element_collection_v<
+                            ReceiveComponent>) {
+            ERROR("Can't yet do numerical initial data with nodegroups");
           } else {
-            // Source and target element are the same (matching domains and
-            // same h-refinement), so no interpolation across elements is
-            // needed. We still may have to interpolate between different
-            // meshes (p-refinement). First, verify this assumption:
-            if (source_domain.has_value()) {
-              detail::verify_inertial_coordinates(
-                  *source_domain, observation_value,
-                  source_domain_functions_of_time, target_element_id,
-                  target_mesh, target_points);
-            }
-            tuples::tagged_tuple_from_typelist<FieldTagsList>
-                target_element_data{};
-            if (source_mesh == target_mesh) {
-              target_element_data = std::move(source_element_data);
-            } else {
-              detail::interpolate_selected_fields<FieldTagsList>(
-                  make_not_null(&target_element_data), source_element_data,
-                  source_mesh, target_mesh, selected_fields);
-            }
-            // Pass data directly to the target element
-            if constexpr (Parallel::is_dg_element_collection_v<
-                              ReceiveComponent>) {
-              ERROR("Can't yet do numerical initial data with nodegroups");
-            } else {
-              Parallel::receive_data<Tags::VolumeData<FieldTagsList>>(
-                  Parallel::get_parallel_component<ReceiveComponent>(
-                      cache)[target_element_id],
-                  volume_data_id, std::move(target_element_data));
-            }
-            completed_target_elements.insert(target_element_id);
+            Parallel::receive_data<Tags::VolumeData<FieldTagsList>>(
+                Parallel::get_parallel_component<ReceiveComponent>(
+                    cache)[target_element_id],
+                volume_data_id, std::move(*all_target_element_data[i]));
           }
-        }  // loop over overlapping source elements
-      }  // loop over registered elements
+          completed_target_elements.insert(target_element_id);
+          target_element_data_buffer.erase(target_element_id);
+          all_indices_of_filled_interp_points.erase(target_element_id);
+          target_block_logical_coords.erase(target_element_id);
+        }
+      }
       for (const auto& completed_element_id : completed_target_elements) {
         target_element_ids.erase(completed_element_id);
       }
@@ -85,6 +85,24 @@ struct ElementsAreIdentical {
       "'InertialCoordinates(_x,_y,_z)' must exist in the files. They are used "
       "to verify that the target points indeed match the source data.";
 };
+
+/*!
+ * \brief The number of threads used to find and interpolate the data for the
+ * target points.
+ *
+ * The threads are started by the reader on each node and are not known to
+ * Charm++, so they should only use cores that are otherwise idle while the data
+ * is imported.
+ */
+struct NumberOfThreads {
+  using type = size_t;
+  static constexpr Options::String help =
+      "Number of threads on each node that find and interpolate the data for "
+      "the target points. The threads are not managed by Charm++, so choose at "
+      "most the number of cores of a node that are idle while the data is "
+      "imported. Set to 1 to do all work on the core that reads the data.";
+  static type lower_bound() { return 1; }
+};
 }  // namespace OptionTags
 
 /// Options that specify the volume data to load. See the option tags for
@@ -93,7 +111,8 @@ struct ImporterOptions
     : tuples::TaggedTuple<OptionTags::FileGlob, OptionTags::Subgroup,
                           OptionTags::ObservationValue,
                           OptionTags::ObservationValueEpsilon,
-                          OptionTags::ElementsAreIdentical> {
+                          OptionTags::ElementsAreIdentical,
+                          OptionTags::NumberOfThreads> {
   using options = tags_list;
   static constexpr Options::String help = "The volume data to load.";
   using TaggedTuple::TaggedTuple;
@@ -0,0 +1,227 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/AsyncVolumeWriter.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Compression.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace observers {
+AsyncVolumeWriter::AsyncVolumeWriter() : state_(std::make_unique<State>()) {}
+
+AsyncVolumeWriter::AsyncVolumeWriter(AsyncVolumeWriter&& rhs) noexcept =
+    default;
+
+AsyncVolumeWriter& AsyncVolumeWriter::operator=(
+    AsyncVolumeWriter&& rhs) noexcept {
+  if (this != &rhs) {
+    shut_down();
+    state_ = std::move(rhs.state_);
+  }
+  return *this;
+}
+
+AsyncVolumeWriter::~AsyncVolumeWriter() { shut_down(); }
+
+void AsyncVolumeWriter::write(
+    Write&& volume_write, const gsl::not_null<Parallel::NodeLock*> file_lock,
+    const size_t memory_budget, const size_t number_of_compression_threads) {
+  ASSERT(state_ != nullptr, "Cannot write with a moved-from writer.");
+  const size_t size_in_bytes =
+      AsyncVolumeWriter_detail::size_in_bytes(volume_write.volume_data);
+  std::unique_lock lock(state_->mutex);
+  // Backpressure without blocking the caller: writes that don't fit in the
+  // budget wait in `deferred` until the background thread takes them on.
+  state_->deferred.push_back(QueuedWrite{std::move(volume_write),
+                                         file_lock.get(), size_in_bytes,
+                                         memory_budget,
+                                         number_of_compression_threads});
+  state_->deferred_bytes += size_in_bytes;
+  admit_deferred_writes(state_.get());
+  const bool start_thread = not state_->thread.joinable();
+  if (start_thread) {
+    state_->thread = std::thread(&AsyncVolumeWriter::run, state_.get());
+  }
+  lock.unlock();
+  if (start_thread) {
+    const std::lock_guard registry_lock(registry_mutex());
+    static const bool registered_at_exit =
+        std::atexit(&wait_for_running_writers) == 0;
+    (void)registered_at_exit;
+    running_writers().push_back(state_.get());
+  }
+  state_->work_available.notify_one();
+}
+
+void AsyncVolumeWriter::wait_until_written() {
+  if (state_ != nullptr) {
+    wait_until_written(state_.get());
+  }
+}
+
+void AsyncVolumeWriter::wait_until_written(const gsl::not_null<State*> state) {
+  std::unique_lock lock(state->mutex);
+  state->work_finished.wait(lock, [&state]() {
+    return state->queue.empty() and state->deferred.empty() and
+           not state->writing;
+  });
+}
+
+size_t AsyncVolumeWriter::queued_bytes() const {
+  if (state_ == nullptr) {
+    return 0;
+  }
+  const std::lock_guard lock(state_->mutex);
+  return state_->queued_bytes + state_->deferred_bytes;
+}
+
+size_t AsyncVolumeWriter::deferred_bytes() const {
+  if (state_ == nullptr) {
+    return 0;
+  }
+  const std::lock_guard lock(state_->mutex);
+  return state_->deferred_bytes;
+}
+
+void AsyncVolumeWriter::admit_deferred_writes(
+    const gsl::not_null<State*> state) {
+  // A write larger than its budget is admitted once nothing else is queued.
+  while (not state->deferred.empty() and
+         (state->queued_bytes == 0 or
+          state->queued_bytes + state->deferred.front().size_in_bytes <=
+              state->deferred.front().memory_budget)) {
+    state->queued_bytes += state->deferred.front().size_in_bytes;
+    state->deferred_bytes -= state->deferred.front().size_in_bytes;
+    state->queue.push_back(std::move(state->deferred.front()));
+    state->deferred.pop_front();
+  }
+}
+
+void AsyncVolumeWriter::pup(PUP::er& p) {
+  // Queued writes reference node locks and are not serialized. Finish them so
+  // that no data is lost.
+  if (not p.isUnpacking()) {
+    wait_until_written();
+  }
+}
+
+void AsyncVolumeWriter::shut_down() {
+  if (state_ == nullptr) {
+    return;
+  }
+  if (state_->thread.joinable()) {
+    const std::lock_guard registry_lock(registry_mutex());
+    auto& writers = running_writers();
+    writers.erase(std::remove(writers.begin(), writers.end(), state_.get()),
+                  writers.end());
+  }
+  {
+    const std::lock_guard lock(state_->mutex);
+    state_->shutting_down = true;
+  }
+  state_->work_available.notify_one();
+  if (state_->thread.joinable()) {
+    state_->thread.join();
+  }
+}
+
+void AsyncVolumeWriter::run(const gsl::not_null<State*> state) {
+  std::unique_lock lock(state->mutex);
+  while (true) {
+    state->work_available.wait(lock, [&state]() {
+      return not state->queue.empty() or state->shutting_down;
+    });
+    if (state->queue.empty()) {
+      // Shutting down and all data has been written.
+      return;
+    }
+    QueuedWrite queued_write = std::move(state->queue.front());
+    state->queue.pop_front();
+    state->writing = true;
+    lock.unlock();
+
+    {
+      const std::lock_guard hold_file_lock(*queued_write.file_lock);
+      // Scoping is for closing HDF5 file before we release the lock.
+      const Write& volume_write = queued_write.write;
+      h5::H5File<h5::AccessType::ReadWrite> h5file(
+          volume_write.file_name, true, volume_write.input_source);
+      constexpr size_t version_number = 0;
+      // The default compression of volume data, with the chunks compressed
+      // on several threads.
+      h5::Compression compression{};
+      compression.number_of_threads =
+          queued_write.number_of_compression_threads;
+      auto& volume_file = h5file.try_insert<h5::VolumeData>(
+          volume_write.subfile_name, version_number, compression);
+      volume_file.write_volume_data(
+          volume_write.observation_id.hash(),
+          volume_write.observation_id.value(), volume_write.volume_data,
+          volume_write.serialized_domain,
+          volume_write.serialized_functions_of_time);
+    }
+    // Free the data before reporting that the memory is available again.
+    queued_write.write.volume_data.clear();
+    queued_write.write.volume_data.shrink_to_fit();
+
+    lock.lock();
+    state->queued_bytes -= queued_write.size_in_bytes;
+    state->writing = false;
+    admit_deferred_writes(state);
+    state->work_finished.notify_all();
+  }
+}
+
+std::mutex& AsyncVolumeWriter::registry_mutex() {
+  static std::mutex mutex{};
+  return mutex;
+}
+
+std::vector<AsyncVolumeWriter::State*>& AsyncVolumeWriter::running_writers() {
+  static std::vector<State*> writers{};
+  return writers;
+}
+
+void AsyncVolumeWriter::wait_for_running_writers() {
+  const std::lock_guard lock(registry_mutex());
+  for (State* state : running_writers()) {
+    wait_until_written(state);
+  }
+}
+
+namespace AsyncVolumeWriter_detail {
+size_t size_in_bytes(const std::vector<ElementVolumeData>& volume_data) {
+  size_t result = 0;
+  for (const auto& element : volume_data) {
+    for (const auto& component : element.tensor_components) {
+      result += std::visit(
+          [](const auto& data) {
+            return data.size() * sizeof(typename std::decay_t<
+                                        decltype(data)>::value_type);
+          },
+          component.data);
+    }
+  }
+  return result;
+}
+}  // namespace AsyncVolumeWriter_detail
+}  // namespace observers
@@ -0,0 +1,151 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "IO/H5/TensorData.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+namespace Parallel {
+class NodeLock;
+}  // namespace Parallel
+/// \endcond
+
+namespace observers {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Writes volume data to disk on a background thread.
+ *
+ * \details `ThreadedActions::ContributeVolumeDataToWriter` normally writes the
+ * volume data of all elements on a node on the core that received the last
+ * contribution, which stalls that core for as long as the HDF5 write and
+ * compression take. When the `Tags::AsyncVolumeWriterMemoryBudget` is in the
+ * global cache the data is instead moved into this writer, which writes it on a
+ * dedicated thread and returns immediately.
+ *
+ * The chunks of each tensor component are shuffled and deflated on
+ * `number_of_compression_threads` threads (the background thread and helpers
+ * started for each component) and then written by the background thread with
+ * `H5Dwrite_chunk`. See `h5::Compression`. HDF5 is not thread-safe, so only the
+ * background thread calls it, and it holds the node's `Tags::H5FileLock` while
+ * it writes. Everything else that calls HDF5 while the simulation runs holds
+ * the same lock: the synchronous observer writers, the CCE worldtube readers
+ * and their prefetch threads, and the volume data importers (see
+ * `observers::h5_file_lock`). Files opened while parsing options or
+ * initializing are opened before any volume data is queued.
+ *
+ * The data handed to the background thread is limited to `memory_budget`
+ * bytes. `write` never waits for earlier writes: a write that would exceed the
+ * budget is deferred, without copying its data, and the background thread
+ * takes it on in arrival order once enough earlier writes have finished. A
+ * single write larger than the budget is taken on once nothing else is being
+ * written. Deferred writes count toward `queued_bytes()`.
+ *
+ * The writer is not serialized. Serializing it waits for all queued writes to
+ * finish, and a deserialized writer starts with an empty queue. Queued writes
+ * are also finished when the process exits.
+ */
+class AsyncVolumeWriter {
+ public:
+  /// A single `h5::VolumeData::write_volume_data` call.
+  struct Write {
+    std::string file_name{};
+    std::string input_source{};
+    std::string subfile_name{};
+    ObservationId observation_id{};
+    std::vector<ElementVolumeData> volume_data{};
+    std::optional<std::vector<char>> serialized_domain{};
+    std::optional<std::vector<char>> serialized_functions_of_time{};
+  };
+
+  AsyncVolumeWriter();
+  AsyncVolumeWriter(const AsyncVolumeWriter&) = delete;
+  AsyncVolumeWriter& operator=(const AsyncVolumeWriter&) = delete;
+  AsyncVolumeWriter(AsyncVolumeWriter&& rhs) noexcept;
+  AsyncVolumeWriter& operator=(AsyncVolumeWriter&& rhs) noexcept;
+  /// Waits for all queued writes to finish.
+  ~AsyncVolumeWriter();
+
+  /// Queue `volume_write`, holding `file_lock` while it is written and
+  /// compressing on `number_of_compression_threads` threads. Returns
+  /// immediately. The write is deferred if the data already handed to the
+  /// background thread plus `volume_write` exceed `memory_budget` bytes.
+  void write(Write&& volume_write,
+             gsl::not_null<Parallel::NodeLock*> file_lock,
+             size_t memory_budget, size_t number_of_compression_threads = 1);
+
+  /// Block until all queued writes have finished.
+  void wait_until_written();
+
+  /// The number of bytes of volume data waiting to be written, including
+  /// deferred writes.
+  size_t queued_bytes() const;
+
+  /// The number of bytes of volume data in deferred writes.
+  size_t deferred_bytes() const;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  struct QueuedWrite {
+    Write write;
+    Parallel::NodeLock* file_lock;
+    size_t size_in_bytes;
+    size_t memory_budget;
+    size_t number_of_compression_threads;
+  };
+
+  struct State {
+    mutable std::mutex mutex{};
+    std::condition_variable work_available{};
+    std::condition_variable work_finished{};
+    // Writes handed to the background thread, and the bytes in them
+    // (including the one being written)
+    std::deque<QueuedWrite> queue{};
+    size_t queued_bytes{0};
+    // Writes waiting for the bytes in `queue` to drop below their budget
+    std::deque<QueuedWrite> deferred{};
+    size_t deferred_bytes{0};
+    bool writing{false};
+    bool shutting_down{false};
+    std::thread thread{};
+  };
+
+  void shut_down();
+  static void run(gsl::not_null<State*> state);
+  // Move deferred writes to the queue while they fit in their budget. Must be
+  // called with `state->mutex` held.
+  static void admit_deferred_writes(gsl::not_null<State*> state);
+  static void wait_until_written(gsl::not_null<State*> state);
+
+  // Charm++ exits the process without destroying the observer components, so
+  // writers with a running thread are registered here and finish their writes
+  // when the process exits.
+  static std::mutex& registry_mutex();
+  static std::vector<State*>& running_writers();
+  static void wait_for_running_writers();
+
+  std::unique_ptr<State> state_;
+};
+
+namespace AsyncVolumeWriter_detail {
+/// The number of bytes of tensor data in `volume_data`.
+size_t size_in_bytes(const std::vector<ElementVolumeData>& volume_data);
+}  // namespace AsyncVolumeWriter_detail
+}  // namespace observers
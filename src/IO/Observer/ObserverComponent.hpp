@@ -3,18 +3,24 @@
 
 #pragma once
 
+#include <type_traits>
+
+#include "IO/Observer/Actions/GetLockPointer.hpp"
 #include "IO/Observer/Initialize.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/Algorithms/AlgorithmGroup.hpp"
 #include "Parallel/Algorithms/AlgorithmNodegroup.hpp"
 #include "Parallel/ArrayComponentId.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/NodeLock.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "Parallel/Tags/InputSource.hpp"
 #include "ParallelAlgorithms/Actions/TerminatePhase.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TypeTraits/IsA.hpp"
 
 namespace observers {
 /*!
@@ -65,4 +71,44 @@ struct ObserverWriter {
       const Parallel::Phase /*next_phase*/,
       Parallel::CProxy_GlobalCache<Metavariables>& /*global_cache*/) {}
 };
+
+namespace detail {
+template <typename Component, typename = std::void_t<>>
+struct is_observer_writer : tt::is_a<ObserverWriter, Component> {};
+
+template <typename Component>
+struct is_observer_writer<
+    Component, std::void_t<typename Component::component_being_mocked>>
+    : tt::is_a<ObserverWriter, typename Component::component_being_mocked> {};
+
+template <typename... Components>
+constexpr bool has_observer_writer(tmpl::list<Components...> /*meta*/) {
+  return (is_observer_writer<Components>::value or ...);
+}
+}  // namespace detail
+
+/*!
+ * \ingroup ObserversGroup
+ * \brief The `Tags::H5FileLock` of the `ObserverWriter` on this node, or
+ * `nullptr` if there is no `ObserverWriter`.
+ *
+ * \details Volume data may be written on a background thread (see
+ * `observers::AsyncVolumeWriter`) that holds this lock, so any component that
+ * calls HDF5 while the simulation is running must hold it as well. The same
+ * caveats as for `Actions::GetLockPointer` apply to the returned pointer.
+ */
+template <typename Metavariables>
+Parallel::NodeLock* h5_file_lock(Parallel::GlobalCache<Metavariables>& cache) {
+  if constexpr (detail::has_observer_writer(
+                    typename Metavariables::component_list{})) {
+    return Parallel::local_branch(
+               Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
+                   cache))
+        ->template local_synchronous_action<
+            Actions::GetLockPointer<Tags::H5FileLock>>();
+  } else {
+    (void)cache;
+    return nullptr;
+  }
+}
 }  // namespace observers
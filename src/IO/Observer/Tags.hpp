@@ -16,6 +16,7 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "IO/H5/TensorData.hpp"
+#include "IO/Observer/AsyncVolumeWriter.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "Options/String.hpp"
 #include "Parallel/ArrayComponentId.hpp"
@@ -146,11 +147,20 @@ struct ReductionDataNames : db::SimpleTag {
 ///
 /// The reason for only having one lock for all files is that we currently don't
 /// require a thread-safe HDF5 installation. In the future we will need to
-/// experiment with different HDF5 configurations.
+/// experiment with different HDF5 configurations. Components other than the
+/// observers can get the lock with `observers::h5_file_lock`.
 struct H5FileLock : db::SimpleTag {
   using type = Parallel::NodeLock;
 };
 
+/// \brief Writes volume data in the background when
+/// `Tags::AsyncVolumeWriterMemoryBudget` is in the global cache.
+///
+/// See `observers::AsyncVolumeWriter`.
+struct AsyncVolumeWriter : db::SimpleTag {
+  using type = observers::AsyncVolumeWriter;
+};
+
 /*!
  * \brief A string identifying observations related to the `Tag`.
  *
@@ -205,6 +215,29 @@ struct SurfaceFileName {
       "Name of the surface data file without extension"};
   using group = Group;
 };
+
+/// The amount of volume data in megabytes that each node may queue for writing
+/// in the background. See `observers::AsyncVolumeWriter`.
+struct AsyncVolumeWriterMemoryBudget {
+  using type = size_t;
+  static constexpr Options::String help = {
+      "Megabytes of volume data each node may hand to its background writer "
+      "at once. Further observations are deferred until earlier writes have "
+      "finished, without stalling the node."};
+  using group = Group;
+};
+
+/// The number of threads that compress volume data written in the background.
+/// See `observers::AsyncVolumeWriter`.
+struct AsyncVolumeWriterCompressionThreads {
+  using type = size_t;
+  static constexpr Options::String help = {
+      "Threads per node that compress the volume data written in the "
+      "background, including the writer thread itself. These run alongside "
+      "the Charm++ worker threads, so leave cores free for them."};
+  static type lower_bound() { return 1; }
+  using group = Group;
+};
 }  // namespace OptionTags
 
 namespace Tags {
@@ -264,5 +297,39 @@ struct SurfaceFileName : db::SimpleTag {
     return surface_file_name;
   }
 };
+
+/// \brief The number of bytes of volume data that each node may queue for
+/// writing in the background.
+///
+/// Volume data is written asynchronously by `observers::AsyncVolumeWriter` if
+/// and only if this tag is in the global cache. Executables opt in by adding it
+/// to their `const_global_cache_tags`.
+struct AsyncVolumeWriterMemoryBudget : db::SimpleTag {
+  using type = size_t;
+  using option_tags =
+      tmpl::list<::observers::OptionTags::AsyncVolumeWriterMemoryBudget>;
+
+  static constexpr bool pass_metavariables = false;
+  static size_t create_from_options(const size_t memory_budget_in_megabytes) {
+    return memory_budget_in_megabytes * 1024 * 1024;
+  }
+};
+
+/// \brief The number of threads that compress volume data written in the
+/// background.
+///
+/// Only used if `Tags::AsyncVolumeWriterMemoryBudget` is in the global cache.
+/// If this tag is not in the global cache the background thread compresses
+/// alone.
+struct AsyncVolumeWriterCompressionThreads : db::SimpleTag {
+  using type = size_t;
+  using option_tags =
+      tmpl::list<::observers::OptionTags::AsyncVolumeWriterCompressionThreads>;
+
+  static constexpr bool pass_metavariables = false;
+  static size_t create_from_options(const size_t number_of_threads) {
+    return number_of_threads;
+  }
+};
 }  // namespace Tags
 }  // namespace observers
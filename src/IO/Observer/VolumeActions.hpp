@@ -18,6 +18,7 @@
 #include "IO/H5/File.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "IO/Observer/AsyncVolumeWriter.hpp"
 #include "IO/Observer/Helpers.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
@@ -163,6 +164,11 @@ void write_data(const std::string& h5_file_name,
  * \brief Move data to the observer writer for writing to disk.
  *
  * Once data from all cores is collected this action writes the data to disk.
+ * If `Tags::AsyncVolumeWriterMemoryBudget` is in the global cache the data is
+ * moved to the node's `observers::AsyncVolumeWriter` and written in the
+ * background instead, compressed on
+ * `Tags::AsyncVolumeWriterCompressionThreads` threads if that tag is in the
+ * global cache.
  */
 struct ContributeVolumeDataToWriter {
   template <typename ParallelComponent, typename DbTagsList,
@@ -225,15 +231,17 @@ struct ContributeVolumeDataToWriter {
                        std::unordered_set<Parallel::ArrayComponentId>>*
         volume_observers_contributed = nullptr;
     Parallel::NodeLock* volume_data_lock = nullptr;
+    AsyncVolumeWriter* async_volume_writer = nullptr;
     size_t observations_registered_with_id = std::numeric_limits<size_t>::max();
 
     {
       const std::lock_guard hold_lock(*node_lock);
       db::mutate<TensorDataTag, Tags::ContributorsOfTensorData,
-                 Tags::VolumeDataLock, Tags::H5FileLock>(
+                 Tags::VolumeDataLock, Tags::H5FileLock,
+                 Tags::AsyncVolumeWriter>(
           [&observation_id, &observations_registered_with_id,
            &observer_group_id, &all_volume_data, &volume_observers_contributed,
-           &volume_data_lock, &volume_file_lock](
+           &volume_data_lock, &volume_file_lock, &async_volume_writer](
               const gsl::not_null<typename TensorDataTag::type*>
                   volume_data_ptr,
               const gsl::not_null<std::unordered_map<
@@ -242,6 +250,7 @@ struct ContributeVolumeDataToWriter {
                   volume_observers_contributed_ptr,
               const gsl::not_null<Parallel::NodeLock*> volume_data_lock_ptr,
               const gsl::not_null<Parallel::NodeLock*> volume_file_lock_ptr,
+              const gsl::not_null<AsyncVolumeWriter*> async_volume_writer_ptr,
               const std::unordered_map<
                   ObservationKey,
                   std::unordered_set<Parallel::ArrayComponentId>>&
@@ -271,6 +280,7 @@ struct ContributeVolumeDataToWriter {
             observations_registered_with_id =
                 observations_registered.at(key).size();
             volume_file_lock = &*volume_file_lock_ptr;
+            async_volume_writer = &*async_volume_writer_ptr;
           },
           make_not_null(&box),
           db::get<Tags::ExpectedContributorsForObservations>(box));
@@ -330,12 +340,14 @@ struct ContributeVolumeDataToWriter {
 
       std::vector<ElementVolumeData> volume_data_to_write;
 
+      // The data is no longer needed once it is written, so move it rather
+      // than copy it.
       if constexpr (std::is_same_v<tmpl::at_c<VolumeDataAtObsId, 1>,
                                    ElementVolumeData>) {
         volume_data_to_write.reserve(volume_data.size());
-        for (const auto& [id, element] : volume_data) {
+        for (auto& [id, element] : volume_data) {
           (void)id;  // avoid compiler warnings
-          volume_data_to_write.push_back(element);
+          volume_data_to_write.push_back(std::move(element));
         }
       } else {
         size_t total_size = 0;
@@ -345,57 +357,85 @@ struct ContributeVolumeDataToWriter {
         }
         volume_data_to_write.reserve(total_size);
 
-        for (const auto& [id, vec_elements] : volume_data) {
+        for (auto& [id, vec_elements] : volume_data) {
           (void)id;  // avoid compiler warnings
-          volume_data_to_write.insert(volume_data_to_write.end(),
-                                      vec_elements.begin(), vec_elements.end());
+          volume_data_to_write.insert(
+              volume_data_to_write.end(),
+              std::make_move_iterator(vec_elements.begin()),
+              std::make_move_iterator(vec_elements.end()));
         }
       }
 
-      // Write to file. We use a separate node lock because writing can be
-      // very time consuming (it's network dependent, depends on how full the
-      // disks are, what other users are doing, etc.) and we want to be able
-      // to continue to work on the nodegroup while we are writing data to
-      // disk.
-      const std::lock_guard hold_lock(*volume_file_lock);
-      {
-        // Scoping is for closing HDF5 file before we release the lock.
-        const auto& file_prefix = Parallel::get<Tags::VolumeFileName>(cache);
-        auto& my_proxy =
-            Parallel::get_parallel_component<ParallelComponent>(cache);
-        h5::H5File<h5::AccessType::ReadWrite> h5file(
-            file_prefix +
-                std::to_string(
-                    Parallel::my_node<int>(*Parallel::local_branch(my_proxy))) +
-                ".h5",
-            true, observers::input_source_from_cache(cache));
-        constexpr size_t version_number = 0;
-        auto& volume_file =
-            h5file.try_insert<h5::VolumeData>(subfile_name, version_number);
+      const auto& file_prefix = Parallel::get<Tags::VolumeFileName>(cache);
+      auto& my_proxy =
+          Parallel::get_parallel_component<ParallelComponent>(cache);
+      const std::string file_name =
+          file_prefix +
+          std::to_string(
+              Parallel::my_node<int>(*Parallel::local_branch(my_proxy))) +
+          ".h5";
 
-        // Serialize domain. See `Domain` docs for details on the serialization.
-        // The domain is retrieved from the global cache using the standard
-        // domain tag. If more flexibility is required here later, then the
-        // domain can be passed along with the `ContributeVolumeData` action.
-        const auto serialized_domain = serialize(
-            Parallel::get<domain::Tags::Domain<Metavariables::volume_dim>>(
-                cache));
-        const auto serialized_functions_of_time =
-            [&cache]() -> std::optional<std::vector<char>> {
-          // Functions-of-time are in the _mutable_ global cache, so they aren't
-          // accessible through the DataBox by default
-          if constexpr (Parallel::is_in_global_cache<
-                            Metavariables, domain::Tags::FunctionsOfTime>) {
-            return serialize(get<domain::Tags::FunctionsOfTime>(cache));
-          } else {
-            (void)cache;
-            return std::nullopt;
-          }
-        }();
-        // Write the data to the file
-        volume_file.write_volume_data(
-            observation_id.hash(), observation_id.value(), volume_data_to_write,
-            serialized_domain, serialized_functions_of_time);
+      // Serialize domain. See `Domain` docs for details on the serialization.
+      // The domain is retrieved from the global cache using the standard
+      // domain tag. If more flexibility is required here later, then the
+      // domain can be passed along with the `ContributeVolumeData` action.
+      auto serialized_domain = serialize(
+          Parallel::get<domain::Tags::Domain<Metavariables::volume_dim>>(
+              cache));
+      auto serialized_functions_of_time =
+          [&cache]() -> std::optional<std::vector<char>> {
+        // Functions-of-time are in the _mutable_ global cache, so they aren't
+        // accessible through the DataBox by default
+        if constexpr (Parallel::is_in_global_cache<
+                          Metavariables, domain::Tags::FunctionsOfTime>) {
+          return serialize(get<domain::Tags::FunctionsOfTime>(cache));
+        } else {
+          (void)cache;
+          return std::nullopt;
+        }
+      }();
+
+      if constexpr (Parallel::is_in_global_cache<
+                        Metavariables, Tags::AsyncVolumeWriterMemoryBudget>) {
+        size_t number_of_compression_threads = 1;
+        if constexpr (Parallel::is_in_global_cache<
+                          Metavariables,
+                          Tags::AsyncVolumeWriterCompressionThreads>) {
+          number_of_compression_threads =
+              Parallel::get<Tags::AsyncVolumeWriterCompressionThreads>(cache);
+        }
+        // The background thread takes the volume file lock while it writes.
+        // This returns right away, also when the write has to be deferred.
+        async_volume_writer->write(
+            AsyncVolumeWriter::Write{
+                file_name, observers::input_source_from_cache(cache),
+                subfile_name, observation_id, std::move(volume_data_to_write),
+                std::move(serialized_domain),
+                std::move(serialized_functions_of_time)},
+            volume_file_lock,
+            Parallel::get<Tags::AsyncVolumeWriterMemoryBudget>(cache),
+            number_of_compression_threads);
+      } else {
+        (void)async_volume_writer;
+        // Write to file. We use a separate node lock because writing can be
+        // very time consuming (it's network dependent, depends on how full the
+        // disks are, what other users are doing, etc.) and we want to be able
+        // to continue to work on the nodegroup while we are writing data to
+        // disk.
+        const std::lock_guard hold_lock(*volume_file_lock);
+        {
+          // Scoping is for closing HDF5 file before we release the lock.
+          h5::H5File<h5::AccessType::ReadWrite> h5file(
+              file_name, true, observers::input_source_from_cache(cache));
+          constexpr size_t version_number = 0;
+          auto& volume_file =
+              h5file.try_insert<h5::VolumeData>(subfile_name, version_number);
+          // Write the data to the file
+          volume_file.write_volume_data(
+              observation_id.hash(), observation_id.value(),
+              volume_data_to_write, serialized_domain,
+              serialized_functions_of_time);
+        }
       }
     }
   }
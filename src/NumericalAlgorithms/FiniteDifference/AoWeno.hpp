@@ -26,8 +26,10 @@ namespace fd::reconstruction {
 namespace detail {
 template <size_t NonlinearWeightExponent>
 struct AoWeno53Reconstructor {
-  SPECTRE_ALWAYS_INLINE static std::array<double, 2> pointwise(
-      const double* const u, const int stride, const double gamma_hi,
+  // `T` can be a `double` or a `simd::batch<double>`
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::array<T, 2> pointwise(
+      const T* const u, const int stride, const double gamma_hi,
       const double gamma_lo, const double epsilon) {
     ASSERT(gamma_hi <= 1.0 and gamma_hi >= 0.0,
            "gamma_hi must be in [0.0, 1.0] but is " << gamma_hi);
@@ -81,12 +83,12 @@ struct AoWeno53Reconstructor {
         square(moments_sr3_1[1]) + beta_r3_factor * square(moments_sr3_1[2]),
         square(moments_sr3_2[1]) + beta_r3_factor * square(moments_sr3_2[2]),
         square(moments_sr3_3[1]) + beta_r3_factor * square(moments_sr3_3[2])};
-    const double beta_sr5 = square(moments_sr5[1]) +
-                            61.0 / 5.0 * moments_sr5[1] * moments_sr5[3] +
-                            37.0 / 3.0 * square(moments_sr5[2]) +
-                            1538.0 / 7.0 * moments_sr5[2] * moments_sr5[4] +
-                            8973.0 / 50.0 * square(moments_sr5[3]) +
-                            167158.0 / 49.0 * square(moments_sr5[4]);
+    const T beta_sr5 = square(moments_sr5[1]) +
+                       61.0 / 5.0 * moments_sr5[1] * moments_sr5[3] +
+                       37.0 / 3.0 * square(moments_sr5[2]) +
+                       1538.0 / 7.0 * moments_sr5[2] * moments_sr5[4] +
+                       8973.0 / 50.0 * square(moments_sr5[3]) +
+                       167158.0 / 49.0 * square(moments_sr5[4]);
 
     // Compute linear and normalized nonlinear weights
     const std::array linear_weights{
@@ -97,13 +99,13 @@ struct AoWeno53Reconstructor {
         linear_weights[1] / pow<NonlinearWeightExponent>(beta_r3[0] + epsilon),
         linear_weights[2] / pow<NonlinearWeightExponent>(beta_r3[1] + epsilon),
         linear_weights[3] / pow<NonlinearWeightExponent>(beta_r3[2] + epsilon)};
-    const double normalization = nonlinear_weights[0] + nonlinear_weights[1] +
-                                 nonlinear_weights[2] + nonlinear_weights[3];
-    for (double& nw : nonlinear_weights) {
+    const T normalization = nonlinear_weights[0] + nonlinear_weights[1] +
+                            nonlinear_weights[2] + nonlinear_weights[3];
+    for (T& nw : nonlinear_weights) {
       nw /= normalization;
     }
 
-    const std::array<double, 5> moments{
+    const std::array<T, 5> moments{
         {nonlinear_weights[0] / linear_weights[0] *
                  (moments_sr5[0] - linear_weights[1] * moments_sr3_1[0] -
                   linear_weights[2] * moments_sr3_2[0] -
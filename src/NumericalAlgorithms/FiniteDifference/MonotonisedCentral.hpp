@@ -12,6 +12,7 @@
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Math.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -24,24 +25,27 @@ class Index;
 namespace fd::reconstruction {
 namespace detail {
 struct MonotonisedCentralReconstructor {
-  SPECTRE_ALWAYS_INLINE static std::array<double, 2> pointwise(
-      const double* const q, const int stride) {
-    using std::abs;
+  // The cases of the limiter are evaluated for all points and then selected,
+  // so `T` can be a `double` or a `simd::batch<double>`.
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::array<T, 2> pointwise(const T* const q,
+                                                          const int stride) {
+    const T a = q[stride] - q[0];
+    const T b = q[0] - q[-stride];
 
-    const double a = q[stride] - q[0];
-    const double b = q[0] - q[-stride];
-
-    if (sgn(a) != sgn(b)) {
-      return {{q[0], q[0]}};
-    }
-    if (3.0 * abs(a) <= abs(b)) {
-      return {{q[0] - a, q[stride]}};
-    } else if (3.0 * abs(b) <= abs(a)) {
-      return {{q[-stride], q[0] + b}};
-    } else {
-      const double slope = 0.5 * (q[stride] - q[-stride]);
-      return {{q[0] - 0.5 * slope, q[0] + 0.5 * slope}};
-    }
+    const T slope = 0.5 * (q[stride] - q[-stride]);
+    T lower = q[0] - 0.5 * slope;
+    T upper = q[0] + 0.5 * slope;
+    const auto b_is_limiting = T(3.0 * simd::abs(b)) <= simd::abs(a);
+    lower = simd::select(b_is_limiting, q[-stride], lower);
+    upper = simd::select(b_is_limiting, T(q[0] + b), upper);
+    const auto a_is_limiting = T(3.0 * simd::abs(a)) <= simd::abs(b);
+    lower = simd::select(a_is_limiting, T(q[0] - a), lower);
+    upper = simd::select(a_is_limiting, q[stride], upper);
+    const auto is_extremum = simd::sign(a) != simd::sign(b);
+    lower = simd::select(is_extremum, q[0], lower);
+    upper = simd::select(is_extremum, q[0], upper);
+    return {{lower, upper}};
   }
 
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() { return 3; }
@@ -68,6 +68,21 @@ namespace fd {
  *   \f$u_{i-1}\f$ is at `u[-stride]`. The returned values are the
  *   reconstructed solution on the lower and upper side of the cell.
  *
+ * If the `pointwise` function is a template over the value type, i.e.
+ * \code
+ *      template <typename T>
+ *      SPECTRE_ALWAYS_INLINE static std::array<T, 2> pointwise(
+ *            const T* const u, const int stride)
+ * \endcode
+ * and can be called with `T = simd::batch<double>`, then `reconstruct`
+ * processes `simd::size<simd::batch<double>>()` neighboring stripes of
+ * cells at once (when built with xsimd). The stripes of a batch are
+ * interleaved together with their ghost cells, so the reconstruction at the
+ * element boundaries is vectorized as well. Only the remaining stripes are
+ * reconstructed one point at a time. Such `pointwise` functions must not
+ * branch on the values of `u`. Instead, they evaluate the cases of a limiter
+ * and pick the result with `simd::select`.
+ *
  * \note Currently the stride is always one because we transpose the data before
  * reconstruction. However, it may be faster to have a non-unit stride without
  * the transpose. We have the `stride` parameter in the reconstruction schemes
@@ -5,7 +5,9 @@
 
 #include "NumericalAlgorithms/FiniteDifference/Reconstruct.hpp"
 
+#include <array>
 #include <cstddef>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
@@ -16,6 +18,8 @@
 #include "Domain/Structure/Side.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
+#include "Utilities/TypeTraits/CreateIsCallable.hpp"
 
 namespace fd::reconstruction {
 namespace detail {
@@ -76,6 +80,101 @@ auto u_to_reconstruct_impl(const DataVector& volume_data,
   }
 }
 
+CREATE_IS_CALLABLE(pointwise)
+CREATE_IS_CALLABLE_V(pointwise)
+
+#ifdef SPECTRE_USE_XSIMD
+// Reconstructs the stripes in batches of `simd::size<simd::batch<double>>()`
+// neighboring stripes and returns the number of stripes that were
+// reconstructed, which is a multiple of the batch size. The stripes of a batch
+// are interleaved along with their lower and upper ghost cells, so every
+// reconstruction (also the ones that need ghost data, and the ones in the
+// ghost cells adjacent to the element) uses the same unit-stride stencil.
+template <typename Reconstructor, typename... ArgsForReconstructor>
+size_t reconstruct_stripes_in_batches(
+    const gsl::not_null<gsl::span<double>*> recons_upper,
+    const gsl::not_null<gsl::span<double>*> recons_lower,
+    const gsl::span<const double>& volume_vars,
+    const gsl::span<const double>& lower_ghost_data,
+    const gsl::span<const double>& upper_ghost_data,
+    const size_t points_per_stripe, const size_t number_of_stripes,
+    const ArgsForReconstructor&... args_for_reconstructor) {
+  using std::get;
+  using Batch = simd::batch<double>;
+  constexpr size_t batch_size = simd::size<Batch>();
+  constexpr size_t stencil_width = Reconstructor::stencil_width();
+  constexpr size_t ghost_zone_for_stencil = (stencil_width - 1) / 2;
+  constexpr size_t ghost_pts_in_neighbor_data = ghost_zone_for_stencil + 1;
+  const size_t number_of_batched_stripes =
+      number_of_stripes - number_of_stripes % batch_size;
+  if (number_of_batched_stripes == 0) {
+    return 0;
+  }
+
+  // Cell `i` of the stripes, with `i` from `-ghost_pts_in_neighbor_data` to
+  // `points_per_stripe + ghost_pts_in_neighbor_data - 1`, is stored at
+  // `i + ghost_pts_in_neighbor_data` in `stripes`. We reconstruct the cells
+  // `-1` to `points_per_stripe`, i.e. one ghost cell on either side.
+  const size_t extended_points =
+      points_per_stripe + 2 * ghost_pts_in_neighbor_data;
+  const size_t reconstructed_cells = points_per_stripe + 2;
+  std::vector<Batch> stripes(extended_points);
+  std::vector<double> interleaved(
+      batch_size * (extended_points + 2 * reconstructed_cells));
+  double* const interleaved_stripes = interleaved.data();
+  double* const lower_sides =
+      interleaved_stripes + batch_size * extended_points;
+  double* const upper_sides = lower_sides + batch_size * reconstructed_cells;
+
+  for (size_t first_stripe = 0; first_stripe < number_of_batched_stripes;
+       first_stripe += batch_size) {
+    for (size_t lane = 0; lane < batch_size; ++lane) {
+      const size_t stripe = first_stripe + lane;
+      for (size_t i = 0; i < ghost_pts_in_neighbor_data; ++i) {
+        interleaved_stripes[i * batch_size + lane] =
+            lower_ghost_data[stripe * ghost_pts_in_neighbor_data + i];
+        interleaved_stripes[(ghost_pts_in_neighbor_data + points_per_stripe +
+                             i) *
+                                batch_size +
+                            lane] =
+            upper_ghost_data[stripe * ghost_pts_in_neighbor_data + i];
+      }
+      for (size_t i = 0; i < points_per_stripe; ++i) {
+        interleaved_stripes[(ghost_pts_in_neighbor_data + i) * batch_size +
+                            lane] = volume_vars[stripe * points_per_stripe + i];
+      }
+    }
+    for (size_t i = 0; i < extended_points; ++i) {
+      stripes[i] = simd::load_unaligned(&interleaved_stripes[i * batch_size]);
+    }
+
+    // The cell `i - 1` is centered at `stripes[i + ghost_zone_for_stencil]`
+    for (size_t i = 0; i < reconstructed_cells; ++i) {
+      const auto upper_and_lower = Reconstructor::pointwise(
+          &stripes[i + ghost_zone_for_stencil], 1, args_for_reconstructor...);
+      simd::store_unaligned(&lower_sides[i * batch_size],
+                            get<0>(upper_and_lower));
+      simd::store_unaligned(&upper_sides[i * batch_size],
+                            get<1>(upper_and_lower));
+    }
+
+    // The lower side of cell `i` is the upper side of face `i`, and the upper
+    // side of cell `i` is the lower side of face `i + 1`.
+    for (size_t lane = 0; lane < batch_size; ++lane) {
+      const size_t recons_stripe_offset =
+          (first_stripe + lane) * (points_per_stripe + 1);
+      for (size_t face = 0; face < points_per_stripe + 1; ++face) {
+        (*recons_upper)[recons_stripe_offset + face] =
+            lower_sides[(face + 1) * batch_size + lane];
+        (*recons_lower)[recons_stripe_offset + face] =
+            upper_sides[face * batch_size + lane];
+      }
+    }
+  }
+  return number_of_batched_stripes;
+}
+#endif  // SPECTRE_USE_XSIMD
+
 template <bool ReturnReconstructionOrder, typename Reconstructor, size_t Dim,
           typename... ArgsForReconstructor>
 void reconstruct_impl(
@@ -113,8 +212,30 @@ void reconstruct_impl(
                << reconstruction_order->size());
   }
 
+  ASSERT(volume_extents[0] >= stencil_width - 1,
+         " Subcell volume extent (current value: "
+             << volume_extents[0]
+             << ") must be not smaller than the stencil width (current value: "
+             << stencil_width << ") minus 1");
+
+  // Reconstructors that can be evaluated on SIMD batches handle most stripes
+  // in batches. The remaining stripes, and all stripes of other
+  // reconstructors, are reconstructed one point at a time below.
+  size_t first_unbatched_slice = 0;
+#ifdef SPECTRE_USE_XSIMD
+  if constexpr (is_pointwise_callable_v<Reconstructor,
+                                        const simd::batch<double>*, int,
+                                        const ArgsForReconstructor&...>) {
+    first_unbatched_slice = reconstruct_stripes_in_batches<Reconstructor>(
+        recons_upper, recons_lower, volume_vars, lower_ghost_data,
+        upper_ghost_data, volume_extents[0], number_of_stripes,
+        args_for_reconstructor...);
+  }
+#endif  // SPECTRE_USE_XSIMD
+
   std::array<double, stencil_width> q{};
-  for (size_t slice = 0; slice < number_of_stripes; ++slice) {
+  for (size_t slice = first_unbatched_slice; slice < number_of_stripes;
+       ++slice) {
     const size_t vars_slice_offset = slice * volume_extents[0];
     const size_t vars_neighbor_slice_offset =
         slice * ghost_pts_in_neighbor_data;
@@ -123,9 +244,7 @@ void reconstruct_impl(
     // right cells for adjusting the correction at the interface. This means
     // we include one neighbor on the upper and lower side.
     recons_order_slice_offset =
-        slice % number_of_stripes_per_variable == 0
-            ? 0
-            : (recons_order_slice_offset + volume_extents[0] + 2);
+        (slice % number_of_stripes_per_variable) * (volume_extents[0] + 2);
     [[maybe_unused]] size_t recons_order_index = 0;
     const auto set_recons_order = [&reconstruction_order, &recons_order_index,
                                    recons_order_slice_offset](
@@ -217,13 +336,6 @@ void reconstruct_impl(
       //         c c c c | c
       //  c = points used for reconstruction
 
-      ASSERT(
-          volume_extents[0] >= stencil_width - 1,
-          " Subcell volume extent (current value: "
-              << volume_extents[0]
-              << ") must be not smaller than the stencil width (current value: "
-              << stencil_width << ") minus 1");
-
       size_t j = 0;
       for (size_t k =
                vars_slice_offset + volume_extents[0] - (stencil_width - 1 - i);
@@ -5,7 +5,10 @@
 
 #include <algorithm>
 #include <array>
+#include <complex>
 #include <iterator>
+#include <ostream>
+#include <pup.h>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
@@ -13,6 +16,7 @@
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 
 namespace {
 
@@ -197,29 +201,143 @@ Matrix interpolation_matrix(
   }
   return result;
 }
+
+// The 1D interpolation weights of the target points in each dimension, used in
+// the `intrp::IrregularMode::MatrixFree` mode. Unlike `interpolation_matrix`
+// this also supports meshes that mix FD and DG bases.
+template <size_t Dim>
+std::array<Matrix, Dim> one_dimensional_weights(
+    const Mesh<Dim>& mesh,
+    const tnsr::I<DataVector, Dim, Frame::ElementLogical>& points) {
+  const size_t number_of_target_points = get<0>(points).size();
+  std::array<Matrix, Dim> result{};
+  for (size_t d = 0; d < Dim; ++d) {
+    const Mesh<1> mesh_1d = mesh.slice_through(d);
+    if (mesh_1d.basis(0) == Spectral::Basis::FiniteDifference) {
+      const DataVector xi_source = get<0>(logical_coordinates(mesh_1d));
+      auto& weights = gsl::at(result, d);
+      weights.resize(number_of_target_points, mesh_1d.extents(0));
+      for (size_t p = 0; p < number_of_target_points; ++p) {
+        const auto stencil = fd_stencil(xi_source, points.get(d)[p]);
+        for (size_t i = 0; i < stencil.size(); ++i) {
+          weights(p, i) = stencil[i];
+        }
+      }
+    } else {
+      gsl::at(result, d) =
+          Spectral::interpolation_matrix(mesh_1d, points.get(d));
+    }
+  }
+  return result;
+}
 }  // namespace
 
 namespace intrp {
 
+std::ostream& operator<<(std::ostream& os, const IrregularMode mode) {
+  switch (mode) {
+    case IrregularMode::DenseMatrix:
+      return os << "DenseMatrix";
+    case IrregularMode::MatrixFree:
+      return os << "MatrixFree";
+    default:
+      ERROR("Unknown intrp::IrregularMode");
+  }
+}
+
 template <size_t Dim>
 Irregular<Dim>::Irregular() = default;
 
 template <size_t Dim>
-Irregular<Dim>::Irregular(const Mesh<Dim>& source_mesh,
-                          const tnsr::I<DataVector, Dim, Frame::ElementLogical>&
-                              target_points)
-    : interpolation_matrix_(interpolation_matrix(source_mesh, target_points)) {}
+Irregular<Dim>::Irregular(
+    const Mesh<Dim>& source_mesh,
+    const tnsr::I<DataVector, Dim, Frame::ElementLogical>& target_points,
+    const IrregularMode mode)
+    : mode_(mode),
+      number_of_target_points_(get<0>(target_points).size()),
+      number_of_source_points_(source_mesh.number_of_grid_points()) {
+  if (mode_ == IrregularMode::DenseMatrix) {
+    interpolation_matrix_ = interpolation_matrix(source_mesh, target_points);
+  } else {
+    weights_ = one_dimensional_weights(source_mesh, target_points);
+  }
+}
 
 template <size_t Dim>
 void Irregular<Dim>::pup(PUP::er& p) {
+  p | mode_;
+  p | number_of_target_points_;
+  p | number_of_source_points_;
   p | interpolation_matrix_;
+  p | weights_;
+}
+
+template <size_t Dim>
+template <typename T>
+void Irregular<Dim>::tensor_product_interpolate(
+    const gsl::not_null<T*> result, const T* const input,
+    const size_t number_of_components) const {
+  // The sums over the source points are done one dimension at a time: for
+  // each line in the first dimension the target points accumulate their sum
+  // over that line in `xi_sums`, which is then weighted and added to
+  // `eta_sums` (in 3D) and so on. All innermost loops run contiguously over the
+  // target points, so the compiler vectorizes them.
+  const size_t num_targets = number_of_target_points_;
+  std::array<size_t, 3> extents{{1, 1, 1}};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(extents, d) = gsl::at(weights_, d).columns();
+  }
+  std::vector<T> xi_sums(Dim > 1 ? num_targets : 0);
+  std::vector<T> eta_sums(Dim > 2 ? num_targets : 0);
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (size_t component = 0; component < number_of_components; ++component) {
+    const T* const component_input =
+        input + component * number_of_source_points_;
+    T* const component_result = result.get() + component * num_targets;
+    std::fill(component_result, component_result + num_targets, T{0.0});
+    T* const eta_accumulator = Dim > 2 ? eta_sums.data() : component_result;
+    T* const xi_accumulator = Dim > 1 ? xi_sums.data() : eta_accumulator;
+    for (size_t k = 0, s = 0; k < extents[2]; ++k) {
+      if constexpr (Dim > 2) {
+        std::fill(eta_sums.begin(), eta_sums.end(), T{0.0});
+      }
+      for (size_t j = 0; j < extents[1]; ++j) {
+        if constexpr (Dim > 1) {
+          std::fill(xi_sums.begin(), xi_sums.end(), T{0.0});
+        }
+        for (size_t i = 0; i < extents[0]; ++i, ++s) {
+          const T value = component_input[s];
+          const double* const xi_weights =
+              weights_[0].data() + i * weights_[0].spacing();
+          for (size_t p = 0; p < num_targets; ++p) {
+            xi_accumulator[p] += xi_weights[p] * value;
+          }
+        }
+        if constexpr (Dim > 1) {
+          const double* const eta_weights =
+              weights_[1].data() + j * weights_[1].spacing();
+          for (size_t p = 0; p < num_targets; ++p) {
+            eta_accumulator[p] += eta_weights[p] * xi_accumulator[p];
+          }
+        }
+      }
+      if constexpr (Dim > 2) {
+        const double* const zeta_weights =
+            weights_[2].data() + k * weights_[2].spacing();
+        for (size_t p = 0; p < num_targets; ++p) {
+          component_result[p] += zeta_weights[p] * eta_accumulator[p];
+        }
+      }
+    }
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 }
 
 template <size_t Dim>
 void Irregular<Dim>::interpolate(const gsl::not_null<DataVector*> result,
                                  const DataVector& input) const {
-  const size_t m = interpolation_matrix_.rows();
-  const size_t k = interpolation_matrix_.columns();
+  const size_t m = number_of_target_points_;
+  const size_t k = number_of_source_points_;
   ASSERT(k == input.size(),
          "Number of points in 'input', "
              << input.size()
@@ -228,6 +346,10 @@ void Irregular<Dim>::interpolate(const gsl::not_null<DataVector*> result,
   if (result->size() != m) {
     result->destructive_resize(m);
   }
+  if (mode_ == IrregularMode::MatrixFree) {
+    tensor_product_interpolate(make_not_null(result->data()), input.data(), 1);
+    return;
+  }
   dgemv_('n', m, k, 1.0, interpolation_matrix_.data(),
          interpolation_matrix_.spacing(), input.data(), 1, 0.0, result->data(),
          1);
@@ -243,8 +365,8 @@ DataVector Irregular<Dim>::interpolate(const DataVector& input) const {
 template <size_t Dim>
 void Irregular<Dim>::interpolate(const gsl::not_null<ComplexDataVector*> result,
                                  const ComplexDataVector& input) const {
-  const size_t m = interpolation_matrix_.rows();
-  const size_t k = interpolation_matrix_.columns();
+  const size_t m = number_of_target_points_;
+  const size_t k = number_of_source_points_;
   ASSERT(k == input.size(),
          "Number of points in 'input', "
              << input.size()
@@ -253,6 +375,10 @@ void Irregular<Dim>::interpolate(const gsl::not_null<ComplexDataVector*> result,
   if (result->size() != m) {
     result->destructive_resize(m);
   }
+  if (mode_ == IrregularMode::MatrixFree) {
+    tensor_product_interpolate(make_not_null(result->data()), input.data(), 1);
+    return;
+  }
   // Possible performance optimization: can possibly be written as a single
   // `dgemm` call, or might be faster using `zgemv`.
   // NOLINTBEGIN
@@ -278,8 +404,8 @@ ComplexDataVector Irregular<Dim>::interpolate(
 template <size_t Dim>
 void Irregular<Dim>::interpolate(const gsl::not_null<gsl::span<double>*> result,
                                  const gsl::span<const double>& input) const {
-  const size_t m = interpolation_matrix_.rows();
-  const size_t k = interpolation_matrix_.columns();
+  const size_t m = number_of_target_points_;
+  const size_t k = number_of_source_points_;
   ASSERT(input.size() % k == 0,
          "Number of points in 'input', "
              << input.size()
@@ -289,19 +415,22 @@ void Irregular<Dim>::interpolate(const gsl::not_null<gsl::span<double>*> result,
   ASSERT(result->size() == number_of_components * m,
          "The result must be of size " << number_of_components * m
                                        << " but got " << result->size());
-  dgemm_<true>('N', 'N', interpolation_matrix_.rows(), number_of_components,
-               interpolation_matrix_.columns(), 1.0,
+  if (mode_ == IrregularMode::MatrixFree) {
+    tensor_product_interpolate(make_not_null(result->data()), input.data(),
+                               number_of_components);
+    return;
+  }
+  dgemm_<true>('N', 'N', m, number_of_components, k, 1.0,
                interpolation_matrix_.data(), interpolation_matrix_.spacing(),
-               input.data(), interpolation_matrix_.columns(), 0.0,
-               result->data(), interpolation_matrix_.rows());
+               input.data(), k, 0.0, result->data(), m);
 }
 
 template <size_t Dim>
 void Irregular<Dim>::interpolate(
     const gsl::not_null<gsl::span<std::complex<double>>*> result,
     const gsl::span<const std::complex<double>>& input) const {
-  const size_t m = interpolation_matrix_.rows();
-  const size_t k = interpolation_matrix_.columns();
+  const size_t m = number_of_target_points_;
+  const size_t k = number_of_source_points_;
   ASSERT(input.size() % k == 0,
          "Number of points in 'input', "
              << input.size()
@@ -311,6 +440,11 @@ void Irregular<Dim>::interpolate(
   ASSERT(result->size() == number_of_components * m,
          "The result must be of size " << number_of_components * m
                                        << " but got " << result->size());
+  if (mode_ == IrregularMode::MatrixFree) {
+    tensor_product_interpolate(make_not_null(result->data()), input.data(),
+                               number_of_components);
+    return;
+  }
   // BLAS zgemm operates on complex matrices, so we need to copy the real matrix
   // to a complex matrix with zero imaginary part before calling zgemm.
   // Note by Nils Vu (Aug 2024): Profiling of partial derivatives showed that
@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <array>
 #include <complex>
 #include <cstddef>
+#include <iosfwd>
 
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -26,25 +28,44 @@ class er;
 
 namespace intrp {
 
+/// \ingroup NumericalAlgorithmsGroup
+/// \brief How `intrp::Irregular` stores the interpolation weights.
+///
+/// - `DenseMatrix`: a matrix of size `target_points` $\times$
+///   `mesh.number_of_grid_points()` that is applied with BLAS. This is fastest
+///   when the same interpolant is applied many times to a few target points.
+/// - `MatrixFree`: only the 1D weights of each target point in each dimension,
+///   i.e. `target_points` $\times$ `mesh.extents(d)` per dimension. The
+///   tensor-product contraction is evaluated on the fly, vectorized over the
+///   target points. This needs far less memory and is much cheaper to
+///   construct, so it is preferable when there are many target points or the
+///   interpolant is applied only once or twice before the targets move.
+enum class IrregularMode { DenseMatrix, MatrixFree };
+
+std::ostream& operator<<(std::ostream& os, IrregularMode mode);
+
 /// \ingroup NumericalAlgorithmsGroup
 /// \brief Interpolates a `Variables` onto an arbitrary set of points.
 ///
 /// \details If the `source_mesh` uses Spectral::Basis::FiniteDifference,
 /// linear interpolation is done in each dimension; otherwise it uses the
 /// barycentric interpolation provided by Spectral::interpolation_matrix in each
-/// dimension.
+/// dimension. See `intrp::IrregularMode` for how the weights are stored.
 template <size_t Dim>
 class Irregular {
  public:
   Irregular(
       const Mesh<Dim>& source_mesh,
-      const tnsr::I<DataVector, Dim, Frame::ElementLogical>& target_points);
+      const tnsr::I<DataVector, Dim, Frame::ElementLogical>& target_points,
+      IrregularMode mode = IrregularMode::DenseMatrix);
   Irregular();
 
   /// Serialization for Charm++
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p);
 
+  IrregularMode mode() const { return mode_; }
+
   /// @{
   /// Performs the interpolation on a `Variables` with grid points corresponding
   /// to the `Mesh<Dim>` specified in the constructor.
@@ -84,9 +105,30 @@ class Irregular {
 
  private:
   friend bool operator==(const Irregular& lhs, const Irregular& rhs) {
-    return lhs.interpolation_matrix_ == rhs.interpolation_matrix_;
+    return lhs.mode_ == rhs.mode_ and
+           lhs.number_of_target_points_ == rhs.number_of_target_points_ and
+           lhs.number_of_source_points_ == rhs.number_of_source_points_ and
+           lhs.interpolation_matrix_ == rhs.interpolation_matrix_ and
+           lhs.weights_ == rhs.weights_;
   }
-  Matrix interpolation_matrix_;
+
+  // Contracts `number_of_components` components of `input`, each with
+  // `number_of_source_points_` points, with the 1D weights. Only used in
+  // `IrregularMode::MatrixFree`.
+  template <typename T>
+  void tensor_product_interpolate(gsl::not_null<T*> result, const T* input,
+                                  size_t number_of_components) const;
+
+  IrregularMode mode_{IrregularMode::DenseMatrix};
+  size_t number_of_target_points_{0};
+  size_t number_of_source_points_{0};
+  // Only used in `IrregularMode::DenseMatrix`
+  Matrix interpolation_matrix_{};
+  // Only used in `IrregularMode::MatrixFree`. The weights of target point `p`
+  // in dimension `d` are the row `weights_[d](p, i)`. The matrices are
+  // column-major, so the weights of source point `i` are contiguous over the
+  // target points.
+  std::array<Matrix, Dim> weights_{};
 };
 
 template <size_t Dim>
@@ -94,15 +136,14 @@ template <typename TagsList>
 void Irregular<Dim>::interpolate(
     const gsl::not_null<Variables<TagsList>*> result,
     const Variables<TagsList>& vars) const {
-  if (UNLIKELY(result->number_of_grid_points() !=
-               interpolation_matrix_.rows())) {
-    *result = Variables<TagsList>(interpolation_matrix_.rows(), 0.);
+  if (UNLIKELY(result->number_of_grid_points() != number_of_target_points_)) {
+    *result = Variables<TagsList>(number_of_target_points_, 0.);
   }
-  ASSERT(interpolation_matrix_.columns() == vars.number_of_grid_points(),
+  ASSERT(number_of_source_points_ == vars.number_of_grid_points(),
          "Number of grid points in source 'vars', "
              << vars.number_of_grid_points()
              << ",\n disagrees with the size of the source_mesh, "
-             << interpolation_matrix_.columns()
+             << number_of_source_points_
              << ", that was passed into the constructor");
   auto result_span = gsl::make_span(result->data(), result->size());
   const auto vars_span = gsl::make_span(vars.data(), vars.size());
@@ -113,7 +154,7 @@ template <size_t Dim>
 template <typename TagsList>
 Variables<TagsList> Irregular<Dim>::interpolate(
     const Variables<TagsList>& vars) const {
-  Variables<TagsList> result{interpolation_matrix_.rows()};
+  Variables<TagsList> result{number_of_target_points_};
   interpolate(make_not_null(&result), vars);
   return result;
 }
@@ -130,6 +130,29 @@ class MultiLinearSpanInterpolation {
                        std::make_index_sequence<Dimension>{});
   }
 
+  /*!
+   * \brief Interpolate the variables `VariablesToInterpolate` to
+   * `number_of_points` target points at once.
+   *
+   * \details `target_points[d]` points to the `number_of_points` coordinates
+   * in dimension `d`, and the values of the `i`th requested variable are
+   * written to `results[i]`. The points are processed in blocks of
+   * `points_per_block`. For each block the bracketing indices and relative
+   * coordinates are first computed in loops over contiguous arrays that the
+   * compiler vectorizes, and then every requested variable is read from each
+   * corner of the bracketing cell together. Because the variables of a table
+   * node are stored next to each other this touches one cache line per
+   * corner instead of one per corner and variable.
+   */
+  template <size_t... VariablesToInterpolate>
+  void interpolate_points(
+      const std::array<double*, sizeof...(VariablesToInterpolate)>& results,
+      const std::array<const double*, Dimension>& target_points,
+      size_t number_of_points) const;
+
+  /// Number of points processed together by `interpolate_points`
+  static constexpr size_t points_per_block = 64;
+
   MultiLinearSpanInterpolation() = default;
 
   MultiLinearSpanInterpolation(
@@ -380,6 +403,102 @@ auto MultiLinearSpanInterpolation<Dimension, NumberOfVariables,
   return weights;
 }
 
+template <size_t Dimension, size_t NumberOfVariables, bool UniformSpacing>
+template <size_t... VariablesToInterpolate>
+void MultiLinearSpanInterpolation<Dimension, NumberOfVariables,
+                                  UniformSpacing>::
+    interpolate_points(
+        const std::array<double*, sizeof...(VariablesToInterpolate)>& results,
+        const std::array<const double*, Dimension>& target_points,
+        const size_t number_of_points) const {
+  static_assert(((VariablesToInterpolate < NumberOfVariables) and ...),
+                "You are trying to interpolate a variable that this container "
+                "does not hold.");
+  constexpr size_t number_of_corners = two_to_the(Dimension);
+  constexpr std::array<size_t, sizeof...(VariablesToInterpolate)> variables{
+      {VariablesToInterpolate...}};
+
+  // Offsets of the corners of a cell relative to its lowest corner, with the
+  // first index varying fastest as in `get_weights`.
+  std::array<size_t, number_of_corners> corner_offsets{};
+  for (size_t corner = 0; corner < number_of_corners; ++corner) {
+    size_t offset = 0;
+    size_t stride = 1;
+    for (size_t d = 0; d < Dimension; ++d) {
+      offset += ((corner >> d) & 1) * stride;
+      stride *= number_of_points_[d];
+    }
+    gsl::at(corner_offsets, corner) = offset;
+  }
+
+  std::array<std::array<double, points_per_block>, Dimension>
+      relative_coordinates{};
+  std::array<size_t, points_per_block> lowest_corner{};
+
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (size_t block_begin = 0; block_begin < number_of_points;
+       block_begin += points_per_block) {
+    const size_t block_size =
+        std::min(points_per_block, number_of_points - block_begin);
+
+    lowest_corner.fill(0);
+    size_t stride = 1;
+    for (size_t d = 0; d < Dimension; ++d) {
+      const double* const x = gsl::at(target_points, d) + block_begin;
+      double* const relative = gsl::at(relative_coordinates, d).data();
+      size_t* const corners = lowest_corner.data();
+      if constexpr (UniformSpacing) {
+        const double lower = x_[d][0];
+        const double inverse_spacing = inverse_spacing_[d];
+        const auto max_index = static_cast<double>(number_of_points_[d] - 2);
+        for (size_t p = 0; p < block_size; ++p) {
+          const double coordinate = (x[p] - lower) * inverse_spacing;
+          ASSERT((allow_extrapolation_below_data_[d] or coordinate >= 0.) and
+                     (allow_extrapolation_abov_data_[d] or
+                      coordinate <= max_index + 1.),
+                 "Interpolation exceeds table bounds.\nwhich_dimension: "
+                     << d << "\ntarget point: " << x[p]);
+          // Outside the table the nearest cell is extrapolated linearly.
+          const double index =
+              std::min(max_index, std::max(0., std::floor(coordinate)));
+          relative[p] = coordinate - index;
+          corners[p] += static_cast<size_t>(index) * stride;
+        }
+      } else {
+        for (size_t p = 0; p < block_size; ++p) {
+          const size_t index = find_index(d, x[p]);
+          relative[p] =
+              (x[p] - x_[d][index]) / (x_[d][index + 1] - x_[d][index]);
+          corners[p] += index * stride;
+        }
+      }
+      stride *= number_of_points_[d];
+    }
+
+    for (size_t p = 0; p < block_size; ++p) {
+      std::array<double, sizeof...(VariablesToInterpolate)> sums{};
+      for (size_t corner = 0; corner < number_of_corners; ++corner) {
+        double weight = 1.;
+        for (size_t d = 0; d < Dimension; ++d) {
+          const double xx = gsl::at(relative_coordinates, d)[p];
+          weight *= ((corner >> d) & 1) == 1 ? xx : 1. - xx;
+        }
+        const double* const node =
+            y_.data() +
+            NumberOfVariables *
+                (gsl::at(lowest_corner, p) + gsl::at(corner_offsets, corner));
+        for (size_t v = 0; v < variables.size(); ++v) {
+          gsl::at(sums, v) += weight * node[gsl::at(variables, v)];
+        }
+      }
+      for (size_t v = 0; v < variables.size(); ++v) {
+        gsl::at(results, v)[block_begin + p] = gsl::at(sums, v);
+      }
+    }
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
 template <size_t Dimension, size_t NumberOfVariables, bool UniformSpacing>
 MultiLinearSpanInterpolation<Dimension, NumberOfVariables, UniformSpacing>::
     MultiLinearSpanInterpolation(
@@ -22,13 +22,16 @@ void bind_irregular_impl(py::module& m) {  // NOLINT
                              ("Irregular" + std::to_string(Dim) + "D").c_str())
       .def(py::init(
                [](const Mesh<Dim>& source_mesh,
-                  const std::array<DataVector, Dim>& target_logical_coords) {
+                  const std::array<DataVector, Dim>& target_logical_coords,
+                  const IrregularMode mode) {
                  return Irregular<Dim>{
                      source_mesh,
                      tnsr::I<DataVector, Dim, Frame::ElementLogical>{
-                         target_logical_coords}};
+                         target_logical_coords},
+                     mode};
                }),
-           py::arg("source_mesh"), py::arg("target_logical_coords"))
+           py::arg("source_mesh"), py::arg("target_logical_coords"),
+           py::arg("mode") = IrregularMode::DenseMatrix)
       .def("interpolate",
            static_cast<DataVector (Irregular<Dim>::*)(const DataVector&) const>(
                &Irregular<Dim>::interpolate),
@@ -37,6 +40,9 @@ void bind_irregular_impl(py::module& m) {  // NOLINT
 }  // namespace
 
 void bind_irregular(py::module& m) {
+  py::enum_<IrregularMode>(m, "IrregularMode")
+      .value("DenseMatrix", IrregularMode::DenseMatrix)
+      .value("MatrixFree", IrregularMode::MatrixFree);
   bind_irregular_impl<1>(m);
   bind_irregular_impl<2>(m);
   bind_irregular_impl<3>(m);
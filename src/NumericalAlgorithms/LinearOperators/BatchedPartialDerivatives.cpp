@@ -0,0 +1,75 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "NumericalAlgorithms/LinearOperators/BatchedPartialDerivatives.hpp"
+
+#include <array>
+#include <cstddef>
+
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/ScratchArena.hpp"
+#include "DataStructures/SumFactorization.hpp"
+#include "DataStructures/Transpose.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace partial_derivatives_detail {
+namespace {
+// Differentiate the contiguous data along a dimension whose grid points are
+// `stride` apart.
+void apply_in_strided_dim(const gsl::not_null<double*> result,
+                          const double* const u, const Matrix& matrix,
+                          const size_t stride, const size_t size) {
+  const size_t number_of_outer_slices = size / (stride * matrix.columns());
+  if (matrix.columns() <= sum_factorization::max_unrolled_extent) {
+    sum_factorization::apply_in_dimension(result, matrix, u, stride,
+                                          number_of_outer_slices);
+    return;
+  }
+  auto buffer = ScratchArena::thread_local_arena().get(2 * size);
+  double* const u_transposed = buffer.data();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  double* const result_transposed = buffer.data() + size;
+  raw_transpose(make_not_null(u_transposed), u, stride, size / stride);
+  apply_matrix_in_first_dim(result_transposed, u_transposed, matrix, size);
+  raw_transpose(result, result_transposed, size / stride, stride);
+}
+}  // namespace
+
+template <size_t Dim>
+void logical_partial_derivatives_of_contiguous_data(
+    const std::array<double*, Dim>& logical_du, const double* const u,
+    const size_t size, const Mesh<Dim>& mesh) {
+  ASSERT(size % mesh.number_of_grid_points() == 0,
+         "The size of the data (" << size
+                                  << ") must be a multiple of the number of "
+                                     "grid points in the mesh ("
+                                  << mesh.number_of_grid_points() << ").");
+  apply_matrix_in_first_dim(
+      logical_du[0], u,
+      Spectral::differentiation_matrix(mesh.slice_through(0)), size);
+  size_t stride = mesh.extents(0);
+  for (size_t d = 1; d < Dim; ++d) {
+    apply_in_strided_dim(
+        make_not_null(gsl::at(logical_du, d)), u,
+        Spectral::differentiation_matrix(mesh.slice_through(d)), stride, size);
+    stride *= mesh.extents(d);
+  }
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                              \
+  template void logical_partial_derivatives_of_contiguous_data(             \
+      const std::array<double*, DIM(data)>& logical_du, const double* u,    \
+      size_t size, const Mesh<DIM(data)>& mesh);
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace partial_derivatives_detail
@@ -0,0 +1,76 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines functions computing partial derivatives and divergences of many
+/// elements at once.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Variables.hpp"
+
+/// \cond
+class DataVector;
+template <size_t Dim>
+class Mesh;
+/// \endcond
+
+namespace partial_derivatives_detail {
+/// Compute the logical partial derivatives of the contiguous data `u` of
+/// `size` entries, which is a sequence of blocks of
+/// `mesh.number_of_grid_points()` values each. Each direction is handled with a
+/// single matrix application spanning all blocks.
+template <size_t Dim>
+void logical_partial_derivatives_of_contiguous_data(
+    const std::array<double*, Dim>& logical_du, const double* u, size_t size,
+    const Mesh<Dim>& mesh);
+}  // namespace partial_derivatives_detail
+
+/// @{
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Compute the partial derivatives of the variables of many elements that
+ * share the same `mesh`.
+ *
+ * \details Computes the same result as calling `partial_derivatives` on each
+ * element, but the `DerivativeTags` of all elements are first gathered into one
+ * contiguous buffer so that the logical derivative in each direction is a
+ * single matrix application over all elements, rather than one small matrix
+ * multiplication per element. This is useful when a node owns many elements
+ * with identical extents, e.g. in a `Parallel::DgElementCollection`.
+ *
+ * The `DerivativeTags` must be the head of `VariableTags`. Entries of `du` are
+ * resized if needed.
+ */
+template <typename ResultTags, typename VariableTags, size_t Dim,
+          typename DerivativeFrame>
+void batched_partial_derivatives(
+    const std::vector<Variables<ResultTags>*>& du,
+    const std::vector<const Variables<VariableTags>*>& u,
+    const Mesh<Dim>& mesh,
+    const std::vector<const InverseJacobian<
+        DataVector, Dim, Frame::ElementLogical, DerivativeFrame>*>&
+        inverse_jacobians);
+
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Compute the divergence of the fluxes of many elements that share the
+ * same `mesh`.
+ *
+ * \details Computes the same result as calling `divergence` on each element,
+ * batching the logical derivatives as in `batched_partial_derivatives`.
+ */
+template <typename DivTags, typename FluxTags, size_t Dim,
+          typename DerivativeFrame>
+void batched_divergence(
+    const std::vector<Variables<DivTags>*>& divergence_of_F,
+    const std::vector<const Variables<FluxTags>*>& F, const Mesh<Dim>& mesh,
+    const std::vector<const InverseJacobian<
+        DataVector, Dim, Frame::ElementLogical, DerivativeFrame>*>&
+        inverse_jacobians);
+/// @}
@@ -0,0 +1,152 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "NumericalAlgorithms/LinearOperators/BatchedPartialDerivatives.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/ScratchArena.hpp"
+#include "DataStructures/Variables.hpp"
+#include "NumericalAlgorithms/LinearOperators/Divergence.tpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace partial_derivatives_detail {
+// Gathers the first `number_of_independent_components` components of every
+// element into `buffer` and computes the logical derivatives of all of them.
+// The result for element `e` in direction `d` starts at
+// `logical_derivs[d] + e * vars_size`.
+template <size_t Dim, typename VariableTags>
+void batched_logical_partial_derivatives(
+    const std::array<double*, Dim>& logical_derivs,
+    const gsl::not_null<double*> buffer,
+    const std::vector<const Variables<VariableTags>*>& u,
+    const size_t number_of_independent_components, const Mesh<Dim>& mesh) {
+  static_assert(
+      std::is_same_v<typename Variables<VariableTags>::value_type, double>,
+      "Batched derivatives are only implemented for real data.");
+  const size_t vars_size =
+      number_of_independent_components * mesh.number_of_grid_points();
+  for (size_t e = 0; e < u.size(); ++e) {
+    ASSERT(u[e]->number_of_grid_points() == mesh.number_of_grid_points(),
+           "Element " << e << " has " << u[e]->number_of_grid_points()
+                      << " grid points, but the mesh has "
+                      << mesh.number_of_grid_points());
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::copy_n(u[e]->data(), vars_size, buffer.get() + e * vars_size);
+  }
+  logical_partial_derivatives_of_contiguous_data(logical_derivs, buffer.get(),
+                                                 u.size() * vars_size, mesh);
+}
+}  // namespace partial_derivatives_detail
+
+template <typename ResultTags, typename VariableTags, size_t Dim,
+          typename DerivativeFrame>
+void batched_partial_derivatives(
+    const std::vector<Variables<ResultTags>*>& du,
+    const std::vector<const Variables<VariableTags>*>& u,
+    const Mesh<Dim>& mesh,
+    const std::vector<const InverseJacobian<
+        DataVector, Dim, Frame::ElementLogical, DerivativeFrame>*>&
+        inverse_jacobians) {
+  ASSERT(du.size() == u.size() and inverse_jacobians.size() == u.size(),
+         "Need the same number of results ("
+             << du.size() << "), variables (" << u.size()
+             << ") and inverse Jacobians (" << inverse_jacobians.size()
+             << ").");
+  using DerivativeTags =
+      tmpl::front<tmpl::split_at<VariableTags, tmpl::size<ResultTags>>>;
+  static_assert(
+      std::is_same_v<
+          tmpl::transform<ResultTags, tmpl::bind<tmpl::type_from, tmpl::_1>>,
+          tmpl::transform<db::wrap_tags_in<Tags::deriv, DerivativeTags,
+                                           tmpl::size_t<Dim>, DerivativeFrame>,
+                          tmpl::bind<tmpl::type_from, tmpl::_1>>>);
+  constexpr size_t number_of_independent_components =
+      Variables<DerivativeTags>::number_of_independent_components;
+  const size_t vars_size =
+      number_of_independent_components * mesh.number_of_grid_points();
+  const size_t batch_size = u.size() * vars_size;
+
+  auto buffer = ScratchArena::thread_local_arena().get((Dim + 1) * batch_size);
+  std::array<double*, Dim> logical_derivs{};
+  for (size_t d = 0; d < Dim; ++d) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    gsl::at(logical_derivs, d) = buffer.data() + (d + 1) * batch_size;
+  }
+  partial_derivatives_detail::batched_logical_partial_derivatives(
+      logical_derivs, make_not_null(buffer.data()), u,
+      number_of_independent_components, mesh);
+
+  for (size_t e = 0; e < u.size(); ++e) {
+    if (UNLIKELY(du[e]->number_of_grid_points() !=
+                 mesh.number_of_grid_points())) {
+      du[e]->initialize(mesh.number_of_grid_points());
+    }
+    std::array<const double*, Dim> element_logical_derivs{};
+    for (size_t d = 0; d < Dim; ++d) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      gsl::at(element_logical_derivs, d) =
+          gsl::at(logical_derivs, d) + e * vars_size;
+    }
+    partial_derivatives_detail::partial_derivatives_impl(
+        make_not_null(du[e]), element_logical_derivs,
+        number_of_independent_components, *inverse_jacobians[e]);
+  }
+}
+
+template <typename DivTags, typename FluxTags, size_t Dim,
+          typename DerivativeFrame>
+void batched_divergence(
+    const std::vector<Variables<DivTags>*>& divergence_of_F,
+    const std::vector<const Variables<FluxTags>*>& F, const Mesh<Dim>& mesh,
+    const std::vector<const InverseJacobian<
+        DataVector, Dim, Frame::ElementLogical, DerivativeFrame>*>&
+        inverse_jacobians) {
+  ASSERT(divergence_of_F.size() == F.size() and
+             inverse_jacobians.size() == F.size(),
+         "Need the same number of results ("
+             << divergence_of_F.size() << "), fluxes (" << F.size()
+             << ") and inverse Jacobians (" << inverse_jacobians.size()
+             << ").");
+  constexpr size_t number_of_independent_components =
+      Variables<FluxTags>::number_of_independent_components;
+  const size_t vars_size =
+      number_of_independent_components * mesh.number_of_grid_points();
+  const size_t batch_size = F.size() * vars_size;
+
+  auto buffer = ScratchArena::thread_local_arena().get((Dim + 1) * batch_size);
+  std::array<double*, Dim> logical_derivs{};
+  for (size_t d = 0; d < Dim; ++d) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    gsl::at(logical_derivs, d) = buffer.data() + (d + 1) * batch_size;
+  }
+  partial_derivatives_detail::batched_logical_partial_derivatives(
+      logical_derivs, make_not_null(buffer.data()), F,
+      number_of_independent_components, mesh);
+
+  std::array<Variables<FluxTags>, Dim> logical_partial_derivatives_of_F{};
+  for (size_t e = 0; e < F.size(); ++e) {
+    if (UNLIKELY(divergence_of_F[e]->number_of_grid_points() !=
+                 mesh.number_of_grid_points())) {
+      divergence_of_F[e]->initialize(mesh.number_of_grid_points());
+    }
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(logical_partial_derivatives_of_F, d)
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          .set_data_ref(gsl::at(logical_derivs, d) + e * vars_size, vars_size);
+    }
+    divergence_detail::divergence_from_logical_derivatives(
+        make_not_null(divergence_of_F[e]), logical_partial_derivatives_of_F,
+        *inverse_jacobians[e]);
+  }
+}
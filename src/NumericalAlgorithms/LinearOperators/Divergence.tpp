@@ -11,6 +11,50 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
 
+namespace divergence_detail {
+// Contracts the logical derivatives of the fluxes with the inverse Jacobian.
+template <typename... DivTags, typename... FluxTags, size_t Dim,
+          typename DerivativeFrame>
+void divergence_from_logical_derivatives(
+    const gsl::not_null<Variables<tmpl::list<DivTags...>>*> divergence_of_F,
+    const std::array<Variables<tmpl::list<FluxTags...>>, Dim>&
+        logical_partial_derivatives_of_F,
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                          DerivativeFrame>& inverse_jacobian) {
+  const auto apply_div = [
+    &divergence_of_F, &inverse_jacobian, &logical_partial_derivatives_of_F
+  ](auto flux_tag_v, auto div_tag_v) {
+    using FluxTag = std::decay_t<decltype(flux_tag_v)>;
+    using DivFluxTag = std::decay_t<decltype(div_tag_v)>;
+
+    using first_index =
+        tmpl::front<typename FluxTag::type::index_list>;
+    static_assert(
+        std::is_same_v<typename first_index::Frame, DerivativeFrame> and
+            first_index::ul == UpLo::Up,
+        "First index of tensor cannot be contracted with derivative "
+        "because either it is in the wrong frame or it has the wrong "
+        "valence");
+
+    auto& divergence_of_flux = get<DivFluxTag>(*divergence_of_F);
+    for (auto it = divergence_of_flux.begin(); it != divergence_of_flux.end();
+         ++it) {
+      *it = 0.0;
+      const auto div_flux_indices = divergence_of_flux.get_tensor_index(it);
+      for (size_t i0 = 0; i0 < Dim; ++i0) {
+        const auto flux_indices = prepend(div_flux_indices, i0);
+        for (size_t d = 0; d < Dim; ++d) {
+          *it += inverse_jacobian.get(d, i0) *
+                 get<FluxTag>(gsl::at(logical_partial_derivatives_of_F, d))
+                     .get(flux_indices);
+        }
+      }
+    }
+  };
+  EXPAND_PACK_LEFT_TO_RIGHT(apply_div(FluxTags{}, DivTags{}));
+}
+}  // namespace divergence_detail
+
 template <typename FluxTags, size_t Dim, typename DerivativeFrame>
 Variables<db::wrap_tags_in<Tags::div, FluxTags>> divergence(
     const Variables<FluxTags>& F, const Mesh<Dim>& mesh,
@@ -64,37 +108,8 @@ void divergence(
             make_not_null(&logical_derivs), temp, temp, F, mesh);
   }
 
-  const auto apply_div = [
-    &divergence_of_F, &inverse_jacobian, &logical_partial_derivatives_of_F
-  ](auto flux_tag_v, auto div_tag_v) {
-    using FluxTag = std::decay_t<decltype(flux_tag_v)>;
-    using DivFluxTag = std::decay_t<decltype(div_tag_v)>;
-
-    using first_index =
-        tmpl::front<typename FluxTag::type::index_list>;
-    static_assert(
-        std::is_same_v<typename first_index::Frame, DerivativeFrame> and
-            first_index::ul == UpLo::Up,
-        "First index of tensor cannot be contracted with derivative "
-        "because either it is in the wrong frame or it has the wrong "
-        "valence");
-
-    auto& divergence_of_flux = get<DivFluxTag>(*divergence_of_F);
-    for (auto it = divergence_of_flux.begin(); it != divergence_of_flux.end();
-         ++it) {
-      *it = 0.0;
-      const auto div_flux_indices = divergence_of_flux.get_tensor_index(it);
-      for (size_t i0 = 0; i0 < Dim; ++i0) {
-        const auto flux_indices = prepend(div_flux_indices, i0);
-        for (size_t d = 0; d < Dim; ++d) {
-          *it += inverse_jacobian.get(d, i0) *
-                 get<FluxTag>(gsl::at(logical_partial_derivatives_of_F, d))
-                     .get(flux_indices);
-        }
-      }
-    }
-  };
-  EXPAND_PACK_LEFT_TO_RIGHT(apply_div(FluxTags{}, DivTags{}));
+  divergence_detail::divergence_from_logical_derivatives(
+      divergence_of_F, logical_partial_derivatives_of_F, inverse_jacobian);
 }
 
 template <typename FluxTags, size_t Dim>
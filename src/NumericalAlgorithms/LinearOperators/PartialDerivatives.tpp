@@ -5,10 +5,13 @@
 
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
 
+#include <type_traits>
+
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "DataStructures/SumFactorization.hpp"
 #include "DataStructures/Transpose.hpp"
 #include "DataStructures/Variables.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -299,11 +302,21 @@ struct LogicalImpl<2, VariableTags, DerivativeTags> {
     const size_t num_components_times_xi_slices = deriv_size / mesh.extents(0);
     apply_matrix_in_first_dim(logical_partial_derivatives_of_u[0], u.data(),
                               differentiation_matrix_xi, deriv_size);
+    const Matrix& differentiation_matrix_eta =
+        Spectral::differentiation_matrix(mesh.slice_through(1));
+    if constexpr (std::is_same_v<ValueType, double>) {
+      if (mesh.extents(1) <= sum_factorization::max_unrolled_extent) {
+        // Differentiate along eta in place, without transposing.
+        sum_factorization::apply_in_dimension(
+            make_not_null(logical_partial_derivatives_of_u[1]),
+            differentiation_matrix_eta, u.data(), mesh.extents(0),
+            deriv_size / mesh.extents().product());
+        return;
+      }
+    }
     transpose<Variables<VariableTags>, Variables<DerivativeTags>>(
         make_not_null(u_eta_fastest), u, mesh.extents(0),
         num_components_times_xi_slices);
-    const Matrix& differentiation_matrix_eta =
-        Spectral::differentiation_matrix(mesh.slice_through(1));
     apply_matrix_in_first_dim(partial_u_wrt_eta->data(), u_eta_fastest->data(),
                               differentiation_matrix_eta, deriv_size);
     raw_transpose(make_not_null(logical_partial_derivatives_of_u[1]),
@@ -334,12 +347,32 @@ struct LogicalImpl<3, VariableTags, DerivativeTags> {
     const size_t num_components_times_xi_slices = deriv_size / mesh.extents(0);
     apply_matrix_in_first_dim(logical_partial_derivatives_of_u[0], u.data(),
                               differentiation_matrix_xi, deriv_size);
+    const Matrix& differentiation_matrix_eta =
+        Spectral::differentiation_matrix(mesh.slice_through(1));
+    const Matrix& differentiation_matrix_zeta =
+        Spectral::differentiation_matrix(mesh.slice_through(2));
+    const size_t chunk_size = mesh.extents(0) * mesh.extents(1);
+    const size_t number_of_chunks = deriv_size / chunk_size;
+
+    if constexpr (std::is_same_v<ValueType, double>) {
+      if (mesh.extents(1) <= sum_factorization::max_unrolled_extent and
+          mesh.extents(2) <= sum_factorization::max_unrolled_extent) {
+        // Differentiate along eta and zeta in place, without transposing.
+        sum_factorization::apply_in_dimension(
+            make_not_null(logical_partial_derivatives_of_u[1]),
+            differentiation_matrix_eta, u.data(), mesh.extents(0),
+            number_of_chunks);
+        sum_factorization::apply_in_dimension(
+            make_not_null(logical_partial_derivatives_of_u[2]),
+            differentiation_matrix_zeta, u.data(), chunk_size,
+            deriv_size / mesh.extents().product());
+        return;
+      }
+    }
 
     transpose<Variables<VariableTags>, Variables<DerivativeTags>>(
         make_not_null(u_eta_or_zeta_fastest), u, mesh.extents(0),
         num_components_times_xi_slices);
-    const Matrix& differentiation_matrix_eta =
-        Spectral::differentiation_matrix(mesh.slice_through(1));
     apply_matrix_in_first_dim(partial_u_wrt_eta_or_zeta->data(),
                               u_eta_or_zeta_fastest->data(),
                               differentiation_matrix_eta, deriv_size);
@@ -347,12 +380,8 @@ struct LogicalImpl<3, VariableTags, DerivativeTags> {
                   partial_u_wrt_eta_or_zeta->data(),
                   num_components_times_xi_slices, mesh.extents(0));
 
-    const size_t chunk_size = mesh.extents(0) * mesh.extents(1);
-    const size_t number_of_chunks = deriv_size / chunk_size;
     transpose(make_not_null(u_eta_or_zeta_fastest), u, chunk_size,
               number_of_chunks);
-    const Matrix& differentiation_matrix_zeta =
-        Spectral::differentiation_matrix(mesh.slice_through(2));
     apply_matrix_in_first_dim(partial_u_wrt_eta_or_zeta->data(),
                               u_eta_or_zeta_fastest->data(),
                               differentiation_matrix_zeta, deriv_size);
@@ -0,0 +1,122 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "NumericalAlgorithms/LinearSolver/BatchedLinearSolve.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace LinearSolver::Serial {
+int batched_linear_solve(const gsl::not_null<DataVector*> rhs_in_solution_out,
+                         const gsl::not_null<DataVector*> matrices,
+                         const size_t size) {
+  ASSERT(size > 0 and rhs_in_solution_out->size() % size == 0,
+         "The size of the right-hand sides, " << rhs_in_solution_out->size()
+                                              << ", must be a multiple of the "
+                                                 "size of the systems, "
+                                              << size);
+  const size_t batch_size = rhs_in_solution_out->size() / size;
+  ASSERT(matrices->size() == size * size * batch_size,
+         "The batch of matrices must have size "
+             << size * size * batch_size << ", but has size "
+             << matrices->size());
+  double* const a = matrices->data();
+  double* const x = rhs_in_solution_out->data();
+  const auto entry = [&a, &batch_size, &size](const size_t row,
+                                              const size_t column) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return a + (row + size * column) * batch_size;
+  };
+  const auto rhs = [&x, &batch_size](const size_t row) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return x + row * batch_size;
+  };
+
+  std::vector<double> pivot_magnitudes(batch_size);
+  std::vector<size_t> pivot_rows(batch_size);
+  std::vector<double> inverse_pivots(batch_size);
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (size_t k = 0; k < size; ++k) {
+    // Find the pivot of every system. The selection is branch-free so the
+    // loop over the batch vectorizes.
+    const double* const diagonal = entry(k, k);
+    for (size_t b = 0; b < batch_size; ++b) {
+      pivot_magnitudes[b] = std::abs(diagonal[b]);
+      pivot_rows[b] = k;
+    }
+    for (size_t i = k + 1; i < size; ++i) {
+      const double* const candidates = entry(i, k);
+      for (size_t b = 0; b < batch_size; ++b) {
+        const double magnitude = std::abs(candidates[b]);
+        const bool larger = magnitude > pivot_magnitudes[b];
+        pivot_magnitudes[b] = larger ? magnitude : pivot_magnitudes[b];
+        pivot_rows[b] = larger ? i : pivot_rows[b];
+      }
+    }
+    // Swap rows in the systems that need it. Only the columns that haven't
+    // been eliminated yet are needed, since the multipliers are applied to the
+    // right-hand side right away.
+    for (size_t b = 0; b < batch_size; ++b) {
+      const size_t pivot_row = pivot_rows[b];
+      if (pivot_row == k) {
+        continue;
+      }
+      for (size_t j = k; j < size; ++j) {
+        std::swap(entry(k, j)[b], entry(pivot_row, j)[b]);
+      }
+      std::swap(rhs(k)[b], rhs(pivot_row)[b]);
+    }
+    for (size_t b = 0; b < batch_size; ++b) {
+      if (pivot_magnitudes[b] == 0.0) {
+        return static_cast<int>(k + 1);
+      }
+      inverse_pivots[b] = 1.0 / diagonal[b];
+    }
+
+    // Eliminate column k below the diagonal. The multipliers are stored in
+    // place of the eliminated entries.
+    const double* const rhs_k = rhs(k);
+    for (size_t i = k + 1; i < size; ++i) {
+      double* const multipliers = entry(i, k);
+      for (size_t b = 0; b < batch_size; ++b) {
+        multipliers[b] *= inverse_pivots[b];
+      }
+      for (size_t j = k + 1; j < size; ++j) {
+        double* const row_i = entry(i, j);
+        const double* const row_k = entry(k, j);
+        for (size_t b = 0; b < batch_size; ++b) {
+          row_i[b] -= multipliers[b] * row_k[b];
+        }
+      }
+      double* const rhs_i = rhs(i);
+      for (size_t b = 0; b < batch_size; ++b) {
+        rhs_i[b] -= multipliers[b] * rhs_k[b];
+      }
+    }
+  }
+
+  // Back substitution
+  for (size_t i = size; i-- > 0;) {
+    double* const rhs_i = rhs(i);
+    for (size_t j = i + 1; j < size; ++j) {
+      const double* const upper = entry(i, j);
+      const double* const solution_j = rhs(j);
+      for (size_t b = 0; b < batch_size; ++b) {
+        rhs_i[b] -= upper[b] * solution_j[b];
+      }
+    }
+    const double* const diagonal = entry(i, i);
+    for (size_t b = 0; b < batch_size; ++b) {
+      rhs_i[b] /= diagonal[b];
+    }
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  return 0;
+}
+}  // namespace LinearSolver::Serial
@@ -0,0 +1,41 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+class DataVector;
+/// \endcond
+
+namespace LinearSolver::Serial {
+/*!
+ * \ingroup LinearSolverGroup
+ * \brief Solves a batch of small dense linear systems \f$A_b x_b = r_b\f$ of
+ * the same `size` by LU decomposition with partial pivoting.
+ *
+ * \details This is meant for many (hundreds or more) systems with only a few
+ * dozen unknowns, where calling LAPACK for each system is dominated by the
+ * overhead of the call. The systems are interleaved so that the same entry of
+ * all matrices is contiguous in memory:
+ *
+ * - `matrices` holds entry \f$(i, j)\f$ of matrix \f$b\f$ at index
+ *   `(i + size * j) * batch_size + b`, i.e. each matrix is column-major.
+ * - `rhs_in_solution_out` holds entry \f$i\f$ of \f$r_b\f$ at index
+ *   `i * batch_size + b` and is overwritten with the solutions \f$x_b\f$.
+ *
+ * The batch size is `rhs_in_solution_out->size() / size`. All loops of the
+ * elimination run over the batch, so they are vectorized by the compiler.
+ * Only the row swaps of the pivoting, which differ between the systems, are
+ * done one system at a time. The `matrices` are overwritten.
+ *
+ * Returns 0 on success. If a matrix is singular, returns \f$i + 1\f$ where
+ * \f$i\f$ is the first column with a zero pivot in any of the systems, like the
+ * `INFO` value of LAPACK's `dgesv`. The solutions are then not usable.
+ */
+int batched_linear_solve(gsl::not_null<DataVector*> rhs_in_solution_out,
+                         gsl::not_null<DataVector*> matrices, size_t size);
+}  // namespace LinearSolver::Serial
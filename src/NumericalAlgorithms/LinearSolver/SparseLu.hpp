@@ -0,0 +1,245 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/CompressedMatrix.hpp"
+#include "DataStructures/DynamicVector.hpp"
+#include "NumericalAlgorithms/Convergence/HasConverged.hpp"
+#include "NumericalAlgorithms/LinearSolver/BuildMatrix.hpp"
+#include "NumericalAlgorithms/LinearSolver/LinearSolver.hpp"
+#include "NumericalAlgorithms/LinearSolver/SparseLuFactorization.hpp"
+#include "Options/String.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeWithValue.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TypeTraits/CreateIsCallable.hpp"
+
+namespace LinearSolver::Serial {
+
+/// \cond
+template <typename ValueType, typename LinearSolverRegistrars>
+struct SparseLu;
+/// \endcond
+
+namespace detail {
+CREATE_IS_CALLABLE(operator_signature)
+CREATE_IS_CALLABLE_V(operator_signature)
+}  // namespace detail
+
+namespace Registrars {
+/// Registers the `LinearSolver::Serial::SparseLu` linear solver
+template <typename ValueType>
+struct SparseLu {
+  template <typename LinearSolverRegistrars>
+  using f = Serial::SparseLu<ValueType, LinearSolverRegistrars>;
+};
+}  // namespace Registrars
+
+/*!
+ * \brief Linear solver that builds a sparse matrix representation of the
+ * linear operator and solves it with a sparse LU factorization
+ *
+ * Like `LinearSolver::Serial::ExplicitInverse`, this solver "sniffs out" the
+ * matrix representation of the operator by feeding it with unit vectors, so
+ * the first solve is expensive and successive solves converge immediately.
+ * However, it stores only the nonzero entries of the operator and factorizes
+ * it with a `LinearSolver::Serial::SparseLuFactorization` instead of computing
+ * the dense inverse. For DG operators, which couple each grid point only to
+ * grid points on the same lines and to its neighbors, this reduces the cost of
+ * the setup and the memory by a large factor, in particular at high polynomial
+ * order in 3D.
+ *
+ * Operators with identical matrix representations share a single
+ * factorization on each node (see
+ * `LinearSolver::Serial::shared_sparse_lu_factorization`). This is the case for
+ * subdomain operators of elements with the same mesh and geometry, e.g. on
+ * rectilinear domains. If the linear operator can identify itself, i.e. it has
+ * an `operator_signature` member function that takes the `source` followed by
+ * the `operator_args` and returns a `std::optional<std::vector<double>>`, then
+ * the signature is used to look up the factorization instead. In that case the
+ * matrix is only built on the first element of the node with that signature,
+ * which skips the most expensive part of the setup on all other elements. The
+ * `source` defines the order of the matrix rows and columns, so operators must
+ * only return the same signature for sources with the same layout.
+ *
+ * \par Advice on using this linear solver:
+ * - See the advice for `LinearSolver::Serial::ExplicitInverse`. In particular,
+ *   avoid resetting the solver when it is used as preconditioner and the
+ *   operator changes only a little.
+ * - The fill-in of the factorization grows with the number of grid points.
+ *   Monitor the memory usage for large subdomains.
+ */
+template <typename ValueType,
+          typename LinearSolverRegistrars =
+              tmpl::list<Registrars::SparseLu<ValueType>>>
+class SparseLu : public LinearSolver<LinearSolverRegistrars> {
+ private:
+  using Base = LinearSolver<LinearSolverRegistrars>;
+
+ public:
+  using options = tmpl::list<>;
+  static constexpr Options::String help =
+      "Build a sparse matrix representation of the linear operator and "
+      "factorize it with a sparse LU decomposition. Elements with identical "
+      "operators share the factorization. This means that the first solve has "
+      "a large initialization cost, but all subsequent solves converge "
+      "immediately. The setup is cheaper and needs less memory than "
+      "ExplicitInverse for sparse operators.";
+
+  SparseLu() = default;
+  SparseLu(const SparseLu& /*rhs*/) = default;
+  SparseLu& operator=(const SparseLu& /*rhs*/) = default;
+  SparseLu(SparseLu&& /*rhs*/) = default;
+  SparseLu& operator=(SparseLu&& /*rhs*/) = default;
+  ~SparseLu() = default;
+
+  /// \cond
+  explicit SparseLu(CkMigrateMessage* m) : Base(m) {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(SparseLu);  // NOLINT
+  /// \endcond
+
+  /*!
+   * \brief Solve the equation \f$Ax=b\f$ by constructing the sparse operator
+   * matrix \f$A\f$ and its LU factorization. The first solve is
+   * computationally expensive and successive solves are cheap.
+   *
+   * See `LinearSolver::Serial::ExplicitInverse::solve` for requirements on the
+   * `SourceType`.
+   */
+  template <typename LinearOperator, typename VarsType, typename SourceType,
+            typename... OperatorArgs>
+  Convergence::HasConverged solve(
+      gsl::not_null<VarsType*> solution, const LinearOperator& linear_operator,
+      const SourceType& source,
+      const std::tuple<OperatorArgs...>& operator_args = std::tuple{}) const;
+
+  /// Flags the operator to require re-initialization and releases this
+  /// solver's share of the factorization. Call this function to rebuild the
+  /// solver when the operator changed.
+  void reset() override {
+    size_ = std::numeric_limits<size_t>::max();
+    factorization_ = nullptr;
+  }
+
+  /// Size of the operator.
+  size_t size() const { return size_; }
+
+  /// The factorization of the operator. May be shared with other solvers.
+  const SparseLuFactorization<ValueType>& factorization() const {
+    return *factorization_;
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override {
+    p | size_;
+    if (size_ != std::numeric_limits<size_t>::max()) {
+      // The factorization is not shared with other solvers after
+      // deserialization
+      SparseLuFactorization<ValueType> factorization{};
+      if (not p.isUnpacking()) {
+        factorization = *factorization_;
+      }
+      p | factorization;
+      if (p.isUnpacking()) {
+        factorization_ =
+            std::make_shared<const SparseLuFactorization<ValueType>>(
+                std::move(factorization));
+        source_workspace_.resize(size_);
+        solution_workspace_.resize(size_);
+      }
+    }
+  }
+
+  std::unique_ptr<Base> get_clone() const override {
+    return std::make_unique<SparseLu>(*this);
+  }
+
+ private:
+  // Caches for successive solves of the same operator
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable size_t size_ = std::numeric_limits<size_t>::max();
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::shared_ptr<const SparseLuFactorization<ValueType>>
+      factorization_{};
+
+  // Buffers to avoid re-allocating memory for applying the operator
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable blaze::DynamicVector<ValueType> source_workspace_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable blaze::DynamicVector<ValueType> solution_workspace_{};
+};
+
+template <typename ValueType, typename LinearSolverRegistrars>
+template <typename LinearOperator, typename VarsType, typename SourceType,
+          typename... OperatorArgs>
+Convergence::HasConverged SparseLu<ValueType, LinearSolverRegistrars>::solve(
+    const gsl::not_null<VarsType*> solution,
+    const LinearOperator& linear_operator, const SourceType& source,
+    const std::tuple<OperatorArgs...>& operator_args) const {
+  if (UNLIKELY(size_ == std::numeric_limits<size_t>::max())) {
+    const auto& used_for_size = source;
+    size_ = used_for_size.size();
+    source_workspace_.resize(size_);
+    solution_workspace_.resize(size_);
+    const auto build_operator_matrix = [this, &used_for_size, &linear_operator,
+                                        &operator_args]() {
+      blaze::CompressedMatrix<ValueType, blaze::columnMajor> matrix(size_,
+                                                                    size_);
+      // Construct sparse matrix representation by "sniffing out" the
+      // operator, i.e. feeding it unit vectors
+      auto operand_buffer = make_with_value<VarsType>(used_for_size, 0.);
+      auto result_buffer = make_with_value<SourceType>(used_for_size, 0.);
+      build_matrix(make_not_null(&matrix), make_not_null(&operand_buffer),
+                   make_not_null(&result_buffer), linear_operator,
+                   operator_args);
+      return matrix;
+    };
+    std::optional<std::vector<double>> operator_signature{};
+    if constexpr (detail::is_operator_signature_callable_v<
+                      const LinearOperator&, const SourceType&,
+                      const OperatorArgs&...>) {
+      operator_signature = std::apply(
+          [&linear_operator, &used_for_size](const auto&... args) {
+            return linear_operator.operator_signature(used_for_size, args...);
+          },
+          operator_args);
+    }
+    if (operator_signature.has_value()) {
+      factorization_ = shared_sparse_lu_factorization<ValueType>(
+          std::move(*operator_signature), build_operator_matrix);
+    } else {
+      factorization_ = shared_sparse_lu_factorization(build_operator_matrix());
+    }
+  }
+  // Copy source into contiguous workspace, which the factorization overwrites
+  std::copy(source.begin(), source.end(), source_workspace_.begin());
+  factorization_->solve(make_not_null(&solution_workspace_),
+                        make_not_null(&source_workspace_));
+  // Reconstruct solution data from contiguous workspace
+  std::copy(solution_workspace_.begin(), solution_workspace_.end(),
+            solution->begin());
+  return {0, 0};
+}
+
+/// \cond
+// NOLINTBEGIN
+template <typename ValueType, typename LinearSolverRegistrars>
+PUP::able::PUP_ID SparseLu<ValueType, LinearSolverRegistrars>::my_PUP_ID = 0;
+// NOLINTEND
+/// \endcond
+
+}  // namespace LinearSolver::Serial
@@ -0,0 +1,419 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "NumericalAlgorithms/LinearSolver/SparseLuFactorization.hpp"
+
+#include <algorithm>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <boost/functional/hash.hpp>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <pup_stl.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace LinearSolver::Serial {
+
+namespace {
+constexpr size_t unset = std::numeric_limits<size_t>::max();
+
+// Reverse Cuthill-McKee ordering of the symmetrized sparsity pattern
+template <typename MatrixType>
+std::vector<size_t> reverse_cuthill_mckee(const MatrixType& matrix) {
+  const size_t size = matrix.columns();
+  std::vector<std::vector<size_t>> neighbors(size);
+  for (size_t j = 0; j < size; ++j) {
+    for (auto it = matrix.begin(j); it != matrix.end(j); ++it) {
+      const size_t i = it->index();
+      if (i != j) {
+        neighbors[i].push_back(j);
+        neighbors[j].push_back(i);
+      }
+    }
+  }
+  for (auto& node_neighbors : neighbors) {
+    std::sort(node_neighbors.begin(), node_neighbors.end());
+    node_neighbors.erase(
+        std::unique(node_neighbors.begin(), node_neighbors.end()),
+        node_neighbors.end());
+  }
+  const auto degree_is_less = [&neighbors](const size_t lhs, const size_t rhs) {
+    return neighbors[lhs].size() < neighbors[rhs].size();
+  };
+  std::vector<size_t> nodes_by_degree(size);
+  for (size_t i = 0; i < size; ++i) {
+    nodes_by_degree[i] = i;
+  }
+  std::stable_sort(nodes_by_degree.begin(), nodes_by_degree.end(),
+                   degree_is_less);
+
+  std::vector<size_t> order{};
+  order.reserve(size);
+  std::vector<bool> visited(size, false);
+  std::vector<size_t> new_neighbors{};
+  // Breadth-first search of every connected component, starting at a node of
+  // minimal degree
+  for (const size_t start : nodes_by_degree) {
+    if (visited[start]) {
+      continue;
+    }
+    visited[start] = true;
+    size_t front = order.size();
+    order.push_back(start);
+    while (front < order.size()) {
+      const size_t node = order[front];
+      ++front;
+      new_neighbors.clear();
+      for (const size_t neighbor : neighbors[node]) {
+        if (not visited[neighbor]) {
+          visited[neighbor] = true;
+          new_neighbors.push_back(neighbor);
+        }
+      }
+      std::stable_sort(new_neighbors.begin(), new_neighbors.end(),
+                       degree_is_less);
+      order.insert(order.end(), new_neighbors.begin(), new_neighbors.end());
+    }
+  }
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+template <typename MatrixType>
+size_t hash_matrix(const MatrixType& matrix) {
+  size_t hash = 0;
+  boost::hash_combine(hash, matrix.rows());
+  boost::hash_combine(hash, matrix.columns());
+  for (size_t j = 0; j < matrix.columns(); ++j) {
+    for (auto it = matrix.begin(j); it != matrix.end(j); ++it) {
+      boost::hash_combine(hash, it->index());
+      boost::hash_combine(hash, it->value());
+    }
+  }
+  return hash;
+}
+
+// Exact comparison of the entries. Blaze's `operator==` compares floating
+// point values only approximately.
+template <typename MatrixType>
+bool matrices_are_identical(const MatrixType& lhs, const MatrixType& rhs) {
+  if (lhs.rows() != rhs.rows() or lhs.columns() != rhs.columns()) {
+    return false;
+  }
+  for (size_t j = 0; j < lhs.columns(); ++j) {
+    if (lhs.nonZeros(j) != rhs.nonZeros(j)) {
+      return false;
+    }
+    for (auto lhs_it = lhs.begin(j), rhs_it = rhs.begin(j);
+         lhs_it != lhs.end(j); ++lhs_it, ++rhs_it) {
+      if (lhs_it->index() != rhs_it->index() or
+          lhs_it->value() != rhs_it->value()) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool keys_are_identical(const std::vector<double>& lhs,
+                        const std::vector<double>& rhs) {
+  return lhs == rhs;
+}
+
+template <typename MatrixType>
+bool keys_are_identical(const MatrixType& lhs, const MatrixType& rhs) {
+  return matrices_are_identical(lhs, rhs);
+}
+
+// The factorization is stored together with the key that identifies it, i.e.
+// the matrix itself or a signature of the operator
+template <typename ValueType, typename KeyType>
+struct SharedFactorization {
+  KeyType key;
+  SparseLuFactorization<ValueType> factorization;
+};
+
+template <typename ValueType, typename KeyType>
+struct FactorizationCache {
+  std::mutex mutex{};
+  std::unordered_multimap<
+      size_t, std::weak_ptr<const SharedFactorization<ValueType, KeyType>>>
+      entries{};
+};
+
+template <typename ValueType, typename KeyType>
+FactorizationCache<ValueType, KeyType>& factorization_cache() {
+  static FactorizationCache<ValueType, KeyType> cache{};
+  return cache;
+}
+
+// Find a live factorization with an identical key and drop expired entries.
+// The cache mutex must be held.
+template <typename ValueType, typename KeyType>
+std::shared_ptr<const SharedFactorization<ValueType, KeyType>> find_in_cache(
+    const gsl::not_null<FactorizationCache<ValueType, KeyType>*> cache,
+    const size_t hash, const KeyType& key) {
+  auto [it, end] = cache->entries.equal_range(hash);
+  while (it != end) {
+    auto entry = it->second.lock();
+    if (entry == nullptr) {
+      it = cache->entries.erase(it);
+      continue;
+    }
+    if (keys_are_identical(entry->key, key)) {
+      return entry;
+    }
+    ++it;
+  }
+  return nullptr;
+}
+
+// Look up the `key` in the cache, or factorize the matrix returned by
+// `build_matrix` and insert it
+template <typename ValueType, typename KeyType, typename BuildMatrix>
+std::shared_ptr<const SparseLuFactorization<ValueType>> find_or_factorize(
+    KeyType key, const size_t hash, const BuildMatrix& build_matrix) {
+  auto& cache = factorization_cache<ValueType, KeyType>();
+  {
+    const std::lock_guard lock(cache.mutex);
+    if (auto entry = find_in_cache(make_not_null(&cache), hash, key);
+        entry != nullptr) {
+      return {entry, &entry->factorization};
+    }
+  }
+  // Factorize without holding the lock so other threads can factorize
+  // different matrices concurrently
+  SparseLuFactorization<ValueType> factorization{build_matrix(key)};
+  const std::lock_guard lock(cache.mutex);
+  // Another thread may have factorized an identical operator in the meantime
+  if (auto entry = find_in_cache(make_not_null(&cache), hash, key);
+      entry != nullptr) {
+    return {entry, &entry->factorization};
+  }
+  auto entry = std::make_shared<const SharedFactorization<ValueType, KeyType>>(
+      SharedFactorization<ValueType, KeyType>{std::move(key),
+                                              std::move(factorization)});
+  cache.entries.emplace(hash, entry);
+  return {entry, &entry->factorization};
+}
+}  // namespace
+
+template <typename ValueType>
+SparseLuFactorization<ValueType>::SparseLuFactorization(
+    const matrix_type& matrix) {
+  ASSERT(matrix.rows() == matrix.columns(),
+         "Can only factorize square matrices, but the matrix has "
+             << matrix.rows() << " rows and " << matrix.columns()
+             << " columns.");
+  const size_t size = matrix.columns();
+  column_order_ = reverse_cuthill_mckee(matrix);
+  pivot_rows_.resize(size);
+  u_diagonal_.resize(size);
+  l_column_starts_.reserve(size + 1);
+  u_column_starts_.reserve(size + 1);
+  l_column_starts_.push_back(0);
+  u_column_starts_.push_back(0);
+
+  // Elimination step of every row of the original matrix, or `unset` if the
+  // row hasn't been used as pivot yet
+  std::vector<size_t> row_steps(size, unset);
+  // Dense workspace for the column that is being eliminated, and the rows in
+  // which it is nonzero
+  std::vector<ValueType> column(size, ValueType{0.});
+  std::vector<bool> is_in_pattern(size, false);
+  std::vector<size_t> pattern{};
+  for (size_t j = 0; j < size; ++j) {
+    const size_t original_column = column_order_[j];
+    for (auto it = matrix.begin(original_column);
+         it != matrix.end(original_column); ++it) {
+      column[it->index()] = it->value();
+      is_in_pattern[it->index()] = true;
+      pattern.push_back(it->index());
+    }
+    // Apply the previous elimination steps in order. This solves
+    // L[:j,:j] U[:j,j] = A[:j,j] for the column of U.
+    for (size_t k = 0; k < j; ++k) {
+      const size_t pivot_row = pivot_rows_[k];
+      if (not is_in_pattern[pivot_row] or column[pivot_row] == ValueType{0.}) {
+        continue;
+      }
+      const ValueType u_value = column[pivot_row];
+      u_row_indices_.push_back(k);
+      u_values_.push_back(u_value);
+      for (size_t l = l_column_starts_[k]; l < l_column_starts_[k + 1]; ++l) {
+        const size_t row = l_row_indices_[l];
+        if (not is_in_pattern[row]) {
+          is_in_pattern[row] = true;
+          pattern.push_back(row);
+        }
+        column[row] -= l_values_[l] * u_value;
+      }
+    }
+    u_column_starts_.push_back(u_values_.size());
+
+    // Choose the pivot among the rows that haven't been eliminated yet,
+    // preferring the diagonal to preserve the ordering
+    double max_magnitude = 0.;
+    size_t max_row = unset;
+    for (const size_t row : pattern) {
+      if (row_steps[row] == unset and std::abs(column[row]) > max_magnitude) {
+        max_magnitude = std::abs(column[row]);
+        max_row = row;
+      }
+    }
+    if (max_row == unset) {
+      ERROR("Sparse LU factorization failed because the matrix is singular. "
+            "Column "
+            << original_column << " is linearly dependent on the others.");
+    }
+    const size_t diagonal_row = original_column;
+    const size_t pivot_row =
+        (row_steps[diagonal_row] == unset and is_in_pattern[diagonal_row] and
+         std::abs(column[diagonal_row]) >= pivot_threshold * max_magnitude)
+            ? diagonal_row
+            : max_row;
+    pivot_rows_[j] = pivot_row;
+    row_steps[pivot_row] = j;
+    const ValueType pivot = column[pivot_row];
+    u_diagonal_[j] = pivot;
+    for (const size_t row : pattern) {
+      if (row_steps[row] == unset and column[row] != ValueType{0.}) {
+        l_row_indices_.push_back(row);
+        l_values_.push_back(column[row] / pivot);
+      }
+      column[row] = ValueType{0.};
+      is_in_pattern[row] = false;
+    }
+    l_column_starts_.push_back(l_values_.size());
+    pattern.clear();
+  }
+}
+
+template <typename ValueType>
+void SparseLuFactorization<ValueType>::solve(
+    const gsl::not_null<vector_type*> solution,
+    const gsl::not_null<vector_type*> source) const {
+  const size_t size = pivot_rows_.size();
+  ASSERT(source->size() == size,
+         "The source has size " << source->size()
+                                << ", but the factorized matrix has size "
+                                << size);
+  solution->resize(size);
+  // Forward substitution with L, in place of the source
+  for (size_t k = 0; k < size; ++k) {
+    const ValueType pivot_value = (*source)[pivot_rows_[k]];
+    if (pivot_value == ValueType{0.}) {
+      continue;
+    }
+    for (size_t l = l_column_starts_[k]; l < l_column_starts_[k + 1]; ++l) {
+      (*source)[l_row_indices_[l]] -= l_values_[l] * pivot_value;
+    }
+  }
+  // Back substitution with U, undoing the column ordering
+  for (size_t k = 0; k < size; ++k) {
+    (*solution)[column_order_[k]] = (*source)[pivot_rows_[k]];
+  }
+  for (size_t j = size; j-- > 0;) {
+    (*solution)[column_order_[j]] /= u_diagonal_[j];
+    const ValueType solution_j = (*solution)[column_order_[j]];
+    for (size_t u = u_column_starts_[j]; u < u_column_starts_[j + 1]; ++u) {
+      (*solution)[column_order_[u_row_indices_[u]]] -=
+          u_values_[u] * solution_j;
+    }
+  }
+}
+
+template <typename ValueType>
+void SparseLuFactorization<ValueType>::pup(PUP::er& p) {
+  p | column_order_;
+  p | pivot_rows_;
+  p | l_column_starts_;
+  p | l_row_indices_;
+  p | l_values_;
+  p | u_column_starts_;
+  p | u_row_indices_;
+  p | u_values_;
+  p | u_diagonal_;
+}
+
+template <typename ValueType>
+bool operator==(const SparseLuFactorization<ValueType>& lhs,
+                const SparseLuFactorization<ValueType>& rhs) {
+  return lhs.column_order_ == rhs.column_order_ and
+         lhs.pivot_rows_ == rhs.pivot_rows_ and
+         lhs.l_column_starts_ == rhs.l_column_starts_ and
+         lhs.l_row_indices_ == rhs.l_row_indices_ and
+         lhs.l_values_ == rhs.l_values_ and
+         lhs.u_column_starts_ == rhs.u_column_starts_ and
+         lhs.u_row_indices_ == rhs.u_row_indices_ and
+         lhs.u_values_ == rhs.u_values_ and lhs.u_diagonal_ == rhs.u_diagonal_;
+}
+
+template <typename ValueType>
+bool operator!=(const SparseLuFactorization<ValueType>& lhs,
+                const SparseLuFactorization<ValueType>& rhs) {
+  return not(lhs == rhs);
+}
+
+template <typename ValueType>
+std::shared_ptr<const SparseLuFactorization<ValueType>>
+shared_sparse_lu_factorization(
+    blaze::CompressedMatrix<ValueType, blaze::columnMajor> matrix) {
+  const size_t hash = hash_matrix(matrix);
+  return find_or_factorize<ValueType>(
+      std::move(matrix), hash,
+      [](const blaze::CompressedMatrix<ValueType, blaze::columnMajor>& key)
+          -> const blaze::CompressedMatrix<ValueType, blaze::columnMajor>& {
+        return key;
+      });
+}
+
+template <typename ValueType>
+std::shared_ptr<const SparseLuFactorization<ValueType>>
+shared_sparse_lu_factorization(
+    std::vector<double> operator_signature,
+    const std::function<
+        blaze::CompressedMatrix<ValueType, blaze::columnMajor>()>&
+        build_matrix) {
+  const size_t hash =
+      boost::hash_range(operator_signature.begin(), operator_signature.end());
+  return find_or_factorize<ValueType>(
+      std::move(operator_signature), hash,
+      [&build_matrix](const std::vector<double>& /*key*/) {
+        return build_matrix();
+      });
+}
+
+#define INSTANTIATE(TYPE)                                                    \
+  template class SparseLuFactorization<TYPE>;                                \
+  template bool operator==(const SparseLuFactorization<TYPE>& lhs,           \
+                           const SparseLuFactorization<TYPE>& rhs);          \
+  template bool operator!=(const SparseLuFactorization<TYPE>& lhs,           \
+                           const SparseLuFactorization<TYPE>& rhs);          \
+  template std::shared_ptr<const SparseLuFactorization<TYPE>>                \
+  shared_sparse_lu_factorization(                                            \
+      blaze::CompressedMatrix<TYPE, blaze::columnMajor> matrix);             \
+  template std::shared_ptr<const SparseLuFactorization<TYPE>>                \
+  shared_sparse_lu_factorization(                                            \
+      std::vector<double> operator_signature,                                \
+      const std::function<                                                   \
+          blaze::CompressedMatrix<TYPE, blaze::columnMajor>()>& build_matrix);
+
+INSTANTIATE(double)
+INSTANTIATE(std::complex<double>)
+
+#undef INSTANTIATE
+
+}  // namespace LinearSolver::Serial
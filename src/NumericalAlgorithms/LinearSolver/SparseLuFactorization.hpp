@@ -0,0 +1,132 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace LinearSolver::Serial {
+
+/*!
+ * \brief Sparse LU factorization of a square matrix
+ *
+ * The columns of the matrix are first reordered with the reverse Cuthill-McKee
+ * algorithm applied to the sparsity pattern of \f$A + A^T\f$, which reduces
+ * the fill-in of the factorization for the banded-like operators of
+ * neighboring grid points. The reordered matrix is then factorized column by
+ * column (left-looking) with threshold partial pivoting, i.e. the diagonal
+ * entry is kept as pivot unless it is smaller than `pivot_threshold` times the
+ * largest entry of the column. Only the nonzero entries of the factors \f$L\f$
+ * and \f$U\f$ are stored.
+ */
+template <typename ValueType>
+class SparseLuFactorization {
+ public:
+  using matrix_type = blaze::CompressedMatrix<ValueType, blaze::columnMajor>;
+  using vector_type = blaze::DynamicVector<ValueType>;
+
+  static constexpr double pivot_threshold = 0.1;
+
+  SparseLuFactorization() = default;
+
+  /// Factorize the square `matrix`. Fails with an `ERROR` if the matrix is
+  /// singular.
+  explicit SparseLuFactorization(const matrix_type& matrix);
+
+  size_t size() const { return pivot_rows_.size(); }
+
+  /// Number of stored entries of \f$L\f$ and \f$U\f$
+  size_t number_of_nonzeros() const {
+    return l_values_.size() + u_values_.size() + u_diagonal_.size();
+  }
+
+  /// Solve \f$Ax=b\f$. The `source` \f$b\f$ is used as workspace and is
+  /// overwritten.
+  void solve(gsl::not_null<vector_type*> solution,
+             gsl::not_null<vector_type*> source) const;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  template <typename LocalValueType>
+  friend bool operator==(const SparseLuFactorization<LocalValueType>& lhs,
+                         const SparseLuFactorization<LocalValueType>& rhs);
+
+  // Column `j` of the reordered matrix is column `column_order_[j]` of the
+  // original matrix
+  std::vector<size_t> column_order_{};
+  // Row of the original matrix that is eliminated in step `j`
+  std::vector<size_t> pivot_rows_{};
+  // Entries of L below the (unit) diagonal in compressed columns. The row
+  // indices refer to the original matrix.
+  std::vector<size_t> l_column_starts_{};
+  std::vector<size_t> l_row_indices_{};
+  std::vector<ValueType> l_values_{};
+  // Entries of U above the diagonal in compressed columns. The row indices
+  // refer to the elimination steps.
+  std::vector<size_t> u_column_starts_{};
+  std::vector<size_t> u_row_indices_{};
+  std::vector<ValueType> u_values_{};
+  std::vector<ValueType> u_diagonal_{};
+};
+
+template <typename ValueType>
+bool operator==(const SparseLuFactorization<ValueType>& lhs,
+                const SparseLuFactorization<ValueType>& rhs);
+
+template <typename ValueType>
+bool operator!=(const SparseLuFactorization<ValueType>& lhs,
+                const SparseLuFactorization<ValueType>& rhs);
+
+/*!
+ * \brief Factorize the `matrix`, or share the factorization of an identical
+ * matrix that is still in use on this node.
+ *
+ * Operators on elements with the same mesh and geometry (e.g. the elements of
+ * a regular lattice) have identical matrix representations, so their
+ * factorization only needs to be computed and stored once. Matrices are
+ * identified by a hash and an exact comparison of their entries. The
+ * factorizations are held by the returned pointers only, so a factorization is
+ * released once no element uses it anymore. This function is thread-safe.
+ */
+template <typename ValueType>
+std::shared_ptr<const SparseLuFactorization<ValueType>>
+shared_sparse_lu_factorization(
+    blaze::CompressedMatrix<ValueType, blaze::columnMajor> matrix);
+
+/*!
+ * \brief Share the factorization of an operator identified by the
+ * `operator_signature`, or factorize the matrix returned by `build_matrix`.
+ *
+ * This overload avoids building the matrix altogether when an operator with
+ * the same signature is already factorized on this node. The signature must
+ * identify the operator uniquely, e.g. by the mesh, the Jacobians and the
+ * boundary conditions of a subdomain (see
+ * `elliptic::dg::subdomain_operator::SubdomainOperator::operator_signature`).
+ * Signatures are compared exactly. The `build_matrix` function is invoked only
+ * if no factorization with the same signature is in use. This function is
+ * thread-safe.
+ */
+template <typename ValueType>
+std::shared_ptr<const SparseLuFactorization<ValueType>>
+shared_sparse_lu_factorization(
+    std::vector<double> operator_signature,
+    const std::function<
+        blaze::CompressedMatrix<ValueType, blaze::columnMajor>()>&
+        build_matrix);
+
+}  // namespace LinearSolver::Serial
@@ -5,9 +5,14 @@
 
 #include <algorithm>
 #include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <ostream>
 #include <tuple>
+#include <utility>
 
+#include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -62,13 +67,31 @@ namespace ylm {
 thread_local Spherepack_detail::MemoryPool Spherepack::memory_pool_ =
     Spherepack_detail::MemoryPool();
 
+namespace {
+// The const storage depends only on l_max and m_max, so it is shared by all
+// instances with the same resolution on this process. Entries are never
+// removed: Strahlkorpers are frequently created and destroyed (e.g. in every
+// iteration of the horizon finder), and only a handful of resolutions are in
+// use during a simulation.
+struct ConstStorageCache {
+  std::mutex mutex{};
+  std::map<std::pair<size_t, size_t>,
+           std::shared_ptr<const Spherepack_detail::ConstStorage>>
+      entries{};
+};
+
+ConstStorageCache& const_storage_cache() {
+  static ConstStorageCache cache{};
+  return cache;
+}
+}  // namespace
+
 Spherepack::Spherepack(const size_t l_max, const size_t m_max)
     : l_max_{l_max},
       m_max_{m_max},
       n_theta_{l_max_ + 1},
       n_phi_{2 * m_max_ + 1},
-      spectral_size_{2 * (l_max_ + 1) * (m_max_ + 1)},
-      storage_(l_max_, m_max_) {
+      spectral_size_{2 * (l_max_ + 1) * (m_max_ + 1)} {
   if (l_max_ < 2) {
     ERROR("Must use l_max>=2, not l_max=" << l_max_);
   }
@@ -79,10 +102,27 @@ Spherepack::Spherepack(const size_t l_max, const size_t m_max)
     ERROR("Must use m_max<=l_max, not l_max=" << l_max_
                                               << ", m_max=" << m_max_);
   }
-  calculate_collocation_points();
-  fill_scalar_work_arrays();
-  fill_vector_work_arrays();
-  calculate_interpolation_data();
+  auto& cache = const_storage_cache();
+  const std::pair key{l_max_, m_max_};
+  {
+    const std::lock_guard lock(cache.mutex);
+    if (const auto it = cache.entries.find(key); it != cache.entries.end()) {
+      storage_ = it->second;
+      return;
+    }
+  }
+  // Fill the tables without holding the lock so other threads can set up
+  // different resolutions concurrently
+  auto storage =
+      std::make_shared<Spherepack_detail::ConstStorage>(l_max_, m_max_);
+  calculate_collocation_points(storage.get());
+  fill_scalar_work_arrays(storage.get());
+  fill_vector_work_arrays(storage.get());
+  calculate_interpolation_data(storage.get());
+  const std::lock_guard lock(cache.mutex);
+  // Another thread may have filled the tables for this resolution in the
+  // meantime, in which case we use those
+  storage_ = cache.entries.try_emplace(key, std::move(storage)).first->second;
 }
 
 void Spherepack::phys_to_spec_impl(
@@ -106,7 +146,7 @@ void Spherepack::phys_to_spec_impl(
       loop_over_offset ? -1 : int(physical_offset);
   const int effective_spectral_offset =
       loop_over_offset ? -1 : int(spectral_offset);
-  const auto& work_phys_to_spec = storage_.work_phys_to_spec;
+  const auto& work_phys_to_spec = storage_->work_phys_to_spec;
   shags_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
          effective_physical_offset, effective_spectral_offset,
          static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1,
@@ -145,7 +185,7 @@ void Spherepack::spec_to_phys_impl(
   const int effective_spectral_offset =
       loop_over_offset ? -1 : int(spectral_offset);
 
-  const auto& work_scalar_spec_to_phys = storage_.work_scalar_spec_to_phys;
+  const auto& work_scalar_spec_to_phys = storage_->work_scalar_spec_to_phys;
   shsgs_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
          effective_physical_offset, effective_spectral_offset,
          static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1,
@@ -207,6 +247,91 @@ DataVector Spherepack::spec_to_phys_all_offsets(
   return result;
 }
 
+void Spherepack::phys_to_spec_batch(
+    const gsl::not_null<double*> spectral_coefs,
+    const gsl::not_null<const double*> collocation_values,
+    const size_t number_of_fields) const {
+  if (number_of_fields == 1) {
+    phys_to_spec_impl(spectral_coefs, collocation_values);
+    return;
+  }
+  // Interleave the fields so SPHEREPACK transforms all of them in a single
+  // pass, with the fields in the innermost loop
+  const size_t phys_size = physical_size();
+  auto& interleaved_values = memory_pool_.get(phys_size * number_of_fields);
+  auto& interleaved_coefs =
+      memory_pool_.get(spectral_size_ * number_of_fields);
+  // clang-tidy: 'do not use pointer arithmetic'
+  for (size_t field = 0; field < number_of_fields; ++field) {
+    for (size_t i = 0; i < phys_size; ++i) {
+      interleaved_values[field + i * number_of_fields] =
+          collocation_values.get()[i + field * phys_size];  // NOLINT
+    }
+  }
+  phys_to_spec_impl(interleaved_coefs.data(), interleaved_values.data(),
+                    number_of_fields, 0, number_of_fields, 0, true);
+  for (size_t field = 0; field < number_of_fields; ++field) {
+    for (size_t i = 0; i < spectral_size_; ++i) {
+      spectral_coefs.get()[i + field * spectral_size_] =  // NOLINT
+          interleaved_coefs[field + i * number_of_fields];
+    }
+  }
+  memory_pool_.free(interleaved_coefs);
+  memory_pool_.free(interleaved_values);
+}
+
+void Spherepack::spec_to_phys_batch(
+    const gsl::not_null<double*> collocation_values,
+    const gsl::not_null<const double*> spectral_coefs,
+    const size_t number_of_fields) const {
+  if (number_of_fields == 1) {
+    spec_to_phys_impl(collocation_values, spectral_coefs);
+    return;
+  }
+  const size_t phys_size = physical_size();
+  auto& interleaved_coefs =
+      memory_pool_.get(spectral_size_ * number_of_fields);
+  auto& interleaved_values = memory_pool_.get(phys_size * number_of_fields);
+  // clang-tidy: 'do not use pointer arithmetic'
+  for (size_t field = 0; field < number_of_fields; ++field) {
+    for (size_t i = 0; i < spectral_size_; ++i) {
+      interleaved_coefs[field + i * number_of_fields] =
+          spectral_coefs.get()[i + field * spectral_size_];  // NOLINT
+    }
+  }
+  spec_to_phys_impl(interleaved_values.data(), interleaved_coefs.data(),
+                    number_of_fields, 0, number_of_fields, 0, true);
+  for (size_t field = 0; field < number_of_fields; ++field) {
+    for (size_t i = 0; i < phys_size; ++i) {
+      collocation_values.get()[i + field * phys_size] =  // NOLINT
+          interleaved_values[field + i * number_of_fields];
+    }
+  }
+  memory_pool_.free(interleaved_values);
+  memory_pool_.free(interleaved_coefs);
+}
+
+DataVector Spherepack::phys_to_spec_batch(const DataVector& collocation_values,
+                                          const size_t number_of_fields) const {
+  ASSERT(collocation_values.size() == physical_size() * number_of_fields,
+         "Sizes don't match: " << collocation_values.size() << " vs "
+                               << physical_size() * number_of_fields);
+  DataVector result(spectral_size() * number_of_fields);
+  phys_to_spec_batch(result.data(), collocation_values.data(),
+                     number_of_fields);
+  return result;
+}
+
+DataVector Spherepack::spec_to_phys_batch(const DataVector& spectral_coefs,
+                                          const size_t number_of_fields) const {
+  ASSERT(spectral_coefs.size() == spectral_size() * number_of_fields,
+         "Sizes don't match: " << spectral_coefs.size() << " vs "
+                               << spectral_size() * number_of_fields);
+  DataVector result(physical_size() * number_of_fields);
+  spec_to_phys_batch(result.data(), spectral_coefs.data(), number_of_fields);
+  return result;
+}
+
 void Spherepack::gradient(const std::array<double*, 2>& df,
                           const gsl::not_null<const double*> collocation_values,
                           const size_t physical_stride,
@@ -257,7 +382,7 @@ void Spherepack::gradient_from_coefs_impl(
       loop_over_offset ? -1 : int(physical_offset);
   const int effective_spectral_offset =
       loop_over_offset ? -1 : int(spectral_offset);
-  const auto& work_vector_spec_to_phys = storage_.work_vector_spec_to_phys;
+  const auto& work_vector_spec_to_phys = storage_->work_vector_spec_to_phys;
   gradgs_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
           effective_physical_offset, effective_spectral_offset,
           static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1, df[0],
@@ -348,7 +473,7 @@ void Spherepack::scalar_laplacian_from_coefs(
   const size_t work_size = n_theta_ * (3 * n_phi_ + 2 * l1 + 1);
   auto& work = memory_pool_.get(work_size);
   int err = 0;
-  const auto& work_scalar_spec_to_phys = storage_.work_scalar_spec_to_phys;
+  const auto& work_scalar_spec_to_phys = storage_->work_scalar_spec_to_phys;
   slapgs_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
           static_cast<int>(physical_offset), static_cast<int>(spectral_offset),
           static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1,
@@ -405,12 +530,12 @@ void Spherepack::second_derivative(
     const std::array<double*, 2>& df, const gsl::not_null<SecondDeriv*> ddf,
     const gsl::not_null<const double*> collocation_values,
     const size_t physical_stride, const size_t physical_offset) const {
-  const auto& cos_theta = storage_.cos_theta;
-  const auto& sin_theta = storage_.sin_theta;
-  const auto& sin_phi = storage_.sin_phi;
-  const auto& cos_phi = storage_.cos_phi;
-  const auto& cot_theta = storage_.cot_theta;
-  const auto& cosec_theta = storage_.cosec_theta;
+  const auto& cos_theta = storage_->cos_theta;
+  const auto& sin_theta = storage_->sin_theta;
+  const auto& sin_phi = storage_->sin_phi;
+  const auto& cos_phi = storage_->cos_phi;
+  const auto& cot_theta = storage_->cot_theta;
+  const auto& cosec_theta = storage_->cosec_theta;
 
   // Get first derivatives
   gradient(df, collocation_values, physical_stride, physical_offset);
@@ -550,7 +675,7 @@ Spherepack::InterpolationInfo<T>::InterpolationInfo(
 template <typename T>
 Spherepack::InterpolationInfo<T> Spherepack::set_up_interpolation_info(
     const std::array<T, 2>& target_points) const {
-  return InterpolationInfo(l_max_, m_max_, storage_.work_interp_pmm,
+  return InterpolationInfo(l_max_, m_max_, storage_->work_interp_pmm,
                            target_points);
 }
 
@@ -585,9 +710,9 @@ void Spherepack::interpolate_from_coefs(
           << interpolation_info.l_max() << ") and Spherepack instance ("
           << l_max_ << ")");
   };
-  const auto& alpha = storage_.work_interp_alpha;
-  const auto& beta = storage_.work_interp_beta;
-  const auto& index = storage_.work_interp_index;
+  const auto& alpha = storage_->work_interp_alpha;
+  const auto& beta = storage_->work_interp_beta;
+  const auto& index = storage_->work_interp_index;
   // alpha holds alpha(n,m,x)/x, beta holds beta(n+1,m).
   // index holds the index into the coefficient array.
   // All are indexed together.
@@ -693,9 +818,77 @@ T Spherepack::interpolate_from_coefs(
   return result;
 }
 
-void Spherepack::calculate_collocation_points() {
+void Spherepack::interpolation_matrix(
+    const gsl::not_null<Matrix*> result,
+    const InterpolationInfo<DataVector>& interpolation_info) const {
+  if (UNLIKELY(m_max_ != interpolation_info.m_max())) {
+    ERROR("Different m_max for InterpolationInfo ("
+          << interpolation_info.m_max() << ") and Spherepack instance ("
+          << m_max_ << ")");
+  };
+  if (UNLIKELY(l_max_ != interpolation_info.l_max())) {
+    ERROR("Different l_max for InterpolationInfo ("
+          << interpolation_info.l_max() << ") and Spherepack instance ("
+          << l_max_ << ")");
+  };
+  const auto& alpha = storage_->work_interp_alpha;
+  const auto& beta = storage_->work_interp_beta;
+  const auto& index = storage_->work_interp_index;
+  // Same tables as in `interpolate_from_coefs`, which runs the Clenshaw
+  // recurrence over them. Here the recurrence is run forward instead:
+  // pbar(n+1,m) = alpha(n,m,x) pbar(n,m) + beta(n,m) pbar(n-1,m), starting
+  // from pbar(m,m) = pbar_factor[m]. For each m the tables hold n from
+  // n_theta_-1 down to m, so the entry of (n,m) is `start + n_theta_-1-n`.
+
+  const size_t num_points = interpolation_info.size();
+  const size_t l1 = m_max_ + 1;
+  const size_t b_offset = l1 * n_theta_;
+  *result = Matrix(num_points, spectral_size(), 0.0);
+
+  const auto& cos_theta = interpolation_info.cos_theta;
+  DataVector pbar_nm1(num_points);
+  DataVector pbar_n(num_points);
+  DataVector pbar_np1(num_points);
+  DataVector column{};
+  const auto set_column = [&column, &result, &num_points](const size_t j) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    column.set_data_ref(result->data() + j * result->spacing(), num_points);
+  };
+
+  size_t start = 0;
+  for (size_t m = 0; m < l1; ++m) {
+    pbar_n = interpolation_info.pbar_factor[m];
+    for (size_t n = m; n < n_theta_; ++n) {
+      const size_t idx = start + n_theta_ - 1 - n;
+      set_column(index[idx]);
+      if (m == 0) {
+        // There is no phi dependence, and there is a factor of 1/2.
+        column = 0.5 * pbar_n;
+      } else {
+        column = pbar_n * interpolation_info.cos_m_phi[m];
+        set_column(b_offset + index[idx]);
+        column = -pbar_n * interpolation_info.sin_m_phi[m];
+      }
+      if (n + 1 < n_theta_) {
+        // beta(n,m) is stored with the entry of (n-1,m), i.e. `idx + 1`.
+        pbar_np1 = cos_theta * alpha[idx] * pbar_n;
+        if (n > m) {
+          pbar_np1 += beta[idx + 1] * pbar_nm1;
+        }
+        std::swap(pbar_nm1, pbar_n);
+        std::swap(pbar_n, pbar_np1);
+      }
+    }
+    start += n_theta_ - m;
+  }
+  ASSERT(start == index.size(),
+         "Wrong size " << start << ", expected " << index.size());
+}
+
+void Spherepack::calculate_collocation_points(
+    const gsl::not_null<Spherepack_detail::ConstStorage*> storage) const {
   // Theta
-  auto& theta = storage_.theta;
+  auto& theta = storage->theta;
   DataVector temp(2 * n_theta_ + 1);
   auto work = gsl::make_span(temp.data(), n_theta_);
   auto unused_weights = gsl::make_span(temp.data() + n_theta_, n_theta_ + 1);
@@ -708,17 +901,17 @@ void Spherepack::calculate_collocation_points() {
   }
 
   // Phi
-  auto& phi = storage_.phi;
+  auto& phi = storage->phi;
   const double two_pi_over_n_phi = 2.0 * M_PI / n_phi_;
   for (size_t i = 0; i < n_phi_; ++i) {
     phi[i] = two_pi_over_n_phi * i;
   }
 
   // Other trig functions at collocation points
-  auto& cos_theta = storage_.cos_theta;
-  auto& sin_theta = storage_.sin_theta;
-  auto& cot_theta = storage_.cot_theta;
-  auto& cosec_theta = storage_.cosec_theta;
+  auto& cos_theta = storage->cos_theta;
+  auto& sin_theta = storage->sin_theta;
+  auto& cot_theta = storage->cot_theta;
+  auto& cosec_theta = storage->cosec_theta;
   for (size_t i = 0; i < n_theta_; ++i) {
     cos_theta[i] = cos(theta[i]);
     sin_theta[i] = sin(theta[i]);
@@ -726,15 +919,16 @@ void Spherepack::calculate_collocation_points() {
     cot_theta[i] = cos_theta[i] * cosec_theta[i];
   }
 
-  auto& sin_phi = storage_.sin_phi;
-  auto& cos_phi = storage_.cos_phi;
+  auto& sin_phi = storage->sin_phi;
+  auto& cos_phi = storage->cos_phi;
   for (size_t i = 0; i < n_phi_; ++i) {
     cos_phi[i] = cos(phi[i]);
     sin_phi[i] = sin(phi[i]);
   }
 }
 
-void Spherepack::calculate_interpolation_data() {
+void Spherepack::calculate_interpolation_data(
+    const gsl::not_null<Spherepack_detail::ConstStorage*> storage) const {
   // SPHEREPACK expands f(theta,phi) as
   //
   // f(theta,phi) =
@@ -772,10 +966,10 @@ void Spherepack::calculate_interpolation_data() {
   // and  Pbar(m+1)(m) is (2m+1)!! x(1-x^2)^(n/2)sqrt((2m+3)/(2(2m+1)!))
   //  Ratio Pbar(m+1)(m)/Pbar(m)(m)   = x sqrt(2m+3)
   //  Ratio Pbar(m+1)(m+1)/Pbar(m)(m) = sqrt(1-x^2) sqrt((2m+3)/(2m+2))
-  auto& alpha = storage_.work_interp_alpha;
-  auto& beta = storage_.work_interp_beta;
-  auto& pmm = storage_.work_interp_pmm;
-  auto& index = storage_.work_interp_index;
+  auto& alpha = storage->work_interp_alpha;
+  auto& beta = storage->work_interp_beta;
+  auto& pmm = storage->work_interp_pmm;
+  auto& index = storage->work_interp_index;
 
   const size_t l1 = m_max_ + 1;
 
@@ -827,10 +1021,11 @@ void Spherepack::calculate_interpolation_data() {
   }
 }
 
-void Spherepack::fill_vector_work_arrays() {
+void Spherepack::fill_vector_work_arrays(
+    const gsl::not_null<Spherepack_detail::ConstStorage*> storage) const {
   DataVector work((3 * n_theta_ * (n_theta_ + 3) + 2) / 2);
 
-  auto& work_vector_spec_to_phys = storage_.work_vector_spec_to_phys;
+  auto& work_vector_spec_to_phys = storage->work_vector_spec_to_phys;
   int err = 0;
   vhsgsi_(static_cast<int>(n_theta_), static_cast<int>(n_phi_),
           work_vector_spec_to_phys.data(),
@@ -841,7 +1036,8 @@ void Spherepack::fill_vector_work_arrays() {
   }
 }
 
-void Spherepack::fill_scalar_work_arrays() {
+void Spherepack::fill_scalar_work_arrays(
+    const gsl::not_null<Spherepack_detail::ConstStorage*> storage) const {
   // Quadrature weights
   {
     DataVector temp(3 * n_theta_ + 1);
@@ -854,7 +1050,7 @@ void Spherepack::fill_scalar_work_arrays() {
     if (UNLIKELY(err != 0)) {
       ERROR("gaqd error " << err << " in Spherepack");
     }
-    auto& quadrature_weights = storage_.quadrature_weights;
+    auto& quadrature_weights = storage->quadrature_weights;
     for (size_t i = 0; i < n_theta_; ++i) {
       for (size_t j = 0; j < n_phi_; ++j) {
         quadrature_weights[i + j * n_theta_] = (2 * M_PI / n_phi_) * weights[i];
@@ -869,7 +1065,7 @@ void Spherepack::fill_scalar_work_arrays() {
     DataVector temp(work0_size + work1_size);
     auto work0 = gsl::make_span(temp.data(), work0_size);
     auto work1 = gsl::make_span(temp.data() + work0_size, work1_size);
-    auto& work_phys_to_spec = storage_.work_phys_to_spec;
+    auto& work_phys_to_spec = storage->work_phys_to_spec;
     int err = 0;
     shagsi_(static_cast<int>(n_theta_), static_cast<int>(n_phi_),
             work_phys_to_spec.data(),
@@ -879,7 +1075,7 @@ void Spherepack::fill_scalar_work_arrays() {
     if (UNLIKELY(err != 0)) {
       ERROR("shagsi error " << err << " in Spherepack");
     }
-    auto& work_scalar_spec_to_phys = storage_.work_scalar_spec_to_phys;
+    auto& work_scalar_spec_to_phys = storage->work_scalar_spec_to_phys;
     shsgsi_(static_cast<int>(n_theta_), static_cast<int>(n_phi_),
             work_scalar_spec_to_phys.data(),
             static_cast<int>(work_scalar_spec_to_phys.size()), work0.data(),
@@ -6,6 +6,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -17,6 +18,10 @@
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
 
+/// \cond
+class Matrix;
+/// \endcond
+
 /// Items related to spherical harmonics
 namespace ylm {
 
@@ -129,6 +134,10 @@ namespace ylm {
  *
  * Spherepack stores two types of quantities:
  *   1. storage_, which is filled in the constructor and is always const.
+ *      It depends only on l_max and m_max, so it is shared by all instances
+ *      with the same resolution on a process. Constructing a Spherepack
+ *      with a resolution that was used before only looks up the storage in
+ *      a cache and doesn't recompute the tables.
  *   2. memory_pool_, which is dynamic and thread_local, and is overwritten
  *      by various member functions that need temporary storage.
  */
@@ -209,10 +218,10 @@ class Spherepack {
   /// The theta points are Gauss-Legendre in \f$\cos(\theta)\f$,
   /// so there are no points at the poles.
   SPECTRE_ALWAYS_INLINE const std::vector<double>& theta_points() const {
-    return storage_.theta;
+    return storage_->theta;
   }
   SPECTRE_ALWAYS_INLINE const std::vector<double>& phi_points() const {
-    return storage_.phi;
+    return storage_->phi;
   }
   std::array<DataVector, 2> theta_phi_points() const;
   /// @}
@@ -260,6 +269,23 @@ class Spherepack {
   };
   /// @}
 
+  /// @{
+  /// Spectral transformations of `number_of_fields` scalar fields that are
+  /// stored one after another, e.g. the components of a tensor. The fields
+  /// are transformed in a single pass over the Legendre functions, which is
+  /// faster than transforming each field separately.
+  void phys_to_spec_batch(gsl::not_null<double*> spectral_coefs,
+                          gsl::not_null<const double*> collocation_values,
+                          size_t number_of_fields) const;
+  void spec_to_phys_batch(gsl::not_null<double*> collocation_values,
+                          gsl::not_null<const double*> spectral_coefs,
+                          size_t number_of_fields) const;
+  DataVector phys_to_spec_batch(const DataVector& collocation_values,
+                                size_t number_of_fields) const;
+  DataVector spec_to_phys_batch(const DataVector& spectral_coefs,
+                                size_t number_of_fields) const;
+  /// @}
+
   /// @{
   /// Simpler, less general interfaces to `phys_to_spec` and `spec_to_phys`.
   /// Acts on a slice of the input and returns a unit-stride result.
@@ -396,7 +422,7 @@ class Spherepack {
       gsl::not_null<const double*> collocation_values,
       size_t physical_stride = 1, size_t physical_offset = 0) const {
     // clang-tidy: 'do not use pointer arithmetic'
-    return ddot_(n_theta_ * n_phi_, storage_.quadrature_weights.data(), 1,
+    return ddot_(n_theta_ * n_phi_, storage_->quadrature_weights.data(), 1,
                  collocation_values.get() + physical_offset,  // NOLINT
                  physical_stride);
   }
@@ -405,7 +431,7 @@ class Spherepack {
   /// is the definite integral, where \f$c_i\f$ are collocation values
   /// at point i.
   SPECTRE_ALWAYS_INLINE const std::vector<double>& integration_weights() const {
-    return storage_.quadrature_weights;
+    return storage_->quadrature_weights;
   }
 
   /// Adds a constant (i.e. \f$f(\theta,\phi)\f$ += \f$c\f$) to the function
@@ -456,6 +482,18 @@ class Spherepack {
                               size_t spectral_stride = 1,
                               size_t spectral_offset = 0) const;
 
+  /// The matrix that interpolates spectral coefficients onto the points
+  /// that have been passed into the `set_up_interpolation_info` function.
+  /// It has one row per point and one column per entry of the spectral
+  /// coefficient buffer, so `interpolate_from_coefs` is the product of this
+  /// matrix with the coefficients. Columns of buffer entries that don't hold
+  /// a coefficient are zero. The columns are filled with the associated
+  /// Legendre functions from a forward recurrence, so the cost is the same
+  /// as a single call to `interpolate_from_coefs`.
+  void interpolation_matrix(
+      gsl::not_null<Matrix*> result,
+      const InterpolationInfo<DataVector>& interpolation_info) const;
+
   /// Simpler interface to `interpolate`.  If you need to call this
   /// repeatedly on different `spectral_coefs` or `collocation_values`
   /// for the same target points, this is inefficient; instead use
@@ -500,10 +538,14 @@ class Spherepack {
                                 size_t physical_stride = 1,
                                 size_t physical_offset = 0,
                                 bool loop_over_offset = false) const;
-  void calculate_collocation_points();
-  void calculate_interpolation_data();
-  void fill_scalar_work_arrays();
-  void fill_vector_work_arrays();
+  void calculate_collocation_points(
+      gsl::not_null<Spherepack_detail::ConstStorage*> storage) const;
+  void calculate_interpolation_data(
+      gsl::not_null<Spherepack_detail::ConstStorage*> storage) const;
+  void fill_scalar_work_arrays(
+      gsl::not_null<Spherepack_detail::ConstStorage*> storage) const;
+  void fill_vector_work_arrays(
+      gsl::not_null<Spherepack_detail::ConstStorage*> storage) const;
   size_t l_max_, m_max_, n_theta_, n_phi_;
   size_t spectral_size_;
   // memory_pool_ will be shared by multiple instances of
@@ -515,7 +557,7 @@ class Spherepack {
   // safe to resize objects in memory_pool_ or to overwrite them with
   // arbitrary data.
   static thread_local Spherepack_detail::MemoryPool memory_pool_;
-  Spherepack_detail::ConstStorage storage_;
+  std::shared_ptr<const Spherepack_detail::ConstStorage> storage_;
 };  // class Spherepack
 
 bool operator==(const Spherepack& lhs, const Spherepack& rhs);
@@ -0,0 +1,80 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/ArrayCollection/RebalanceElementCollection.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace Parallel::Actions {
+namespace detail {
+// Returns the measured cost of every element in the collection and restarts
+// measuring them.
+template <size_t Dim, typename ElementCollection>
+std::unordered_map<ElementId<Dim>, double> collect_element_costs(
+    const gsl::not_null<ElementCollection*> element_collection) {
+  std::unordered_map<ElementId<Dim>, double> element_costs{};
+  for (auto& [element_id, element] : *element_collection) {
+    const std::lock_guard element_lock(element.element_lock());
+    element_costs.emplace(element_id, element.measured_cost());
+    element.reset_measured_cost();
+  }
+  return element_costs;
+}
+}  // namespace detail
+
+/*!
+ * \brief Collects the measured cost of every element on the node and reduces
+ * them over the nodegroup to start rebalancing the `DgElementCollection`.
+ *
+ * This is the action the `DgElementCollection` runs in the
+ * `Parallel::Phase::LoadBalancing` phase. Charm++ load balancing cannot move
+ * the elements of a nodegroup, so the collection redistributes them itself.
+ * The measured cost of each element (see
+ * `Parallel::DgElementArrayMemberBase::measured_cost()`) is reset, so the
+ * next rebalance uses the cost measured since this one. The target of the
+ * reduction is `Parallel::Actions::RebalanceElementCollection`.
+ */
+template <size_t Dim>
+struct ContributeElementCosts {
+  template <typename DbTagsList, typename... InboxTags, typename ArrayIndex,
+            typename ActionList, typename ParallelComponent,
+            typename Metavariables>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    std::unordered_map<ElementId<Dim>, double> element_costs{};
+    db::mutate<typename ParallelComponent::element_collection_tag>(
+        [&element_costs](const auto element_collection_ptr) {
+          element_costs =
+              detail::collect_element_costs<Dim>(element_collection_ptr);
+        },
+        make_not_null(&box));
+
+    auto& my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
+    Parallel::contribute_to_reduction<RebalanceElementCollection>(
+        Parallel::ReductionData<
+            Parallel::ReductionDatum<std::unordered_map<ElementId<Dim>, double>,
+                                     funcl::Merge<>>>{std::move(element_costs)},
+        my_proxy[Parallel::my_node<size_t>(cache)], my_proxy);
+    return {Parallel::AlgorithmExecution::Halt, std::nullopt};
+  }
+};
+}  // namespace Parallel::Actions
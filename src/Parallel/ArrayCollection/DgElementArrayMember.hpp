@@ -4,6 +4,7 @@
 #pragma once
 
 #include <charm++.h>
+#include <chrono>
 #include <cstddef>
 #include <exception>
 #include <pup.h>
@@ -281,6 +282,7 @@ void DgElementArrayMember<Dim, Metavariables,
         this->halt_algorithm_until_next_phase_) {
       return;
     }
+    const auto start_time = std::chrono::steady_clock::now();
     const auto invoke_for_phase = [this](auto phase_dep_v) {
       using PhaseDep = decltype(phase_dep_v);
       constexpr Parallel::Phase phase = PhaseDep::phase;
@@ -308,6 +310,9 @@ void DgElementArrayMember<Dim, Metavariables,
     // waiting on data to be sent or because the algorithm has been marked as
     // terminated.
     EXPAND_PACK_LEFT_TO_RIGHT(invoke_for_phase(PhaseDepActionListsPack{}));
+    this->measured_cost_ += std::chrono::duration<double>(
+                                std::chrono::steady_clock::now() - start_time)
+                                .count();
   } catch (const std::exception& exception) {
     initiate_shutdown(exception);
   }
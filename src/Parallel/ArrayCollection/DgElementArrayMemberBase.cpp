@@ -102,6 +102,16 @@ size_t DgElementArrayMemberBase<Dim>::get_core() const {
   return my_core_;
 }
 
+template <size_t Dim>
+double DgElementArrayMemberBase<Dim>::measured_cost() const {
+  return measured_cost_;
+}
+
+template <size_t Dim>
+void DgElementArrayMemberBase<Dim>::reset_measured_cost() {
+  measured_cost_ = 0.0;
+}
+
 template <size_t Dim>
 void DgElementArrayMemberBase<Dim>::pup(PUP::er& p) {
   PUP::able::pup(p);
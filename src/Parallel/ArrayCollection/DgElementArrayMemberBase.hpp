@@ -105,6 +105,17 @@ class DgElementArrayMemberBase : PUP::able {
   /// \brief Get which core this element should pretend to be bound to.
   size_t get_core() const;
 
+  /// \brief The wall time in seconds spent in `perform_algorithm()` since the
+  /// last call to `reset_measured_cost()`.
+  ///
+  /// `Parallel::Actions::RebalanceElementCollection` uses this to distribute
+  /// the elements according to their actual cost. The measured cost is not
+  /// serialized.
+  double measured_cost() const;
+
+  /// \brief Restart measuring the cost of the element.
+  void reset_measured_cost();
+
   /// Returns the name of the last "next iterable action" to be run before a
   /// deadlock occurred.
   const std::string& deadlock_analysis_next_iterable_action() const {
@@ -131,6 +142,7 @@ class DgElementArrayMemberBase : PUP::able {
   std::string deadlock_analysis_next_iterable_action_{};
   ElementId<Dim> element_id_;
   size_t my_node_{std::numeric_limits<size_t>::max()};
+  double measured_cost_{0.0};
   // There is no associated core. However, we use this as a method of
   // interoperating with core-aware concepts like the interpolation
   // framework. Once that framework is core-agnostic we will remove my_core_.
@@ -7,6 +7,7 @@
 #include <memory>
 
 #include "Parallel/Algorithms/AlgorithmNodegroupDeclarations.hpp"
+#include "Parallel/ArrayCollection/ContributeElementCosts.hpp"
 #include "Parallel/ArrayCollection/CreateElementCollection.hpp"
 #include "Parallel/ArrayCollection/DgElementArrayMember.hpp"
 #include "Parallel/ArrayCollection/DgElementArrayMemberBase.hpp"
@@ -27,6 +28,11 @@ namespace Parallel {
  * The `PhaseDepActionList` is the PDAL that was used for the array
  * approach. Some actions will require updating to support nodegroups if they
  * haven't already been.
+ *
+ * Charm++ cannot migrate the elements inside a nodegroup, so in the
+ * `Parallel::Phase::LoadBalancing` phase the collection redistributes its
+ * elements itself, using the wall time each element spent executing actions
+ * since the last rebalance. See `Parallel::Actions::ContributeElementCosts`.
  */
 template <size_t Dim, class Metavariables, class PhaseDepActionList>
 struct DgElementCollection {
@@ -54,7 +60,9 @@ struct DgElementCollection {
   ///
   /// These are computed using
   /// `Parallel::TransformPhaseDependentActionListForNodegroup` from the
-  /// `PhaseDepActionList` template parameter.
+  /// `PhaseDepActionList` template parameter. If the `PhaseDepActionList` has
+  /// a `Parallel::Phase::LoadBalancing` phase, its actions are replaced by
+  /// `Parallel::Actions::ContributeElementCosts`.
   using phase_dependent_action_list = tmpl::append<
       tmpl::list<Parallel::PhaseActions<
           Parallel::Phase::Initialization,
@@ -62,7 +70,7 @@ struct DgElementCollection {
                                                       PhaseDepActionList,
                                                       simple_tags_from_options>,
                      Parallel::Actions::TerminatePhase>>>,
-      TransformPhaseDependentActionListForNodegroup<PhaseDepActionList>>;
+      TransformPhaseDependentActionListForNodegroup<Dim, PhaseDepActionList>>;
 
   /// @{
   /// \brief The tags for the global cache.
@@ -0,0 +1,110 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Parallel/ArrayCollection/ReceiveMigratedElement.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
+#include "Parallel/ArrayCollection/Tags/NumberOfElementsTerminated.hpp"
+#include "Parallel/ElementRegistration.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+
+namespace Parallel::Actions {
+namespace detail {
+// Invoked on an element with `DgElementArrayMember::simple_action` before it
+// leaves the node.
+struct DeregisterMigratingElement {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& array_index) {
+    Parallel::deregister_element<ParallelComponent>(box, cache, array_index);
+  }
+};
+}  // namespace detail
+
+/*!
+ * \brief Reduction target of `Parallel::Actions::ContributeElementCosts` that
+ * redistributes the elements of the `DgElementCollection` according to their
+ * measured costs.
+ *
+ * Every node receives the costs of all elements and computes the same new
+ * distribution with `domain::z_curve_proc_distribution()`. Elements assigned
+ * to another node are deregistered, serialized, removed from the collection
+ * and sent to their new node with
+ * `Parallel::Actions::ReceiveMigratedElement`. Elements that stay on the node
+ * are assigned their new core. Finally the `Parallel::Tags::ElementLocations`
+ * are updated.
+ *
+ * This runs in the `Parallel::Phase::LoadBalancing` phase, when all elements
+ * have terminated and no messages between elements are in flight.
+ */
+struct RebalanceElementCollection {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex, size_t Dim>
+  static void apply(
+      db::DataBox<DbTagsList>& box, Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/,
+      const std::unordered_map<ElementId<Dim>, double>& element_costs) {
+    const size_t my_node = Parallel::my_node<size_t>(cache);
+    const std::unordered_map<ElementId<Dim>, size_t> new_procs =
+        domain::z_curve_proc_distribution(
+            element_costs, Parallel::number_of_procs<size_t>(cache));
+    std::unordered_map<ElementId<Dim>, size_t> new_locations{};
+    for (const auto& [element_id, proc] : new_procs) {
+      new_locations.emplace(element_id, Parallel::node_of<size_t>(proc, cache));
+    }
+
+    auto& my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
+    const gsl::not_null<Parallel::NodeLock*> node_lock =
+        make_not_null(&Parallel::local_branch(my_proxy)->get_node_lock());
+    const std::lock_guard node_guard(*node_lock);
+    db::mutate<typename ParallelComponent::element_collection_tag,
+               Tags::ElementLocations<Dim>, Tags::NumberOfElementsTerminated>(
+        [&my_node, &my_proxy, &new_locations, &new_procs](
+            const auto element_collection_ptr,
+            const gsl::not_null<std::unordered_map<ElementId<Dim>, size_t>*>
+                element_locations,
+            const gsl::not_null<size_t*> number_of_elements_terminated) {
+          for (auto it = element_collection_ptr->begin();
+               it != element_collection_ptr->end();) {
+            auto& [element_id, element] = *it;
+            const size_t new_node = new_locations.at(element_id);
+            if (new_node == my_node) {
+              element.set_core(new_procs.at(element_id));
+              ++it;
+              continue;
+            }
+            ASSERT(element.get_terminate(),
+                   "Element " << element_id
+                              << " must be terminated to migrate it.");
+            element
+                .template simple_action<detail::DeregisterMigratingElement>();
+            Parallel::threaded_action<ReceiveMigratedElement>(
+                my_proxy[new_node], element_id, new_procs.at(element_id),
+                serialize(element));
+            --(*number_of_elements_terminated);
+            it = element_collection_ptr->erase(it);
+          }
+          *element_locations = std::move(new_locations);
+        },
+        make_not_null(&box));
+  }
+};
+}  // namespace Parallel::Actions
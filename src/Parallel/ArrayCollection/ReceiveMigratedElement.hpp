@@ -0,0 +1,88 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Parallel/ArrayCollection/Tags/NumberOfElementsTerminated.hpp"
+#include "Parallel/ElementRegistration.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+
+namespace Parallel::Actions {
+namespace detail {
+// Invoked on an element with `DgElementArrayMember::simple_action` after it
+// arrived on its new node.
+struct RegisterMigratedElement {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& array_index) {
+    Parallel::register_element<ParallelComponent>(box, cache, array_index);
+  }
+};
+}  // namespace detail
+
+/*!
+ * \brief Inserts an element that was moved from another node by
+ * `Parallel::Actions::RebalanceElementCollection` into the
+ * `DgElementCollection` on this node.
+ *
+ * The element is deserialized, assigned to `core` and registered again (see
+ * `Parallel::register_element`). Migrated elements are always terminated, so
+ * `Parallel::Tags::NumberOfElementsTerminated` is incremented.
+ */
+struct ReceiveMigratedElement {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex, size_t Dim,
+            typename DistributedObject>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock,
+                    const DistributedObject* /*distributed_object*/,
+                    const ElementId<Dim>& element_id, const size_t core,
+                    const std::vector<char>& serialized_element) {
+    using Element =
+        typename ParallelComponent::element_collection_tag::type::mapped_type;
+    const std::lock_guard node_guard(*node_lock);
+    db::mutate<typename ParallelComponent::element_collection_tag,
+               Tags::NumberOfElementsTerminated>(
+        [&cache, &core, &element_id, &serialized_element](
+            const auto element_collection_ptr,
+            const gsl::not_null<size_t*> number_of_elements_terminated) {
+          const auto [it, inserted] = element_collection_ptr->emplace(
+              std::piecewise_construct, std::forward_as_tuple(element_id),
+              std::forward_as_tuple(
+                  deserialize<Element>(serialized_element.data())));
+          if (not inserted) {
+            ERROR("Element " << element_id << " migrated to node "
+                             << Parallel::my_node<size_t>(cache)
+                             << " is already on that node.");
+          }
+          auto& element = it->second;
+          if (not element.get_terminate()) {
+            ERROR("Element " << element_id
+                             << " was migrated without being terminated. This "
+                                "is a bug.");
+          }
+          ++(*number_of_elements_terminated);
+          element.set_core(core);
+          element.template simple_action<detail::RegisterMigratedElement>();
+        },
+        make_not_null(&box));
+  }
+};
+}  // namespace Parallel::Actions
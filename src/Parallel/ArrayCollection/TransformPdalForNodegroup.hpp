@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <cstddef>
+
+#include "Parallel/ArrayCollection/ContributeElementCosts.hpp"
 #include "Parallel/ArrayCollection/StartPhaseOnNodegroup.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
@@ -10,20 +13,28 @@
 
 namespace Parallel {
 namespace detail {
-template <typename OnePhaseActions>
+template <typename OnePhaseActions, typename Dim>
 struct TransformPdalForNodegroup {
+  // The elements don't run any actions during load balancing. Instead, the
+  // nodegroup redistributes them according to their measured cost.
   using type = tmpl::conditional_t<
       OnePhaseActions::phase == Parallel::Phase::Initialization, tmpl::list<>,
-      Parallel::PhaseActions<OnePhaseActions::phase,
-                             tmpl::list<Actions::StartPhaseOnNodegroup>>>;
+      tmpl::conditional_t<
+          OnePhaseActions::phase == Parallel::Phase::LoadBalancing,
+          Parallel::PhaseActions<
+              Parallel::Phase::LoadBalancing,
+              tmpl::list<Actions::ContributeElementCosts<Dim::value>>>,
+          Parallel::PhaseActions<OnePhaseActions::phase,
+                                 tmpl::list<Actions::StartPhaseOnNodegroup>>>>;
 };
 }  // namespace detail
 
 /// \brief Transforms the `PhaseDepActionList` (phase dependent action
 /// list/PDAL) from one used for a `evolution::DgElementArray` to that for
 /// `Parallel::DgElementCollection`
-template <typename PhaseDepActionList>
+template <size_t Dim, typename PhaseDepActionList>
 using TransformPhaseDependentActionListForNodegroup =
-    tmpl::flatten<tmpl::transform<PhaseDepActionList,
-                                  detail::TransformPdalForNodegroup<tmpl::_1>>>;
+    tmpl::flatten<tmpl::transform<
+        PhaseDepActionList,
+        detail::TransformPdalForNodegroup<tmpl::_1, tmpl::size_t<Dim>>>>;
 }  // namespace Parallel
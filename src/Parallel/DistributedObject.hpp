@@ -682,9 +682,13 @@ void DistributedObject<
   p | array_index_;
   p | global_cache_proxy_;
   if constexpr (Parallel::is_dg_element_collection_v<ParallelComponent>) {
+    // Charm++ doesn't migrate nodegroups. The collection moves its elements
+    // between nodes itself (see Parallel::Actions::ContributeElementCosts), so
+    // we only get here if something tries to checkpoint during that phase.
     if (phase_ == Parallel::Phase::LoadBalancing) {
       ERROR(
-          "Can't do load balacing phase with DG element collection right now.");
+          "Can't serialize a DG element collection during the load balancing "
+          "phase because its elements may be migrating between nodes.");
     }
   } else {
     // Note that `perform_registration_or_deregistration` passes the `box_` by
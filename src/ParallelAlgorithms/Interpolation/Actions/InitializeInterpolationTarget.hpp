@@ -57,6 +57,7 @@ CREATE_IS_CALLABLE_V(initialize)
 ///     `Tags::CurrentTemporalId<TemporalId>` if target is sequential
 ///   - `Tags::CompletedTemporalIds<TemporalId>`
 ///   - `Tags::InterpolatedVars<InterpolationTargetTag,TemporalId>`
+///   - `Tags::PreviousBlockLogicalCoords<VolumeDim>`
 ///   - `::Tags::Variables<typename
 ///                   InterpolationTargetTag::vars_to_interpolate_to_target>`
 /// - Removes: nothing
@@ -77,6 +78,7 @@ struct InitializeInterpolationTarget {
                           Tags::TemporalIds<TemporalId>>,
       Tags::CompletedTemporalIds<TemporalId>,
       Tags::InterpolatedVars<InterpolationTargetTag, TemporalId>,
+      Tags::PreviousBlockLogicalCoords<Metavariables::volume_dim>,
       ::Tags::Variables<
           typename InterpolationTargetTag::vars_to_interpolate_to_target>>;
 
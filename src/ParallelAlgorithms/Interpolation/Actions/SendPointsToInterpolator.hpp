@@ -43,6 +43,7 @@ namespace Actions {
 /// - Adds: nothing
 /// - Removes: nothing
 /// - Modifies:
+///   - `Tags::PreviousBlockLogicalCoords`
 ///   - `Tags::IndicesOfFilledInterpPoints`
 ///   - `Tags::IndicesOfInvalidInterpPoints`
 ///   - `Tags::InterpolatedVars<InterpolationTargetTag, TemporalId>`
@@ -58,7 +59,7 @@ struct SendPointsToInterpolator {
                     const TemporalId& temporal_id,
                     const size_t iteration = 0_st) {
     auto coords = InterpolationTarget_detail::block_logical_coords<
-        InterpolationTargetTag>(box, cache, temporal_id);
+        InterpolationTargetTag>(make_not_null(&box), cache, temporal_id);
     InterpolationTarget_detail::set_up_interpolation<InterpolationTargetTag>(
         make_not_null(&box), temporal_id, coords);
 
@@ -116,10 +116,12 @@ void interpolate_data(
               }
             }
 
-            // Now interpolate.
+            // Now interpolate. The interpolant is used only once, so don't
+            // build the dense interpolation matrix.
             const auto& element_coord_holder = element_coord_pair.second;
             intrp::Irregular<Metavariables::volume_dim> interpolator(
-                volume_info.mesh, element_coord_holder.element_logical_coords);
+                volume_info.mesh, element_coord_holder.element_logical_coords,
+                intrp::IrregularMode::MatrixFree);
             // This first branch is used if compute_vars_to_interpolate exists
             // or if the vars_to_interpolate_to_target is a subset of the
             // interpolator_source_vars.
@@ -63,6 +63,8 @@ template <typename TemporalId>
 struct CurrentTemporalId;
 template <typename TemporalId>
 struct TemporalIds;
+template <size_t VolumeDim>
+struct PreviousBlockLogicalCoords;
 }  // namespace Tags
 namespace TargetPoints {
 template <typename InterpolationTargetTag, typename Frame>
@@ -521,6 +523,9 @@ void add_received_variables(
 /// and one Action indirectly calls this version of block_logical_coords:
 /// - SendPointsToInterpolator (called by AddTemporalIdsToInterpolationTarget
 ///                             and by FindApparentHorizon)
+///
+/// If `previous_block_logical_coords` holds the result for the same number of
+/// points, each point is first looked up in the block it was in before.
 template <typename InterpolationTargetTag, typename Metavariables,
           typename TemporalId>
 auto block_logical_coords(
@@ -528,7 +533,9 @@ auto block_logical_coords(
     const tnsr::I<
         DataVector, Metavariables::volume_dim,
         typename InterpolationTargetTag::compute_target_points::frame>& coords,
-    const TemporalId& temporal_id) {
+    const TemporalId& temporal_id,
+    const std::vector<BlockLogicalCoords<Metavariables::volume_dim>>&
+        previous_block_logical_coords = {}) {
   const auto& domain =
       get<domain::Tags::Domain<Metavariables::volume_dim>>(cache);
   if constexpr (std::is_same_v<typename InterpolationTargetTag::
@@ -536,7 +543,8 @@ auto block_logical_coords(
                                ::Frame::Grid>) {
     // Frame is grid frame, so don't need any FunctionsOfTime,
     // whether or not the maps are time_dependent.
-    return ::block_logical_coordinates(domain, coords);
+    return ::block_logical_coordinates(domain, coords,
+                                       previous_block_logical_coords);
   }
 
   if (domain.is_time_dependent()) {
@@ -547,7 +555,7 @@ auto block_logical_coords(
       // that functions_of_time are up to date at temporal_id.
       const auto& functions_of_time = get<domain::Tags::FunctionsOfTime>(cache);
       return ::block_logical_coordinates(
-          domain, coords,
+          domain, coords, previous_block_logical_coords,
           InterpolationTarget_detail::get_temporal_id_value(temporal_id),
           functions_of_time);
     } else {
@@ -567,7 +575,8 @@ auto block_logical_coords(
   }
 
   // Time-independent case.
-  return ::block_logical_coordinates(domain, coords);
+  return ::block_logical_coordinates(domain, coords,
+                                     previous_block_logical_coords);
 }
 
 /// Version of block_logical_coords that computes the interpolation
@@ -577,10 +586,6 @@ auto block_logical_coords(
 ///
 /// This version of block_logical_coordinates is called when there
 /// is an Interpolator ParallelComponent.
-///
-/// Currently one Action directly calls this version of block_logical_coords:
-/// - SendPointsToInterpolator (called by AddTemporalIdsToInterpolationTarget
-///                             and by FindApparentHorizon)
 template <typename InterpolationTargetTag, typename DbTags,
           typename Metavariables, typename TemporalId>
 auto block_logical_coords(const db::DataBox<DbTags>& box,
@@ -593,6 +598,37 @@ auto block_logical_coords(const db::DataBox<DbTags>& box,
       temporal_id);
 }
 
+/// Version of block_logical_coords that also keeps the result in
+/// `Tags::PreviousBlockLogicalCoords`. The next call starts each point's
+/// search from the block it was found in, which is much faster for targets
+/// that send nearly the same points every time, like the iterations of an
+/// apparent horizon finder or a fixed sphere.
+///
+/// Currently one Action directly calls this version of block_logical_coords:
+/// - SendPointsToInterpolator (called by AddTemporalIdsToInterpolationTarget
+///                             and by FindApparentHorizon)
+template <typename InterpolationTargetTag, typename DbTags,
+          typename Metavariables, typename TemporalId>
+auto block_logical_coords(const gsl::not_null<db::DataBox<DbTags>*> box,
+                          const Parallel::GlobalCache<Metavariables>& cache,
+                          const TemporalId& temporal_id) {
+  using previous_tag =
+      Tags::PreviousBlockLogicalCoords<Metavariables::volume_dim>;
+  auto result = block_logical_coords<InterpolationTargetTag>(
+      cache,
+      InterpolationTargetTag::compute_target_points::points(
+          *box, tmpl::type_<Metavariables>{}, temporal_id),
+      temporal_id, db::get<previous_tag>(*box));
+  db::mutate<previous_tag>(
+      [&result](const gsl::not_null<
+                std::vector<BlockLogicalCoords<Metavariables::volume_dim>>*>
+                    previous_block_logical_coords) {
+        *previous_block_logical_coords = result;
+      },
+      box);
+  return result;
+}
+
 /// Version of block_logical_coords for when the coords are
 /// time-independent.
 template <typename InterpolationTargetTag, typename DbTags,
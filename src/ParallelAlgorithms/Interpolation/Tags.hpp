@@ -10,10 +10,12 @@
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Domain/BlockLogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolatedVars.hpp"
@@ -120,6 +122,16 @@ struct CompletedTemporalIds : db::SimpleTag {
   using type = std::deque<TemporalId>;
 };
 
+/// The block logical coordinates an InterpolationTarget computed the last time
+/// it sent its points to the Interpolator.
+///
+/// Targets often send nearly the same points every time, so the block each
+/// point was found in is tried first the next time.
+template <size_t VolumeDim>
+struct PreviousBlockLogicalCoords : db::SimpleTag {
+  using type = std::vector<BlockLogicalCoords<VolumeDim>>;
+};
+
 /// Holds interpolated variables on an InterpolationTarget.
 template <typename InterpolationTargetTag, typename TemporalId>
 struct InterpolatedVars : db::SimpleTag {
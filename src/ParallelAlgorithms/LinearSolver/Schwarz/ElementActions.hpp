@@ -36,6 +36,7 @@
 #include "NumericalAlgorithms/DiscontinuousGalerkin/HasReceivedFromAllMortars.hpp"
 #include "NumericalAlgorithms/LinearSolver/ExplicitInverse.hpp"
 #include "NumericalAlgorithms/LinearSolver/Gmres.hpp"
+#include "NumericalAlgorithms/LinearSolver/SparseLu.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
@@ -189,6 +190,8 @@ template <typename FieldsTag, typename SubdomainOperator,
 using subdomain_solver = LinearSolver::Serial::LinearSolver<tmpl::append<
     tmpl::list<::LinearSolver::Serial::Registrars::Gmres<SubdomainData>,
                ::LinearSolver::Serial::Registrars::ExplicitInverse<
+                   typename SubdomainData::value_type>,
+               ::LinearSolver::Serial::Registrars::SparseLu<
                    typename SubdomainData::value_type>>,
     SubdomainPreconditioners>>;
 
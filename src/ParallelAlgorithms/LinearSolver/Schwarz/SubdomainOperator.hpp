@@ -41,6 +41,15 @@ namespace LinearSolver::Schwarz {
  * Schwarz algorithm: all subdomain solves are independent of each other (see
  * `LinearSolver::Schwarz::Schwarz` for details).
  *
+ * A subdomain operator can optionally implement this member function template:
+ * - `operator_signature`: Takes the element's DataBox and returns a
+ *   `std::optional<std::vector<double>>` that identifies the operator on this
+ *   subdomain. Subdomains with equal signatures must have the same operator,
+ *   so subdomain solvers can share their setup between elements on the same
+ *   node (see `LinearSolver::Serial::SparseLu`). Return `std::nullopt` if the
+ *   operator can't be identified cheaply, e.g. because it depends on
+ *   background fields.
+ *
  * Here's an example of a subdomain operator that is the restriction of an
  * explicit global matrix:
  *
@@ -346,14 +346,12 @@ Tabulated3D<IsRelativistic>::pressure_from_density_and_temperature_impl(
     get(pressure) = std::exp(interpolated_state[0]);
 
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < get(electron_fraction).size(); ++s) {
-      auto weights = interpolator_.get_weights(
-          get(log_temperature)[s], get(log_rest_mass_density)[s],
-          get(converted_electron_fraction)[s]);
-      auto interpolated_state =
-          interpolator_.template interpolate<Pressure>(weights);
-      get(pressure)[s] = std::exp(interpolated_state[0]);
-    }
+    interpolator_.template interpolate_points<Pressure>(
+        {{get(pressure).data()}},
+        {{get(log_temperature).data(), get(log_rest_mass_density).data(),
+          get(converted_electron_fraction).data()}},
+        get(pressure).size());
+    get(pressure) = exp(get(pressure));
   }
 
   return pressure;
@@ -525,15 +523,13 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
     get(specific_internal_energy) =
         std::exp(interpolated_state[0]) + energy_shift_;
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < get(electron_fraction).size(); ++s) {
-      auto weights = interpolator_.get_weights(
-          get(log_temperature)[s], get(log_rest_mass_density)[s],
-          get(converted_electron_fraction)[s]);
-      auto interpolated_state =
-          interpolator_.template interpolate<Epsilon>(weights);
-      get(specific_internal_energy)[s] =
-          std::exp(interpolated_state[0]) + energy_shift_;
-    }
+    interpolator_.template interpolate_points<Epsilon>(
+        {{get(specific_internal_energy).data()}},
+        {{get(log_temperature).data(), get(log_rest_mass_density).data(),
+          get(converted_electron_fraction).data()}},
+        get(specific_internal_energy).size());
+    get(specific_internal_energy) =
+        exp(get(specific_internal_energy)) + energy_shift_;
   }
 
   return specific_internal_energy;
@@ -567,19 +563,51 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
     get(cs2) = interpolated_state[0];
 
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < get(electron_fraction).size(); ++s) {
-      auto weights = interpolator_.get_weights(
-          get(log_temperature)[s], get(log_rest_mass_density)[s],
-          get(converted_electron_fraction)[s]);
-      auto interpolated_state =
-          interpolator_.template interpolate<CsSquared>(weights);
-      get(cs2)[s] = interpolated_state[0];
-    }
+    interpolator_.template interpolate_points<CsSquared>(
+        {{get(cs2).data()}},
+        {{get(log_temperature).data(), get(log_rest_mass_density).data(),
+          get(converted_electron_fraction).data()}},
+        get(cs2).size());
   }
 
   return cs2;
 }
 
+template <bool IsRelativistic>
+void Tabulated3D<IsRelativistic>::
+    thermodynamic_state_from_density_and_temperature(
+        const gsl::not_null<Scalar<DataVector>*> pressure,
+        const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+        const gsl::not_null<Scalar<DataVector>*> sound_speed_squared,
+        const Scalar<DataVector>& rest_mass_density,
+        const Scalar<DataVector>& temperature,
+        const Scalar<DataVector>& electron_fraction) const {
+  const size_t number_of_points = get(rest_mass_density).size();
+  get(*pressure).destructive_resize(number_of_points);
+  get(*specific_internal_energy).destructive_resize(number_of_points);
+  get(*sound_speed_squared).destructive_resize(number_of_points);
+
+  Scalar<DataVector> converted_electron_fraction;
+  Scalar<DataVector> log_rest_mass_density;
+  Scalar<DataVector> log_temperature;
+
+  convert_to_table_quantities(
+      make_not_null(&converted_electron_fraction),
+      make_not_null(&log_rest_mass_density), make_not_null(&log_temperature),
+      electron_fraction, rest_mass_density, temperature);
+
+  interpolator_.template interpolate_points<Pressure, Epsilon, CsSquared>(
+      {{get(*pressure).data(), get(*specific_internal_energy).data(),
+        get(*sound_speed_squared).data()}},
+      {{get(log_temperature).data(), get(log_rest_mass_density).data(),
+        get(converted_electron_fraction).data()}},
+      number_of_points);
+
+  get(*pressure) = exp(get(*pressure));
+  get(*specific_internal_energy) =
+      exp(get(*specific_internal_energy)) + energy_shift_;
+}
+
 template <bool IsRelativistic>
 double Tabulated3D<IsRelativistic>::specific_internal_energy_lower_bound(
     const double rest_mass_density, const double electron_fraction) const {
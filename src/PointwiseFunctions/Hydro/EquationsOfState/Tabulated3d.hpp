@@ -113,6 +113,22 @@ class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
     get(*log_temperature) = log(get(*log_temperature));
   }
 
+  /*!
+   * \brief Computes the pressure, specific internal energy and sound speed
+   * squared at all points from a single pass over the table.
+   *
+   * \details The interpolation weights of each point are computed once and
+   * shared by all three quantities, which are read together from the table
+   * nodes. This is faster than calling the three individual functions.
+   */
+  void thermodynamic_state_from_density_and_temperature(
+      gsl::not_null<Scalar<DataVector>*> pressure,
+      gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+      gsl::not_null<Scalar<DataVector>*> sound_speed_squared,
+      const Scalar<DataVector>& rest_mass_density,
+      const Scalar<DataVector>& temperature,
+      const Scalar<DataVector>& electron_fraction) const;
+
   std::unique_ptr<EquationOfState<IsRelativistic, 3>> get_clone()
       const override;
 
@@ -19,6 +19,10 @@ AdaptiveSteppingDiagnostics& AdaptiveSteppingDiagnostics::operator+=(
   number_of_steps += other.number_of_steps;
   number_of_step_fraction_changes += other.number_of_step_fraction_changes;
   number_of_step_rejections += other.number_of_step_rejections;
+  number_of_lts_coefficient_cache_hits +=
+      other.number_of_lts_coefficient_cache_hits;
+  number_of_lts_coefficient_cache_misses +=
+      other.number_of_lts_coefficient_cache_misses;
   return *this;
 }
 
@@ -28,6 +32,8 @@ void AdaptiveSteppingDiagnostics::pup(PUP::er& p) {
   p | number_of_steps;
   p | number_of_step_fraction_changes;
   p | number_of_step_rejections;
+  p | number_of_lts_coefficient_cache_hits;
+  p | number_of_lts_coefficient_cache_misses;
 }
 
 bool operator==(const AdaptiveSteppingDiagnostics& a,
@@ -37,7 +43,11 @@ bool operator==(const AdaptiveSteppingDiagnostics& a,
          a.number_of_steps == b.number_of_steps and
          a.number_of_step_fraction_changes ==
              b.number_of_step_fraction_changes and
-         a.number_of_step_rejections == b.number_of_step_rejections;
+         a.number_of_step_rejections == b.number_of_step_rejections and
+         a.number_of_lts_coefficient_cache_hits ==
+             b.number_of_lts_coefficient_cache_hits and
+         a.number_of_lts_coefficient_cache_misses ==
+             b.number_of_lts_coefficient_cache_misses;
 }
 
 bool operator!=(const AdaptiveSteppingDiagnostics& a,
@@ -4,18 +4,24 @@
 #include "Time/TimeSteppers/AdamsLts.hpp"
 
 #include <algorithm>
+#include <array>
+#include <boost/container_hash/hash.hpp>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <limits>
+#include <optional>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/MathWrapper.hpp"
 #include "NumericalAlgorithms/Interpolation/LagrangePolynomial.hpp"
 #include "Time/ApproximateTime.hpp"
 #include "Time/BoundaryHistory.hpp"
 #include "Time/EvolutionOrdering.hpp"
+#include "Time/Slab.hpp"
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Time/TimeSteppers/AdamsCoefficients.hpp"
@@ -24,6 +30,7 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Rational.hpp"
 
 namespace TimeSteppers::adams_lts {
 Time exact_substep_time(const TimeStepId& id) {
@@ -320,19 +327,13 @@ LtsCoefficients lts_coefficients_for_gts(
   }
   return lts_coefficients;
 }
-}  // namespace
 
 template <typename TimeType>
-LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
-                                 const ConstBoundaryHistoryTimes& remote_times,
-                                 const Time& start_time,
-                                 const TimeType& end_time,
-                                 const AdamsScheme& local_scheme,
-                                 const AdamsScheme& remote_scheme,
-                                 const AdamsScheme& small_step_scheme) {
-  if (start_time == end_time) {
-    return {};
-  }
+LtsCoefficients compute_lts_coefficients(
+    const ConstBoundaryHistoryTimes& local_times,
+    const ConstBoundaryHistoryTimes& remote_times, const Time& start_time,
+    const TimeType& end_time, const AdamsScheme& local_scheme,
+    const AdamsScheme& remote_scheme, const AdamsScheme& small_step_scheme) {
   const evolution_less<Time> time_less{local_times.front().time_runs_forward()};
 
   LtsCoefficients step_coefficients{};
@@ -441,6 +442,239 @@ LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
   return step_coefficients;
 }
 
+// A set of coefficients with the ids replaced by their positions in
+// the histories and the coefficients divided by the step size.
+struct CachedCoefficient {
+  std::pair<size_t, size_t> local_step_and_substep;
+  std::pair<size_t, size_t> remote_step_and_substep;
+  double coefficient;
+};
+
+struct CachedPattern {
+  // Empty for unused entries
+  std::vector<std::int64_t> key{};
+  size_t hash = 0;
+  std::vector<CachedCoefficient> coefficients{};
+};
+
+struct PatternCache {
+  // Enough for the patterns of all mortars of a few elements with
+  // different step ratios and orders
+  std::array<CachedPattern, 64> patterns{};
+  size_t next = 0;
+  std::vector<std::int64_t> key_buffer{};
+  std::vector<std::pair<Slab, std::int64_t>> slab_buffer{};
+  LtsCoefficientsCacheStatistics statistics{};
+};
+
+PatternCache& thread_local_pattern_cache() {
+  thread_local PatternCache cache{};
+  return cache;
+}
+
+// The coefficients depend only on the times relative to the step, so
+// the times are keyed by their slab relative to the first local step
+// and their exact fraction of that slab.  This describes the times
+// relative to the step only if all the slabs have the same duration,
+// so patterns spanning a change of the slab size are not cached.
+class PatternSlabs {
+ public:
+  PatternSlabs(
+      const gsl::not_null<std::vector<std::pair<Slab, std::int64_t>>*> slabs,
+      const TimeStepId& reference_id)
+      : slabs_(slabs), reference_slab_number_(reference_id.slab_number()) {
+    slabs_->clear();
+    slabs_->emplace_back(reference_id.step_time().slab(), 0);
+  }
+
+  // The number of the slab of the id relative to the reference slab,
+  // or nullopt if its duration differs from that of the reference
+  // slab.
+  std::optional<std::int64_t> insert(const TimeStepId& id) {
+    const Slab& slab = id.step_time().slab();
+    const std::int64_t relative_number =
+        id.slab_number() - reference_slab_number_;
+    if (find(slab).has_value()) {
+      return relative_number;
+    }
+    const double reference_duration =
+        slabs_->front().first.duration().value();
+    if (std::abs(slab.duration().value() - reference_duration) >
+        100.0 * std::numeric_limits<double>::epsilon() *
+            std::abs(reference_duration)) {
+      return std::nullopt;
+    }
+    slabs_->emplace_back(slab, relative_number);
+    return relative_number;
+  }
+
+  // The number of a slab of the histories relative to the reference
+  // slab, or nullopt if the slab is not in the histories.
+  std::optional<std::int64_t> find(const Slab& slab) const {
+    for (const auto& [known_slab, relative_number] : *slabs_) {
+      if (known_slab == slab) {
+        return relative_number;
+      }
+    }
+    return std::nullopt;
+  }
+
+ private:
+  gsl::not_null<std::vector<std::pair<Slab, std::int64_t>>*> slabs_;
+  std::int64_t reference_slab_number_;
+};
+
+void append_fraction_to_key(const gsl::not_null<std::vector<std::int64_t>*> key,
+                            const Rational& fraction) {
+  key->push_back(fraction.numerator());
+  key->push_back(fraction.denominator());
+}
+
+bool append_times_to_key(const gsl::not_null<std::vector<std::int64_t>*> key,
+                         const gsl::not_null<PatternSlabs*> slabs,
+                         const ConstBoundaryHistoryTimes& times) {
+  key->push_back(static_cast<std::int64_t>(times.size()));
+  for (size_t step = 0; step < times.size(); ++step) {
+    const TimeStepId& id = times[step];
+    const std::optional<std::int64_t> slab_number = slabs->insert(id);
+    if (not slab_number.has_value()) {
+      return false;
+    }
+    key->push_back(*slab_number);
+    append_fraction_to_key(key, id.step_time().fraction());
+    const size_t number_of_substeps = times.number_of_substeps(step);
+    key->push_back(static_cast<std::int64_t>(number_of_substeps));
+    for (size_t substep = 1; substep < number_of_substeps; ++substep) {
+      append_fraction_to_key(
+          key, exact_substep_time(times[{step, substep}]).fraction());
+    }
+  }
+  return true;
+}
+
+bool append_time_to_key(const gsl::not_null<std::vector<std::int64_t>*> key,
+                        const PatternSlabs& slabs, const Time& time) {
+  const std::optional<std::int64_t> slab_number = slabs.find(time.slab());
+  if (not slab_number.has_value()) {
+    return false;
+  }
+  key->push_back(*slab_number);
+  append_fraction_to_key(key, time.fraction());
+  return true;
+}
+
+void append_scheme_to_key(const gsl::not_null<std::vector<std::int64_t>*> key,
+                          const AdamsScheme& scheme) {
+  key->push_back(static_cast<std::int64_t>(scheme.type));
+  key->push_back(static_cast<std::int64_t>(scheme.order));
+}
+
+std::pair<size_t, size_t> step_and_substep(
+    const ConstBoundaryHistoryTimes& times, const TimeStepId& id) {
+  for (size_t step = 0; step < times.size(); ++step) {
+    for (size_t substep = 0; substep < times.number_of_substeps(step);
+         ++substep) {
+      if (times[{step, substep}] == id) {
+        return {step, substep};
+      }
+    }
+  }
+  ERROR("Coefficient for " << id << " not found in the history.");
+}
+
+LtsCoefficients cached_lts_coefficients(
+    const ConstBoundaryHistoryTimes& local_times,
+    const ConstBoundaryHistoryTimes& remote_times, const Time& start_time,
+    const Time& end_time, const AdamsScheme& local_scheme,
+    const AdamsScheme& remote_scheme, const AdamsScheme& small_step_scheme) {
+  PatternCache& cache = thread_local_pattern_cache();
+  const double step_size = end_time.value() - start_time.value();
+
+  // The coefficients are determined by the ids in the histories
+  // relative to the step, so they are the key together with the
+  // schemes.
+  std::vector<std::int64_t>& key = cache.key_buffer;
+  key.clear();
+  PatternSlabs slabs(make_not_null(&cache.slab_buffer), local_times.front());
+  key.push_back(local_times.front().time_runs_forward() ? 1 : 0);
+  const bool cacheable =
+      append_times_to_key(make_not_null(&key), make_not_null(&slabs),
+                          local_times) and
+      append_times_to_key(make_not_null(&key), make_not_null(&slabs),
+                          remote_times) and
+      append_time_to_key(make_not_null(&key), slabs, start_time) and
+      append_time_to_key(make_not_null(&key), slabs, end_time);
+  if (not cacheable) {
+    ++cache.statistics.misses;
+    return compute_lts_coefficients(local_times, remote_times, start_time,
+                                    end_time, local_scheme, remote_scheme,
+                                    small_step_scheme);
+  }
+  append_scheme_to_key(make_not_null(&key), local_scheme);
+  append_scheme_to_key(make_not_null(&key), remote_scheme);
+  append_scheme_to_key(make_not_null(&key), small_step_scheme);
+  const size_t hash = boost::hash_range(key.begin(), key.end());
+
+  for (const CachedPattern& pattern : cache.patterns) {
+    if (pattern.hash == hash and pattern.key == key) {
+      ++cache.statistics.hits;
+      // The ids are ordered the same way as those the pattern was
+      // computed from, so the result is still sorted.
+      LtsCoefficients coefficients{};
+      for (const CachedCoefficient& entry : pattern.coefficients) {
+        coefficients.emplace_back(local_times[entry.local_step_and_substep],
+                                  remote_times[entry.remote_step_and_substep],
+                                  entry.coefficient * step_size);
+      }
+      return coefficients;
+    }
+  }
+
+  ++cache.statistics.misses;
+  LtsCoefficients coefficients = compute_lts_coefficients(
+      local_times, remote_times, start_time, end_time, local_scheme,
+      remote_scheme, small_step_scheme);
+  CachedPattern& pattern = cache.patterns[cache.next];
+  cache.next = (cache.next + 1) % cache.patterns.size();
+  pattern.key = key;
+  pattern.hash = hash;
+  pattern.coefficients.clear();
+  for (const auto& entry : coefficients) {
+    pattern.coefficients.push_back(
+        {step_and_substep(local_times, get<0>(entry)),
+         step_and_substep(remote_times, get<1>(entry)),
+         get<2>(entry) / step_size});
+  }
+  return coefficients;
+}
+}  // namespace
+
+template <typename TimeType>
+LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
+                                 const ConstBoundaryHistoryTimes& remote_times,
+                                 const Time& start_time,
+                                 const TimeType& end_time,
+                                 const AdamsScheme& local_scheme,
+                                 const AdamsScheme& remote_scheme,
+                                 const AdamsScheme& small_step_scheme) {
+  if (start_time == end_time) {
+    return {};
+  }
+  if constexpr (std::is_same_v<TimeType, Time>) {
+    return cached_lts_coefficients(local_times, remote_times, start_time,
+                                   end_time, local_scheme, remote_scheme,
+                                   small_step_scheme);
+  } else {
+    return compute_lts_coefficients(local_times, remote_times, start_time,
+                                    end_time, local_scheme, remote_scheme,
+                                    small_step_scheme);
+  }
+}
+
+const LtsCoefficientsCacheStatistics& lts_coefficients_cache_statistics() {
+  return thread_local_pattern_cache().statistics;
+}
+
 #define MATH_WRAPPER_TYPE(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATE(_, data)                          \
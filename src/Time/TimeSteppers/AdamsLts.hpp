@@ -5,6 +5,7 @@
 
 #include <boost/container/small_vector.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <tuple>
 
 #include "Time/TimeStepId.hpp"
@@ -114,6 +115,17 @@ bool operator!=(const AdamsScheme& a, const AdamsScheme& b);
  * times.  Any additional terms can be generated by a second call
  * treating the remainder of the step as non-dense.
  *
+ * For steps aligned with the control times, the coefficients are
+ * cached per thread.  The coefficients only depend on the pattern of
+ * the step times relative to the step being taken, and are
+ * proportional to the step size, so in steady local time-stepping
+ * with fixed step ratios the same pattern recurs every few steps.  The
+ * cache is keyed by the exact slab fractions of the step times of
+ * both histories and of \p start_time and \p end_time, by their
+ * slabs relative to the first local step, and by the schemes.  Steps
+ * whose histories span slabs of different durations and dense output
+ * are not cached.  See `lts_coefficients_cache_statistics`.
+ *
  * \tparam TimeType The type `Time` for a step aligned with the
  * control times or `ApproximateTime` for dense output.
  */
@@ -125,4 +137,16 @@ LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
                                  const AdamsScheme& local_scheme,
                                  const AdamsScheme& remote_scheme,
                                  const AdamsScheme& small_step_scheme);
+
+/// Number of (non-dense) `lts_coefficients` calls that reused or
+/// computed coefficients
+struct LtsCoefficientsCacheStatistics {
+  std::uint64_t hits = 0;
+  std::uint64_t misses = 0;
+};
+
+/// The statistics of the `lts_coefficients` cache of the calling
+/// thread since the thread started.  Take the difference of two calls
+/// to attribute the cache use to some work.
+const LtsCoefficientsCacheStatistics& lts_coefficients_cache_statistics();
 }  // namespace TimeSteppers::adams_lts
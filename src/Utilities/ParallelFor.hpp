@@ -0,0 +1,70 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines function parallel_for
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+/*!
+ * \ingroup UtilitiesGroup
+ * \brief Call `function(i)` for every `i` in `[0, size)` using up to
+ * `number_of_threads` threads.
+ *
+ * \details The range is split into contiguous blocks, one per thread. The
+ * calling thread handles the first block and `number_of_threads - 1` additional
+ * `std::thread`s handle the others. All of them are joined before returning.
+ * With `number_of_threads <= 1` (or `size <= 1`) everything runs on the calling
+ * thread and no thread is started. If calls to `function` throw, the first
+ * exception is rethrown on the calling thread once all threads have finished.
+ *
+ * `function` must be safe to call concurrently for different `i`.
+ *
+ * \warning The threads are not known to Charm++. Code that runs inside an
+ * action should take `number_of_threads` from an option, so that a run does not
+ * start more threads than a node has cores to spare.
+ */
+template <typename Function>
+void parallel_for(const size_t size, const size_t number_of_threads,
+                  const Function& function) {
+  const size_t num_threads =
+      std::clamp(number_of_threads, size_t{1}, std::max(size, size_t{1}));
+  if (num_threads == 1) {
+    for (size_t i = 0; i < size; ++i) {
+      function(i);
+    }
+    return;
+  }
+  std::vector<std::exception_ptr> exceptions(num_threads);
+  const auto run_range = [&function, &exceptions, &size,
+                          &num_threads](const size_t thread_index) {
+    try {
+      for (size_t i = thread_index * size / num_threads;
+           i < (thread_index + 1) * size / num_threads; ++i) {
+        function(i);
+      }
+    } catch (...) {
+      exceptions[thread_index] = std::current_exception();
+    }
+  };
+  std::vector<std::thread> threads{};
+  threads.reserve(num_threads - 1);
+  for (size_t thread_index = 1; thread_index < num_threads; ++thread_index) {
+    threads.emplace_back(run_range, thread_index);
+  }
+  run_range(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& exception : exceptions) {
+    if (exception != nullptr) {
+      std::rethrow_exception(exception);
+    }
+  }
+}
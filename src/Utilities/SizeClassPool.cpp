@@ -0,0 +1,193 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Utilities/SizeClassPool.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <new>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace size_class_pool {
+namespace {
+// Every block starts with a header that records its size class. The header
+// is a full cache line so that the returned memory keeps the alignment of the
+// underlying allocation.
+constexpr size_t alignment = 64;
+constexpr size_t header_bytes = alignment;
+constexpr size_t min_class_bytes = 64;
+constexpr size_t log2_min_class_bytes = 6;
+constexpr size_t classes_per_power_of_two = 4;
+constexpr size_t unpooled_class = std::numeric_limits<size_t>::max();
+
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+struct Header {
+  size_t size_class;
+};
+
+void* system_allocate(const size_t total_bytes) {
+  return ::operator new(total_bytes, std::align_val_t{alignment});
+}
+
+void system_deallocate(void* const block) {
+  ::operator delete(block, std::align_val_t{alignment});
+}
+
+// Containers with static or thread storage duration may release memory after
+// the calling thread's cache has been destroyed, in which case we fall back to
+// the system allocator.
+thread_local bool thread_cache_is_alive = true;
+
+class ThreadCache {
+ public:
+  static constexpr size_t number_of_classes =
+      1 +
+      (static_cast<size_t>(std::bit_width(max_pooled_bytes - 1)) - 1 -
+       log2_min_class_bytes) *
+          classes_per_power_of_two +
+      classes_per_power_of_two;
+
+  ThreadCache() = default;
+  ThreadCache(const ThreadCache&) = delete;
+  ThreadCache& operator=(const ThreadCache&) = delete;
+  ThreadCache(ThreadCache&&) = delete;
+  ThreadCache& operator=(ThreadCache&&) = delete;
+  ~ThreadCache() {
+    release();
+    thread_cache_is_alive = false;
+  }
+
+  void* allocate(const size_t bytes) {
+    ++statistics_.number_of_allocations;
+    if (bytes > max_pooled_bytes) {
+      return finish(system_allocate(header_bytes + bytes), unpooled_class);
+    }
+    const size_t size_class = detail::size_class(bytes);
+    if (FreeBlock* const block = gsl::at(free_lists_, size_class);
+        block != nullptr) {
+      gsl::at(free_lists_, size_class) = block->next;
+      statistics_.cached_bytes -= detail::size_class_bytes(size_class);
+      ++statistics_.number_of_cache_hits;
+      return finish(block, size_class);
+    }
+    return finish(
+        system_allocate(header_bytes + detail::size_class_bytes(size_class)),
+        size_class);
+  }
+
+  void deallocate(void* const block, const size_t size_class) {
+    if (size_class == unpooled_class or
+        statistics_.cached_bytes + detail::size_class_bytes(size_class) >
+            max_cached_bytes_per_thread) {
+      system_deallocate(block);
+      return;
+    }
+    auto* const free_block = static_cast<FreeBlock*>(block);
+    free_block->next = gsl::at(free_lists_, size_class);
+    gsl::at(free_lists_, size_class) = free_block;
+    statistics_.cached_bytes += detail::size_class_bytes(size_class);
+  }
+
+  void release() {
+    for (auto& free_list : free_lists_) {
+      while (free_list != nullptr) {
+        FreeBlock* const next = free_list->next;
+        system_deallocate(free_list);
+        free_list = next;
+      }
+    }
+    statistics_.cached_bytes = 0;
+  }
+
+  const Statistics& statistics() const { return statistics_; }
+
+  void reset_statistics() {
+    statistics_.number_of_allocations = 0;
+    statistics_.number_of_cache_hits = 0;
+  }
+
+ private:
+  static void* finish(void* const block, const size_t size_class) {
+    static_cast<Header*>(block)->size_class = size_class;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return static_cast<char*>(block) + header_bytes;
+  }
+
+  std::array<FreeBlock*, number_of_classes> free_lists_{};
+  Statistics statistics_{};
+};
+
+ThreadCache& thread_cache() {
+  thread_local ThreadCache cache{};
+  return cache;
+}
+}  // namespace
+
+namespace detail {
+size_t size_class(const size_t bytes) {
+  if (bytes <= min_class_bytes) {
+    return 0;
+  }
+  // 2^power < bytes <= 2^(power+1), split into classes_per_power_of_two
+  // equally spaced classes.
+  const size_t power = static_cast<size_t>(std::bit_width(bytes - 1)) - 1;
+  const size_t step = (1_st << power) / classes_per_power_of_two;
+  const size_t sub_class = (bytes - 1 - (1_st << power)) / step;
+  return 1 + (power - log2_min_class_bytes) * classes_per_power_of_two +
+         sub_class;
+}
+
+size_t size_class_bytes(const size_t size_class) {
+  if (size_class == 0) {
+    return min_class_bytes;
+  }
+  const size_t power =
+      (size_class - 1) / classes_per_power_of_two + log2_min_class_bytes;
+  const size_t sub_class = (size_class - 1) % classes_per_power_of_two;
+  return (1_st << power) +
+         (sub_class + 1) * ((1_st << power) / classes_per_power_of_two);
+}
+}  // namespace detail
+
+void* allocate(const size_t bytes) {
+  if (UNLIKELY(not thread_cache_is_alive)) {
+    void* const block = system_allocate(header_bytes + bytes);
+    static_cast<Header*>(block)->size_class = unpooled_class;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return static_cast<char*>(block) + header_bytes;
+  }
+  return thread_cache().allocate(bytes);
+}
+
+void deallocate(void* const pointer) {
+  if (pointer == nullptr) {
+    return;
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  void* const block = static_cast<char*>(pointer) - header_bytes;
+  const size_t size_class = static_cast<const Header*>(block)->size_class;
+  ASSERT(size_class == unpooled_class or
+             size_class < ThreadCache::number_of_classes,
+         "Corrupted size class " << size_class
+                                 << " when returning memory to the pool.");
+  if (UNLIKELY(not thread_cache_is_alive)) {
+    system_deallocate(block);
+    return;
+  }
+  thread_cache().deallocate(block, size_class);
+}
+
+void release_thread_cache() { thread_cache().release(); }
+
+const Statistics& thread_statistics() { return thread_cache().statistics(); }
+
+void reset_thread_statistics() { thread_cache().reset_statistics(); }
+}  // namespace size_class_pool
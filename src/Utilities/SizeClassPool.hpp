@@ -0,0 +1,110 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include "Utilities/MemoryHelpers.hpp"
+
+/*!
+ * \brief A thread-local, size-class based cache of heap allocations.
+ *
+ * \details Large numeric containers such as `DataVector` and `Variables` are
+ * constructed and destroyed many times per element per time step with the same
+ * handful of sizes. Blocks released through this pool are kept on per-thread
+ * free lists bucketed by size class, and subsequent requests of a similar size
+ * are served from those lists without calling into the system allocator.
+ *
+ * Size classes are spaced by a quarter of a power of two, so at most 25% of a
+ * block is wasted. Requests larger than `max_pooled_bytes` bypass the cache,
+ * and each thread keeps at most `max_cached_bytes_per_thread` of idle memory.
+ * Blocks may be freed on a different thread than the one that allocated them;
+ * they are then cached by the freeing thread.
+ *
+ * Whether `VectorImpl` and `Variables` allocate through the pool is controlled
+ * at compile time by the `SPECTRE_POOLED_ALLOCATION` CMake option, which
+ * selects the type of `size_class_pool::owning_array`.
+ */
+namespace size_class_pool {
+/// Requests above this size go directly to the system allocator.
+constexpr size_t max_pooled_bytes = 32 * 1024 * 1024;
+/// The maximum amount of idle memory cached by a single thread.
+constexpr size_t max_cached_bytes_per_thread = 512 * 1024 * 1024;
+
+/// Allocate at least `bytes` bytes, aligned to 64 bytes.
+void* allocate(size_t bytes);
+
+/// Return memory obtained from `allocate` to the calling thread's cache.
+void deallocate(void* pointer);
+
+/// Free all memory cached by the calling thread.
+void release_thread_cache();
+
+/// Allocation counters for the calling thread.
+struct Statistics {
+  /// Calls to `allocate`.
+  size_t number_of_allocations{0};
+  /// Calls to `allocate` that were served from the cache.
+  size_t number_of_cache_hits{0};
+  /// Bytes currently held in the cache.
+  size_t cached_bytes{0};
+};
+
+/// The allocation counters for the calling thread.
+const Statistics& thread_statistics();
+
+/// Reset the counters (but not `cached_bytes`) for the calling thread.
+void reset_thread_statistics();
+
+namespace detail {
+/// The index of the size class for a request of `bytes` bytes.
+size_t size_class(size_t bytes);
+/// The number of bytes in blocks of the size class `size_class`.
+size_t size_class_bytes(size_t size_class);
+}  // namespace detail
+
+/// Deleter for arrays allocated by `make_unique_array_for_overwrite`.
+template <typename T>
+struct ArrayDeleter {
+  void operator()(T* const pointer) const { deallocate(pointer); }
+};
+
+template <typename T>
+// NOLINTNEXTLINE(modernize-avoid-c-arrays)
+using unique_array = std::unique_ptr<T[], ArrayDeleter<T>>;
+
+/// Allocate an uninitialized array of `size` `T`s from the pool.
+template <typename T>
+unique_array<T> make_unique_array_for_overwrite(const size_t size) {
+  static_assert(std::is_trivially_destructible_v<T>,
+                "Only trivially destructible types can be allocated from the "
+                "pool.");
+  T* const pointer = static_cast<T*>(allocate(size * sizeof(T)));
+  std::uninitialized_default_construct_n(pointer, size);
+  return unique_array<T>(pointer);
+}
+
+/// The owning array type used by `VectorImpl` and `Variables`.
+#ifdef SPECTRE_POOLED_ALLOCATION
+template <typename T>
+using owning_array = unique_array<T>;
+#else
+template <typename T>
+// NOLINTNEXTLINE(modernize-avoid-c-arrays)
+using owning_array = std::unique_ptr<T[]>;
+#endif
+
+/// Allocate an uninitialized `owning_array`.
+template <typename T>
+owning_array<T> make_owning_array_for_overwrite(const size_t size) {
+#ifdef SPECTRE_POOLED_ALLOCATION
+  return make_unique_array_for_overwrite<T>(size);
+#else
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  return cpp20::make_unique_for_overwrite<T[]>(size);
+#endif
+}
+}  // namespace size_class_pool
@@ -3,12 +3,15 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cmath>
+#include <cstddef>
 #include <type_traits>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Expressions/Evaluate.hpp"
 #include "DataStructures/Tensor/Expressions/TensorIndex.hpp"
 #include "DataStructures/Tensor/IndexType.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "Helpers/DataStructures/Tensor/Expressions/EvaluateRank0.hpp"
 #include "Helpers/DataStructures/Tensor/Expressions/EvaluateRank1.hpp"
 #include "Helpers/DataStructures/Tensor/Expressions/EvaluateRank2.hpp"
@@ -32,11 +35,119 @@ void test_contains_indices_to_contract() {
   test_contains_indices_to_contract_impl<ti::j, ti::c, ti::J, ti::A, ti::a>(
       true);
 }
+
+template <typename TensorType>
+void fill_with_values(const gsl::not_null<TensorType*> tensor,
+                      const size_t num_points, const double seed) {
+  for (size_t i = 0; i < tensor->size(); ++i) {
+    (*tensor)[i] = DataVector(num_points);
+    for (size_t p = 0; p < num_points; ++p) {
+      (*tensor)[i][p] = std::sin(seed + 0.1 * static_cast<double>(p) +
+                                 static_cast<double>(i));
+    }
+  }
+}
+
+template <typename TensorType>
+auto tensor_at_point(const TensorType& tensor, const size_t p) {
+  Tensor<double, typename TensorType::symmetry, typename TensorType::index_list>
+      result{};
+  for (size_t i = 0; i < tensor.size(); ++i) {
+    result[i] = tensor[i][p];
+  }
+  return result;
+}
+
+// Check that expressions over more than one tile of grid points give the same
+// result as evaluating them pointwise
+void test_tiled_evaluation() {
+  const size_t num_points = 2 * tenex::evaluate_tile_size + 37;
+  tnsr::ab<DataVector, 3> R{};
+  tnsr::A<DataVector, 3> S{};
+  tnsr::a<DataVector, 3> G{};
+  Scalar<DataVector> T{};
+  fill_with_values(make_not_null(&R), num_points, 0.1);
+  fill_with_values(make_not_null(&S), num_points, 0.2);
+  fill_with_values(make_not_null(&G), num_points, 0.3);
+  fill_with_values(make_not_null(&T), num_points, 0.4);
+  get(T) += 2.;
+
+  // This expression is large enough to be split into subtrees
+  tnsr::a<DataVector, 3> L_split{};
+  tenex::evaluate<ti::a>(make_not_null(&L_split),
+                         R(ti::a, ti::b) * S(ti::B) + 3. * T() * G(ti::a) -
+                             sqrt(T()) * G(ti::a) / T());
+  // This expression is evaluated as a whole
+  tnsr::a<DataVector, 3> L_whole{};
+  tenex::evaluate<ti::a>(make_not_null(&L_whole),
+                         2. * G(ti::a) - T() * G(ti::a));
+  // The LHS tensor is used in the RHS expression
+  tnsr::a<DataVector, 3> L_update = G;
+  tenex::update<ti::a>(make_not_null(&L_update),
+                       T() * L_update(ti::a) + R(ti::b, ti::a) * S(ti::B));
+
+  CHECK(get<0>(L_split).size() == num_points);
+  CHECK(get<0>(L_whole).size() == num_points);
+  for (size_t p = 0; p < num_points; ++p) {
+    const auto R_p = tensor_at_point(R, p);
+    const auto S_p = tensor_at_point(S, p);
+    const auto G_p = tensor_at_point(G, p);
+    const auto T_p = tensor_at_point(T, p);
+    const auto expected_split = tenex::evaluate<ti::a>(
+        R_p(ti::a, ti::b) * S_p(ti::B) + 3. * T_p() * G_p(ti::a) -
+        sqrt(T_p()) * G_p(ti::a) / T_p());
+    const auto expected_whole =
+        tenex::evaluate<ti::a>(2. * G_p(ti::a) - T_p() * G_p(ti::a));
+    const auto expected_update = tenex::evaluate<ti::a>(
+        T_p() * G_p(ti::a) + R_p(ti::b, ti::a) * S_p(ti::B));
+    for (size_t i = 0; i < 4; ++i) {
+      CHECK(L_split.get(i)[p] == approx(expected_split.get(i)));
+      CHECK(L_whole.get(i)[p] == approx(expected_whole.get(i)));
+      CHECK(L_update.get(i)[p] == approx(expected_update.get(i)));
+    }
+  }
+
+  // Evaluating without tiles gives the same result
+  tnsr::a<DataVector, 3> L_untiled{};
+  tenex::evaluate<ti::a>(make_not_null(&L_untiled),
+                         R(ti::a, ti::b) * S(ti::B) + 3. * T() * G(ti::a) -
+                             sqrt(T()) * G(ti::a) / T(),
+                         false);
+  CHECK_ITERABLE_APPROX(L_untiled, L_split);
+  tnsr::a<DataVector, 3> L_update_untiled = G;
+  tenex::update<ti::a>(make_not_null(&L_update_untiled),
+                       T() * L_update_untiled(ti::a) +
+                           R(ti::b, ti::a) * S(ti::B),
+                       false);
+  CHECK_ITERABLE_APPROX(L_update_untiled, L_update);
+
+  // Only the spatial components are evaluated, so the time component is left
+  // alone. In particular, `tenex::evaluate` doesn't resize it and
+  // `tenex::update` doesn't overwrite it.
+  const DataVector time_component = 2. * get<0>(G);
+  tnsr::a<DataVector, 3> L_spatial = G;
+  get<0>(L_spatial) = time_component;
+  tenex::update<ti::i>(make_not_null(&L_spatial),
+                       T() * L_spatial(ti::i) - G(ti::i));
+  const DataVector short_time_component{1.0, 2.0, 3.0};
+  tnsr::a<DataVector, 3> L_spatial_evaluate{};
+  get<0>(L_spatial_evaluate) = short_time_component;
+  tenex::evaluate<ti::i>(make_not_null(&L_spatial_evaluate),
+                         T() * G(ti::i) - G(ti::i));
+  CHECK(get<0>(L_spatial) == time_component);
+  CHECK(get<0>(L_spatial_evaluate) == short_time_component);
+  for (size_t i = 1; i < 4; ++i) {
+    const DataVector expected = get(T) * G.get(i) - G.get(i);
+    CHECK_ITERABLE_APPROX(L_spatial.get(i), expected);
+    CHECK_ITERABLE_APPROX(L_spatial_evaluate.get(i), expected);
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.Evaluate",
                   "[DataStructures][Unit]") {
   test_contains_indices_to_contract();
+  test_tiled_evaluation();
 
   // Rank 0: double
   TestHelpers::tenex::test_evaluate_rank_0<double>(-7.31);
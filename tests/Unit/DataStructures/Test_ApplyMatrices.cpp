@@ -18,6 +18,7 @@
 #include "DataStructures/Index.hpp"
 #include "DataStructures/IndexIterator.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "DataStructures/SumFactorization.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Framework/TestHelpers.hpp"
@@ -209,6 +210,14 @@ SPECTRE_TEST_CASE("Unit.DataStructures.ApplyMatrices",
     test_interpolation<ScalarTag, TensorTag, 2>();
     test_interpolation<ScalarTag, TensorTag, 3>();
   }
+  {
+    INFO("Extents above the sum-factorization limit");
+    const Mesh<2> source_mesh{
+        {{sum_factorization::max_unrolled_extent + 2, 3}}, basis, quadrature};
+    const Mesh<2> dest_mesh{{{5, 4}}, basis, quadrature};
+    CheckApply<ScalarTag, TensorTag, 2>::apply(source_mesh, dest_mesh,
+                                               Index<2>{3, 2});
+  }
   {
     INFO("ComplexDataVector test");
     test_interpolation<ComplexScalarTag, ComplexTensorTag, 1>();
@@ -0,0 +1,101 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/ScratchArena.hpp"
+
+namespace {
+void test_nested_buffers() {
+  ScratchArena arena{};
+  CHECK(arena.capacity() == 0);
+  CHECK(arena.high_water_mark() == 0);
+  {
+    auto a = arena.get(10);
+    CHECK(a.size() == 10);
+    CHECK(arena.number_of_allocations() == 1);
+    CHECK(arena.number_of_buffers_in_use() == 1);
+    for (size_t i = 0; i < a.size(); ++i) {
+      a.data()[i] = static_cast<double>(i);  // NOLINT
+    }
+    {
+      // Does not fit in the main block, so goes to an overflow block.
+      auto b = arena.get(100);
+      CHECK(b.size() == 100);
+      CHECK(arena.number_of_allocations() == 2);
+      CHECK(arena.number_of_buffers_in_use() == 2);
+      // Moving a buffer transfers ownership without releasing it.
+      auto c = std::move(b);
+      CHECK(c.size() == 100);
+      CHECK(arena.number_of_buffers_in_use() == 2);
+    }
+    CHECK(arena.number_of_buffers_in_use() == 1);
+    for (size_t i = 0; i < a.size(); ++i) {
+      CHECK(a.data()[i] == static_cast<double>(i));  // NOLINT
+    }
+  }
+  CHECK(arena.number_of_buffers_in_use() == 0);
+  // Releasing everything folds the overflow into the main block.
+  CHECK(arena.high_water_mark() == 16 + 104);
+  CHECK(arena.capacity() == arena.high_water_mark());
+  CHECK(arena.number_of_allocations() == 3);
+
+  // The same pattern now needs no allocations.
+  arena.reset_statistics();
+  {
+    auto a = arena.get(10);
+    auto b = arena.get(100);
+    CHECK(a.data() != b.data());
+  }
+  CHECK(arena.number_of_allocations() == 0);
+  CHECK(arena.high_water_mark() == 16 + 104);
+
+  arena.release_memory();
+  CHECK(arena.capacity() == 0);
+}
+
+void test_apply_matrices_warm_up() {
+  auto& arena = ScratchArena::thread_local_arena();
+  const Index<3> extents{4, 5, 6};
+  const DataVector data(2 * extents.product(), 1.0);
+  std::array<Matrix, 3> matrices{};
+  for (size_t d = 0; d < 3; ++d) {
+    gsl::at(matrices, d) = Matrix(extents[d], extents[d], 0.0);
+    for (size_t i = 0; i < extents[d]; ++i) {
+      gsl::at(matrices, d)(i, i) = 2.0;
+    }
+  }
+  DataVector result(data.size());
+  apply_matrices(make_not_null(&result), matrices, data, extents);
+  CHECK(result == DataVector(data.size(), 8.0));
+  CHECK(arena.high_water_mark() >= 2 * data.size());
+
+  arena.reset_statistics();
+  for (size_t i = 0; i < 10; ++i) {
+    apply_matrices(make_not_null(&result), matrices, data, extents);
+  }
+  CHECK(arena.number_of_allocations() == 0);
+  CHECK(arena.number_of_buffers_in_use() == 0);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.ScratchArena",
+                  "[DataStructures][Unit]") {
+  test_nested_buffers();
+  test_apply_matrices_warm_up();
+  CHECK_THROWS_WITH(
+      ([]() {
+        ScratchArena arena{};
+        auto a = arena.get(8);
+        arena.release_memory();
+      }()),
+      Catch::Matchers::ContainsSubstring("buffers in use"));
+}
@@ -0,0 +1,84 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <random>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/SumFactorization.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+void check_apply_in_dimension(const gsl::not_null<std::mt19937*> gen,
+                              const size_t rows, const size_t columns,
+                              const size_t stride,
+                              const size_t number_of_outer_slices) {
+  CAPTURE(rows);
+  CAPTURE(columns);
+  CAPTURE(stride);
+  CAPTURE(number_of_outer_slices);
+  std::uniform_real_distribution<double> dist{-1.0, 1.0};
+  Matrix matrix(rows, columns);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < columns; ++c) {
+      matrix(r, c) = dist(*gen);
+    }
+  }
+  const auto data = make_with_random_values<DataVector>(
+      gen, make_not_null(&dist),
+      DataVector(stride * columns * number_of_outer_slices));
+
+  DataVector expected(stride * rows * number_of_outer_slices, 0.0);
+  for (size_t b = 0; b < number_of_outer_slices; ++b) {
+    for (size_t r = 0; r < rows; ++r) {
+      for (size_t c = 0; c < columns; ++c) {
+        for (size_t a = 0; a < stride; ++a) {
+          expected[a + stride * (r + rows * b)] +=
+              matrix(r, c) * data[a + stride * (c + columns * b)];
+        }
+      }
+    }
+  }
+
+  DataVector result(expected.size());
+  sum_factorization::apply_in_dimension(make_not_null(result.data()), matrix,
+                                        data.data(), stride,
+                                        number_of_outer_slices);
+  CHECK_ITERABLE_APPROX(result, expected);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.SumFactorization",
+                  "[DataStructures][Unit]") {
+  MAKE_GENERATOR(gen);
+  // Cover every unrolled kernel, the runtime-sized kernel (including more
+  // than one chunk of columns) and the BLAS path for unit stride.
+  for (size_t columns = 1;
+       columns <= 2 * sum_factorization::max_unrolled_extent + 3; ++columns) {
+    for (const size_t stride : {1_st, 2_st, 5_st, 12_st}) {
+      check_apply_in_dimension(make_not_null(&gen), columns, columns, stride,
+                               3);
+      check_apply_in_dimension(make_not_null(&gen), columns + 2, columns,
+                               stride, 2);
+      if (columns > 1) {
+        check_apply_in_dimension(make_not_null(&gen), columns - 1, columns,
+                                 stride, 4);
+      }
+    }
+  }
+
+  CHECK(sum_factorization::has_small_extents(
+      std::array<Matrix, 2>{{Matrix(4, 4), Matrix{}}}));
+  CHECK_FALSE(sum_factorization::has_small_extents(
+      std::array<Matrix, 2>{{Matrix{}, Matrix{}}}));
+  CHECK_FALSE(sum_factorization::has_small_extents(std::array<Matrix, 2>{
+      {Matrix(4, 4), Matrix(sum_factorization::max_unrolled_extent + 1,
+                            sum_factorization::max_unrolled_extent + 1)}}));
+}
@@ -15,13 +15,17 @@
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.tpp"
 #include "Domain/CoordinateMaps/TimeDependent/Shape.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/ShapeMapTransitionFunctions/RegisterDerivedWithCharm.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/ShapeMapTransitionFunctions/ShapeMapTransitionFunction.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/ShapeMapTransitionFunctions/SphereTransition.hpp"
 #include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
+#include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/Domain/CoordinateMaps/TestMapHelpers.hpp"
+#include "NumericalAlgorithms/SphericalHarmonics/Spherepack.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/SpherepackIterator.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Surfaces/Tags.hpp"
 #include "Utilities/Gsl.hpp"
@@ -581,6 +585,147 @@ void test_combined_call(const TransitionFunction& transition_func, size_t l_max,
   CHECK_ITERABLE_APPROX(combined_frame_velocity, single_frame_velocity);
   CHECK_ITERABLE_APPROX(combined_jacobian, single_jacobian);
 }
+
+// The cached basis interpolates coefficients like Spherepack does, and is
+// reused for identical coordinates.
+void test_ylm_basis_cache(gsl::not_null<std::mt19937*> generator) {
+  const size_t l_max = 5;
+  const size_t m_max = 4;
+  const ylm::Spherepack ylm{l_max, m_max};
+  const std::uniform_real_distribution dist{-10., 10.};
+  const auto coords =
+      make_with_random_values<std::array<DataVector, 3>>(generator, dist, 9);
+  const auto coefs = make_with_random_values<DataVector>(
+      generator, dist, DataVector(ylm.spectral_size()));
+  CoordinateMaps::TimeDependent::detail::ShapeYlmBasisCache cache{};
+  const auto basis = cache.basis(ylm, coords);
+  REQUIRE(basis->rows() == coords[0].size());
+  REQUIRE(basis->columns() == ylm.spectral_size());
+  CHECK(cache.basis(ylm, coords) == basis);
+
+  const auto& [x, y, z] = coords;
+  const std::array<DataVector, 2> theta_phi{atan2(hypot(x, y), z),
+                                            atan2(y, x)};
+  const DataVector expected = ylm.interpolate_from_coefs(coefs, theta_phi);
+  DataVector interpolated(coords[0].size(), 0.0);
+  for (size_t i = 0; i < basis->rows(); ++i) {
+    for (size_t j = 0; j < basis->columns(); ++j) {
+      interpolated[i] += (*basis)(i, j) * coefs[j];
+    }
+  }
+  CHECK_ITERABLE_APPROX(interpolated, expected);
+
+  // A different resolution or different coordinates replace the basis
+  const ylm::Spherepack extended_ylm{l_max + 1, m_max + 1};
+  CHECK(cache.basis(extended_ylm, coords)->columns() ==
+        extended_ylm.spectral_size());
+  auto new_coords = coords;
+  new_coords[0][0] += 1.0;
+  CHECK(cache.basis(ylm, new_coords) != basis);
+}
+
+// The Y_lm basis for `DataVector` coordinates is cached by maps owned by an
+// element. Evaluating the map repeatedly, at new coordinates (as after
+// refinement) and with copies of the map must agree with the pointwise
+// evaluation, with and without the cache.
+template <typename TransitionFunction>
+void test_cached_ylm_basis(const TransitionFunction& transition_func,
+                           gsl::not_null<std::mt19937*> generator) {
+  const size_t l_max = 4;
+  const size_t m_max = 3;
+  const std::uniform_real_distribution dist{-10., 10.};
+  const auto center =
+      make_with_random_values<std::array<double, 3>>(generator, dist, 3);
+  auto random_coefs = generate_random_coefs(l_max, m_max, generator);
+  DataVector spherepack_coefs =
+      convert_coefs_to_spherepack(random_coefs, l_max, m_max);
+  FunctionsOfTimeMap functions_of_time{};
+  double time{};
+  auto map = CoordinateMaps::TimeDependent::Shape{};
+  generate_random_map_time_and_f_of_time(
+      make_not_null(&map), make_not_null(&time),
+      make_not_null(&functions_of_time), l_max, m_max, center, transition_func,
+      spherepack_coefs, std::nullopt, false, generator);
+
+  const auto check_against_pointwise =
+      [&time, &functions_of_time](
+          const CoordinateMaps::TimeDependent::Shape& local_map,
+          const std::array<DataVector, 3>& coords) {
+        const auto mapped_coords = local_map(coords, time, functions_of_time);
+        const auto frame_velocity =
+            local_map.frame_velocity(coords, time, functions_of_time);
+        const auto jacobian =
+            local_map.jacobian(coords, time, functions_of_time);
+        for (size_t i = 0; i < coords[0].size(); ++i) {
+          CAPTURE(i);
+          const std::array<double, 3> point{coords[0][i], coords[1][i],
+                                            coords[2][i]};
+          const auto expected_mapped_point =
+              local_map(point, time, functions_of_time);
+          const auto expected_frame_velocity =
+              local_map.frame_velocity(point, time, functions_of_time);
+          const auto expected_jacobian =
+              local_map.jacobian(point, time, functions_of_time);
+          for (size_t j = 0; j < 3; ++j) {
+            CHECK(gsl::at(mapped_coords, j)[i] ==
+                  approx(gsl::at(expected_mapped_point, j)));
+            CHECK(gsl::at(frame_velocity, j)[i] ==
+                  approx(gsl::at(expected_frame_velocity, j)));
+            for (size_t k = 0; k < 3; ++k) {
+              CHECK(jacobian.get(j, k)[i] ==
+                    approx(expected_jacobian.get(j, k)));
+            }
+          }
+        }
+      };
+
+  const auto coords =
+      make_with_random_values<std::array<DataVector, 3>>(generator, dist, 10);
+  const auto new_coords =
+      make_with_random_values<std::array<DataVector, 3>>(generator, dist, 7);
+  auto element_map = map;
+  element_map.enable_element_cache();
+  for (const auto* local_map : {&map, &element_map}) {
+    CAPTURE(local_map == &element_map);
+    {
+      INFO("First evaluation");
+      check_against_pointwise(*local_map, coords);
+    }
+    {
+      INFO("Repeated evaluation");
+      check_against_pointwise(*local_map, coords);
+    }
+    {
+      INFO("New coordinates");
+      check_against_pointwise(*local_map, new_coords);
+      check_against_pointwise(*local_map, coords);
+    }
+    {
+      INFO("Copy and serialization");
+      const auto map_copy = *local_map;
+      check_against_pointwise(map_copy, coords);
+      check_against_pointwise(serialize_and_deserialize(*local_map), coords);
+    }
+  }
+  {
+    INFO("Element clone of a coordinate map");
+    const auto coordinate_map =
+        domain::make_coordinate_map_base<Frame::Grid, Frame::Inertial>(map);
+    const auto element_clone = coordinate_map->get_element_clone();
+    tnsr::I<DataVector, 3, Frame::Grid> grid_coords{};
+    for (size_t i = 0; i < 3; ++i) {
+      grid_coords.get(i) = gsl::at(coords, i);
+    }
+    for (size_t repeat = 0; repeat < 2; ++repeat) {
+      CHECK_ITERABLE_APPROX(
+          (*element_clone)(grid_coords, time, functions_of_time),
+          (*coordinate_map)(grid_coords, time, functions_of_time));
+      CHECK_ITERABLE_APPROX(
+          element_clone->jacobian(grid_coords, time, functions_of_time),
+          coordinate_map->jacobian(grid_coords, time, functions_of_time));
+    }
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.CoordinateMaps.TimeDependent.Shape",
@@ -593,6 +738,8 @@ SPECTRE_TEST_CASE("Unit.Domain.CoordinateMaps.TimeDependent.Shape",
   MAKE_GENERATOR(generator);
 
   test_inverse(make_not_null(&generator));
+  test_ylm_basis_cache(make_not_null(&generator));
+  test_cached_ylm_basis(sphere_transition, make_not_null(&generator));
 
   for (const auto include_size : make_array(false, true)) {
     CAPTURE(include_size);
@@ -60,6 +60,17 @@ void test(const gsl::not_null<FunctionsOfTime::FunctionOfTime*> f_of_t,
     CHECK(approx(lambdas2[0][0]) == cube(t));
     CHECK(approx(lambdas2[0][1]) == square(t));
 
+    // Evaluating into existing buffers reuses their allocations
+    std::array<DataVector, 3> buffer{};
+    f_of_t->evaluate(buffer, t);
+    CHECK_ITERABLE_APPROX(buffer, lambdas0);
+    const double* const buffer_data = buffer[2].data();
+    f_of_t->evaluate(buffer, t);
+    CHECK(buffer[2].data() == buffer_data);
+    CHECK_ITERABLE_APPROX(buffer, lambdas0);
+    f_of_t->evaluate(gsl::make_span(buffer.data(), 1), t);
+    CHECK_ITERABLE_APPROX(buffer[0], lambdas2[0]);
+
     t += dt;
     f_of_t_derived->update(t, {6.0, 0.0}, t + dt);
     CHECK(f_of_t->expiration_after(t) == t + dt);
@@ -0,0 +1,115 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
+#include "Domain/FunctionsOfTime/RegisterDerivedWithCharm.hpp"
+#include "Domain/FunctionsOfTime/SettleToConstant.hpp"
+#include "Domain/FunctionsOfTime/SnapshotCache.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace domain::FunctionsOfTime {
+namespace {
+void test_ids() {
+  PiecewisePolynomial<2> f_of_t{
+      0.0, {{{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}}}, 10.0};
+  const auto copy = f_of_t;
+  CHECK(copy.id() != f_of_t.id());
+  CHECK(serialize_and_deserialize(f_of_t).id() != f_of_t.id());
+  CHECK(f_of_t.get_clone()->id() != f_of_t.id());
+  const auto id = f_of_t.id();
+  // Updating doesn't change the values at earlier times
+  f_of_t.update(10.0, {1.0, 1.0}, 20.0);
+  CHECK(f_of_t.id() == id);
+  f_of_t = copy;
+  CHECK(f_of_t.id() != id);
+  CHECK(f_of_t.id() != copy.id());
+}
+
+void test_cached_evaluate() {
+  const PiecewisePolynomial<2> f_of_t{
+      0.0, {{{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}}}, 10.0};
+  const SettleToConstant settle_to_constant{
+      {{{1.0}, {-1.0}, {0.5}}}, 0.0, 2.0};
+  for (const double time : {0.0, 0.5, 1.5, 0.5}) {
+    CAPTURE(time);
+    CHECK_ITERABLE_APPROX(cached_evaluate<1>(f_of_t, time), f_of_t.func(time));
+    CHECK_ITERABLE_APPROX(cached_evaluate<3>(f_of_t, time),
+                          f_of_t.func_and_2_derivs(time));
+    CHECK_ITERABLE_APPROX(cached_evaluate<2>(f_of_t, time),
+                          f_of_t.func_and_deriv(time));
+    CHECK_ITERABLE_APPROX(cached_evaluate<2>(settle_to_constant, time),
+                          settle_to_constant.func_and_deriv(time));
+  }
+  {
+    INFO("Cached values reuse the allocations of the result");
+    std::array<DataVector, 2> result{};
+    cached_evaluate(result, f_of_t, 0.5);
+    const double* const result_data = result[1].data();
+    cached_evaluate(result, f_of_t, 0.5);
+    CHECK(result[1].data() == result_data);
+    CHECK_ITERABLE_APPROX(result, f_of_t.func_and_deriv(0.5));
+  }
+  {
+    INFO("Components are returned by value");
+    const auto components = cached_evaluate_components<2, 2>(f_of_t, 0.5);
+    const auto components_later =
+        cached_evaluate_components<2, 2>(f_of_t, 1.5);
+    const auto expected = f_of_t.func_and_deriv(0.5);
+    const auto expected_later = f_of_t.func_and_deriv(1.5);
+    for (size_t i = 0; i < 2; ++i) {
+      for (size_t j = 0; j < 2; ++j) {
+        CHECK(gsl::at(gsl::at(components, i), j) ==
+              approx(gsl::at(expected, i)[j]));
+        CHECK(gsl::at(gsl::at(components_later, i), j) ==
+              approx(gsl::at(expected_later, i)[j]));
+      }
+    }
+    CHECK(cached_evaluate_components<1, 1>(settle_to_constant, 0.5)[0][0] ==
+          approx(settle_to_constant.func(0.5)[0][0]));
+  }
+  {
+    INFO("Different functions at the same time don't collide");
+    const PiecewisePolynomial<2> other_f_of_t{
+        0.0, {{{-1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}}}, 10.0};
+    CHECK_ITERABLE_APPROX(cached_evaluate<3>(other_f_of_t, 0.5),
+                          other_f_of_t.func_and_2_derivs(0.5));
+    CHECK_ITERABLE_APPROX(cached_evaluate<3>(f_of_t, 0.5),
+                          f_of_t.func_and_2_derivs(0.5));
+  }
+  {
+    INFO("More snapshots than fit in the cache");
+    std::vector<std::unique_ptr<FunctionOfTime>> functions_of_time{};
+    for (size_t i = 0; i < 100; ++i) {
+      functions_of_time.push_back(std::make_unique<PiecewisePolynomial<1>>(
+          0.0,
+          std::array<DataVector, 2>{
+              {{static_cast<double>(i)}, {static_cast<double>(2 * i)}}},
+          10.0));
+    }
+    for (size_t repeat = 0; repeat < 2; ++repeat) {
+      for (const auto& function_of_time : functions_of_time) {
+        CHECK_ITERABLE_APPROX(cached_evaluate<2>(*function_of_time, 1.0),
+                              function_of_time->func_and_deriv(1.0));
+      }
+    }
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.SnapshotCache",
+                  "[Domain][Unit]") {
+  register_derived_with_charm();
+  test_ids();
+  test_cached_evaluate();
+}
+}  // namespace domain::FunctionsOfTime
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <iterator>
 #include <limits>
@@ -18,6 +19,7 @@
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/BlockBoundingBox.hpp"
 #include "Domain/BlockLogicalCoordinates.hpp"
 #include "Domain/Creators/DomainCreator.hpp"
 #include "Domain/Creators/Rectilinear.hpp"
@@ -32,6 +34,7 @@
 #include "Domain/Structure/BlockId.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Structure/SegmentId.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
@@ -72,6 +75,76 @@ void test_element_logical_coordinates() {
         tnsr::I<double, 3, Frame::ElementLogical>{{{1., 0., 1.}}});
 }
 
+// The lookup with an `ElementIndex` must agree with the loop over all elements
+template <size_t Dim>
+void check_element_index(
+    const std::vector<ElementId<Dim>>& element_ids,
+    const std::vector<BlockLogicalCoords<Dim>>& block_logical_coords) {
+  const auto expected =
+      element_logical_coordinates(element_ids, block_logical_coords);
+  const auto result = element_logical_coordinates(
+      ElementIndex<Dim>{element_ids}, block_logical_coords);
+  CHECK(result.size() == expected.size());
+  for (const auto& [id, expected_holder] : expected) {
+    INFO(id);
+    const auto pos = result.find(id);
+    REQUIRE(pos != result.end());
+    CHECK(pos->second.offsets == expected_holder.offsets);
+    CHECK(pos->second.element_logical_coords ==
+          expected_holder.element_logical_coords);
+  }
+}
+
+void test_element_index() {
+  // Block 0 is split in xi, and the upper half is split again in eta. Block 1
+  // has a single element on another grid.
+  const std::vector<ElementId<2>> element_ids{
+      ElementId<2>{0, {{SegmentId{1, 0}, SegmentId{0, 0}}}},
+      ElementId<2>{0, {{SegmentId{1, 1}, SegmentId{1, 0}}}},
+      ElementId<2>{0, {{SegmentId{1, 1}, SegmentId{1, 1}}}},
+      ElementId<2>{1, 1}};
+  const ElementIndex<2> element_index{element_ids};
+  CHECK(element_index.element_ids() == element_ids);
+  const auto find = [&element_index](const size_t block_id, const double xi,
+                                     const double eta) {
+    return element_index.find(
+        domain::BlockId{block_id},
+        tnsr::I<double, 2, Frame::BlockLogical>{{{xi, eta}}});
+  };
+  CHECK(find(0, -0.5, 0.7) == std::optional<size_t>{0});
+  CHECK(find(0, 0.5, -0.7) == std::optional<size_t>{1});
+  CHECK(find(0, 0.5, 0.7) == std::optional<size_t>{2});
+  // Points on shared boundaries belong to the upper element, unless they are
+  // on the upper boundary of the block
+  CHECK(find(0, 0.0, -1.0) == std::optional<size_t>{1});
+  CHECK(find(0, 0.5, 0.0) == std::optional<size_t>{2});
+  CHECK(find(0, 1.0, 1.0) == std::optional<size_t>{2});
+  CHECK(find(0, -1.0, 1.0) == std::optional<size_t>{0});
+  CHECK(find(1, 0.3, -0.2) == std::optional<size_t>{3});
+  CHECK(find(2, 0.3, -0.2) == std::nullopt);
+  CHECK(find(0, 1.5, 0.0) == std::nullopt);
+
+  // Points on a grid that includes all element boundaries
+  std::vector<BlockLogicalCoords<2>> block_logical_coords{};
+  for (size_t block_id = 0; block_id < 3; ++block_id) {
+    for (size_t i = 0; i <= 8; ++i) {
+      for (size_t j = 0; j <= 8; ++j) {
+        block_logical_coords.emplace_back(
+            IdPair<domain::BlockId, tnsr::I<double, 2, Frame::BlockLogical>>{
+                domain::BlockId{block_id},
+                tnsr::I<double, 2, Frame::BlockLogical>{
+                    {{-1.0 + 0.25 * static_cast<double>(i),
+                      -1.0 + 0.25 * static_cast<double>(j)}}}});
+      }
+    }
+  }
+  block_logical_coords.emplace_back(std::nullopt);
+  check_element_index(element_ids, block_logical_coords);
+  auto reversed_element_ids = element_ids;
+  std::reverse(reversed_element_ids.begin(), reversed_element_ids.end());
+  check_element_index(reversed_element_ids, block_logical_coords);
+}
+
 template <size_t Dim>
 void fuzzy_test_block_and_element_logical_coordinates(
     const Domain<Dim>& domain,
@@ -185,6 +258,7 @@ void fuzzy_test_block_and_element_logical_coordinates(
   // Test versus all the element_ids.
   const auto element_logical_result =
       element_logical_coordinates(all_element_ids, block_logical_result);
+  check_element_index(all_element_ids, block_logical_result);
 
   for (const auto& expected_holder_pair : expected_coord_holders) {
     const auto pos = element_logical_result.find(expected_holder_pair.first);
@@ -278,6 +352,52 @@ void fuzzy_test_block_and_element_logical_coordinates_unrefined(
                           block_coords[s]);
   }
 
+  // Distributing the points over threads doesn't change the result
+  const auto threaded_block_logical_result = block_logical_coordinates(
+      domain, inertial_coords, time, functions_of_time, 3);
+  CHECK(threaded_block_logical_result.size() == n_pts);
+  for (size_t s = 0; s < n_pts; ++s) {
+    CHECK(threaded_block_logical_result[s].value().id.get_index() ==
+          block_ids[s]);
+    CHECK_ITERABLE_APPROX(threaded_block_logical_result[s].value().data,
+                          block_coords[s]);
+  }
+
+  // Starting from the previous result, or from the wrong blocks, gives the
+  // same result
+  std::vector<BlockLogicalCoords<Dim>> wrong_block_logical_result =
+      block_logical_result;
+  for (size_t s = 0; s < n_pts; ++s) {
+    wrong_block_logical_result[s].value().id =
+        domain::BlockId((block_ids[s] + 1) % n_blocks);
+  }
+  for (const auto& previous_block_logical_result :
+       {block_logical_result, wrong_block_logical_result,
+        std::vector<BlockLogicalCoords<Dim>>{}}) {
+    const auto warm_started_block_logical_result =
+        block_logical_coordinates(domain, inertial_coords,
+                                  previous_block_logical_result, time,
+                                  functions_of_time);
+    CHECK(warm_started_block_logical_result.size() == n_pts);
+    for (size_t s = 0; s < n_pts; ++s) {
+      CHECK(warm_started_block_logical_result[s].value().id.get_index() ==
+            block_ids[s]);
+      CHECK_ITERABLE_APPROX(warm_started_block_logical_result[s].value().data,
+                            block_coords[s]);
+    }
+  }
+
+  // The points lie in the bounding box of their block
+  for (size_t s = 0; s < n_pts; ++s) {
+    tnsr::I<double, Dim, Frame::Inertial> point{};
+    for (size_t d = 0; d < Dim; ++d) {
+      point.get(d) = inertial_coords.get(d)[s];
+    }
+    CHECK(domain::bounding_box<Dim, Frame::Inertial>(
+              domain.blocks()[block_ids[s]], time, functions_of_time)
+              .contains(point));
+  }
+
   // Map to distorted coords
   // For this test, we test distorted coords only if the first block has
   // a distorted frame.  For this test, either all blocks have a distorted
@@ -499,6 +619,7 @@ void test_block_and_element_logical_coordinates(
 
   const auto element_logical_result =
       element_logical_coordinates(element_ids, block_logical_result);
+  check_element_index(element_ids, block_logical_result);
 
   std::vector<tnsr::I<DataVector, Dim, Frame::ElementLogical>>
       expected_elem_logical;
@@ -741,6 +862,7 @@ void test_element_ids_are_uniquely_determined() {
 
   const auto result_shuffled =
       element_logical_coordinates(element_ids, block_logical_points);
+  check_element_index(element_ids, block_logical_points);
 
   size_t points_found = 0;
   for (const auto& [id, coord_holder] : result_unshuffled) {
@@ -816,12 +938,89 @@ void test_block_logical_coordinates_with_roundoff_error() {
   CHECK(get<0>(block_logical_coords[4]->data) == 1.0);
   CHECK(get<1>(block_logical_coords[5]->data) < 1.0);
   CHECK(get<0>(block_logical_coords[6]->data) < 1.0);
+
+  // Starting from block 4 gives the same result. Points on the boundary of
+  // block 4 move to block 0.
+  auto previous_block_logical_coords = block_logical_coords;
+  for (auto& previous_coords : previous_block_logical_coords) {
+    previous_coords->id = domain::BlockId(4);
+  }
+  const auto warm_started_block_logical_coords = block_logical_coordinates(
+      domain, inertial_coords, previous_block_logical_coords);
+  for (size_t i = 0; i < points.size(); ++i) {
+    CAPTURE(points[i]);
+    const auto& result = warm_started_block_logical_coords[i];
+    CAPTURE(result);
+    REQUIRE(result.has_value());
+    CHECK(result->id.get_index() == expected_block_ids[i]);
+    CHECK(result->data == block_logical_coords[i]->data);
+  }
+}
+
+void test_block_logical_coordinates_with_bounding_boxes() {
+  const auto shell = domain::creators::Sphere(
+      1., 3., domain::creators::Sphere::Excision{}, 0_st, 3_st, true);
+  const auto domain = shell.create_domain();
+
+  // With more points than blocks only the blocks whose bounding box contains
+  // a point are tried first. Points on shared block boundaries must still be
+  // assigned to the block with the smaller id, and points outside all boxes
+  // are outside the domain.
+  std::vector<std::array<double, 3>> points{};
+  std::vector<std::optional<size_t>> expected_block_ids{};
+  for (size_t i = 0; i < 5; ++i) {
+    const double r = 1.25 + 0.4 * static_cast<double>(i);
+    // On the shared boundary of blocks 0 and 4
+    points.push_back({{r, M_PI_4, 0.}});
+    expected_block_ids.emplace_back(0);
+    // On the corner shared by blocks 0, 2 and 4
+    points.push_back({{r, acos(1.0 / sqrt(3.0)), M_PI_4}});
+    expected_block_ids.emplace_back(0);
+    // Inside block 4
+    points.push_back({{r, M_PI_2, 0.}});
+    expected_block_ids.emplace_back(4);
+    // Outside the domain and outside all bounding boxes
+    points.push_back({{10.0 * r, M_PI_2, 0.}});
+    expected_block_ids.emplace_back(std::nullopt);
+  }
+  // Inside the excision, but inside some bounding boxes
+  points.push_back({{0.5, M_PI_2, 0.}});
+  expected_block_ids.emplace_back(std::nullopt);
+  REQUIRE(points.size() > domain.blocks().size());
+
+  tnsr::I<DataVector, 3> inertial_coords{points.size()};
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto& [r, theta, phi] = points[i];
+    get<0>(inertial_coords)[i] = r * cos(phi) * sin(theta);
+    get<1>(inertial_coords)[i] = r * sin(phi) * sin(theta);
+    get<2>(inertial_coords)[i] = r * cos(theta);
+  }
+
+  for (const size_t number_of_threads : {1_st, 3_st}) {
+    CAPTURE(number_of_threads);
+    const auto block_logical_coords = block_logical_coordinates(
+        domain, inertial_coords, std::numeric_limits<double>::signaling_NaN(),
+        {}, number_of_threads);
+    REQUIRE(block_logical_coords.size() == points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+      CAPTURE(points[i]);
+      const auto& result = block_logical_coords[i];
+      CAPTURE(result);
+      if (expected_block_ids[i].has_value()) {
+        REQUIRE(result.has_value());
+        CHECK(result->id.get_index() == expected_block_ids[i].value());
+      } else {
+        CHECK_FALSE(result.has_value());
+      }
+    }
+  }
 }
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.BlockAndElementLogicalCoords",
                   "[Domain][Unit]") {
   test_element_logical_coordinates();
+  test_element_index();
   test_block_and_element_logical_coordinates1();
   test_block_and_element_logical_coordinates3();
   fuzzy_test_block_and_element_logical_coordinates3(20);
@@ -834,4 +1033,5 @@ SPECTRE_TEST_CASE("Unit.Domain.BlockAndElementLogicalCoords",
   test_block_logical_coordinates1fail();
   test_element_ids_are_uniquely_determined();
   test_block_logical_coordinates_with_roundoff_error();
+  test_block_logical_coordinates_with_bounding_boxes();
 }
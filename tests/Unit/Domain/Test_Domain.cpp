@@ -119,6 +119,16 @@ void test_1d_domains() {
           std::vector<std::string>{std::string{"Left"}, std::string{"Right"}});
     CHECK(domain_from_corners.block_groups().at("All") ==
           std::unordered_set<std::string>{"Left", "Right"});
+    // The bounding boxes are padded by 10% of the extent of each block
+    const auto check_bounding_boxes = [](const Domain<1>& domain) {
+      REQUIRE(domain.block_bounding_boxes().size() == 2);
+      CHECK(domain.block_bounding_boxes()[0].lower_corner[0] == approx(-2.2));
+      CHECK(domain.block_bounding_boxes()[0].upper_corner[0] == approx(0.2));
+      CHECK(domain.block_bounding_boxes()[1].lower_corner[0] == approx(-0.2));
+      CHECK(domain.block_bounding_boxes()[1].upper_corner[0] == approx(2.2));
+    };
+    check_bounding_boxes(domain_from_corners);
+    check_bounding_boxes(serialize_and_deserialize(domain_from_corners));
 
     Domain<1> domain_no_corners(
         make_vector<std::unique_ptr<
@@ -20,6 +20,7 @@
 #include "Domain/ElementDistribution.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Structure/SegmentId.hpp"
 #include "Domain/Structure/ZCurve.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -498,6 +499,51 @@ void test_proc_retrieval(
     }
   }
 }
+
+// Test `domain::z_curve_proc_distribution` with elements of different
+// refinement levels, as they appear after AMR
+void test_z_curve_proc_distribution() {
+  // Block 0 is refined once, and its lower-left quadrant once more. Block 1 is
+  // a single element.
+  const std::vector<ElementId<2>> element_ids{
+      ElementId<2>{0, {{SegmentId{2, 0}, SegmentId{2, 0}}}},
+      ElementId<2>{0, {{SegmentId{2, 1}, SegmentId{2, 0}}}},
+      ElementId<2>{0, {{SegmentId{2, 0}, SegmentId{2, 1}}}},
+      ElementId<2>{0, {{SegmentId{2, 1}, SegmentId{2, 1}}}},
+      ElementId<2>{0, {{SegmentId{1, 1}, SegmentId{1, 0}}}},
+      ElementId<2>{0, {{SegmentId{1, 0}, SegmentId{1, 1}}}},
+      ElementId<2>{0, {{SegmentId{1, 1}, SegmentId{1, 1}}}},
+      ElementId<2>{1, {{SegmentId{0, 0}, SegmentId{0, 0}}}}};
+  std::unordered_map<ElementId<2>, double> costs{};
+  for (const auto& element_id : element_ids) {
+    costs[element_id] = element_id.block_id() == 1 ? 3.0 : 1.0;
+  }
+  const auto check = [&element_ids](
+                         const std::unordered_map<ElementId<2>, size_t>& procs,
+                         const std::vector<size_t>& expected_procs) {
+    REQUIRE(procs.size() == element_ids.size());
+    for (size_t i = 0; i < element_ids.size(); ++i) {
+      CAPTURE(element_ids[i]);
+      CHECK(procs.at(element_ids[i]) == expected_procs[i]);
+    }
+  };
+  check(domain::z_curve_proc_distribution(costs, 3),
+        {0, 0, 0, 1, 1, 1, 2, 2});
+  check(domain::z_curve_proc_distribution(costs, 3, {1}),
+        {0, 0, 0, 2, 2, 2, 3, 3});
+  check(domain::z_curve_proc_distribution(costs, 1),
+        {0, 0, 0, 0, 0, 0, 0, 0});
+  // Expensive elements get a proc of their own
+  costs.at(element_ids[0]) = 20.0;
+  check(domain::z_curve_proc_distribution(costs, 2),
+        {0, 1, 1, 1, 1, 1, 1, 1});
+  // Without measured costs all elements are weighted equally
+  for (auto& [element_id, cost] : costs) {
+    cost = 0.0;
+  }
+  check(domain::z_curve_proc_distribution(costs, 4),
+        {0, 0, 1, 1, 2, 2, 3, 3});
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
@@ -543,4 +589,6 @@ SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
   // `Element`s in the domain
   test_proc_retrieval(domain::ElementWeight::NumGridPointsAndGridSpacing,
                       lattice_2d, 100, std::unordered_set<size_t>{17});
+
+  test_z_curve_proc_distribution();
 }
@@ -6,11 +6,15 @@
 #include <array>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
+#include <algorithm>
 #include <cstddef>
+#include <map>
 #include <memory>
 #include <optional>
 #include <random>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -34,6 +38,7 @@
 #include "Domain/Creators/Tags/FunctionsOfTime.hpp"
 #include "Domain/Creators/Tags/InitialExtents.hpp"
 #include "Domain/Creators/Tags/InitialRefinementLevels.hpp"
+#include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/InitialElementIds.hpp"
 #include "Domain/Tags.hpp"
@@ -267,6 +272,41 @@ struct RandomBackground : elliptic::analytic_data::Background {
 template <size_t Dim>
 PUP::able::PUP_ID RandomBackground<Dim>::my_PUP_ID = 0;  // NOLINT
 
+// Overlap directions in the order of the subdomain data, operand and result of
+// applying the subdomain operator, stored by operator signature. Subdomains
+// with the same signature must have the same operator and the same layout.
+template <typename SubdomainOperator>
+using KnownOperator =
+    std::tuple<std::vector<Direction<SubdomainOperator::volume_dim>>,
+               blaze::DynamicVector<double>, blaze::DynamicVector<double>>;
+
+template <typename SubdomainOperator>
+std::map<std::vector<double>, KnownOperator<SubdomainOperator>>&
+operators_by_signature() {
+  static std::map<std::vector<double>, KnownOperator<SubdomainOperator>>
+      operators{};
+  return operators;
+}
+
+template <size_t Dim, typename TagsList>
+std::vector<Direction<Dim>> overlap_directions(
+    const LinearSolver::Schwarz::ElementCenteredSubdomainData<Dim, TagsList>&
+        data) {
+  std::vector<Direction<Dim>> result{};
+  for (const auto& [overlap_id, overlap_data] : data.overlap_data) {
+    (void)overlap_data;
+    result.push_back(overlap_id.direction());
+  }
+  return result;
+}
+
+template <typename SubdomainData>
+blaze::DynamicVector<double> contiguous_data(const SubdomainData& data) {
+  blaze::DynamicVector<double> result(data.size());
+  std::copy(data.begin(), data.end(), result.begin());
+  return result;
+}
+
 template <typename SubdomainOperator, typename Fields>
 struct ApplySubdomainOperator {
   template <typename DbTags, typename... InboxTags, typename Metavariables,
@@ -308,6 +348,36 @@ struct ApplySubdomainOperator {
     subdomain_operator(make_not_null(&subdomain_result), subdomain_data, box,
                        override_boundary_conditions);
 
+    // Check that a subdomain with the same operator signature as this one has
+    // the same operator, i.e. it gives the same result for the same operand
+    const auto signature = subdomain_operator.operator_signature(
+        subdomain_data, box, override_boundary_conditions);
+    if (signature.has_value()) {
+      auto& known_operators = operators_by_signature<SubdomainOperator>();
+      const auto found_operator = known_operators.find(*signature);
+      if (found_operator == known_operators.end()) {
+        known_operators.emplace(
+            *signature, std::make_tuple(overlap_directions(subdomain_data),
+                                        contiguous_data(subdomain_data),
+                                        contiguous_data(subdomain_result)));
+      } else {
+        const auto& [known_directions, known_operand, known_result] =
+            found_operator->second;
+        CHECK(overlap_directions(subdomain_data) == known_directions);
+        REQUIRE(known_operand.size() == subdomain_data.size());
+        auto operand = subdomain_data;
+        std::copy(known_operand.begin(), known_operand.end(), operand.begin());
+        auto result = make_with_value<
+            typename SubdomainOperatorAppliedToDataTag<Dim, Fields>::type>(
+            subdomain_data, 0.);
+        subdomain_operator(make_not_null(&result), operand, box,
+                           override_boundary_conditions);
+        Approx custom_approx = Approx::custom().epsilon(1.e-9).scale(1.0);
+        CHECK_ITERABLE_CUSTOM_APPROX(contiguous_data(result), known_result,
+                                     custom_approx);
+      }
+    }
+
     // Store result in the DataBox for checks
     db::mutate<SubdomainOperatorAppliedToDataTag<Dim, Fields>>(
         [&subdomain_result](const auto subdomain_operator_applied_to_data) {
@@ -961,6 +1031,28 @@ SPECTRE_TEST_CASE("Unit.Elliptic.DG.SubdomainOperator", "[Unit][Elliptic]") {
       test_subdomain_operator<system>(domain_creator);
     }
   }
+  {
+    INFO("Congruent subdomains with different overlap orders");
+    using system = Poisson::FirstOrderSystem<1, Poisson::Geometry::Curved>;
+    //  |-B0--|-B1--|-B2--|-B3--|
+    //  [o|o|o|o|o|o|o|o]-> xi
+    // The overlaps of an element are ordered by the parity of the neighbors'
+    // block IDs. So the upper element in B1 stores its overlap with B2 first,
+    // whereas the congruent upper element in B2 stores its overlap with B3
+    // last. Their signatures must differ because their operator matrices are
+    // laid out differently.
+    const auto dirichlet_bc = make_boundary_condition<system>(
+        elliptic::BoundaryConditionType::Dirichlet);
+    const domain::creators::AlignedLattice<1> domain_creator{
+        {{{-2., -1., 0., 1., 2.}}},
+        {{1}},
+        {{3}},
+        {},
+        {},
+        {},
+        {{{{dirichlet_bc->get_clone(), dirichlet_bc->get_clone()}}}}};
+    test_subdomain_operator<system>(domain_creator);
+  }
   {
     INFO("Refined");
     {
@@ -29,6 +29,7 @@
 #include "Evolution/DiscontinuousGalerkin/Initialization/QuadratureTag.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
+#include "Evolution/DiscontinuousGalerkin/SharedMortarDataBuffer.hpp"
 #include "Framework/ActionTesting.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
@@ -176,6 +177,8 @@ void test_impl(
 
   CHECK(get_tag(evolution::dg::Tags::BoundaryData<Dim>{}) ==
         typename evolution::dg::Tags::BoundaryData<Dim>::type{});
+  CHECK(get_tag(evolution::dg::Tags::SharedMortarDataBuffer<Dim>{}) ==
+        typename evolution::dg::Tags::SharedMortarDataBuffer<Dim>::type{});
 }
 
 template <size_t Dim, bool LocalTimeStepping>
@@ -422,12 +425,14 @@ void test_p_refine(
       Tags::MortarData<Dim>, Tags::MortarMesh<Dim>, Tags::MortarSize<Dim>,
       Tags::MortarNextTemporalId<Dim>,
       evolution::dg::Tags::NormalCovectorAndMagnitude<Dim>,
-      Tags::MortarDataHistory<Dim, typename dt_variables_tag<Dim>::type>>>(
+      Tags::MortarDataHistory<Dim, typename dt_variables_tag<Dim>::type>,
+      evolution::dg::Tags::SharedMortarDataBuffer<Dim>>>(
       std::move(new_mesh), std::move(new_element),
       ::dg::MortarMap<Dim, Mesh<Dim>>{}, std::move(neighbor_info),
       std::move(mortar_data), std::move(mortar_mesh), std::move(mortar_size),
       std::move(mortar_next_temporal_id),
-      std::move(normal_covector_and_magnitude), std::move(mortar_data_history));
+      std::move(normal_covector_and_magnitude), std::move(mortar_data_history),
+      evolution::dg::SharedMortarDataBuffer<Dim>{});
 
   db::mutate_apply<evolution::dg::Initialization::ProjectMortars<
       Metavariables<Dim, UsingLts>>>(make_not_null(&box),
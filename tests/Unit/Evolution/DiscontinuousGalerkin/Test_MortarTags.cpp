@@ -22,6 +22,8 @@ void test() {
       "MortarNextTemporalId");
   TestHelpers::db::test_simple_tag<Tags::BoundaryMessageFromInbox<Dim>>(
       "BoundaryMessageFromInbox");
+  TestHelpers::db::test_simple_tag<Tags::SharedMortarDataBuffer<Dim>>(
+      "SharedMortarDataBuffer");
 }
 }  // namespace
 
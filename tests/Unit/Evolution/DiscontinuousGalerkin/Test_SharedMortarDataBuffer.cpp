@@ -0,0 +1,140 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <optional>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionalId.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
+#include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
+#include "Evolution/DiscontinuousGalerkin/MortarDataHolder.hpp"
+#include "Evolution/DiscontinuousGalerkin/SharedMortarDataBuffer.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace evolution::dg {
+namespace {
+template <size_t Dim>
+void test() {
+  const DirectionalId<Dim> mortar_id{Direction<Dim>::upper_xi(),
+                                     ElementId<Dim>{1}};
+  const Slab slab{0.0, 1.0};
+  const TimeStepId first_id{true, 0, slab.start()};
+  const TimeStepId second_id{true, 0, slab.start() + slab.duration() / 2};
+  const TimeStepId third_id{true, 0, slab.end()};
+
+  DirectionalIdMap<Dim, MortarDataHolder<Dim>> mortar_data{};
+  auto& local_data = mortar_data[mortar_id].local().mortar_data;
+  SharedMortarDataBuffer<Dim> buffer{};
+  CHECK(buffer == SharedMortarDataBuffer<Dim>{});
+
+  // Share the data for the first time step.
+  local_data = DataVector{1.0, 2.0, 3.0};
+  const double* const first_allocation = local_data->data();
+  DataVector neighbor_view{};
+  buffer.share(make_not_null(&neighbor_view),
+               make_not_null(&mortar_data.at(mortar_id).local()), mortar_id,
+               first_id);
+  CHECK_FALSE(neighbor_view.is_owning());
+  CHECK(neighbor_view.data() == first_allocation);
+  CHECK(neighbor_view == DataVector{1.0, 2.0, 3.0});
+  // The view is moved into the message to the neighbor the same way
+  // ComputeTimeDerivative does it.
+  BoundaryData<Dim> message{};
+  message = BoundaryData<Dim>{Mesh<Dim>{},
+                              std::nullopt,
+                              std::nullopt,
+                              std::nullopt,
+                              {std::move(neighbor_view)},
+                              first_id,
+                              0,
+                              1};
+  REQUIRE(message.boundary_correction_data.has_value());
+  const DataVector& first_view = *message.boundary_correction_data;
+  CHECK_FALSE(first_view.is_owning());
+  CHECK(first_view.data() == first_allocation);
+  CHECK(first_view == DataVector{1.0, 2.0, 3.0});
+  CHECK_FALSE(local_data->is_owning());
+  CHECK(local_data->data() == first_allocation);
+  CHECK(buffer.latest_time_step_id(mortar_id) == first_id);
+  CHECK(buffer != SharedMortarDataBuffer<Dim>{});
+
+  // The older slot is still empty, so reclaiming gives back empty owning
+  // storage.
+  buffer.reclaim(make_not_null(&mortar_data));
+  CHECK(local_data->is_owning());
+  CHECK(local_data->empty());
+  CHECK(first_view == DataVector{1.0, 2.0, 3.0});
+
+  // Share the data for the second time step. It goes into the other slot and
+  // the first view stays valid.
+  local_data = DataVector{4.0, 5.0, 6.0};
+  const double* const second_allocation = local_data->data();
+  DataVector second_view{};
+  buffer.share(make_not_null(&second_view),
+               make_not_null(&mortar_data.at(mortar_id).local()), mortar_id,
+               second_id);
+  CHECK(second_view.data() == second_allocation);
+  CHECK(second_view == DataVector{4.0, 5.0, 6.0});
+  CHECK(first_view == DataVector{1.0, 2.0, 3.0});
+  CHECK(buffer.latest_time_step_id(mortar_id) == second_id);
+
+  // The memory of the first time step is reused for the third.
+  buffer.reclaim(make_not_null(&mortar_data));
+  CHECK(local_data->is_owning());
+  CHECK(local_data->data() == first_allocation);
+  // Mimic the in-place computation of the mortar data.
+  local_data->destructive_resize(3);
+  CHECK(local_data->data() == first_allocation);
+  *local_data = 7.0;
+  (*local_data)[1] = 8.0;
+  (*local_data)[2] = 9.0;
+  DataVector third_view{};
+  buffer.share(make_not_null(&third_view),
+               make_not_null(&mortar_data.at(mortar_id).local()), mortar_id,
+               third_id);
+  CHECK(third_view.data() == first_allocation);
+  CHECK(third_view == DataVector{7.0, 8.0, 9.0});
+  CHECK(second_view == DataVector{4.0, 5.0, 6.0});
+  CHECK(buffer.latest_time_step_id(mortar_id) == third_id);
+
+  // Reclaiming skips mortars that no longer exist.
+  DirectionalIdMap<Dim, MortarDataHolder<Dim>> other_mortar_data{};
+  buffer.reclaim(make_not_null(&other_mortar_data));
+  CHECK(other_mortar_data.empty());
+
+  // Serialization copies the shared data.
+  const auto deserialized_buffer = serialize_and_deserialize(buffer);
+  CHECK(deserialized_buffer == buffer);
+  CHECK(deserialized_buffer.latest_time_step_id(mortar_id) == third_id);
+  const auto deserialized_mortar_data =
+      serialize_and_deserialize(mortar_data.at(mortar_id).local());
+  REQUIRE(deserialized_mortar_data.mortar_data.has_value());
+  CHECK(deserialized_mortar_data.mortar_data->is_owning());
+  CHECK(*deserialized_mortar_data.mortar_data == DataVector{7.0, 8.0, 9.0});
+
+  // Releasing makes the local data owning and frees the buffer.
+  buffer.release(make_not_null(&mortar_data));
+  CHECK(local_data->is_owning());
+  CHECK(*local_data == DataVector{7.0, 8.0, 9.0});
+  CHECK(buffer == SharedMortarDataBuffer<Dim>{});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.DG.SharedMortarDataBuffer",
+                  "[Unit][Evolution]") {
+  test<1>();
+  test<2>();
+  test<3>();
+}
+}  // namespace evolution::dg
@@ -0,0 +1,111 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#include "Evolution/Particles/MonteCarlo/Packet.hpp"
+#include "Evolution/Particles/MonteCarlo/PacketStore.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+using Particles::MonteCarlo::Packet;
+using Particles::MonteCarlo::PacketStore;
+
+template <typename Generator>
+std::vector<Packet> random_packets(const gsl::not_null<Generator*> generator,
+                                   const size_t number_of_packets,
+                                   const size_t number_of_grid_points) {
+  UniformCustomDistribution<double> dist{-1.0, 1.0};
+  UniformCustomDistribution<size_t> grid_point_dist{0,
+                                                    number_of_grid_points - 1};
+  std::vector<Packet> packets{};
+  for (size_t i = 0; i < number_of_packets; ++i) {
+    packets.emplace_back(i % 2, 1.0 + dist(*generator),
+                         grid_point_dist(*generator), dist(*generator),
+                         dist(*generator), dist(*generator), dist(*generator),
+                         1.0, dist(*generator), dist(*generator),
+                         dist(*generator));
+  }
+  return packets;
+}
+
+template <typename Generator>
+void test_store(const gsl::not_null<Generator*> generator) {
+  const size_t number_of_grid_points = 8;
+  const auto packets = random_packets(generator, 13, number_of_grid_points);
+  PacketStore store{packets, 100};
+  CHECK(store.size() == 13);
+  CHECK_FALSE(store.empty());
+  CHECK(store.packets() == packets);
+  CHECK(store.id[4] == 104);
+  CHECK(store.random_number_counter[4] == 0);
+
+  store.push_back(packets[2], 7, 12);
+  CHECK(store.size() == 14);
+  CHECK(store.packet(13) == packets[2]);
+  CHECK(store.id[13] == 7);
+  CHECK(store.random_number_counter[13] == 12);
+
+  store.set_packet(0, packets[1]);
+  CHECK(store.packet(0) == packets[1]);
+  CHECK(store.id[0] == 100);
+
+  store.swap_and_pop(1);
+  CHECK(store.size() == 13);
+  CHECK(store.packet(1) == packets[2]);
+  CHECK(store.id[1] == 7);
+  test_serialization(store);
+
+  {
+    INFO("Sort by closest grid point");
+    // Packets that left the element are sorted into the last bucket
+    Packet packet_outside_element = packets[0];
+    packet_outside_element.index_of_closest_grid_point = number_of_grid_points;
+    store.push_back(packet_outside_element, 200);
+    const PacketStore unsorted_store = store;
+    store.sort_by_closest_grid_point(number_of_grid_points);
+    REQUIRE(store.size() == unsorted_store.size());
+    size_t number_of_packets_in_buckets = 0;
+    for (size_t grid_point = 0; grid_point <= number_of_grid_points;
+         ++grid_point) {
+      CAPTURE(grid_point);
+      CHECK(store.bucket_begin(grid_point) == number_of_packets_in_buckets);
+      for (size_t i = store.bucket_begin(grid_point);
+           i < store.bucket_end(grid_point); ++i) {
+        CHECK(store.index_of_closest_grid_point[i] == grid_point);
+        ++number_of_packets_in_buckets;
+      }
+    }
+    CHECK(number_of_packets_in_buckets == store.size());
+    CHECK(store.id.back() == 200);
+    // The sort moves all data of a packet and is stable
+    std::vector<size_t> unsorted_index(store.size());
+    for (size_t j = 0; j < store.size(); ++j) {
+      for (size_t i = 0; i < unsorted_store.size(); ++i) {
+        if (unsorted_store.id[i] == store.id[j]) {
+          unsorted_index[j] = i;
+          CHECK(store.packet(j) == unsorted_store.packet(i));
+        }
+      }
+      if (j > 0 and store.index_of_closest_grid_point[j] ==
+                        store.index_of_closest_grid_point[j - 1]) {
+        CHECK(unsorted_index[j] > unsorted_index[j - 1]);
+      }
+    }
+  }
+
+  store.clear();
+  CHECK(store.empty());
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.Particles.MonteCarloPacketStore",
+                  "[Unit][Evolution]") {
+  MAKE_GENERATOR(generator);
+  test_store(make_not_null(&generator));
+}
@@ -0,0 +1,115 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Evolution/Particles/MonteCarlo/PhiloxRandomNumberGenerator.hpp"
+#include "Framework/TestHelpers.hpp"
+
+namespace {
+using Particles::MonteCarlo::PhiloxRandomNumberGenerator;
+
+void test_known_answers() {
+  // Known-answer tests of the Random123 library
+  CHECK(Particles::MonteCarlo::detail::philox4x32({0, 0, 0, 0}, {0, 0}) ==
+        std::array<std::uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c,
+                                     0x9b00dbd8});
+  CHECK(Particles::MonteCarlo::detail::philox4x32(
+            {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+            {0xffffffff, 0xffffffff}) ==
+        std::array<std::uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6,
+                                     0x6d5451fd});
+  CHECK(Particles::MonteCarlo::detail::philox4x32(
+            {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+            {0xa4093822, 0x299f31d0}) ==
+        std::array<std::uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420,
+                                     0x24126ea1});
+  // The generator draws the blocks of the counter in order
+  PhiloxRandomNumberGenerator generator{0, 0};
+  CHECK(generator() == 0x6627e8d5);
+  CHECK(generator() == 0xe169c58d);
+  CHECK(generator() == 0xbc57ac4c);
+  CHECK(generator() == 0x9b00dbd8);
+  const auto second_block =
+      Particles::MonteCarlo::detail::philox4x32({1, 0, 0, 0}, {0, 0});
+  CHECK(generator() == second_block[0]);
+  CHECK(generator.counter() == 5);
+}
+
+void test_streams() {
+  const std::uint64_t seed = 0x123456789abcdef;
+  std::vector<std::uint32_t> values{};
+  PhiloxRandomNumberGenerator generator{seed, 7};
+  for (size_t i = 0; i < 10; ++i) {
+    values.push_back(generator());
+  }
+  {
+    INFO("Continue from a counter");
+    PhiloxRandomNumberGenerator continued_generator{seed, 7, 3};
+    for (size_t i = 3; i < 10; ++i) {
+      CHECK(continued_generator() == values[i]);
+    }
+    CHECK(continued_generator == generator);
+  }
+  {
+    INFO("Discard");
+    PhiloxRandomNumberGenerator discarding_generator{seed, 7};
+    discarding_generator();
+    discarding_generator.discard(5);
+    CHECK(discarding_generator() == values[6]);
+  }
+  {
+    INFO("Different streams and seeds");
+    PhiloxRandomNumberGenerator other_stream{seed, 8};
+    PhiloxRandomNumberGenerator other_seed{seed + 1, 7};
+    CHECK(other_stream() != values[0]);
+    CHECK(other_seed() != values[0]);
+    CHECK(other_stream != generator);
+  }
+  {
+    INFO("Serialization");
+    PhiloxRandomNumberGenerator serialized_generator{seed, 7, 2};
+    serialized_generator();
+    const auto deserialized_generator =
+        serialize_and_deserialize(serialized_generator);
+    CHECK(deserialized_generator == serialized_generator);
+    auto copy = deserialized_generator;
+    CHECK(copy() == values[3]);
+  }
+}
+
+void test_uniform_distribution() {
+  PhiloxRandomNumberGenerator generator{42, 3};
+  const size_t number_of_samples = 10000;
+  double mean = 0.0;
+  for (size_t i = 0; i < number_of_samples; ++i) {
+    const double zero_to_one = generator.uniform_zero_to_one();
+    CHECK(zero_to_one >= 0.0);
+    CHECK(zero_to_one < 1.0);
+    const double eps_to_one = generator.uniform_eps_to_one();
+    CHECK(eps_to_one > 0.0);
+    CHECK(eps_to_one <= 1.0);
+    mean += zero_to_one;
+  }
+  mean /= static_cast<double>(number_of_samples);
+  CHECK(mean == approx(0.5).epsilon(0.02));
+  // Works with the distributions of the standard library
+  std::uniform_real_distribution<double> distribution(2.0, 3.0);
+  const double value = distribution(generator);
+  CHECK(value >= 2.0);
+  CHECK(value < 3.0);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.Particles.MonteCarloPhilox",
+                  "[Unit][Evolution]") {
+  test_known_answers();
+  test_streams();
+  test_uniform_distribution();
+}
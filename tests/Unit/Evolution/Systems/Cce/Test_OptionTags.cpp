@@ -123,6 +123,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.OptionTags", "[Unit][Cce]") {
         "OptionTagsKleinGordonCceR0100.h5");
   CHECK(TestHelpers::test_option_tag<Cce::OptionTags::H5LookaheadTimes>("5") ==
         5_st);
+  CHECK(TestHelpers::test_option_tag<Cce::OptionTags::H5PrefetchDepth>("2") ==
+        2_st);
   CHECK(TestHelpers::test_option_tag<Cce::OptionTags::ScriInterpolationOrder>(
             "4") == 4_st);
 
@@ -188,7 +190,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.OptionTags", "[Unit][Cce]") {
       filename, 4.0, 100.0, 0.0, 0.1, 8);
 
   CHECK(Cce::Tags::H5WorldtubeBoundaryDataManager::create_from_options(
-            8, filename, 3, std::make_unique<intrp::CubicSpanInterpolator>(),
+            8, filename, 3, 1, std::make_unique<intrp::CubicSpanInterpolator>(),
             false, true, std::nullopt)
             ->get_l_max() == 8);
 
@@ -4,6 +4,7 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <vector>
 
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -759,6 +760,63 @@ void test_reduced_spec_worldtube_buffer_updater(
       });
   CHECK(buffer_updater.get_extraction_radius() == 100.0);
 }
+
+template <typename Generator>
+void test_prefetching_data_manager(const gsl::not_null<Generator*> gen) {
+  UniformCustomDistribution<double> value_dist{0.1, 0.5};
+  gr::Solutions::KerrSchild solution{
+      value_dist(*gen),
+      {{value_dist(*gen), value_dist(*gen), value_dist(*gen)}},
+      {{value_dist(*gen), value_dist(*gen), value_dist(*gen)}}};
+  const double frequency = 0.1 * value_dist(*gen);
+  const double amplitude = 0.1 * value_dist(*gen);
+  const size_t buffer_size = 4;
+  const size_t l_max = 8;
+
+  DataVector time_buffer{60};
+  for (size_t i = 0; i < time_buffer.size(); ++i) {
+    time_buffer[i] = 0.1 * static_cast<double>(i);
+  }
+  const auto make_manager = [&](const size_t prefetch_depth) {
+    return BondiWorldtubeDataManager{
+        std::make_unique<ReducedDummyBufferUpdater>(
+            time_buffer, solution, std::nullopt, amplitude, frequency, l_max,
+            false),
+        l_max, buffer_size,
+        std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
+        prefetch_depth};
+  };
+  const auto synchronous_manager = make_manager(0);
+  const auto prefetching_manager = make_manager(2);
+
+  const size_t number_of_angular_points =
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max);
+  Variables<Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>
+      expected_boundary_variables{number_of_angular_points};
+  Variables<Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>
+      prefetched_boundary_variables{number_of_angular_points};
+  Parallel::NodeLock hdf5_lock{};
+  // Steady steps that use the prefetched windows, and a jump that skips them
+  std::vector<double> times{};
+  for (size_t i = 0; i < 50; ++i) {
+    times.push_back(0.5 + 0.03 * static_cast<double>(i));
+  }
+  for (size_t i = 0; i < 20; ++i) {
+    times.push_back(4.0 + 0.07 * static_cast<double>(i));
+  }
+  for (const double time : times) {
+    CAPTURE(time);
+    CHECK(synchronous_manager.populate_hypersurface_boundary_data(
+        make_not_null(&expected_boundary_variables), time,
+        make_not_null(&hdf5_lock)));
+    CHECK(prefetching_manager.populate_hypersurface_boundary_data(
+        make_not_null(&prefetched_boundary_variables), time,
+        make_not_null(&hdf5_lock)));
+    CHECK(prefetching_manager.get_time_span() ==
+          synchronous_manager.get_time_span());
+    CHECK(prefetched_boundary_variables == expected_boundary_variables);
+  }
+}
 }  // namespace
 
 // An increased timeout because this test seems to have high variance in
@@ -807,5 +865,9 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.ReadBoundaryDataH5",
                                                 ReducedDummyBufferUpdater>(
         make_not_null(&gen));
   }
+  {
+    INFO("Testing prefetching data manager");
+    test_prefetching_data_manager(make_not_null(&gen));
+  }
 }
 }  // namespace Cce
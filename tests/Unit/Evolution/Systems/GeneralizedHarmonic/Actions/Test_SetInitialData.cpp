@@ -292,6 +292,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Gh.NumericInitialData",
           0.,
           {1.0e-9},
           false,
+          1,
           NumericInitialData::GhVars{"CustomSpacetimeMetric", "CustomPi"}},
       "NumericInitialData:\n"
       "  FileGlob: TestInitialData.h5\n"
@@ -299,13 +300,14 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Gh.NumericInitialData",
       "  ObservationValue: 0.\n"
       "  ObservationValueEpsilon: 1e-9\n"
       "  ElementsAreIdentical: False\n"
+      "  NumberOfThreads: 1\n"
       "  Variables:\n"
       "    SpacetimeMetric: CustomSpacetimeMetric\n"
       "    Pi: CustomPi\n",
       true);
   test_set_initial_data(
       NumericInitialData{
-          "TestInitialData.h5", "VolumeData", 0., std::nullopt, false,
+          "TestInitialData.h5", "VolumeData", 0., std::nullopt, false, 2,
           NumericInitialData::AdmVars{"CustomSpatialMetric", "CustomLapse",
                                       "CustomShift",
                                       "CustomExtrinsicCurvature"}},
@@ -315,6 +317,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Gh.NumericInitialData",
       "  ObservationValue: 0.\n"
       "  ObservationValueEpsilon: Auto\n"
       "  ElementsAreIdentical: False\n"
+      "  NumberOfThreads: 2\n"
       "  Variables:\n"
       "    SpatialMetric: CustomSpatialMetric\n"
       "    Lapse: CustomLapse\n"
@@ -337,6 +337,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.GhValenciaDivClean.SetInitialData",
             0.,
             {1.0e-9},
             false,
+            1,
             gh::NumericInitialData::GhVars{"CustomSpacetimeMetric", "CustomPi"},
             {"CustomRho", "CustomUi", "CustomYe", "CustomB"},
             1.e-14},
@@ -346,6 +347,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.GhValenciaDivClean.SetInitialData",
         "  ObservationValue: 0.\n"
         "  ObservationValueEpsilon: 1e-9\n"
         "  ElementsAreIdentical: False\n"
+        "  NumberOfThreads: 1\n"
         "  GhVariables:\n"
         "    SpacetimeMetric: CustomSpacetimeMetric\n"
         "    Pi: CustomPi\n"
@@ -362,6 +364,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.GhValenciaDivClean.SetInitialData",
                            0.,
                            std::nullopt,
                            false,
+                           2,
                            gh::NumericInitialData::AdmVars{
                                "CustomSpatialMetric", "CustomLapse",
                                "CustomShift", "CustomExtrinsicCurvature"},
@@ -373,6 +376,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.GhValenciaDivClean.SetInitialData",
         "  ObservationValue: 0.\n"
         "  ObservationValueEpsilon: Auto\n"
         "  ElementsAreIdentical: False\n"
+        "  NumberOfThreads: 2\n"
         "  GhVariables:\n"
         "    SpatialMetric: CustomSpatialMetric\n"
         "    Lapse: CustomLapse\n"
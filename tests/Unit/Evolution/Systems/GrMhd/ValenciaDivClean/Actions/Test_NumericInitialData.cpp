@@ -247,6 +247,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.ValenciaDivClean.NumericInitialData",
                          0.,
                          {1.0e-9},
                          false,
+                         1,
                          {"CustomRho", "CustomUi", "CustomYe", "CustomB"},
                          1.e-14},
       "NumericInitialData:\n"
@@ -255,6 +256,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.ValenciaDivClean.NumericInitialData",
       "  ObservationValue: 0.\n"
       "  ObservationValueEpsilon: 1e-9\n"
       "  ElementsAreIdentical: False\n"
+      "  NumberOfThreads: 1\n"
       "  Variables:\n"
       "    RestMassDensity: CustomRho\n"
       "    LowerSpatialFourVelocity: CustomUi\n"
@@ -267,6 +269,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.ValenciaDivClean.NumericInitialData",
                          0.,
                          std::nullopt,
                          false,
+                         2,
                          {"CustomRho", "CustomUi", 0.15, 0.},
                          1.e-14},
       "NumericInitialData:\n"
@@ -275,6 +278,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.ValenciaDivClean.NumericInitialData",
       "  ObservationValue: 0.\n"
       "  ObservationValueEpsilon: Auto\n"
       "  ElementsAreIdentical: False\n"
+      "  NumberOfThreads: 2\n"
       "  Variables:\n"
       "    RestMassDensity: CustomRho\n"
       "    LowerSpatialFourVelocity: CustomUi\n"
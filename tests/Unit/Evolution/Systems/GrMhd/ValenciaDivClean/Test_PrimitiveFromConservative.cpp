@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include <limits>
@@ -13,11 +14,13 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/ConservativeFromPrimitive.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.tpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAlHydro.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservativeOptions.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/PointwiseFunctions/GeneralRelativity/TestHelpers.hpp"
 #include "Helpers/PointwiseFunctions/Hydro/TestHelpers.hpp"
@@ -29,6 +32,7 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/PolytropicFluid.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes {
@@ -407,6 +411,105 @@ void test_primitive_from_conservative_known(const DataVector& used_for_size) {
   }
 }
 
+#ifdef SPECTRE_USE_XSIMD
+// Check that the batched KastaunEtAl recovery agrees with the scalar one, which
+// is the reference implementation.
+template <bool EnforcePhysicality, typename EosType>
+void test_kastaun_batch(const gsl::not_null<std::mt19937*> generator,
+                        const EosType& equation_of_state) {
+  using Batch = simd::batch<double>;
+  constexpr size_t width = simd::size<Batch>();
+  const DataVector used_for_size(width);
+  const auto rest_mass_density =
+      TestHelpers::hydro::random_density(generator, used_for_size);
+  const auto electron_fraction =
+      TestHelpers::hydro::random_electron_fraction(generator, used_for_size);
+  const auto lorentz_factor =
+      TestHelpers::hydro::random_lorentz_factor(generator, used_for_size);
+  const auto specific_internal_energy =
+      TestHelpers::hydro::random_specific_internal_energy(generator,
+                                                          used_for_size);
+  const auto pressure = equation_of_state.pressure_from_density_and_energy(
+      rest_mass_density, specific_internal_energy, electron_fraction);
+  auto spatial_metric =
+      make_with_value<tnsr::ii<DataVector, 3>>(used_for_size, 0.0);
+  for (size_t i = 0; i < 3; ++i) {
+    spatial_metric.get(i, i) = 1.0;
+  }
+  const auto velocity = TestHelpers::hydro::random_velocity(
+      generator, lorentz_factor, spatial_metric);
+  const auto magnetic_field = TestHelpers::hydro::random_magnetic_field(
+      generator, pressure, spatial_metric);
+
+  // The inputs of the recovery in flat space
+  const DataVector d = get(rest_mass_density) * get(lorentz_factor);
+  const DataVector rho_h_w_squared =
+      (get(rest_mass_density) * (1.0 + get(specific_internal_energy)) +
+       get(pressure)) *
+      square(get(lorentz_factor));
+  DataVector b_squared(width, 0.0);
+  DataVector b_dot_v(width, 0.0);
+  for (size_t i = 0; i < 3; ++i) {
+    b_squared += square(magnetic_field.get(i));
+    b_dot_v += magnetic_field.get(i) * velocity.get(i);
+  }
+  DataVector s_squared(width, 0.0);
+  DataVector s_dot_b(width, 0.0);
+  for (size_t i = 0; i < 3; ++i) {
+    const DataVector s_i = (rho_h_w_squared + b_squared) * velocity.get(i) -
+                           b_dot_v * magnetic_field.get(i);
+    s_squared += square(s_i);
+    s_dot_b += s_i * magnetic_field.get(i);
+  }
+  const DataVector tau =
+      rho_h_w_squared - get(pressure) - d + b_squared -
+      0.5 * (square(b_dot_v) + b_squared / square(get(lorentz_factor)));
+
+  const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions options(
+      0.0, 0.0, 0.5 * sqrt(std::numeric_limits<double>::max()));
+  grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PrimitiveRecoveryDataBatch<
+      Batch>
+      batch_result{};
+  const auto success = grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::
+      KastaunEtAl::apply_batch<EnforcePhysicality>(
+          make_not_null(&batch_result), simd::load_unaligned(tau.data()),
+          simd::load_unaligned(s_squared.data()),
+          simd::load_unaligned(s_dot_b.data()),
+          simd::load_unaligned(b_squared.data()),
+          simd::load_unaligned(d.data()),
+          simd::load_unaligned(get(electron_fraction).data()),
+          equation_of_state, options);
+  CHECK(simd::all(success));
+  std::array<DataVector, 5> batch_values{};
+  for (auto& values : batch_values) {
+    values = DataVector(width);
+  }
+  simd::store_unaligned(batch_values[0].data(),
+                        batch_result.rest_mass_density);
+  simd::store_unaligned(batch_values[1].data(), batch_result.lorentz_factor);
+  simd::store_unaligned(batch_values[2].data(), batch_result.pressure);
+  simd::store_unaligned(batch_values[3].data(),
+                        batch_result.specific_internal_energy);
+  simd::store_unaligned(batch_values[4].data(), batch_result.rho_h_w_squared);
+
+  Approx custom_approx = Approx::custom().epsilon(1.e-10).scale(1.0);
+  for (size_t s = 0; s < width; ++s) {
+    CAPTURE(s);
+    const auto scalar_result = grmhd::ValenciaDivClean::
+        PrimitiveRecoverySchemes::KastaunEtAl::apply<EnforcePhysicality>(
+            0.0, tau[s], s_squared[s], s_dot_b[s], b_squared[s], d[s],
+            get(electron_fraction)[s], equation_of_state, options);
+    REQUIRE(scalar_result.has_value());
+    CHECK(batch_values[0][s] ==
+          custom_approx(scalar_result->rest_mass_density));
+    CHECK(batch_values[1][s] == custom_approx(scalar_result->lorentz_factor));
+    CHECK(batch_values[2][s] == custom_approx(scalar_result->pressure));
+    CHECK(batch_values[3][s] ==
+          custom_approx(scalar_result->specific_internal_energy));
+    CHECK(batch_values[4][s] == custom_approx(scalar_result->rho_h_w_squared));
+  }
+}
+#endif  // SPECTRE_USE_XSIMD
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
@@ -532,4 +635,20 @@ SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
       wrapped_3d_polytrope_hot, make_with_value<Scalar<DataVector>>(dv, 1e-4),
       make_with_value<Scalar<DataVector>>(dv, 1e-1),
       make_with_value<Scalar<DataVector>>(dv, 1.0), &generator);
+
+  // Enough points for several full SIMD batches plus a remainder
+  const DataVector many_points(37);
+  test_primitive_from_conservative_random<tmpl::list<
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl>>(
+      &generator, wrapped_ideal_fluid, many_points);
+  test_primitive_from_conservative_random<tmpl::list<
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl,
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin,
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>>(
+      &generator, wrapped_3d_polytrope_hot, many_points);
+#ifdef SPECTRE_USE_XSIMD
+  test_kastaun_batch<true>(make_not_null(&generator), wrapped_ideal_fluid);
+  test_kastaun_batch<false>(make_not_null(&generator), wrapped_ideal_fluid);
+  test_kastaun_batch<true>(make_not_null(&generator), wrapped_3d_polytrope_hot);
+#endif  // SPECTRE_USE_XSIMD
 }
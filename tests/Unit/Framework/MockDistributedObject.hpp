@@ -25,6 +25,7 @@
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/AlgorithmMetafunctions.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
@@ -407,6 +408,10 @@ class MockDistributedObject {
   const databox_type& get_databox() const { return box_; }
   /// @}
 
+  /// The lock that threaded actions receive, like
+  /// `Parallel::DistributedObject::get_node_lock()`.
+  Parallel::NodeLock& get_node_lock() { return node_lock_; }
+
   template <typename Tag>
   const auto& get_databox_tag() const {
     return db::get<Tag>(box_);
@@ -657,9 +662,19 @@ class MockDistributedObject {
   template <typename Action, typename... Args, size_t... Is>
   void forward_tuple_to_threaded_action(std::tuple<Args...>&& args,
                                         std::index_sequence<Is...> /*meta*/) {
-    Action::template apply<Component>(
-        box_, *global_cache_, std::as_const(array_index_),
-        make_not_null(&node_lock_), std::forward<Args>(std::get<Is>(args))...);
+    // Like `Parallel::DistributedObject`, pass the distributed object to the
+    // threaded actions of DG element collections.
+    if constexpr (Parallel::is_dg_element_collection_v<Component>) {
+      Action::template apply<Component>(
+          box_, *global_cache_, std::as_const(array_index_),
+          make_not_null(&node_lock_), this,
+          std::forward<Args>(std::get<Is>(args))...);
+    } else {
+      Action::template apply<Component>(
+          box_, *global_cache_, std::as_const(array_index_),
+          make_not_null(&node_lock_),
+          std::forward<Args>(std::get<Is>(args))...);
+    }
   }
 
   template <typename ThisAction, typename ActionList, typename DbTags>
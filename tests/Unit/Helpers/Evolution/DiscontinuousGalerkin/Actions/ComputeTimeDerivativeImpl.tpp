@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <optional>
 #include <ostream>
+#include <pup.h>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -40,6 +41,9 @@
 #include "Evolution/BoundaryCorrectionTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/ComputeTimeDerivative.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/VolumeTermsImpl.tpp"
+#include "Evolution/DiscontinuousGalerkin/AtomicInboxBoundaryData.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
+#include "Evolution/DiscontinuousGalerkin/InboxTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/Initialization/Mortars.hpp"
 #include "Evolution/DiscontinuousGalerkin/Initialization/QuadratureTag.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
@@ -63,6 +67,10 @@
 #include "NumericalAlgorithms/Spectral/Projection.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
+#include "Parallel/NodeLock.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "Time/AdaptiveSteppingDiagnostics.hpp"
@@ -91,6 +99,7 @@
 #include "Utilities/ProtocolHelpers.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
 
 namespace TestHelpers::evolution::dg::Actions {
 struct Var1 : db::SimpleTag {
@@ -886,11 +895,70 @@ struct System {
   using normal_dot_fluxes = NonconservativeNormalDotFlux<Dim>;
 };
 
+// Stands in for a `Parallel::DgElementArrayMember` neighboring the element
+// under test when using nodegroup DG elements. Only its inbox is used, since
+// the threaded actions it is sent are never invoked.
+template <size_t Dim>
+class MockElement {
+ public:
+  using inbox_tags = tmpl::list<
+      ::evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<Dim, true>>;
+
+  MockElement() = default;
+
+  tuples::tagged_tuple_from_typelist<inbox_tags>& inboxes() {
+    return inboxes_;
+  }
+  Parallel::NodeLock& inbox_lock() { return inbox_lock_; }
+  Parallel::NodeLock& element_lock() { return element_lock_; }
+  void perform_algorithm() {}
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) { p | inboxes_; }
+
+ private:
+  tuples::tagged_tuple_from_typelist<inbox_tags> inboxes_{};
+  Parallel::NodeLock inbox_lock_{};
+  Parallel::NodeLock element_lock_{};
+};
+
+template <size_t Dim>
+struct MockElementCollection : db::SimpleTag {
+  using type = std::unordered_map<ElementId<Dim>, MockElement<Dim>>;
+};
+
+template <size_t Dim>
+struct InitializeMockElementCollection {
+  using simple_tags = tmpl::list<MockElementCollection<Dim>,
+                                 Parallel::Tags::ElementLocations<Dim>>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& /*box*/,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+// When using nodegroup DG elements the DataBox of the (single) node holds
+// both the element under test and the collection of its neighbors.
 template <typename Metavariables>
 struct component {
   using metavariables = Metavariables;
-  using chare_type = ActionTesting::MockArrayChare;
-  using array_index = ElementId<Metavariables::volume_dim>;
+  using chare_type =
+      tmpl::conditional_t<Metavariables::use_nodegroup_dg_elements,
+                          ActionTesting::MockNodeGroupChare,
+                          ActionTesting::MockArrayChare>;
+  using array_index =
+      tmpl::conditional_t<Metavariables::use_nodegroup_dg_elements, size_t,
+                          ElementId<Metavariables::volume_dim>>;
+  using element_collection_tag =
+      MockElementCollection<Metavariables::volume_dim>;
 
   using variables_tag = typename Metavariables::system::variables_tag;
   using internal_directions =
@@ -965,7 +1033,11 @@ struct component {
           tmpl::flatten<tmpl::list<
               ActionTesting::InitializeDataBox<simple_tags, compute_tags>,
               ::evolution::dg::Initialization::Mortars<
-                  Metavariables::volume_dim, typename Metavariables::system>>>>,
+                  Metavariables::volume_dim, typename Metavariables::system>,
+              tmpl::conditional_t<Metavariables::use_nodegroup_dg_elements,
+                                  InitializeMockElementCollection<
+                                      Metavariables::volume_dim>,
+                                  tmpl::list<>>>>>,
       Parallel::PhaseActions<
           Parallel::Phase::Testing,
           tmpl::list<::evolution::dg::Actions::ComputeTimeDerivative<
@@ -973,6 +1045,16 @@ struct component {
               AllStepChoosers, Metavariables::local_time_stepping,
               Metavariables::use_nodegroup_dg_elements>>>>;
 };
+}  // namespace TestHelpers::evolution::dg::Actions
+
+namespace Parallel {
+template <typename Metavariables>
+struct is_dg_element_collection<
+    TestHelpers::evolution::dg::Actions::component<Metavariables>>
+    : std::bool_constant<Metavariables::use_nodegroup_dg_elements> {};
+}  // namespace Parallel
+
+namespace TestHelpers::evolution::dg::Actions {
 
 template <size_t Dim, SystemType SystemTypeIn, bool LocalTimeStepping,
           bool UseMovingMesh, bool HasPrimitiveVariables, bool PassVariables,
@@ -1033,6 +1115,7 @@ void test_impl(const Spectral::Quadrature quadrature,
   CAPTURE(system_type);
   CAPTURE(HasPrims);
   CAPTURE(PassVariables);
+  CAPTURE(UseNodegroupDgElements);
   CAPTURE(quadrature);
   CAPTURE(dg_formulation);
   using metavars =
@@ -1174,11 +1257,33 @@ void test_impl(const Spectral::Quadrature quadrature,
            std::move(boundary_conditions)}};
     }
   }();
-  const auto get_tag = [&runner, &self_id](auto tag_v) -> decltype(auto) {
+  typename component<metavars>::array_index self_index{};
+  if constexpr (not UseNodegroupDgElements) {
+    self_index = self_id;
+  }
+  const auto get_tag = [&runner, &self_index](auto tag_v) -> decltype(auto) {
     using tag = std::decay_t<decltype(tag_v)>;
-    return ActionTesting::get_databox_tag<component<metavars>, tag>(runner,
-                                                                    self_id);
+    return ActionTesting::get_databox_tag<component<metavars>, tag>(
+        runner, self_index);
   };
+  // With nodegroup DG elements only the element under test is emplaced. Its
+  // neighbors are added to the element collection after initialization.
+  const auto emplace_element =
+      [&runner, &self_id](
+          const ElementId<Dim>& element_id,
+          const tuples::tagged_tuple_from_typelist<
+              typename component<metavars>::simple_tags>& initial_values) {
+        if constexpr (UseNodegroupDgElements) {
+          if (element_id == self_id) {
+            ActionTesting::emplace_nodegroup_component_and_initialize<
+                component<metavars>>(&runner, initial_values);
+          }
+        } else {
+          (void)self_id;
+          ActionTesting::emplace_component_and_initialize<component<metavars>>(
+              &runner, element_id, initial_values);
+        }
+      };
 
   const Mesh<Dim> mesh{2, Spectral::Basis::Legendre, quadrature};
 
@@ -1322,8 +1427,8 @@ void test_impl(const Spectral::Quadrature quadrature,
     std::vector<std::unique_ptr<StepChooser<StepChooserUse::LtsStep>>>
         step_choosers;
     step_choosers.emplace_back(std::make_unique<StepChoosers::Constant>(0.128));
-    ActionTesting::emplace_component_and_initialize<component<metavars>>(
-        &runner, self_id,
+    emplace_element(
+        self_id,
         {time_step_id,
          next_time_step_id,
          time_step,
@@ -1354,8 +1459,8 @@ void test_impl(const Spectral::Quadrature quadrature,
     for (const auto& [direction, neighbor_ids] : neighbors) {
       (void)direction;
       for (const auto& neighbor_id : neighbor_ids) {
-        ActionTesting::emplace_component_and_initialize<component<metavars>>(
-            &runner, neighbor_id,
+        emplace_element(
+            neighbor_id,
             {time_step_id,
              next_time_step_id,
              time_step,
@@ -1387,8 +1492,8 @@ void test_impl(const Spectral::Quadrature quadrature,
       }
     }
   } else {
-    ActionTesting::emplace_component_and_initialize<component<metavars>>(
-        &runner, self_id,
+    emplace_element(
+        self_id,
         {time_step_id,
          next_time_step_id,
          time_step,
@@ -1418,8 +1523,8 @@ void test_impl(const Spectral::Quadrature quadrature,
     for (const auto& [direction, neighbor_ids] : neighbors) {
       (void)direction;
       for (const auto& neighbor_id : neighbor_ids) {
-        ActionTesting::emplace_component_and_initialize<component<metavars>>(
-            &runner, neighbor_id,
+        emplace_element(
+            neighbor_id,
             {time_step_id,
              next_time_step_id,
              time_step,
@@ -1453,14 +1558,38 @@ void test_impl(const Spectral::Quadrature quadrature,
 
   // Initialize both the "old" and "new" mortars
   ActionTesting::next_action<component<metavars>>(make_not_null(&runner),
-                                                  self_id);
+                                                  self_index);
+  if constexpr (UseNodegroupDgElements) {
+    ActionTesting::next_action<component<metavars>>(make_not_null(&runner),
+                                                    self_index);
+    // All elements are on the only node.
+    db::mutate<Parallel::Tags::ElementLocations<Dim>,
+               MockElementCollection<Dim>>(
+        [&neighbors, &self_id](
+            const gsl::not_null<std::unordered_map<ElementId<Dim>, size_t>*>
+                element_locations,
+            const gsl::not_null<
+                std::unordered_map<ElementId<Dim>, MockElement<Dim>>*>
+                element_collection) {
+          (*element_locations)[self_id] = 0;
+          for (const auto& [direction, neighbor_ids] : neighbors) {
+            (void)direction;
+            for (const auto& neighbor_id : neighbor_ids) {
+              (*element_locations)[neighbor_id] = 0;
+              element_collection->try_emplace(neighbor_id);
+            }
+          }
+        },
+        make_not_null(&ActionTesting::get_databox<component<metavars>>(
+            make_not_null(&runner), self_index)));
+  }
   const auto variables_before_compute_time_derivatives =
       get_tag(variables_tag{});
   // Start testing the actual dg::ComputeTimeDerivative action
   DemandOutgoingCharSpeeds<Dim>::number_of_times_called = 0;
   ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
   ActionTesting::next_action<component<metavars>>(make_not_null(&runner),
-                                                  self_id);
+                                                  self_index);
   CHECK(DemandOutgoingCharSpeeds<Dim>::number_of_times_called ==
         element.external_boundaries().size());
 
@@ -1653,7 +1782,7 @@ void test_impl(const Spectral::Quadrature quadrature,
                  component<metavars>,
                  db::add_tag_prefix<::Tags::dt,
                                     typename metavars::system::variables_tag>>(
-          runner, self_id)),
+          runner, self_index)),
       expected_dt_evolved_vars);
 
   const DirectionalId<Dim> mortar_id_east{Direction<Dim>::upper_xi(), east_id};
@@ -1879,48 +2008,68 @@ void test_impl(const Spectral::Quadrature quadrature,
         compute_expected_mortar_data(mortar_id_east.direction(),
                                      mortar_id_east.id(), true));
   }
+  // The data sent across `mortar_id`, read from the inbox of the neighbor.
+  const auto received_data =
+      [&element, &runner, &self_index, &time_step_id](
+          const DirectionalId<Dim>& mortar_id)
+      -> const ::evolution::dg::BoundaryData<Dim>& {
+    const DirectionalId<Dim> id_from_neighbor{
+        element.neighbors()
+            .at(mortar_id.direction())
+            .orientation()(mortar_id.direction().opposite()),
+        element.id()};
+    if constexpr (UseNodegroupDgElements) {
+      auto& inbox =
+          tuples::get<::evolution::dg::Tags::
+                          BoundaryCorrectionAndGhostCellsInbox<Dim, true>>(
+              db::get_mutable_reference<MockElementCollection<Dim>>(
+                  make_not_null(&ActionTesting::get_databox<
+                                component<metavars>>(make_not_null(&runner),
+                                                     self_index)))
+                  .at(mortar_id.id())
+                  .inboxes());
+      auto& queue = gsl::at(
+          inbox.boundary_data_in_directions,
+          ::evolution::dg::AtomicInboxBoundaryData<Dim>::index(
+              id_from_neighbor));
+      const auto* const received = queue.front();
+      REQUIRE(received != nullptr);
+      CHECK(std::get<0>(*received) == time_step_id);
+      CHECK(std::get<2>(*received) == id_from_neighbor);
+      return std::get<1>(*received);
+    } else {
+      (void)self_index;
+      return ActionTesting::get_inbox_tag<
+                 component<metavars>,
+                 ::evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<
+                     Dim, false>>(runner, mortar_id.id())
+          .at(time_step_id)
+          .at(id_from_neighbor);
+    }
+  };
   CHECK_ITERABLE_APPROX(
-      (ActionTesting::get_inbox_tag<
-           component<metavars>,
-           ::evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<
-               Dim, UseNodegroupDgElements>>(runner, mortar_id_east.id())
-           .at(time_step_id)
-           .at(DirectionalId<Dim>{
-               element.neighbors()
-                   .at(mortar_id_east.direction())
-                   .orientation()(mortar_id_east.direction().opposite()),
-               element.id()})
-           .boundary_correction_data.value()),
+      received_data(mortar_id_east).boundary_correction_data.value(),
       compute_expected_mortar_data(mortar_id_east.direction(),
                                    mortar_id_east.id(), false));
-
-  CHECK((ActionTesting::get_inbox_tag<
-             component<metavars>,
-             ::evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<
-                 Dim, UseNodegroupDgElements>>(runner, mortar_id_east.id())
-             .at(time_step_id)
-             .at(DirectionalId<Dim>{
-                 element.neighbors()
-                     .at(mortar_id_east.direction())
-                     .orientation()(mortar_id_east.direction().opposite()),
-                 element.id()})
-             .validity_range) ==
+  CHECK(received_data(mortar_id_east).validity_range ==
         (LocalTimeStepping ? next_time_step_id : time_step_id));
+  if constexpr (UseNodegroupDgElements and not LocalTimeStepping) {
+    // The aligned neighbor on the same node receives a view of the local
+    // mortar data instead of a copy.
+    const DataVector& east_data =
+        received_data(mortar_id_east).boundary_correction_data.value();
+    CHECK_FALSE(east_data.is_owning());
+    CHECK(east_data.data() == get_tag(::evolution::dg::Tags::MortarData<Dim>{})
+                                  .at(mortar_id_east)
+                                  .local()
+                                  .mortar_data.value()
+                                  .data());
+  }
 
   if constexpr (Dim > 1) {
     const DirectionalId<Dim> mortar_id_south{Direction<Dim>::lower_eta(),
                                              south_id};
-    CHECK((ActionTesting::get_inbox_tag<
-               component<metavars>,
-               ::evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<
-                   Dim, UseNodegroupDgElements>>(runner, mortar_id_south.id())
-               .at(time_step_id)
-               .at(DirectionalId<Dim>{
-                   element.neighbors()
-                       .at(mortar_id_south.direction())
-                       .orientation()(mortar_id_south.direction().opposite()),
-                   element.id()})
-               .validity_range) ==
+    CHECK(received_data(mortar_id_south).validity_range ==
           (LocalTimeStepping ? next_time_step_id : time_step_id));
 
     if (LocalTimeStepping) {
@@ -1945,19 +2094,11 @@ void test_impl(const Spectral::Quadrature quadrature,
                                 Direction<Dim>::lower_eta(), south_id, true));
     }
     CHECK_ITERABLE_APPROX(
-        (ActionTesting::get_inbox_tag<
-             component<metavars>,
-             ::evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<
-                 Dim, UseNodegroupDgElements>>(runner, mortar_id_south.id())
-             .at(time_step_id)
-             .at(DirectionalId<Dim>{
-                 element.neighbors()
-                     .at(mortar_id_south.direction())
-                     .orientation()(mortar_id_south.direction().opposite()),
-                 element.id()})
-             .boundary_correction_data.value()),
+        received_data(mortar_id_south).boundary_correction_data.value(),
         compute_expected_mortar_data(mortar_id_south.direction(),
                                      mortar_id_south.id(), false));
+    // The neighbor that isn't aligned is sent a reoriented copy.
+    CHECK(received_data(mortar_id_south).boundary_correction_data->is_owning());
   }
   if constexpr (LocalTimeStepping) {
     for (const auto& mortar_data :
@@ -2028,8 +2169,6 @@ void test() {
   register_derived_classes_with_charm<
       BoundaryCorrection<Dim, false>>();
 
-  constexpr bool use_nodegroup_dg_elements = false;
-
   const auto invoke_tests_with_quadrature_and_formulation =
       [](const Spectral::Quadrature quadrature,
          const ::dg::Formulation local_dg_formulation) {
@@ -2042,25 +2181,27 @@ void test() {
             (void)moving_mesh;
             if constexpr (not(decltype(use_prims)::value and
                               system_type == SystemType::Nonconservative)) {
-              // PassVariables == false
+              // PassVariables == false, with and without nodegroup elements
+              test_impl<false, std::decay_t<decltype(moving_mesh)>::value, Dim,
+                        system_type, std::decay_t<decltype(use_prims)>::value,
+                        false, false>(quadrature, local_dg_formulation);
+              test_impl<true, std::decay_t<decltype(moving_mesh)>::value, Dim,
+                        system_type, std::decay_t<decltype(use_prims)>::value,
+                        false, false>(quadrature, local_dg_formulation);
               test_impl<false, std::decay_t<decltype(moving_mesh)>::value, Dim,
                         system_type, std::decay_t<decltype(use_prims)>::value,
-                        false, use_nodegroup_dg_elements>(quadrature,
-                                                          local_dg_formulation);
+                        false, true>(quadrature, local_dg_formulation);
               test_impl<true, std::decay_t<decltype(moving_mesh)>::value, Dim,
                         system_type, std::decay_t<decltype(use_prims)>::value,
-                        false, use_nodegroup_dg_elements>(quadrature,
-                                                          local_dg_formulation);
+                        false, true>(quadrature, local_dg_formulation);
 
               // PassVariables == true
               test_impl<false, std::decay_t<decltype(moving_mesh)>::value, Dim,
                         system_type, std::decay_t<decltype(use_prims)>::value,
-                        true, use_nodegroup_dg_elements>(quadrature,
-                                                         local_dg_formulation);
+                        true, false>(quadrature, local_dg_formulation);
               test_impl<true, std::decay_t<decltype(moving_mesh)>::value, Dim,
                         system_type, std::decay_t<decltype(use_prims)>::value,
-                        true, use_nodegroup_dg_elements>(quadrature,
-                                                         local_dg_formulation);
+                        true, false>(quadrature, local_dg_formulation);
             }
           };
           prim_helper(std::integral_constant<bool, false>{});
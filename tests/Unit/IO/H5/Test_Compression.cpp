@@ -0,0 +1,332 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <hdf5.h>
+#include <limits>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
+#include "IO/H5/Compression.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/Helpers.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "IO/H5/Wrappers.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+template <typename T>
+void test_truncate_mantissa(const size_t stored_mantissa_bits) {
+  const std::vector<T> original{
+      static_cast<T>(1.0),
+      static_cast<T>(-3.14159265358979),
+      static_cast<T>(1.0e-30),
+      static_cast<T>(2.718281828459045e20),
+      static_cast<T>(0.0),
+      std::numeric_limits<T>::max(),
+      std::numeric_limits<T>::infinity(),
+      std::numeric_limits<T>::quiet_NaN()};
+  for (const size_t mantissa_bits : {size_t{0}, size_t{7}, size_t{12},
+                                     stored_mantissa_bits}) {
+    CAPTURE(mantissa_bits);
+    auto truncated = original;
+    h5::truncate_mantissa(make_not_null(&truncated), mantissa_bits);
+    const T tolerance = std::ldexp(static_cast<T>(1.0),
+                                   -static_cast<int>(mantissa_bits) - 1);
+    for (size_t i = 0; i + 2 < original.size(); ++i) {
+      CAPTURE(original[i]);
+      CHECK(std::abs(truncated[i] - original[i]) <=
+            tolerance * std::abs(original[i]));
+      CHECK(std::isfinite(truncated[i]));
+    }
+    CHECK(truncated[6] == original[6]);
+    CHECK(std::isnan(truncated[7]));
+    if (mantissa_bits == stored_mantissa_bits) {
+      CHECK(truncated[1] == original[1]);
+    }
+  }
+  // Exact values survive truncation
+  std::vector<T> exact{static_cast<T>(1.5), static_cast<T>(-0.75)};
+  h5::truncate_mantissa(make_not_null(&exact), 1);
+  CHECK(exact == std::vector<T>{static_cast<T>(1.5), static_cast<T>(-0.75)});
+  // Rounding to nearest
+  std::vector<T> rounded{static_cast<T>(1.75), static_cast<T>(1.2)};
+  h5::truncate_mantissa(make_not_null(&rounded), 1);
+  CHECK(rounded == std::vector<T>{static_cast<T>(2.0), static_cast<T>(1.0)});
+}
+
+void test_compression_struct() {
+  const h5::Compression deflate{};
+  CHECK(deflate.codec == h5::Compression::Codec::Deflate);
+  CHECK(deflate.level == 5);
+  CHECK(deflate.shuffle);
+  CHECK_FALSE(deflate.mantissa_bits.has_value());
+  CHECK(deflate.target_bytes_per_chunk == 131'072);
+  CHECK(deflate.number_of_threads == 1);
+  CHECK(h5::Compression::none().codec == h5::Compression::Codec::None);
+  CHECK(deflate != h5::Compression::none());
+  h5::Compression lossy{};
+  lossy.mantissa_bits = 20;
+  CHECK(lossy != deflate);
+  CHECK(lossy == lossy);
+  h5::Compression threaded{};
+  threaded.number_of_threads = 4;
+  CHECK(threaded != deflate);
+
+  CHECK(get_output(h5::Compression::Codec::None) == "None");
+  CHECK(get_output(h5::Compression::Codec::Deflate) == "Deflate");
+  CHECK(get_output(h5::Compression::Codec::Lz4) == "Lz4");
+  CHECK(get_output(h5::Compression::Codec::Zstd) == "Zstd");
+
+  CHECK(h5::detail::chunk_size({10, 100'000}, 8, 131'072) ==
+        std::vector<hsize_t>{10, 16'384});
+  CHECK(h5::detail::chunk_size({3}, 8, 4) == std::vector<hsize_t>{1});
+  CHECK(h5::detail::filter_available(H5Z_FILTER_DEFLATE));
+}
+
+// Number of filters on the dataset at `path`, or -1 if it is contiguous
+int number_of_filters(const std::string& file_name, const std::string& path) {
+  const hid_t file_id =
+      H5Fopen(file_name.c_str(), H5F_ACC_RDONLY, h5::h5p_default());
+  CHECK_H5(file_id, "Failed to open file " << file_name);
+  const hid_t dataset_id = H5Dopen2(file_id, path.c_str(), h5::h5p_default());
+  CHECK_H5(dataset_id, "Failed to open dataset " << path);
+  const hid_t property_list = H5Dget_create_plist(dataset_id);
+  const int result = H5Pget_layout(property_list) == H5D_CONTIGUOUS
+                         ? -1
+                         : H5Pget_nfilters(property_list);
+  CHECK_H5(H5Pclose(property_list), "Failed to close property list");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+  CHECK_H5(H5Fclose(file_id), "Failed to close file");
+  return result;
+}
+
+void test_round_trip(const h5::Compression& compression) {
+  CAPTURE(compression.codec);
+  const std::string file_name{"Unit.IO.H5.Compression.h5"};
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+
+  const size_t number_of_points = 4096;
+  DataVector u(number_of_points);
+  std::vector<float> v(number_of_points);
+  for (size_t i = 0; i < number_of_points; ++i) {
+    u[i] = std::sin(0.01 * static_cast<double>(i));
+    v[i] = static_cast<float>(std::cos(0.01 * static_cast<double>(i)));
+  }
+  std::vector<std::vector<double>> dat_rows(100, std::vector<double>(3));
+  for (size_t i = 0; i < dat_rows.size(); ++i) {
+    dat_rows[i] = {static_cast<double>(i), 1.0 / (1.0 + static_cast<double>(i)),
+                   std::exp(-static_cast<double>(i))};
+  }
+
+  {
+    h5::H5File<h5::AccessType::ReadWrite> file{file_name};
+    auto& volume_file =
+        file.insert<h5::VolumeData>("/element_data", 0, compression);
+    volume_file.write_volume_data(
+        100, 1.0,
+        {{"[B0,(L0I0)]",
+          {TensorComponent{"U", u}, TensorComponent{"V", v}},
+          {number_of_points},
+          {Spectral::Basis::Legendre},
+          {Spectral::Quadrature::GaussLobatto}}});
+    volume_file.write_tensor_component(100, "W", u);
+    file.close_current_object();
+    auto& dat_file = file.insert<h5::Dat>(
+        "/norms", std::vector<std::string>{"Time", "A", "B"}, 0, compression);
+    for (const auto& row : dat_rows) {
+      dat_file.append(row);
+    }
+  }
+
+  {
+    const h5::H5File<h5::AccessType::ReadOnly> file{file_name};
+    const auto& volume_file = file.get<h5::VolumeData>("/element_data");
+    const auto read_u =
+        std::get<DataVector>(volume_file.get_tensor_component(100, "U").data);
+    const auto read_v = std::get<std::vector<float>>(
+        volume_file.get_tensor_component(100, "V").data);
+    const auto read_w =
+        std::get<DataVector>(volume_file.get_tensor_component(100, "W").data);
+    const auto& dat_file = file.get<h5::Dat>("/norms");
+    const auto read_rows =
+        dat_file.get_data<std::vector<std::vector<double>>>();
+    REQUIRE(read_u.size() == number_of_points);
+    REQUIRE(read_v.size() == number_of_points);
+    REQUIRE(read_w.size() == number_of_points);
+    REQUIRE(read_rows.size() == dat_rows.size());
+    if (compression.mantissa_bits.has_value()) {
+      const double tolerance =
+          std::ldexp(1.0, -static_cast<int>(*compression.mantissa_bits) - 1);
+      Approx custom_approx = Approx::custom().epsilon(tolerance).scale(1.0);
+      CHECK_ITERABLE_CUSTOM_APPROX(read_u, u, custom_approx);
+      CHECK(read_w == read_u);
+      for (size_t i = 0; i < number_of_points; ++i) {
+        CHECK(std::abs(read_v[i] - v[i]) <=
+              static_cast<float>(tolerance) * std::abs(v[i]));
+      }
+      CHECK_ITERABLE_CUSTOM_APPROX(read_rows, dat_rows, custom_approx);
+    } else {
+      CHECK(read_u == u);
+      CHECK(read_v == v);
+      CHECK(read_w == u);
+      CHECK(read_rows == dat_rows);
+    }
+  }
+
+  const int filters =
+      number_of_filters(file_name, "/element_data.vol/ObservationId100/U");
+  const int dat_filters = number_of_filters(file_name, "/norms.dat");
+  // The DataVector overload of `write_tensor_component` uses the same
+  // compression as `write_volume_data` when one is given.
+  CHECK(number_of_filters(file_name, "/element_data.vol/ObservationId100/W") ==
+        filters);
+  if (compression.codec == h5::Compression::Codec::None) {
+    CHECK(filters == -1);
+    CHECK(dat_filters == 0);
+  } else {
+    // Shuffle plus a compression filter. Lz4 and Zstd fall back to deflate
+    // when their plugins are not available.
+    CHECK(filters == (compression.shuffle ? 2 : 1));
+    CHECK(dat_filters == (compression.shuffle ? 2 : 1));
+  }
+
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+}
+
+void test_volume_data_default() {
+  const std::string file_name{"Unit.IO.H5.CompressionDefault.h5"};
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+  const DataVector u{1.0, 2.0, 3.0, 4.0};
+  {
+    h5::H5File<h5::AccessType::ReadWrite> file{file_name};
+    auto& volume_file = file.insert<h5::VolumeData>("/element_data", 0);
+    volume_file.write_volume_data(
+        100, 1.0,
+        {{"[B0,(L0I0)]",
+          {TensorComponent{"U", u}},
+          {u.size()},
+          {Spectral::Basis::Legendre},
+          {Spectral::Quadrature::GaussLobatto}}});
+    volume_file.write_tensor_component(100, "W", u);
+  }
+  // Without a compression, volume data is deflated and tensor components
+  // written from a DataVector stay contiguous.
+  CHECK(number_of_filters(file_name, "/element_data.vol/ObservationId100/U") ==
+        2);
+  CHECK(number_of_filters(file_name, "/element_data.vol/ObservationId100/W") ==
+        -1);
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+}
+
+// Chunks compressed on helper threads are stored exactly as HDF5 would store
+// them, including a last chunk that is only partly filled.
+void test_threaded_chunks_match_hdf5(const bool shuffle) {
+  CAPTURE(shuffle);
+  const std::string file_name{"Unit.IO.H5.CompressionChunks.h5"};
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+  std::vector<double> data(3000);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = std::sin(0.01 * static_cast<double>(i));
+  }
+  h5::Compression compression{};
+  compression.shuffle = shuffle;
+  compression.target_bytes_per_chunk = 8192;
+  const hid_t file_id = H5Fcreate(file_name.c_str(), H5F_ACC_TRUNC,
+                                  h5::h5p_default(), h5::h5p_default());
+  CHECK_H5(file_id, "Failed to create file " << file_name);
+  h5::write_data(file_id, data, {data.size()}, "serial", false, compression);
+  compression.number_of_threads = 3;
+  h5::write_data(file_id, data, {data.size()}, "threaded", false,
+                 compression);
+
+  const hid_t serial_id = H5Dopen2(file_id, "serial", h5::h5p_default());
+  const hid_t threaded_id = H5Dopen2(file_id, "threaded", h5::h5p_default());
+  CHECK_H5(serial_id, "Failed to open dataset");
+  CHECK_H5(threaded_id, "Failed to open dataset");
+  const hsize_t chunk_size = 1024;
+  for (hsize_t offset = 0; offset < data.size(); offset += chunk_size) {
+    CAPTURE(offset);
+    hsize_t serial_bytes = 0;
+    hsize_t threaded_bytes = 0;
+    CHECK_H5(H5Dget_chunk_storage_size(serial_id, &offset, &serial_bytes),
+             "Failed to get chunk size");
+    CHECK_H5(H5Dget_chunk_storage_size(threaded_id, &offset, &threaded_bytes),
+             "Failed to get chunk size");
+    REQUIRE(threaded_bytes == serial_bytes);
+    std::vector<unsigned char> serial_chunk(serial_bytes);
+    std::vector<unsigned char> threaded_chunk(threaded_bytes);
+    uint32_t filter_mask = 0;
+    CHECK_H5(H5Dread_chunk(serial_id, h5::h5p_default(), &offset,
+                           &filter_mask, serial_chunk.data()),
+             "Failed to read chunk");
+    CHECK_H5(H5Dread_chunk(threaded_id, h5::h5p_default(), &offset,
+                           &filter_mask, threaded_chunk.data()),
+             "Failed to read chunk");
+    CHECK(threaded_chunk == serial_chunk);
+  }
+  CHECK_H5(H5Dclose(serial_id), "Failed to close dataset");
+  CHECK_H5(H5Dclose(threaded_id), "Failed to close dataset");
+  CHECK_H5(H5Fclose(file_id), "Failed to close file");
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.H5.Compression", "[Unit][IO][H5]") {
+  test_truncate_mantissa<double>(52);
+  test_truncate_mantissa<float>(23);
+  test_compression_struct();
+  test_volume_data_default();
+
+  test_round_trip(h5::Compression{});
+  test_round_trip(h5::Compression::none());
+  for (const auto codec :
+       {h5::Compression::Codec::Lz4, h5::Compression::Codec::Zstd}) {
+    h5::Compression fast{};
+    fast.codec = codec;
+    fast.level = 3;
+    test_round_trip(fast);
+  }
+  h5::Compression lossy{};
+  lossy.mantissa_bits = 16;
+  lossy.target_bytes_per_chunk = 8192;
+  test_round_trip(lossy);
+  lossy.shuffle = false;
+  lossy.mantissa_bits = 0;
+  test_round_trip(lossy);
+  // Chunks compressed on helper threads and written with H5Dwrite_chunk
+  for (const bool shuffle : {true, false}) {
+    h5::Compression threaded{};
+    threaded.shuffle = shuffle;
+    threaded.number_of_threads = 3;
+    threaded.target_bytes_per_chunk = 8192;
+    test_round_trip(threaded);
+    test_threaded_chunks_match_hdf5(shuffle);
+  }
+}
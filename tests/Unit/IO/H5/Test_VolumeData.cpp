@@ -331,6 +331,25 @@ void test() {
     CHECK(last_grid_offset_and_length.second == 8);
   }
 
+  {
+    INFO("Read parts of a tensor component");
+    const size_t observation_id = observation_ids.front();
+    CHECK(get<DataType>(volume_file
+                            .get_tensor_component(observation_id, "U",
+                                                  {{1, 3}, {8, 2}, {15, 1}})
+                            .data) == DataType{2., 3., 4., 9., 10., 16.});
+    CHECK(get<DataType>(volume_file
+                            .get_tensor_component(observation_id, "U",
+                                                  {{0, 0}, {4, 1}})
+                            .data) == DataType{5.});
+    CHECK(get<DataType>(
+              volume_file.get_tensor_component(observation_id, "U", {}).data)
+              .empty());
+    CHECK_THROWS_WITH(
+        volume_file.get_tensor_component(observation_id, "U", {{10, 7}}),
+        Catch::Matchers::ContainsSubstring("out of bounds"));
+  }
+
   {
     INFO("mesh_for_grid");
     const size_t observation_id = observation_ids.front();
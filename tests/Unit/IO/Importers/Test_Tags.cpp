@@ -39,7 +39,8 @@ SPECTRE_TEST_CASE("Unit.IO.Importers.Tags", "[Unit][IO]") {
       "    Subgroup: data.group\n"
       "    ObservationValue: 1.\n"
       "    ObservationValueEpsilon: 1e-9\n"
-      "    ElementsAreIdentical: True");
+      "    ElementsAreIdentical: True\n"
+      "    NumberOfThreads: 4");
   const auto& options =
       opts.get<importers::Tags::ImporterOptions<ExampleVolumeData>>();
   using tuples::get;
@@ -52,6 +53,7 @@ SPECTRE_TEST_CASE("Unit.IO.Importers.Tags", "[Unit][IO]") {
   CHECK(obs_val_eps.has_value());
   CHECK(obs_val_eps.value() == 1.0e-9);
   CHECK(get<importers::OptionTags::ElementsAreIdentical>(options));
+  CHECK(get<importers::OptionTags::NumberOfThreads>(options) == 4);
 
   CHECK(
       std::get<importers::ObservationSelector>(
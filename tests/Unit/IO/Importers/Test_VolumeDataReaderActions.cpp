@@ -32,10 +32,13 @@
 #include "IO/Importers/Actions/RegisterWithElementDataReader.hpp"
 #include "IO/Importers/ElementDataReader.hpp"
 #include "IO/Importers/Tags.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/Tags.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Parallel/ArrayComponentId.hpp"
 #include "Parallel/ArrayIndex.hpp"
+#include "Parallel/NodeLock.hpp"
 #include "Parallel/Phase.hpp"
 #include "Utilities/FileSystem.hpp"
 #include "Utilities/MakeString.hpp"
@@ -98,11 +101,24 @@ struct MockVolumeDataReader {
           metavariables::volume_dim>>>>;
 };
 
+template <typename Metavariables>
+struct MockObserverWriter {
+  using component_being_mocked = observers::ObserverWriter<Metavariables>;
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockNodeGroupChare;
+  using array_index = size_t;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<
+          tmpl::list<observers::Tags::H5FileLock>>>>>;
+};
+
 template <bool AddSubcell>
 struct Metavariables {
   static constexpr size_t volume_dim = 2;
   using component_list = tmpl::list<MockElementArray<Metavariables, AddSubcell>,
-                                    MockVolumeDataReader<Metavariables>>;
+                                    MockVolumeDataReader<Metavariables>,
+                                    MockObserverWriter<Metavariables>>;
 };
 
 template <bool AddSubcell>
@@ -118,10 +134,15 @@ void test_actions(const std::variant<double, importers::ObservationSelector>&
   using metavars = Metavariables<AddSubcell>;
   using reader_component = MockVolumeDataReader<metavars>;
   using element_array = MockElementArray<metavars, AddSubcell>;
+  using writer_component = MockObserverWriter<metavars>;
 
   ActionTesting::MockRuntimeSystem<metavars> runner{{importers::ImporterOptions{
       "TestVolumeData*.h5", "element_data", observation_selection,
-      Options::Auto<double>{}, true}}};
+      Options::Auto<double>{}, true, 1}}};
+
+  // The reader holds the observers' file lock while it reads
+  ActionTesting::emplace_nodegroup_component_and_initialize<writer_component>(
+      make_not_null(&runner), {Parallel::NodeLock{}});
 
   // Setup mock data file reader
   ActionTesting::emplace_nodegroup_component<reader_component>(
@@ -272,6 +293,11 @@ void test_actions(const std::variant<double, importers::ObservationSelector>&
     // Invoke the simple_action `ReadAllVolumeDataAndDistribute` that was called
     // on the reader component by the `ReadVolumeData` action.
     runner.template invoke_queued_simple_action<reader_component>(0);
+    Parallel::NodeLock* const h5_file_lock = observers::h5_file_lock(
+        ActionTesting::cache<reader_component>(runner, 0));
+    REQUIRE(h5_file_lock != nullptr);
+    CHECK(h5_file_lock->try_lock());
+    h5_file_lock->unlock();
     CAPTURE(get_reader_tag(importers::Tags::ElementDataAlreadyRead{}));
     CHECK(get_reader_tag(importers::Tags::ElementDataAlreadyRead{}).size() ==
           1);
@@ -0,0 +1,148 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "IO/Observer/AsyncVolumeWriter.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace observers {
+namespace {
+std::vector<ElementVolumeData> make_volume_data(const double value) {
+  std::vector<ElementVolumeData> result{};
+  result.emplace_back(
+      "[B0,(L0I0)]",
+      std::vector<TensorComponent>{
+          {"U", DataVector{value, value + 1.0, value + 2.0}},
+          {"V", std::vector<float>{1.0f, 2.0f, 3.0f}}},
+      std::vector<size_t>{3},
+      std::vector<Spectral::Basis>{Spectral::Basis::Legendre},
+      std::vector<Spectral::Quadrature>{Spectral::Quadrature::GaussLobatto});
+  return result;
+}
+
+// Large enough to span several compression chunks
+DataVector make_large_data(const double value) {
+  DataVector result(50'003);
+  for (size_t i = 0; i < result.size(); ++i) {
+    result[i] = value + sin(0.01 * static_cast<double>(i));
+  }
+  return result;
+}
+
+std::vector<ElementVolumeData> make_large_volume_data(const double value) {
+  std::vector<ElementVolumeData> result{};
+  result.emplace_back(
+      "[B0,(L0I0)]",
+      std::vector<TensorComponent>{{"U", make_large_data(value)}},
+      std::vector<size_t>{50'003},
+      std::vector<Spectral::Basis>{Spectral::Basis::Legendre},
+      std::vector<Spectral::Quadrature>{Spectral::Quadrature::GaussLobatto});
+  return result;
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.AsyncVolumeWriter", "[Unit][Observers]") {
+  CHECK(AsyncVolumeWriter_detail::size_in_bytes(make_volume_data(0.0)) ==
+        3 * sizeof(double) + 3 * sizeof(float));
+
+  const std::string file_name{"Unit.IO.Observers.AsyncVolumeWriter.h5"};
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+
+  Parallel::NodeLock file_lock{};
+  std::vector<ObservationId> observation_ids{};
+  {
+    AsyncVolumeWriter writer{};
+    CHECK(writer.queued_bytes() == 0);
+    CHECK(writer.deferred_bytes() == 0);
+    // A budget smaller than a single write defers every write until the
+    // previous one has finished. The writes still return right away.
+    const size_t memory_budget = 1;
+    const size_t write_size =
+        AsyncVolumeWriter_detail::size_in_bytes(make_volume_data(0.0));
+    {
+      // Holding the file lock keeps the background thread from finishing the
+      // first write, so the others must be deferred.
+      const std::lock_guard hold_file_lock(file_lock);
+      for (size_t i = 0; i < 4; ++i) {
+        observation_ids.emplace_back(static_cast<double>(i),
+                                     "ObservationType");
+        auto volume_data = make_volume_data(static_cast<double>(i));
+        writer.write(AsyncVolumeWriter::Write{file_name, "", "/element_data",
+                                              observation_ids.back(),
+                                              std::move(volume_data),
+                                              std::nullopt, std::nullopt},
+                     make_not_null(&file_lock), memory_budget);
+      }
+      CHECK(writer.queued_bytes() == 4 * write_size);
+      CHECK(writer.deferred_bytes() == 3 * write_size);
+    }
+    writer.wait_until_written();
+    CHECK(writer.queued_bytes() == 0);
+    CHECK(writer.deferred_bytes() == 0);
+
+    // Chunks compressed on several threads
+    for (size_t i = 4; i < 6; ++i) {
+      observation_ids.emplace_back(static_cast<double>(i), "ObservationType");
+      writer.write(
+          AsyncVolumeWriter::Write{
+              file_name, "", "/element_data", observation_ids.back(),
+              make_large_volume_data(static_cast<double>(i)), std::nullopt,
+              std::nullopt},
+          make_not_null(&file_lock), 1024 * 1024 * 1024, 3);
+    }
+
+    // Moving the writer keeps the queue and background thread.
+    AsyncVolumeWriter moved_writer{std::move(writer)};
+    observation_ids.emplace_back(6.0, "ObservationType");
+    moved_writer.write(
+        AsyncVolumeWriter::Write{file_name, "", "/element_data",
+                                 observation_ids.back(), make_volume_data(6.0),
+                                 std::nullopt, std::nullopt},
+        make_not_null(&file_lock), 1024);
+    // The destructor finishes all writes.
+  }
+
+  {
+    h5::H5File<h5::AccessType::ReadOnly> file{file_name};
+    const auto& volume_file = file.get<h5::VolumeData>("/element_data");
+    CHECK(volume_file.list_observation_ids().size() == observation_ids.size());
+    for (size_t i = 0; i < observation_ids.size(); ++i) {
+      CAPTURE(i);
+      const double value = static_cast<double>(i);
+      CHECK(std::get<DataVector>(
+                volume_file
+                    .get_tensor_component(observation_ids[i].hash(), "U")
+                    .data) == ((i == 4 or i == 5)
+                                   ? make_large_data(value)
+                                   : DataVector{value, value + 1.0,
+                                                value + 2.0}));
+    }
+  }
+
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+}
+}  // namespace observers
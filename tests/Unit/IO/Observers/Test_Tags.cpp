@@ -33,11 +33,19 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Tags", "[Unit][Observers]") {
   TestHelpers::db::test_simple_tag<ReductionDataNames<double>>(
       "ReductionDataNames");
   TestHelpers::db::test_simple_tag<H5FileLock>("H5FileLock");
+  TestHelpers::db::test_simple_tag<AsyncVolumeWriter>("AsyncVolumeWriter");
   TestHelpers::db::test_simple_tag<ObservationKey<TestTag>>(
       "ObservationKey(TestTag)");
   TestHelpers::db::test_simple_tag<VolumeFileName>("VolumeFileName");
   TestHelpers::db::test_simple_tag<ReductionFileName>("ReductionFileName");
   TestHelpers::db::test_simple_tag<SurfaceFileName>("SurfaceFileName");
+  TestHelpers::db::test_simple_tag<AsyncVolumeWriterMemoryBudget>(
+      "AsyncVolumeWriterMemoryBudget");
+  CHECK(AsyncVolumeWriterMemoryBudget::create_from_options(3) ==
+        3 * 1024 * 1024);
+  TestHelpers::db::test_simple_tag<AsyncVolumeWriterCompressionThreads>(
+      "AsyncVolumeWriterCompressionThreads");
+  CHECK(AsyncVolumeWriterCompressionThreads::create_from_options(4) == 4);
   static_assert(
       std::is_same_v<typename ReductionData<double, int, char>::names_tag,
                      ReductionDataNames<double, int, char>>,
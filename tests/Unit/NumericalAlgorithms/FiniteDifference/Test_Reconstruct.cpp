@@ -0,0 +1,117 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "NumericalAlgorithms/FiniteDifference/AoWeno.hpp"
+#include "NumericalAlgorithms/FiniteDifference/Minmod.hpp"
+#include "NumericalAlgorithms/FiniteDifference/MonotonicityPreserving5.hpp"
+#include "NumericalAlgorithms/FiniteDifference/MonotonisedCentral.hpp"
+#include "NumericalAlgorithms/FiniteDifference/Reconstruct.tpp"
+#include "NumericalAlgorithms/FiniteDifference/Wcns5z.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+// In 1D every variable is a stripe, so the number of variables controls how
+// many stripes are reconstructed in SIMD batches and how many remain. The data
+// are random, so the limiters pick different cases in the lanes of a batch.
+// The result must agree with reconstructing every cell on its own.
+template <typename Reconstructor, typename Generator, typename... Args>
+void test_stripes(const gsl::not_null<Generator*> generator,
+                  const Args&... args_for_reconstructor) {
+  constexpr size_t stencil_width = Reconstructor::stencil_width();
+  constexpr size_t ghost_pts = (stencil_width - 1) / 2 + 1;
+  const size_t points_per_stripe = 7;
+  UniformCustomDistribution<double> dist{-1.0, 1.0};
+  for (const size_t number_of_variables : {1_st, 2_st, 5_st, 11_st, 17_st}) {
+    CAPTURE(number_of_variables);
+    const auto volume_vars = make_with_random_values<DataVector>(
+        generator, make_not_null(&dist),
+        DataVector(number_of_variables * points_per_stripe));
+    const auto lower_ghost = make_with_random_values<DataVector>(
+        generator, make_not_null(&dist),
+        DataVector(number_of_variables * ghost_pts));
+    const auto upper_ghost = make_with_random_values<DataVector>(
+        generator, make_not_null(&dist),
+        DataVector(number_of_variables * ghost_pts));
+    DirectionMap<1, gsl::span<const double>> ghost_cell_vars{};
+    ghost_cell_vars[Direction<1>::lower_xi()] =
+        gsl::make_span(lower_ghost.data(), lower_ghost.size());
+    ghost_cell_vars[Direction<1>::upper_xi()] =
+        gsl::make_span(upper_ghost.data(), upper_ghost.size());
+
+    const size_t number_of_faces = points_per_stripe + 1;
+    std::vector<double> upper_side(number_of_variables * number_of_faces);
+    std::vector<double> lower_side(number_of_variables * number_of_faces);
+    std::array<gsl::span<double>, 1> upper_side_span{
+        gsl::make_span(upper_side.data(), upper_side.size())};
+    std::array<gsl::span<double>, 1> lower_side_span{
+        gsl::make_span(lower_side.data(), lower_side.size())};
+    fd::reconstruction::detail::reconstruct<Reconstructor>(
+        make_not_null(&upper_side_span), make_not_null(&lower_side_span),
+        gsl::make_span(volume_vars.data(), volume_vars.size()),
+        ghost_cell_vars, Index<1>{points_per_stripe}, number_of_variables,
+        args_for_reconstructor...);
+
+    std::vector<double> expected_upper_side(upper_side.size());
+    std::vector<double> expected_lower_side(lower_side.size());
+    std::vector<double> stripe(points_per_stripe + 2 * ghost_pts);
+    for (size_t var = 0; var < number_of_variables; ++var) {
+      for (size_t i = 0; i < ghost_pts; ++i) {
+        stripe[i] = lower_ghost[var * ghost_pts + i];
+        stripe[ghost_pts + points_per_stripe + i] =
+            upper_ghost[var * ghost_pts + i];
+      }
+      for (size_t i = 0; i < points_per_stripe; ++i) {
+        stripe[ghost_pts + i] = volume_vars[var * points_per_stripe + i];
+      }
+      // Reconstruct the cells -1 to points_per_stripe
+      for (size_t cell = 0; cell < points_per_stripe + 2; ++cell) {
+        const auto upper_and_lower = Reconstructor::pointwise(
+            &stripe[cell + ghost_pts - 1], 1, args_for_reconstructor...);
+        if (cell > 0) {
+          expected_upper_side[var * number_of_faces + cell - 1] =
+              upper_and_lower[0];
+        }
+        if (cell < number_of_faces) {
+          expected_lower_side[var * number_of_faces + cell] =
+              upper_and_lower[1];
+        }
+      }
+    }
+    CHECK_ITERABLE_APPROX(upper_side, expected_upper_side);
+    CHECK_ITERABLE_APPROX(lower_side, expected_lower_side);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.FiniteDifference.ReconstructStripes",
+                  "[Unit][NumericalAlgorithms]") {
+  MAKE_GENERATOR(generator);
+  using fd::reconstruction::detail::AoWeno53Reconstructor;
+  using fd::reconstruction::detail::MinmodReconstructor;
+  using fd::reconstruction::detail::MonotonicityPreserving5Reconstructor;
+  using fd::reconstruction::detail::MonotonisedCentralReconstructor;
+  using fd::reconstruction::detail::Wcns5zReconstructor;
+  test_stripes<MinmodReconstructor>(make_not_null(&generator));
+  test_stripes<MonotonisedCentralReconstructor>(make_not_null(&generator));
+  test_stripes<MonotonicityPreserving5Reconstructor>(make_not_null(&generator),
+                                                     4.0, 0.0);
+  test_stripes<Wcns5zReconstructor<2, MonotonisedCentralReconstructor>>(
+      make_not_null(&generator), 2.0e-16, 1_st);
+  test_stripes<Wcns5zReconstructor<2, void>>(make_not_null(&generator),
+                                             2.0e-16, 0_st);
+  test_stripes<AoWeno53Reconstructor<2>>(make_not_null(&generator), 0.85,
+                                         0.999, 1.0e-12);
+}
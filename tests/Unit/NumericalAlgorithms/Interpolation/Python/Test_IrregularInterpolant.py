@@ -1,6 +1,7 @@
 # Distributed under the MIT License.
 # See LICENSE.txt for details.
 
+import itertools
 import unittest
 
 import numpy as np
@@ -8,7 +9,7 @@ import numpy.random
 import numpy.testing as npt
 
 from spectre.DataStructures import DataVector
-from spectre.Interpolation import Irregular
+from spectre.Interpolation import Irregular, IrregularMode
 from spectre.Spectral import Basis, Mesh, Quadrature, logical_coordinates
 
 
@@ -33,7 +34,10 @@ class TestIrregular(unittest.TestCase):
     def test_irregular(self):
         for dim in [1, 2, 3]:
             for quadrature in [Quadrature.Gauss, Quadrature.GaussLobatto]:
-                for num_points in range(3, 10):
+                for num_points, mode in itertools.product(
+                    range(3, 10),
+                    [IrregularMode.DenseMatrix, IrregularMode.MatrixFree],
+                ):
                     source_mesh = Mesh[dim](
                         num_points, Basis.Legendre, quadrature
                     )
@@ -46,6 +50,7 @@ class TestIrregular(unittest.TestCase):
                         target_logical_coords=[
                             DataVector(xi) for xi in target_logical_coords
                         ],
+                        mode=mode,
                     )
 
                     source_logical_coords = np.array(
@@ -114,7 +114,9 @@ struct SymmetricTensor : db::SimpleTag {
 }  // namespace TestTags
 
 template <size_t Dim>
-void test_interpolate_to_points(const Mesh<Dim>& mesh) {
+void test_interpolate_to_points(const Mesh<Dim>& mesh,
+                                const intrp::IrregularMode mode) {
+  INFO(mode);
   // Fill target interpolation coordinates with random values
   MAKE_GENERATOR(generator);
   std::uniform_real_distribution<> dist(inertial_coord_min, inertial_coord_max);
@@ -145,15 +147,23 @@ void test_interpolate_to_points(const Mesh<Dim>& mesh) {
   }();
 
   // Set up interpolator. Need do this only once.
-  const intrp::Irregular<Dim> irregular_interpolant(mesh, target_x);
+  const intrp::Irregular<Dim> irregular_interpolant(mesh, target_x, mode);
+  CHECK(irregular_interpolant.mode() == mode);
   test_serialization(irregular_interpolant);
 
   // ... but we construct another interpolator to test operator!=
   {
     auto target_x_new = target_x;
     target_x_new.get(0)[0] *= 0.98;  // Change one point slightly.
-    const intrp::Irregular<Dim> irregular_interpolant_new(mesh, target_x_new);
+    const intrp::Irregular<Dim> irregular_interpolant_new(mesh, target_x_new,
+                                                          mode);
     CHECK(irregular_interpolant_new != irregular_interpolant);
+    const intrp::Irregular<Dim> irregular_interpolant_other_mode(
+        mesh, target_x,
+        mode == intrp::IrregularMode::DenseMatrix
+            ? intrp::IrregularMode::MatrixFree
+            : intrp::IrregularMode::DenseMatrix);
+    CHECK(irregular_interpolant_other_mode != irregular_interpolant);
   }
 
   // Coordinates on the grid
@@ -237,6 +247,12 @@ void test_interpolate_to_points(const Mesh<Dim>& mesh) {
   }
 }
 
+template <size_t Dim>
+void test_interpolate_to_points(const Mesh<Dim>& mesh) {
+  test_interpolate_to_points(mesh, intrp::IrregularMode::DenseMatrix);
+  test_interpolate_to_points(mesh, intrp::IrregularMode::MatrixFree);
+}
+
 template <Spectral::Basis Basis, Spectral::Quadrature Quadrature>
 void test_irregular_interpolant() {
   const size_t start_points = 4;
@@ -355,13 +371,17 @@ void test_polynomial_interpolant(const std::array<size_t, Dim>& extents) {
   const auto source_x = element_map(source_xi);
   const auto target_xi = create_target_points<Dim>(n_random_target_points);
   const auto target_x = element_map(target_xi);
-  intrp::Irregular irregular_interp{mesh, target_xi};
-
-  for (size_t degree = 0; degree <= MaxDegree; ++degree) {
-    const auto source_vars = polynomial<Dim>(source_x, degree);
-    const auto target_vars = irregular_interp.interpolate(source_vars);
-    const auto expected_vars = polynomial<Dim>(target_x, degree);
-    CHECK_VARIABLES_APPROX(target_vars, expected_vars);
+  for (const auto mode : {intrp::IrregularMode::DenseMatrix,
+                          intrp::IrregularMode::MatrixFree}) {
+    INFO(mode);
+    intrp::Irregular irregular_interp{mesh, target_xi, mode};
+
+    for (size_t degree = 0; degree <= MaxDegree; ++degree) {
+      const auto source_vars = polynomial<Dim>(source_x, degree);
+      const auto target_vars = irregular_interp.interpolate(source_vars);
+      const auto expected_vars = polynomial<Dim>(target_x, degree);
+      CHECK_VARIABLES_APPROX(target_vars, expected_vars);
+    }
   }
 }
 
@@ -7,6 +7,7 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "NumericalAlgorithms/Interpolation/MultiLinearSpanInterpolation.hpp"
 #include "Utilities/Gsl.hpp"
 
@@ -144,6 +145,42 @@ void test() {
     CHECK(std::abs(gsl::at(y_expected, nv) - gsl::at(y_interpolated_gen, nv)) <
           epsilon * std::abs(gsl::at(y_expected, nv)));
   }
+
+  // Interpolate more points than fit into a single block, including points
+  // above the table, and compare against the pointwise interpolation.
+  const size_t number_of_points =
+      decltype(uniform_intp)::points_per_block + 13;
+  std::uniform_real_distribution<> dist_point(-1., 1.2);
+  std::array<DataVector, Dim> points{};
+  std::array<const double*, Dim> point_pointers{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(points, d) = make_with_random_values<DataVector>(
+        make_not_null(&gen), make_not_null(&dist_point),
+        DataVector(number_of_points));
+    gsl::at(point_pointers, d) = gsl::at(points, d).data();
+  }
+  Approx local_approx = Approx::custom().epsilon(epsilon).scale(1.0);
+  const auto check_points = [&number_of_points, &points, &point_pointers,
+                             &local_approx](const auto& interpolator) {
+    // Interpolate the last variable and the first one, in that order.
+    std::array<DataVector, 2> results{DataVector(number_of_points),
+                                      DataVector(number_of_points)};
+    interpolator.template interpolate_points<NumVar - 1, 0>(
+        {{results[0].data(), results[1].data()}}, point_pointers,
+        number_of_points);
+    std::array<size_t, 2> which_vars{{NumVar - 1, 0}};
+    for (size_t p = 0; p < number_of_points; ++p) {
+      std::array<double, Dim> target{};
+      for (size_t d = 0; d < Dim; ++d) {
+        gsl::at(target, d) = gsl::at(points, d)[p];
+      }
+      const auto expected = interpolator.interpolate(which_vars, target);
+      CHECK(results[0][p] == local_approx(expected[0]));
+      CHECK(results[1][p] == local_approx(expected[1]));
+    }
+  };
+  check_points(uniform_intp);
+  check_points(general_intp);
 }
 }  // namespace
 
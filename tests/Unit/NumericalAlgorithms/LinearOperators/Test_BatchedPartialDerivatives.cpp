@@ -0,0 +1,122 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "NumericalAlgorithms/LinearOperators/BatchedPartialDerivatives.hpp"
+#include "NumericalAlgorithms/LinearOperators/BatchedPartialDerivatives.tpp"
+#include "NumericalAlgorithms/LinearOperators/Divergence.hpp"
+#include "NumericalAlgorithms/LinearOperators/Divergence.tpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+template <size_t Dim>
+struct Vector : db::SimpleTag {
+  using type = tnsr::I<DataVector, Dim, Frame::Inertial>;
+};
+
+struct Scalar1 : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+template <size_t Dim>
+struct Flux : db::SimpleTag {
+  using type = tnsr::Ij<DataVector, Dim, Frame::Inertial>;
+};
+
+template <size_t Dim>
+void test_batched(const gsl::not_null<std::mt19937*> gen,
+                  const Mesh<Dim>& mesh, const size_t number_of_elements) {
+  CAPTURE(mesh);
+  CAPTURE(number_of_elements);
+  using variable_tags = tmpl::list<Vector<Dim>, Scalar1>;
+  using derivative_tags = tmpl::list<Vector<Dim>>;
+  using deriv_tags = db::wrap_tags_in<Tags::deriv, derivative_tags,
+                                      tmpl::size_t<Dim>, Frame::Inertial>;
+  using flux_tags = tmpl::list<Flux<Dim>>;
+  using div_tags = db::wrap_tags_in<Tags::div, flux_tags>;
+  using InvJac = InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                                 Frame::Inertial>;
+  std::uniform_real_distribution<double> dist{-1.0, 1.0};
+  const DataVector used_for_size{mesh.number_of_grid_points()};
+
+  std::vector<Variables<variable_tags>> u{};
+  std::vector<Variables<flux_tags>> fluxes{};
+  std::vector<InvJac> inv_jacs{};
+  for (size_t e = 0; e < number_of_elements; ++e) {
+    u.push_back(make_with_random_values<Variables<variable_tags>>(
+        gen, make_not_null(&dist), used_for_size));
+    fluxes.push_back(make_with_random_values<Variables<flux_tags>>(
+        gen, make_not_null(&dist), used_for_size));
+    inv_jacs.push_back(make_with_random_values<InvJac>(
+        gen, make_not_null(&dist), used_for_size));
+  }
+
+  std::vector<Variables<deriv_tags>> du(number_of_elements);
+  std::vector<Variables<div_tags>> div_flux(number_of_elements);
+  std::vector<Variables<deriv_tags>*> du_ptrs{};
+  std::vector<Variables<div_tags>*> div_flux_ptrs{};
+  std::vector<const Variables<variable_tags>*> u_ptrs{};
+  std::vector<const Variables<flux_tags>*> flux_ptrs{};
+  std::vector<const InvJac*> inv_jac_ptrs{};
+  for (size_t e = 0; e < number_of_elements; ++e) {
+    du_ptrs.push_back(&du[e]);
+    div_flux_ptrs.push_back(&div_flux[e]);
+    u_ptrs.push_back(&u[e]);
+    flux_ptrs.push_back(&fluxes[e]);
+    inv_jac_ptrs.push_back(&inv_jacs[e]);
+  }
+  batched_partial_derivatives(du_ptrs, u_ptrs, mesh, inv_jac_ptrs);
+  batched_divergence(div_flux_ptrs, flux_ptrs, mesh, inv_jac_ptrs);
+
+  Approx custom_approx = Approx::custom().epsilon(1.e-11).scale(1.0);
+  for (size_t e = 0; e < number_of_elements; ++e) {
+    CAPTURE(e);
+    const auto expected_du =
+        partial_derivatives<derivative_tags>(u[e], mesh, inv_jacs[e]);
+    CHECK_VARIABLES_CUSTOM_APPROX(du[e], expected_du, custom_approx);
+    const auto expected_div = divergence(fluxes[e], mesh, inv_jacs[e]);
+    CHECK_VARIABLES_CUSTOM_APPROX(div_flux[e], expected_div, custom_approx);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.BatchedPartialDerivs",
+                  "[NumericalAlgorithms][LinearOperators][Unit]") {
+  MAKE_GENERATOR(gen);
+  const auto basis = Spectral::Basis::Legendre;
+  const auto quadrature = Spectral::Quadrature::GaussLobatto;
+  for (const size_t number_of_elements : {1_st, 5_st}) {
+    test_batched(make_not_null(&gen), Mesh<1>{4, basis, quadrature},
+                 number_of_elements);
+    test_batched(make_not_null(&gen), Mesh<2>{{{4, 5}}, basis, quadrature},
+                 number_of_elements);
+    test_batched(make_not_null(&gen), Mesh<3>{{{3, 4, 5}}, basis, quadrature},
+                 number_of_elements);
+    // Extents above the sum-factorization limit use the transpose path.
+    test_batched(make_not_null(&gen), Mesh<2>{{{3, 18}}, basis, quadrature},
+                 number_of_elements);
+    test_batched(make_not_null(&gen), Mesh<3>{{{3, 4, 18}}, basis, quadrature},
+                 number_of_elements);
+  }
+}
@@ -0,0 +1,96 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "NumericalAlgorithms/LinearSolver/BatchedLinearSolve.hpp"
+#include "NumericalAlgorithms/LinearSolver/Lapack.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+template <typename Generator>
+void test_random_systems(const gsl::not_null<Generator*> generator) {
+  UniformCustomDistribution<size_t> size_dist(1, 12);
+  const size_t size = size_dist(*generator);
+  const size_t batch_size = 3 * size_dist(*generator);
+  CAPTURE(size);
+  CAPTURE(batch_size);
+  // Entries of random sign and no diagonal dominance, so the systems need
+  // pivoting
+  UniformCustomDistribution<double> value_dist(-1.0, 1.0);
+  DataVector matrices{size * size * batch_size};
+  DataVector rhs{size * batch_size};
+  DataVector expected_solutions{size * batch_size};
+  for (size_t b = 0; b < batch_size; ++b) {
+    Matrix matrix{size, size};
+    DataVector single_rhs{size};
+    for (size_t i = 0; i < size; ++i) {
+      for (size_t j = 0; j < size; ++j) {
+        matrix(i, j) = value_dist(*generator);
+        matrices[(i + size * j) * batch_size + b] = matrix(i, j);
+      }
+      single_rhs[i] = value_dist(*generator);
+      rhs[i * batch_size + b] = single_rhs[i];
+    }
+    DataVector single_solution{size};
+    lapack::general_matrix_linear_solve(make_not_null(&single_solution),
+                                        matrix, single_rhs);
+    for (size_t i = 0; i < size; ++i) {
+      expected_solutions[i * batch_size + b] = single_solution[i];
+    }
+  }
+  CHECK(LinearSolver::Serial::batched_linear_solve(
+            make_not_null(&rhs), make_not_null(&matrices), size) == 0);
+  Approx custom_approx = Approx::custom().epsilon(1.e-9).scale(1.0);
+  CHECK_ITERABLE_CUSTOM_APPROX(rhs, expected_solutions, custom_approx);
+}
+
+void test_pivoting() {
+  // Two matrices with zeros on the diagonal that need row swaps, and an
+  // identity matrix that doesn't
+  const size_t size = 3;
+  const size_t batch_size = 3;
+  DataVector matrices{size * size * batch_size, 0.0};
+  const auto set_entry = [&matrices](const size_t i, const size_t j,
+                                     const size_t b, const double value) {
+    matrices[(i + size * j) * batch_size + b] = value;
+  };
+  // x_1 = 1, x_2 = 2, x_0 = 3
+  set_entry(0, 1, 0, 1.0);
+  set_entry(1, 2, 0, 1.0);
+  set_entry(2, 0, 0, 1.0);
+  // identity
+  set_entry(0, 0, 1, 1.0);
+  set_entry(1, 1, 1, 1.0);
+  set_entry(2, 2, 1, 1.0);
+  // 2 x_2 = 1, 4 x_1 = 2, x_0 + x_2 = 3
+  set_entry(0, 2, 2, 2.0);
+  set_entry(1, 1, 2, 4.0);
+  set_entry(2, 0, 2, 1.0);
+  set_entry(2, 2, 2, 1.0);
+  DataVector rhs{1.0, 1.0, 1.0, 2.0, 2.0, 2.0, 3.0, 3.0, 3.0};
+  CHECK(LinearSolver::Serial::batched_linear_solve(
+            make_not_null(&rhs), make_not_null(&matrices), size) == 0);
+  CHECK_ITERABLE_APPROX(
+      rhs, (DataVector{3.0, 1.0, 2.5, 1.0, 2.0, 0.5, 2.0, 3.0, 0.5}));
+
+  DataVector singular_matrices{size * size * batch_size, 1.0};
+  CHECK(LinearSolver::Serial::batched_linear_solve(
+            make_not_null(&rhs), make_not_null(&singular_matrices), size) ==
+        2);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Numerical.LinearSolver.BatchedLinearSolve",
+                  "[Unit][NumericalAlgorithms][LinearSolver]") {
+  MAKE_GENERATOR(gen);
+  for (size_t i = 0; i < 5; ++i) {
+    test_random_systems(make_not_null(&gen));
+  }
+  test_pivoting();
+}
@@ -0,0 +1,220 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <complex>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "DataStructures/CompressedMatrix.hpp"
+#include "DataStructures/DynamicMatrix.hpp"
+#include "DataStructures/DynamicVector.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Helpers/NumericalAlgorithms/LinearSolver/TestHelpers.hpp"
+#include "NumericalAlgorithms/LinearSolver/SparseLu.hpp"
+#include "NumericalAlgorithms/LinearSolver/SparseLuFactorization.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace helpers = TestHelpers::LinearSolver;
+
+namespace LinearSolver::Serial {
+namespace {
+// A random sparse matrix resembling a 1D DG operator: dense blocks on the
+// diagonal coupled to the neighboring blocks. The diagonal is zero in some
+// rows, so the factorization has to pivot.
+template <typename Generator>
+blaze::DynamicMatrix<double> random_block_matrix(
+    const gsl::not_null<Generator*> generator, const size_t num_blocks,
+    const size_t block_size) {
+  UniformCustomDistribution<double> value_dist(-1., 1.);
+  const size_t size = num_blocks * block_size;
+  blaze::DynamicMatrix<double> matrix(size, size, 0.);
+  for (size_t i = 0; i < size; ++i) {
+    const size_t block = i / block_size;
+    const size_t first_column = block == 0 ? 0 : (block - 1) * block_size;
+    const size_t end_column = std::min(size, (block + 2) * block_size);
+    for (size_t j = first_column; j < end_column; ++j) {
+      if (j / block_size == block or (i + j) % 3 == 0) {
+        matrix(i, j) = value_dist(*generator);
+      }
+    }
+    if (block_size > 1 and i % 4 == 1) {
+      matrix(i, i) = 0.;
+    }
+  }
+  return matrix;
+}
+
+// An operator that can identify itself by a signature
+struct ApplyMatrixWithSignature : helpers::ApplyMatrix<double> {
+  std::optional<std::vector<double>> signature{};
+  std::optional<std::vector<double>> operator_signature(
+      const blaze::DynamicVector<double>& /*layout*/) const {
+    return signature;
+  }
+};
+
+void test_operator_signature() {
+  const blaze::DynamicMatrix<double> matrix{
+      {4., 1., 0.}, {1., 3., 0.}, {0., 1., 2.}};
+  const blaze::DynamicVector<double> source{1., 2., 3.};
+  const blaze::DynamicVector<double> expected_solution =
+      blaze::inv(matrix) * source;
+  blaze::DynamicVector<double> solution(3);
+  const ApplyMatrixWithSignature linear_operator{{matrix}, {{1., 2., 3.}}};
+  const SparseLu<double> solver{};
+  solver.solve(make_not_null(&solution), linear_operator, source);
+  CHECK(linear_operator.invocations == 3);
+  CHECK_ITERABLE_APPROX(solution, expected_solution);
+  {
+    INFO("Share factorization without building the matrix");
+    // The matrix is deliberately different to show that the signature alone
+    // identifies the operator
+    const ApplyMatrixWithSignature other_operator{{2. * matrix},
+                                                  {{1., 2., 3.}}};
+    const SparseLu<double> other_solver{};
+    other_solver.solve(make_not_null(&solution), other_operator, source);
+    CHECK(other_operator.invocations == 0);
+    CHECK(&other_solver.factorization() == &solver.factorization());
+    CHECK_ITERABLE_APPROX(solution, expected_solution);
+  }
+  {
+    INFO("Different signature");
+    const ApplyMatrixWithSignature other_operator{{2. * matrix},
+                                                  {{1., 2., 4.}}};
+    const SparseLu<double> other_solver{};
+    other_solver.solve(make_not_null(&solution), other_operator, source);
+    CHECK(other_operator.invocations == 3);
+    CHECK(&other_solver.factorization() != &solver.factorization());
+    CHECK_ITERABLE_APPROX(solution, 0.5 * expected_solution);
+  }
+  {
+    INFO("No signature");
+    const ApplyMatrixWithSignature other_operator{{matrix}, std::nullopt};
+    const SparseLu<double> other_solver{};
+    other_solver.solve(make_not_null(&solution), other_operator, source);
+    CHECK(other_operator.invocations == 3);
+    CHECK(other_solver.factorization() == solver.factorization());
+    CHECK_ITERABLE_APPROX(solution, expected_solution);
+  }
+}
+
+template <typename Generator>
+void test_factorization(const gsl::not_null<Generator*> generator) {
+  UniformCustomDistribution<size_t> size_dist(1, 6);
+  const size_t num_blocks = size_dist(*generator);
+  const size_t block_size = size_dist(*generator);
+  CAPTURE(num_blocks);
+  CAPTURE(block_size);
+  const auto matrix = random_block_matrix(generator, num_blocks, block_size);
+  const size_t size = matrix.rows();
+  const blaze::CompressedMatrix<double, blaze::columnMajor> sparse_matrix{
+      matrix};
+  const SparseLuFactorization<double> factorization{sparse_matrix};
+  CHECK(factorization.size() == size);
+  UniformCustomDistribution<double> value_dist(-1., 1.);
+  blaze::DynamicVector<double> source(size);
+  for (size_t i = 0; i < size; ++i) {
+    source[i] = value_dist(*generator);
+  }
+  auto source_workspace = source;
+  blaze::DynamicVector<double> solution{};
+  factorization.solve(make_not_null(&solution),
+                      make_not_null(&source_workspace));
+  Approx custom_approx = Approx::custom().epsilon(1.e-9).scale(1.0);
+  const blaze::DynamicVector<double> expected_solution =
+      blaze::inv(matrix) * source;
+  CHECK_ITERABLE_CUSTOM_APPROX(solution, expected_solution, custom_approx);
+  test_serialization(factorization);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.SparseLu",
+                  "[Unit][NumericalAlgorithms][LinearSolver]") {
+  MAKE_GENERATOR(generator);
+  {
+    INFO("Factorize random sparse matrices");
+    for (size_t i = 0; i < 10; ++i) {
+      test_factorization(make_not_null(&generator));
+    }
+  }
+  {
+    INFO("Solve a simple matrix");
+    // Zero on the diagonal, so this needs pivoting
+    const blaze::DynamicMatrix<double> matrix{
+        {0., 1., 0.}, {3., 1., 0.}, {0., 2., 4.}};
+    const helpers::ApplyMatrix<double> linear_operator{matrix};
+    const blaze::DynamicVector<double> source{1., 2., 3.};
+    const blaze::DynamicVector<double> expected_solution{1. / 3., 1., 0.25};
+    blaze::DynamicVector<double> solution(3);
+    SparseLu<double> solver{};
+    const auto has_converged =
+        solver.solve(make_not_null(&solution), linear_operator, source);
+    REQUIRE(has_converged);
+    CHECK(solver.size() == 3);
+    CHECK(linear_operator.invocations == 3);
+    CHECK_ITERABLE_APPROX(solution, expected_solution);
+    // Successive solves don't apply the operator again
+    solver.solve(make_not_null(&solution), linear_operator, source);
+    CHECK(linear_operator.invocations == 3);
+    CHECK_ITERABLE_APPROX(solution, expected_solution);
+    {
+      INFO("Share factorization");
+      const SparseLu<double> other_solver{};
+      other_solver.solve(make_not_null(&solution), linear_operator, source);
+      CHECK(&other_solver.factorization() == &solver.factorization());
+      CHECK_ITERABLE_APPROX(solution, expected_solution);
+    }
+    {
+      INFO("Serialization");
+      const auto deserialized_solver = serialize_and_deserialize(solver);
+      CHECK(deserialized_solver.size() == 3);
+      CHECK(deserialized_solver.factorization() == solver.factorization());
+      deserialized_solver.solve(make_not_null(&solution), linear_operator,
+                                source);
+      CHECK(linear_operator.invocations == 6);
+      CHECK_ITERABLE_APPROX(solution, expected_solution);
+    }
+    {
+      INFO("Resetting");
+      solver.reset();
+      const blaze::DynamicMatrix<double> matrix2{
+          {4., 1., 0.}, {1., 3., 0.}, {0., 0., 1.}};
+      const helpers::ApplyMatrix<double> linear_operator2{matrix2};
+      solver.solve(make_not_null(&solution), linear_operator2, source);
+      const blaze::DynamicVector<double> expected_solution2 =
+          blaze::inv(matrix2) * source;
+      CHECK_ITERABLE_APPROX(solution, expected_solution2);
+    }
+  }
+  {
+    INFO("Identify operators by their signature");
+    test_operator_signature();
+  }
+  {
+    INFO("Solve a complex matrix");
+    const blaze::DynamicMatrix<std::complex<double>> matrix{
+        {std::complex<double>(1., 2.), std::complex<double>(2., -1.)},
+        {std::complex<double>(3., 4.), std::complex<double>(4., 1.)}};
+    const helpers::ApplyMatrix<std::complex<double>> linear_operator{matrix};
+    const blaze::DynamicVector<std::complex<double>> source{
+        std::complex<double>(1., 1.), std::complex<double>(2., -3.)};
+    const blaze::DynamicVector<std::complex<double>> expected_solution{
+        std::complex<double>(0.45, -1.4), std::complex<double>(-1.2, 0.15)};
+    blaze::DynamicVector<std::complex<double>> solution(2);
+    const SparseLu<std::complex<double>> solver{};
+    const auto has_converged =
+        solver.solve(make_not_null(&solution), linear_operator, source);
+    REQUIRE(has_converged);
+    CHECK_ITERABLE_APPROX(solution, expected_solution);
+  }
+}
+
+}  // namespace LinearSolver::Serial
@@ -3,14 +3,17 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <memory>
 #include <random>
 #include <utility>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/NumericalAlgorithms/SphericalHarmonics/YlmTestFunctions.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Spherepack.hpp"
@@ -643,6 +646,68 @@ void test_loop_over_offset(
   }
 }
 
+void test_batch(const size_t l_max, const size_t m_max) {
+  const Spherepack ylm_spherepack(l_max, m_max);
+  const auto& theta = ylm_spherepack.theta_points();
+  const auto& phi = ylm_spherepack.phi_points();
+  const size_t physical_size = ylm_spherepack.physical_size();
+  const size_t spectral_size = ylm_spherepack.spectral_size();
+  const YlmTestFunctions::Y00 y00{};
+  const YlmTestFunctions::Y10 y10{};
+  const YlmTestFunctions::Y11 y11{};
+  const std::array<const YlmTestFunctions::ScalarFunctionWithDerivs*, 3>
+      funcs{{&y00, &y10, &y11}};
+
+  // Fields stored one after another
+  DataVector u(physical_size * funcs.size());
+  DataVector expected_u_spec(spectral_size * funcs.size());
+  DataVector field(physical_size);
+  for (size_t i = 0; i < funcs.size(); ++i) {
+    gsl::at(funcs, i)->func(&field, 1, 0, theta, phi);
+    std::copy(field.begin(), field.end(), u.begin() + i * physical_size);
+    const DataVector field_spec = ylm_spherepack.phys_to_spec(field);
+    std::copy(field_spec.begin(), field_spec.end(),
+              expected_u_spec.begin() + i * spectral_size);
+  }
+
+  const DataVector u_spec = ylm_spherepack.phys_to_spec_batch(u, funcs.size());
+  CHECK_ITERABLE_APPROX(u_spec, expected_u_spec);
+  const DataVector u_test =
+      ylm_spherepack.spec_to_phys_batch(u_spec, funcs.size());
+  CHECK_ITERABLE_APPROX(u_test, u);
+  {
+    INFO("Single field");
+    DataVector single_u_spec(spectral_size);
+    ylm_spherepack.phys_to_spec_batch(single_u_spec.data(), u.data(), 1);
+    CHECK_ITERABLE_APPROX(single_u_spec,
+                          DataVector(expected_u_spec.data(), spectral_size));
+    DataVector single_u(physical_size);
+    ylm_spherepack.spec_to_phys_batch(single_u.data(), single_u_spec.data(),
+                                      1);
+    CHECK_ITERABLE_APPROX(single_u, DataVector(u.data(), physical_size));
+  }
+}
+
+void test_shared_storage() {
+  const Spherepack ylm_a(6, 5);
+  const Spherepack ylm_b(6, 5);
+  const Spherepack ylm_c(6, 4);
+  // Instances with the same resolution share their tables
+  CHECK(&ylm_a.theta_points() == &ylm_b.theta_points());
+  CHECK(&ylm_a.integration_weights() == &ylm_b.integration_weights());
+  CHECK(&ylm_a.theta_points() != &ylm_c.theta_points());
+  const Spherepack ylm_c_copy = ylm_c;
+  CHECK(&ylm_c_copy.theta_points() == &ylm_c.theta_points());
+  // The tables are kept after all instances using them are destroyed
+  const auto* theta_points = &ylm_a.theta_points();
+  {
+    const auto ylm = std::make_unique<Spherepack>(7, 7);
+    theta_points = &ylm->theta_points();
+  }
+  const Spherepack ylm_d(7, 7);
+  CHECK(&ylm_d.theta_points() == theta_points);
+}
+
 void test_theta_phi_points(
     const size_t l_max, const size_t m_max,
     const YlmTestFunctions::ScalarFunctionWithDerivs& func) {
@@ -1078,6 +1143,21 @@ void test_interpolation(
         CHECK(uintanal[s] == approx(test_interp[s]));
         CHECK(uintanal[s] == approx(test_interp_2[s]));
       }
+
+      // The interpolation matrix times the coefficients is the interpolation
+      Matrix interpolation_matrix{};
+      ylm_spherepack_2.interpolation_matrix(
+          make_not_null(&interpolation_matrix), interpolation_info);
+      REQUIRE(interpolation_matrix.rows() == interpolation_info.size());
+      REQUIRE(interpolation_matrix.columns() ==
+              ylm_spherepack.spectral_size());
+      for (size_t s = 0; s < uintanal.size(); ++s) {
+        double interpolated = 0.0;
+        for (size_t k = 0; k < interpolation_matrix.columns(); ++k) {
+          interpolated += interpolation_matrix(s, k) * u_spec[k];
+        }
+        CHECK(uintanal[s] == approx(interpolated));
+      }
     }
   }
 }
@@ -1292,6 +1372,13 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.Spherepack",
     }
   }
 
+  for (size_t l_max = 3; l_max < 6; ++l_max) {
+    for (size_t m_max = 2; m_max <= l_max; ++m_max) {
+      test_batch(l_max, m_max);
+    }
+  }
+  test_shared_storage();
+
   test_prolong_restrict();
 
   Spherepack s(4, 4);
@@ -0,0 +1,299 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/ArrayCollection/ContributeElementCosts.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
+#include "Parallel/ArrayCollection/RebalanceElementCollection.hpp"
+#include "Parallel/ArrayCollection/ReceiveMigratedElement.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
+#include "Parallel/ArrayCollection/Tags/NumberOfElementsTerminated.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace {
+struct Variable : db::SimpleTag {
+  using type = DataVector;
+};
+
+// Stands in for a `Parallel::DgElementArrayMember`, which needs a Charm++
+// global cache. It has a DataBox and records the simple actions invoked on it,
+// so that we can check that elements are deregistered before they migrate and
+// registered again after.
+class MockElement {
+ public:
+  MockElement() = default;
+  MockElement(const ElementId<1>& element_id, DataVector variable,
+              const double measured_cost)
+      : element_id_(element_id),
+        box_(db::create<tmpl::list<Variable>>(std::move(variable))),
+        measured_cost_(measured_cost) {}
+
+  Parallel::NodeLock& element_lock() { return element_lock_; }
+  double measured_cost() const { return measured_cost_; }
+  void reset_measured_cost() { measured_cost_ = 0.0; }
+  void set_core(const size_t core) { core_ = core; }
+  size_t get_core() const { return core_; }
+  bool get_terminate() const { return true; }
+
+  template <typename Action>
+  void simple_action() {
+    simple_actions_.push_back(pretty_type::get_name<Action>());
+  }
+
+  const ElementId<1>& element_id() const { return element_id_; }
+  const auto& databox() const { return box_; }
+  const std::vector<std::string>& simple_actions() const {
+    return simple_actions_;
+  }
+
+  // Like `Parallel::DgElementArrayMember`, the measured cost and the core are
+  // not serialized.
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | element_id_;
+    p | box_;
+    p | simple_actions_;
+  }
+
+ private:
+  ElementId<1> element_id_{};
+  db::DataBox<tmpl::list<Variable>> box_{};
+  double measured_cost_{0.0};
+  size_t core_{0};
+  std::vector<std::string> simple_actions_{};
+  Parallel::NodeLock element_lock_{};
+};
+
+struct ElementCollection : db::SimpleTag {
+  using type = std::unordered_map<ElementId<1>, MockElement>;
+};
+
+struct InitializeCollection {
+  using simple_tags =
+      tmpl::list<ElementCollection, Parallel::Tags::ElementLocations<1>,
+                 Parallel::Tags::NumberOfElementsTerminated>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& /*box*/,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+template <typename Metavariables>
+struct Collection {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockNodeGroupChare;
+  using array_index = size_t;
+  using element_collection_tag = ElementCollection;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization, tmpl::list<InitializeCollection>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<Collection<Metavariables>>;
+};
+}  // namespace
+
+namespace Parallel {
+// Threaded actions on element collections receive the distributed object.
+template <>
+struct is_dg_element_collection<Collection<Metavariables>> : std::true_type {};
+}  // namespace Parallel
+
+namespace {
+using component = Collection<Metavariables>;
+
+DataVector variable(const size_t i) {
+  return DataVector{static_cast<double>(i), 0.5, -2.0};
+}
+
+// The ATF doesn't support reductions, so we collect the costs of each node
+// like `ContributeElementCosts` does, merge them like the reduction does, and
+// invoke the reduction target on every node.
+std::unordered_map<ElementId<1>, double> collect_costs(
+    const gsl::not_null<ActionTesting::MockRuntimeSystem<Metavariables>*>
+        runner) {
+  std::unordered_map<ElementId<1>, double> costs{};
+  for (const size_t node : {0_st, 1_st}) {
+    db::mutate<ElementCollection>(
+        [&costs](const auto element_collection) {
+          costs.merge(Parallel::Actions::detail::collect_element_costs<1>(
+              element_collection));
+        },
+        make_not_null(&ActionTesting::get_databox<component>(runner, node)));
+  }
+  return costs;
+}
+
+void rebalance(
+    const gsl::not_null<ActionTesting::MockRuntimeSystem<Metavariables>*>
+        runner,
+    const std::unordered_map<ElementId<1>, double>& costs) {
+  for (const size_t node : {0_st, 1_st}) {
+    ActionTesting::simple_action<component,
+                                 Parallel::Actions::RebalanceElementCollection>(
+        runner, node, costs);
+  }
+  for (const size_t node : {0_st, 1_st}) {
+    while (not ActionTesting::is_threaded_action_queue_empty<component>(
+        *runner, node)) {
+      ActionTesting::invoke_queued_threaded_action<component>(runner, node);
+    }
+  }
+}
+
+void check_node(
+    const ActionTesting::MockRuntimeSystem<Metavariables>& runner,
+    const size_t node,
+    const std::unordered_map<ElementId<1>, std::vector<std::string>>&
+        expected_elements_and_actions,
+    const std::unordered_map<ElementId<1>, size_t>& expected_locations) {
+  CAPTURE(node);
+  const auto& collection =
+      ActionTesting::get_databox_tag<component, ElementCollection>(runner,
+                                                                   node);
+  CHECK(collection.size() == expected_elements_and_actions.size());
+  CHECK(ActionTesting::get_databox_tag<
+            component, Parallel::Tags::NumberOfElementsTerminated>(
+            runner, node) == expected_elements_and_actions.size());
+  CHECK(ActionTesting::get_databox_tag<component,
+                                       Parallel::Tags::ElementLocations<1>>(
+            runner, node) == expected_locations);
+  for (const auto& [element_id, expected_actions] :
+       expected_elements_and_actions) {
+    CAPTURE(element_id);
+    REQUIRE(collection.count(element_id) == 1);
+    const MockElement& element = collection.at(element_id);
+    CHECK(element.element_id() == element_id);
+    CHECK(element.get_core() == node);
+    CHECK(element.measured_cost() == 0.0);
+    CHECK(element.simple_actions() == expected_actions);
+    CHECK(db::get<Variable>(element.databox()) ==
+          variable(element_id.segment_ids()[0].index()));
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.ArrayCollection.RebalanceElementCollection",
+                  "[Unit][Parallel]") {
+  // Two nodes with one core each, so procs and nodes coincide.
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}, {}, {1, 1}};
+  ActionTesting::emplace_nodegroup_component<component>(
+      make_not_null(&runner));
+
+  std::array<ElementId<1>, 4> element_ids{};
+  for (size_t i = 0; i < element_ids.size(); ++i) {
+    gsl::at(element_ids, i) = ElementId<1>{0, {{SegmentId{2, i}}}};
+  }
+  // All elements start on node 0. The first one is much more expensive.
+  for (const size_t node : {0_st, 1_st}) {
+    db::mutate<ElementCollection, Parallel::Tags::ElementLocations<1>,
+               Parallel::Tags::NumberOfElementsTerminated>(
+        [&element_ids, &node](
+            const auto element_collection, const auto element_locations,
+            const gsl::not_null<size_t*> number_of_elements_terminated) {
+          for (size_t i = 0; i < element_ids.size(); ++i) {
+            const auto& element_id = gsl::at(element_ids, i);
+            (*element_locations)[element_id] = 0;
+            if (node == 0) {
+              element_collection->emplace(
+                  std::piecewise_construct, std::forward_as_tuple(element_id),
+                  std::forward_as_tuple(element_id, variable(i),
+                                        i == 0 ? 20.0 : 1.0));
+            }
+          }
+          *number_of_elements_terminated = element_collection->size();
+        },
+        make_not_null(
+            &ActionTesting::get_databox<component>(make_not_null(&runner),
+                                                   node)));
+  }
+
+  const std::string deregister =
+      pretty_type::get_name<Parallel::Actions::detail::
+                                DeregisterMigratingElement>();
+  const std::string register_again =
+      pretty_type::get_name<Parallel::Actions::detail::
+                                RegisterMigratedElement>();
+
+  // The measured costs are collected and reset.
+  const auto costs = collect_costs(make_not_null(&runner));
+  CHECK(costs == std::unordered_map<ElementId<1>, double>{
+                     {element_ids[0], 20.0},
+                     {element_ids[1], 1.0},
+                     {element_ids[2], 1.0},
+                     {element_ids[3], 1.0}});
+  CHECK(collect_costs(make_not_null(&runner)) ==
+        std::unordered_map<ElementId<1>, double>{{element_ids[0], 0.0},
+                                                 {element_ids[1], 0.0},
+                                                 {element_ids[2], 0.0},
+                                                 {element_ids[3], 0.0}});
+
+  // The expensive element gets node 0 to itself. The others migrate to node 1
+  // and keep their DataBox.
+  rebalance(make_not_null(&runner), costs);
+  const std::unordered_map<ElementId<1>, size_t> first_locations{
+      {element_ids[0], 0},
+      {element_ids[1], 1},
+      {element_ids[2], 1},
+      {element_ids[3], 1}};
+  check_node(runner, 0, {{element_ids[0], {}}}, first_locations);
+  check_node(runner, 1,
+             {{element_ids[1], {deregister, register_again}},
+              {element_ids[2], {deregister, register_again}},
+              {element_ids[3], {deregister, register_again}}},
+             first_locations);
+
+  // Without measured costs all elements are weighted equally, so one element
+  // migrates back.
+  rebalance(make_not_null(&runner), collect_costs(make_not_null(&runner)));
+  const std::unordered_map<ElementId<1>, size_t> second_locations{
+      {element_ids[0], 0},
+      {element_ids[1], 0},
+      {element_ids[2], 1},
+      {element_ids[3], 1}};
+  check_node(runner, 0,
+             {{element_ids[0], {}},
+              {element_ids[1],
+               {deregister, register_again, deregister, register_again}}},
+             second_locations);
+  check_node(runner, 1,
+             {{element_ids[2], {deregister, register_again}},
+              {element_ids[3], {deregister, register_again}}},
+             second_locations);
+}
@@ -264,6 +264,65 @@ SPECTRE_TEST_CASE("Unit.PointwiseFunctions.EquationsOfState.Tabulated3D",
 
   test_against_reference_values(eos);
 
+  {
+    // The combined evaluation agrees with the individual quantities.
+    const size_t number_of_points = 100;
+    std::uniform_real_distribution<> dist_unit(0., 1.);
+    Scalar<DataVector> rest_mass_density{number_of_points};
+    Scalar<DataVector> temperature{number_of_points};
+    Scalar<DataVector> electron_fraction{number_of_points};
+    for (size_t s = 0; s < number_of_points; ++s) {
+      get(rest_mass_density)[s] =
+          eos.rest_mass_density_lower_bound() *
+          pow(eos.rest_mass_density_upper_bound() /
+                  eos.rest_mass_density_lower_bound(),
+              dist_unit(gen));
+      get(temperature)[s] =
+          eos.temperature_lower_bound() *
+          pow(eos.temperature_upper_bound() / eos.temperature_lower_bound(),
+              dist_unit(gen));
+      get(electron_fraction)[s] =
+          eos.electron_fraction_lower_bound() +
+          (eos.electron_fraction_upper_bound() -
+           eos.electron_fraction_lower_bound()) *
+              dist_unit(gen);
+    }
+    Scalar<DataVector> pressure{};
+    Scalar<DataVector> specific_internal_energy{};
+    Scalar<DataVector> sound_speed_squared{};
+    eos.thermodynamic_state_from_density_and_temperature(
+        make_not_null(&pressure), make_not_null(&specific_internal_energy),
+        make_not_null(&sound_speed_squared), rest_mass_density, temperature,
+        electron_fraction);
+    CHECK_ITERABLE_APPROX(pressure,
+                          eos.pressure_from_density_and_temperature(
+                              rest_mass_density, temperature,
+                              electron_fraction));
+    CHECK_ITERABLE_APPROX(
+        specific_internal_energy,
+        eos.specific_internal_energy_from_density_and_temperature(
+            rest_mass_density, temperature, electron_fraction));
+    CHECK_ITERABLE_APPROX(
+        sound_speed_squared,
+        eos.sound_speed_squared_from_density_and_temperature(
+            rest_mass_density, temperature, electron_fraction));
+    for (size_t s = 0; s < number_of_points; ++s) {
+      const Scalar<double> rho{get(rest_mass_density)[s]};
+      const Scalar<double> temp{get(temperature)[s]};
+      const Scalar<double> ye{get(electron_fraction)[s]};
+      CHECK(get(pressure)[s] ==
+            approx(get(eos.pressure_from_density_and_temperature(rho, temp,
+                                                                 ye))));
+      CHECK(get(specific_internal_energy)[s] ==
+            approx(get(
+                eos.specific_internal_energy_from_density_and_temperature(
+                    rho, temp, ye))));
+      CHECK(get(sound_speed_squared)[s] ==
+            approx(get(eos.sound_speed_squared_from_density_and_temperature(
+                rho, temp, ye))));
+    }
+  }
+
   // Test serialization
 
   register_derived_classes_with_charm<EoS::EquationOfState<true, 3>>();
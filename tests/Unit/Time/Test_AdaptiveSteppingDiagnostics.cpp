@@ -7,27 +7,35 @@
 #include "Time/AdaptiveSteppingDiagnostics.hpp"
 
 SPECTRE_TEST_CASE("Unit.Time.AdaptiveSteppingDiagnostics", "[Unit][Time]") {
-  AdaptiveSteppingDiagnostics diags{1, 2, 3, 4, 5};
+  AdaptiveSteppingDiagnostics diags{1, 2, 3, 4, 5, 6, 7};
   CHECK(diags.number_of_slabs == 1);
   CHECK(diags.number_of_slab_size_changes == 2);
   CHECK(diags.number_of_steps == 3);
   CHECK(diags.number_of_step_fraction_changes == 4);
   CHECK(diags.number_of_step_rejections == 5);
+  CHECK(diags.number_of_lts_coefficient_cache_hits == 6);
+  CHECK(diags.number_of_lts_coefficient_cache_misses == 7);
+  CHECK(AdaptiveSteppingDiagnostics{1, 2, 3, 4, 5} ==
+        AdaptiveSteppingDiagnostics{1, 2, 3, 4, 5, 0, 0});
 
-  CHECK(diags == AdaptiveSteppingDiagnostics{1, 2, 3, 4, 5});
-  CHECK(diags != AdaptiveSteppingDiagnostics{2, 2, 3, 4, 5});
-  CHECK(diags != AdaptiveSteppingDiagnostics{1, 3, 3, 4, 5});
-  CHECK(diags != AdaptiveSteppingDiagnostics{1, 2, 4, 4, 5});
-  CHECK(diags != AdaptiveSteppingDiagnostics{1, 2, 3, 5, 5});
-  CHECK(diags != AdaptiveSteppingDiagnostics{1, 2, 3, 4, 6});
-  CHECK_FALSE(diags != AdaptiveSteppingDiagnostics{1, 2, 3, 4, 5});
-  CHECK_FALSE(diags == AdaptiveSteppingDiagnostics{2, 2, 3, 4, 5});
-  CHECK_FALSE(diags == AdaptiveSteppingDiagnostics{1, 3, 3, 4, 5});
-  CHECK_FALSE(diags == AdaptiveSteppingDiagnostics{1, 2, 4, 4, 5});
-  CHECK_FALSE(diags == AdaptiveSteppingDiagnostics{1, 2, 3, 5, 5});
-  CHECK_FALSE(diags == AdaptiveSteppingDiagnostics{1, 2, 3, 4, 6});
+  CHECK(diags == AdaptiveSteppingDiagnostics{1, 2, 3, 4, 5, 6, 7});
+  CHECK(diags != AdaptiveSteppingDiagnostics{2, 2, 3, 4, 5, 6, 7});
+  CHECK(diags != AdaptiveSteppingDiagnostics{1, 3, 3, 4, 5, 6, 7});
+  CHECK(diags != AdaptiveSteppingDiagnostics{1, 2, 4, 4, 5, 6, 7});
+  CHECK(diags != AdaptiveSteppingDiagnostics{1, 2, 3, 5, 5, 6, 7});
+  CHECK(diags != AdaptiveSteppingDiagnostics{1, 2, 3, 4, 6, 6, 7});
+  CHECK(diags != AdaptiveSteppingDiagnostics{1, 2, 3, 4, 5, 7, 7});
+  CHECK(diags != AdaptiveSteppingDiagnostics{1, 2, 3, 4, 5, 6, 8});
+  CHECK_FALSE(diags != AdaptiveSteppingDiagnostics{1, 2, 3, 4, 5, 6, 7});
+  CHECK_FALSE(diags == AdaptiveSteppingDiagnostics{2, 2, 3, 4, 5, 6, 7});
+  CHECK_FALSE(diags == AdaptiveSteppingDiagnostics{1, 3, 3, 4, 5, 6, 7});
+  CHECK_FALSE(diags == AdaptiveSteppingDiagnostics{1, 2, 4, 4, 5, 6, 7});
+  CHECK_FALSE(diags == AdaptiveSteppingDiagnostics{1, 2, 3, 5, 5, 6, 7});
+  CHECK_FALSE(diags == AdaptiveSteppingDiagnostics{1, 2, 3, 4, 6, 6, 7});
+  CHECK_FALSE(diags == AdaptiveSteppingDiagnostics{1, 2, 3, 4, 5, 7, 7});
+  CHECK_FALSE(diags == AdaptiveSteppingDiagnostics{1, 2, 3, 4, 5, 6, 8});
 
   CHECK(diags == serialize_and_deserialize(diags));
   diags += diags;
-  CHECK(diags == AdaptiveSteppingDiagnostics{1, 2, 6, 8, 10});
+  CHECK(diags == AdaptiveSteppingDiagnostics{1, 2, 6, 8, 10, 12, 14});
 }
@@ -798,11 +798,154 @@ void test_lts_coefficients() {
   }
 }
 
+void test_lts_coefficients_cache() {
+  const adams_lts::AdamsScheme ab1{adams_lts::SchemeType::Explicit, 1};
+  const adams_lts::AdamsScheme ab2{adams_lts::SchemeType::Explicit, 2};
+  const auto history_order = std::numeric_limits<size_t>::max();  // unused
+
+  // The local side takes steps of a quarter slab and the remote side
+  // steps of half a slab.  Step the local side from 1/2 to 3/4.
+  const auto make_history = [&history_order](const Slab& slab) {
+    const TimeDelta quarter = slab.duration() / 4;
+    TimeSteppers::BoundaryHistory<double, double, double> history{};
+    history.local().insert(TimeStepId(true, 0, slab.start()), history_order,
+                           0.0);
+    history.local().insert(TimeStepId(true, 0, slab.start() + quarter),
+                           history_order, 0.0);
+    history.local().insert(TimeStepId(true, 0, slab.start() + 2 * quarter),
+                           history_order, 0.0);
+    history.remote().insert(TimeStepId(true, 0, slab.start()), history_order,
+                            0.0);
+    history.remote().insert(TimeStepId(true, 0, slab.start() + 2 * quarter),
+                            history_order, 0.0);
+    return history;
+  };
+  const auto step_coefficients =
+      [](const TimeSteppers::BoundaryHistory<double, double, double>& history,
+         const Slab& slab, const adams_lts::AdamsScheme& scheme) {
+        const TimeDelta quarter = slab.duration() / 4;
+        return adams_lts::lts_coefficients(
+            history.local(), history.remote(), slab.start() + 2 * quarter,
+            slab.start() + 3 * quarter, scheme, scheme, scheme);
+      };
+  const auto check_scaled = [](const adams_lts::LtsCoefficients& scaled,
+                               const adams_lts::LtsCoefficients& original,
+                               const double scale) {
+    REQUIRE(scaled.size() == original.size());
+    for (size_t i = 0; i < original.size(); ++i) {
+      CHECK(get<0>(scaled[i]).substep_time() ==
+            approx(get<0>(original[i]).substep_time() * scale));
+      CHECK(get<1>(scaled[i]).substep_time() ==
+            approx(get<1>(original[i]).substep_time() * scale));
+      CHECK(get<2>(scaled[i]) == approx(get<2>(original[i]) * scale));
+    }
+  };
+  const auto& statistics = adams_lts::lts_coefficients_cache_statistics();
+  const auto number_of_calls = [&statistics]() {
+    return statistics.hits + statistics.misses;
+  };
+
+  const Slab slab(0.0, 1.0);
+  const auto history = make_history(slab);
+  // Earlier tests may have cached the pattern already.
+  const auto calls_before = number_of_calls();
+  const auto coefficients = step_coefficients(history, slab, ab2);
+  CHECK(number_of_calls() == calls_before + 1);
+  // AB2 over the small steps at 1/4 and 1/2, with the remote side
+  // interpolated to 1/4.
+  // clang-format off
+  const adams_lts::LtsCoefficients expected{
+      {history.local()[1], history.remote()[0], -1.0 / 16.0},
+      {history.local()[1], history.remote()[1], -1.0 / 16.0},
+      {history.local()[2], history.remote()[1], 3.0 / 8.0}};
+  // clang-format on
+  check_scaled(coefficients, expected, 1.0);
+
+  const auto hits_before = statistics.hits;
+  check_scaled(step_coefficients(history, slab, ab2), coefficients, 1.0);
+  CHECK(statistics.hits == hits_before + 1);
+
+  {
+    INFO("Scaled pattern");
+    const Slab scaled_slab(0.0, 2.0);
+    const auto scaled_history = make_history(scaled_slab);
+    const auto scaled_coefficients =
+        step_coefficients(scaled_history, scaled_slab, ab2);
+    CHECK(statistics.hits == hits_before + 2);
+    check_scaled(scaled_coefficients, coefficients, 2.0);
+    CHECK(get<0>(scaled_coefficients[0]) == scaled_history.local()[1]);
+    CHECK(get<1>(scaled_coefficients[0]) == scaled_history.remote()[0]);
+  }
+  {
+    INFO("Shifted pattern");
+    const Slab shifted_slab(3.0, 4.0);
+    const auto shifted_history = make_history(shifted_slab);
+    const auto shifted_coefficients =
+        step_coefficients(shifted_history, shifted_slab, ab2);
+    CHECK(statistics.hits == hits_before + 3);
+    REQUIRE(shifted_coefficients.size() == coefficients.size());
+    for (size_t i = 0; i < coefficients.size(); ++i) {
+      CHECK(get<0>(shifted_coefficients[i]).substep_time() ==
+            approx(get<0>(coefficients[i]).substep_time() + 3.0));
+      CHECK(get<1>(shifted_coefficients[i]).substep_time() ==
+            approx(get<1>(coefficients[i]).substep_time() + 3.0));
+      CHECK(get<2>(shifted_coefficients[i]) ==
+            approx(get<2>(coefficients[i])));
+    }
+  }
+  {
+    INFO("Different order");
+    const auto calls_before_ab1 = number_of_calls();
+    const auto ab1_coefficients = step_coefficients(history, slab, ab1);
+    CHECK(number_of_calls() == calls_before_ab1 + 1);
+    // clang-format off
+    const adams_lts::LtsCoefficients expected_ab1{
+        {history.local()[2], history.remote()[1], 1.0 / 4.0}};
+    // clang-format on
+    check_scaled(ab1_coefficients, expected_ab1, 1.0);
+  }
+  {
+    INFO("Dense output is not cached");
+    const auto calls_before_dense = number_of_calls();
+    adams_lts::lts_coefficients(history.local(), history.remote(),
+                                slab.start() + slab.duration() / 2,
+                                ApproximateTime{0.6}, ab2, ab2, ab2);
+    CHECK(number_of_calls() == calls_before_dense);
+  }
+  {
+    INFO("Histories spanning a change of the slab size are not cached");
+    const Slab next_slab(1.0, 3.0);
+    TimeSteppers::BoundaryHistory<double, double, double> resized_history{};
+    resized_history.local().insert(
+        TimeStepId(true, 0, slab.start() + slab.duration() / 2),
+        history_order, 0.0);
+    resized_history.local().insert(TimeStepId(true, 1, next_slab.start()),
+                                   history_order, 0.0);
+    resized_history.remote().insert(TimeStepId(true, 0, slab.start()),
+                                    history_order, 0.0);
+    resized_history.remote().insert(TimeStepId(true, 1, next_slab.start()),
+                                    history_order, 0.0);
+    const auto resized_coefficients = [&resized_history, &next_slab, &ab2]() {
+      return adams_lts::lts_coefficients(
+          resized_history.local(), resized_history.remote(),
+          next_slab.start(), next_slab.start() + next_slab.duration() / 2,
+          ab2, ab2, ab2);
+    };
+    const auto hits_before_resized = statistics.hits;
+    const auto misses_before_resized = statistics.misses;
+    const auto first = resized_coefficients();
+    check_scaled(resized_coefficients(), first, 1.0);
+    CHECK(statistics.hits == hits_before_resized);
+    CHECK(statistics.misses == misses_before_resized + 2);
+  }
+}
+
 SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.AdamsLts", "[Unit][Time]") {
   test_exact_substep_time();
   test_lts_coefficients_struct();
   test_apply_coefficients(0.0);
   test_apply_coefficients(DataVector(5, 0.0));
   test_lts_coefficients();
+  test_lts_coefficients_cache();
 }
 }  // namespace
@@ -0,0 +1,42 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "Utilities/Literals.hpp"
+#include "Utilities/ParallelFor.hpp"
+
+SPECTRE_TEST_CASE("Unit.Utilities.ParallelFor", "[Utilities][Unit]") {
+  for (const size_t size : {0_st, 1_st, 5_st, 100_st}) {
+    for (const size_t number_of_threads : {0_st, 1_st, 3_st, 8_st, 200_st}) {
+      CAPTURE(size);
+      CAPTURE(number_of_threads);
+      std::vector<size_t> calls(size, 0);
+      std::atomic<size_t> total_calls{0};
+      parallel_for(size, number_of_threads,
+                   [&calls, &total_calls](const size_t i) {
+                     ++calls[i];
+                     ++total_calls;
+                   });
+      CHECK(total_calls == size);
+      CHECK(calls == std::vector<size_t>(size, 1));
+    }
+  }
+
+  std::atomic<size_t> total_calls{0};
+  CHECK_THROWS_WITH(parallel_for(10, 4,
+                                 [&total_calls](const size_t i) {
+                                   ++total_calls;
+                                   if (i == 7) {
+                                     throw std::runtime_error("Index 7");
+                                   }
+                                 }),
+                    Catch::Matchers::ContainsSubstring("Index 7"));
+  // The other threads still finish their ranges.
+  CHECK(total_calls >= 8);
+}
@@ -0,0 +1,93 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include "Utilities/SizeClassPool.hpp"
+
+namespace {
+void test_size_classes() {
+  using size_class_pool::detail::size_class;
+  using size_class_pool::detail::size_class_bytes;
+  CHECK(size_class(1) == 0);
+  CHECK(size_class(64) == 0);
+  CHECK(size_class_bytes(0) == 64);
+  CHECK(size_class(65) == 1);
+  CHECK(size_class_bytes(1) == 80);
+  CHECK(size_class(128) == 4);
+  CHECK(size_class_bytes(4) == 128);
+  CHECK(size_class(129) == 5);
+  CHECK(size_class_bytes(5) == 160);
+  for (size_t bytes = 1; bytes <= size_class_pool::max_pooled_bytes;
+       bytes += 1 + bytes / 5) {
+    const size_t the_class = size_class(bytes);
+    CAPTURE(bytes);
+    CHECK(size_class_bytes(the_class) >= bytes);
+    // Never waste more than a quarter of a block.
+    CHECK(4 * (size_class_bytes(the_class) - bytes) <=
+          std::max(size_class_bytes(the_class), size_t{256}));
+    if (the_class > 0) {
+      CHECK(size_class_bytes(the_class - 1) < bytes);
+    }
+  }
+}
+
+void test_reuse() {
+  size_class_pool::release_thread_cache();
+  size_class_pool::reset_thread_statistics();
+  const auto& stats = size_class_pool::thread_statistics();
+  const double* first_address = nullptr;
+  {
+    auto a = size_class_pool::make_unique_array_for_overwrite<double>(1000);
+    first_address = a.get();
+    CHECK(reinterpret_cast<std::uintptr_t>(a.get()) % 64 == 0);
+    a[999] = 1.0;
+  }
+  CHECK(stats.number_of_allocations == 1);
+  CHECK(stats.number_of_cache_hits == 0);
+  CHECK(stats.cached_bytes >= 1000 * sizeof(double));
+  {
+    // A slightly smaller request is served from the same block.
+    auto a = size_class_pool::make_unique_array_for_overwrite<double>(990);
+    CHECK(a.get() == first_address);
+    CHECK(stats.cached_bytes == 0);
+  }
+  CHECK(stats.number_of_allocations == 2);
+  CHECK(stats.number_of_cache_hits == 1);
+  {
+    auto a = size_class_pool::make_unique_array_for_overwrite<
+        std::complex<double>>(10);
+    CHECK(a[9] == std::complex<double>{});
+  }
+  {
+    // Oversized requests are never cached.
+    const size_t cached_bytes = stats.cached_bytes;
+    auto a = size_class_pool::make_unique_array_for_overwrite<char>(
+        size_class_pool::max_pooled_bytes + 1);
+    a.reset();
+    CHECK(stats.cached_bytes == cached_bytes);
+  }
+
+  // Memory freed on another thread is cached there.
+  auto moved = size_class_pool::make_unique_array_for_overwrite<double>(100);
+  std::thread other{[&moved]() {
+    moved.reset();
+    CHECK(size_class_pool::thread_statistics().cached_bytes > 0);
+  }};
+  other.join();
+
+  size_class_pool::release_thread_cache();
+  CHECK(stats.cached_bytes == 0);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Utilities.SizeClassPool", "[Unit][Utilities]") {
+  test_size_classes();
+  test_reuse();
+}